@@ -19,10 +19,21 @@
 #include <WebServer.h>
 #include <Preferences.h>
 #include <SPIFFS.h>
+#include <uri/UriBraces.h>
 #include <QRCode_Library.h>
+#include <esp_sleep.h>
+#include <sys/time.h>
 
 #include "display_config.h"
+#include "image_codec.h"
+#include "image_library.h"
+#define DITHER_NEAREST_LUT 0  // The 32 KB lookup cube does not fit next to the web server
+#include "jpeg_decoder.h"
+#include "web_interface_gz.h"  // Generated from web_interface.h
+#define WEB_PAGE_IDENTITY 1  // Also keep the plain page (~77 KB flash) for clients without gzip
+#if WEB_PAGE_IDENTITY
 #include "web_interface.h"
+#endif
 
 /* ========================================
    CONFIGURATION
@@ -30,10 +41,49 @@
 
 #define AP_SSID "E-Paper WiFi"
 #define AP_PASS "epaper2025"
+#define WIFI_FAST_TIMEOUT_MS 2000      // Reconnect with the cached BSSID, channel and address
+#define WIFI_CONNECT_TIMEOUT_MS 20000  // Scan and DHCP, slow routers included
 
 #define IMAGE_WIDTH 448
 #define IMAGE_HEIGHT 600
 #define IMAGE_FILE "/current.bin"
+#define IMAGE_TEMP_FILE "/upload.tmp"  // Uploads land here and replace IMAGE_FILE when complete
+#define IMAGE_ROW_BYTES (IMAGE_WIDTH / 2)
+#define IMAGE_SIZE (IMAGE_ROW_BYTES * IMAGE_HEIGHT)
+
+#define DIRECT_STREAM true  // Push the image file straight into controller RAM
+#define FLASH_WRITER_BLOCK 4096   // Uploads reach SPIFFS in whole flash sectors
+#define FLASH_WRITER_BLOCKS 4     // Ring of blocks between the web server and the writer task
+#define FLASH_WRITER_CORE 0       // loop() and the web server run on core 1
+#define FLASH_WRITER_TIMEOUT_MS 5000
+#define UPLOAD_DIFF_MAX_RECTS 4   // Changed regions tracked per upload, more are merged
+#define UPLOAD_DIFF_GAP_ROWS 16   // Changed rows closer than this share a region
+#define PARTIAL_WINDOW_ALIGN 8    // Native x alignment of GxEPD2 partial windows, in pixels
+#define IMAGE_CACHE_SLOTS 2       // Replaced images kept on flash for HEAD/POST /image/<hash>
+#define JPEG_MAX_UPLOAD (16UL * 1024 * 1024)  // Decoded while it arrives, never stored
+
+#define RENDER_CORE 1                  // Next to loop(), leaving core 0 to the flash writer
+#define RENDER_PRIORITY 0              // Below loop() (1), so requests preempt a refresh
+#define RENDER_LOAD_SHARE 10           // Progress (%) given to loading the controller RAM
+#define RENDER_REFRESH_ESTIMATE_MS 20000  // Until the first refresh has been timed
+#define RENDER_UPLOADED_IMAGE -1       // Render job for IMAGE_FILE instead of a library image
+#define RENDER_NO_IMAGE -2             // Panel shows neither (boot screen)
+
+#define PLAYLIST_BOOT_HOLD_S 60  // Boot screen (with the setup QR code) before the slideshow starts
+
+// Low-power mode (POST /power?mode=low): deep sleep between slideshow images
+#define LOW_POWER_WAKE_PIN 0      // BOOT button, wakes into the web interface
+#define LOW_POWER_AWAKE_S 180     // Web interface stays up this long after the last request
+#define LOW_POWER_MIN_SLEEP_S 10
+// Assumed currents, not measured: the ESP32 cannot read its own supply current.
+// ESP32 datasheet (Espressif), "Power Consumption by Power Modes" and RF figures:
+//   POWER_ACTIVE_MA  modem-sleep at 240 MHz is 30-68 mA, plus the panel refresh
+//   POWER_WIFI_MA    receive is 95-100 mA; transmit bursts are higher, idle DTIM lower
+//   POWER_SLEEP_UA   deep sleep with RTC timer is 10 uA for the chip; the rest is a
+//                    low-quiescent regulator and the panel (an AMS1117 board draws mA)
+#define POWER_ACTIVE_MA 40
+#define POWER_WIFI_MA 110
+#define POWER_SLEEP_UA 150
 
 /* ========================================
    GLOBAL VARIABLES
@@ -44,7 +94,195 @@ WebServer server(80);
 bool wifiConfigured = false;
 String savedSSID = "";
 String savedPass = "";
-File uploadFile;
+
+// Last successful connection, stored next to the credentials ("wifiCache")
+struct WiFiCache {
+  uint8_t bssid[6];
+  uint8_t channel;
+  uint8_t reserved;
+  uint32_t ip;
+  uint32_t gateway;
+  uint32_t subnet;
+  uint32_t dns;
+};
+
+SemaphoreHandle_t wifiEvent = nullptr;  // Given on every station event
+volatile bool wifiGotIp = false;
+File uploadFile;  // Owned by the flash writer task
+int uploadError = 0;  // HTTP status of a failed upload, 0 if accepted
+const char* uploadErrorText = nullptr;  // Sent with uploadError, generic if null
+char uploadTarget[LIBRARY_PATH_SIZE] = IMAGE_FILE;  // Where the upload in progress ends up
+bool uploadToLibrary = false;
+uint16_t uploadDurationS = 0;  // ?duration= of a library upload, 0 for the default
+bool uploadJpeg = false;  // Decoded and dithered on the frame (JPEG upload)
+DitherAlgorithm uploadDither = DITHER_FLOYD_STEINBERG;
+DitherPalette uploadPalette = DITHER_PALETTE_IDEAL;
+ImageLibrary library;
+int16_t playlistPosition = -1;  // Last library image shown, -1 before the first
+uint32_t playlistShownAt = 0;
+uint32_t playlistDurationS = PLAYLIST_BOOT_HOLD_S;  // Of whatever the panel shows now
+
+/* ========================================
+   LOW POWER STATE
+   ======================================== */
+
+#define RTC_STATE_MAGIC 0x31535045  // "EPS1"
+
+// Kept in RTC memory across deep sleep; cleared on power-on
+struct RtcState {
+  uint32_t magic;
+  int16_t playlistPosition;
+  uint16_t wakes;              // Timer wakes since power-on
+  int64_t sleptAtUs;           // RTC clock when the last sleep started
+  uint32_t sleepMs;            // Totals since power-on, for the current estimate
+  uint32_t activeMs;           // Awake with the radio off
+  uint32_t wifiMs;             // Awake with Wi-Fi
+  uint32_t wakeToRefreshMs;    // Sum over timer wakes
+  uint32_t lastWakeToRefreshMs;
+};
+
+RTC_DATA_ATTR RtcState rtcState;
+bool lowPowerMode = false;
+uint32_t lastActivityMs = 0;  // Web interface requests keep the frame awake
+
+/* ========================================
+   FLASH WRITER STATE
+   ======================================== */
+
+enum FlashJobCommand : uint8_t {
+  FLASH_JOB_OPEN,
+  FLASH_JOB_DECODE,  // OPEN for a JPEG: the file gets the decoded frame
+  FLASH_JOB_WRITE,
+  FLASH_JOB_CLOSE,
+  FLASH_JOB_ABORT
+};
+
+struct FlashJob {
+  FlashJobCommand command;
+  uint8_t block;
+  uint16_t length;
+};
+
+struct FlashWriterStats {
+  uint32_t bytes;
+  uint32_t blocks;
+  uint32_t stalls;      // Times the web server waited for a free block
+  uint32_t stallMs;
+  uint32_t flashMs;     // Time spent in SPIFFS writes (writer task)
+  ImageDigest digest;   // Of the data written, set when the file is closed (writer task)
+  uint32_t peakQueued;  // Most blocks queued or being written at once
+  uint32_t startMs;
+  uint32_t totalMs;
+};
+
+uint8_t flashRing[FLASH_WRITER_BLOCKS][FLASH_WRITER_BLOCK];
+ImageHasher uploadHasher;  // Writer task
+QueueHandle_t flashJobs = nullptr;
+QueueHandle_t flashFreeBlocks = nullptr;
+SemaphoreHandle_t flashWriterDone = nullptr;
+volatile bool flashWriterOk = false;
+bool flashSession = false;
+int16_t flashBlock = -1;  // Block being filled by the web server, -1 if none
+uint16_t flashBlockFill = 0;
+FlashWriterStats flashStats;
+
+// Upload compared with the image it replaces, while it is written
+struct DirtyRect {
+  uint16_t x, y, w, h;  // Image coordinates
+};
+
+struct UploadDiff {
+  bool identical;       // Same bytes as the previous file
+  bool regional;        // rects cover every change (raw images of the same size)
+  uint8_t rectCount;
+  DirtyRect rects[UPLOAD_DIFF_MAX_RECTS];
+  uint32_t changedBytes;
+};
+
+// JPEG uploads: the writer task feeds the blocks to the decoder
+struct JpegUploadStats {
+  JRESULT result;
+  uint32_t width, height;  // Of the photo
+  uint8_t scale;           // Prescale 1/2^scale
+  uint8_t orientation;     // EXIF Orientation, 1 to 8
+  bool oriented;           // false: no memory to turn the photo
+  uint16_t rows;
+  uint32_t decodeMs;       // Decoding, dithering and writing, without waitMs
+  uint32_t waitMs;         // Waiting for the network
+  uint32_t memoryBytes;
+};
+
+JpegUploadStats jpegStats;
+int16_t jpegBlock = -1;  // Block the decoder is reading, -1 if none
+uint16_t jpegOffset = 0;
+uint16_t jpegLength = 0;
+FlashJobCommand jpegEnd = FLASH_JOB_WRITE;  // CLOSE or ABORT once it arrived
+
+File diffFile;  // Previous image, read by the flash writer task
+uint32_t diffOffset = 0;
+UploadDiff uploadDiff;
+
+/* ========================================
+   IMAGE CACHE STATE
+   ======================================== */
+
+enum ImageSource : uint8_t {
+  IMAGE_UNKNOWN,
+  IMAGE_CURRENT,  // IMAGE_FILE
+  IMAGE_CACHED,   // Replaced by an upload, kept until the space is needed
+  IMAGE_LIBRARY
+};
+
+ImageDigest imageCache[IMAGE_CACHE_SLOTS];  // Of the cached files, oldest first
+uint8_t imageCacheCount = 0;
+ImageDigest imageFileDigest;  // Of IMAGE_FILE, valid if imageFileDigestKnown
+bool imageFileDigestKnown = false;
+
+/* ========================================
+   RENDER TASK STATE
+   ======================================== */
+
+enum RenderState : uint8_t {
+  RENDER_IDLE,
+  RENDER_LOADING,     // Reading the image into the controller
+  RENDER_REFRESHING   // Panel busy, the image file is no longer needed
+};
+
+// The rects travel with the job, so the web server never shares them with the render task
+struct RenderJob {
+  int32_t imageId;
+  uint8_t rectCount;  // 0: full refresh
+  DirtyRect rects[UPLOAD_DIFF_MAX_RECTS];
+};
+
+QueueHandle_t renderJobs = nullptr;  // One job; a newer request overwrites it
+SemaphoreHandle_t displayMutex = nullptr;    // Held for a whole render
+SemaphoreHandle_t imageFileMutex = nullptr;  // Held while IMAGE_FILE is read or replaced
+volatile RenderState renderState = RENDER_IDLE;
+volatile uint8_t renderProgress = 0;
+volatile uint32_t renderPhaseStart = 0;
+volatile uint32_t lastRefreshMs = 0;
+volatile uint32_t renderCount = 0;
+volatile int32_t panelImageId = RENDER_NO_IMAGE;         // What the panel shows now
+uint32_t renderSkipped = 0;  // Uploads identical to what the panel shows
+uint32_t renderRequests = 0;   // Refreshes asked for by uploads
+uint32_t renderCoalesced = 0;  // ... of which merged into an already queued one
+bool imageFileLocked = false;  // By the render task
+uint8_t nativeByteLut[256];
+
+// Frames already converted for the controller, in PSRAM (render task only)
+struct FrameCacheEntry {
+  uint8_t* frame;     // GxEPD2_DRIVER_CLASS::WIDTH * HEIGHT / 2 bytes
+  ImageDigest digest;  // Of the image file it was built from
+  uint32_t lastUsed;  // frameCacheClock when last shown, for LRU
+  bool valid;
+};
+
+FrameCacheEntry frameCache[FRAME_CACHE_FRAMES ? FRAME_CACHE_FRAMES : 1];
+uint8_t frameCacheSize = 0;  // Frames allocated at boot, 0 without PSRAM
+uint32_t frameCacheClock = 0;
+uint32_t frameCacheHits = 0;
+uint32_t frameCacheMisses = 0;
 
 /* ========================================
    FUNCTION DECLARATIONS
@@ -52,16 +290,93 @@ File uploadFile;
 
 void initDisplay();
 void showBootScreen();
-void displayImageFromSPIFFS();
+void displayImageFromSPIFFS(const char* path = IMAGE_FILE);
 void drawImageFromSPIFFS(File& file);
+void drawImageWindowFromSPIFFS(File& file, int16_t wx, int16_t wy, int16_t ww, int16_t wh);
+void getPageWindow(uint16_t page, int16_t& wx, int16_t& wy, int16_t& ww, int16_t& wh);
+DirtyRect alignRegion(const DirtyRect& r);
+void getPartialPageWindow(uint16_t page, const DirtyRect& r, int16_t& wx, int16_t& wy, int16_t& ww, int16_t& wh);
+void getNativeRowsWindow(int16_t ys, int16_t ye, int16_t& wx, int16_t& wy, int16_t& ww, int16_t& wh);
+void buildNativeLut();
+bool streamImageToController(File& file, FrameCacheEntry* cacheEntry = nullptr);
+bool fillNativeBand(File& file, uint8_t* band, uint16_t ys, uint16_t h);
+uint16_t streamBandRows();
+String benchmarkBandHeights(File& imageFile);
+void frameCacheBegin();
+bool frameCacheKey(const char* path, ImageDigest& digest);
+bool frameCacheShow(const ImageDigest& digest);
+FrameCacheEntry* frameCacheSlot(const ImageDigest& digest);
+bool isCompressedFile(File& file);
+bool fillNativeBandCompressed(EpzDecoder<File>& decoder, uint8_t* band, uint16_t h);
+void drawCompressedWindow(File& file, EpzDecoder<File>& decoder, int16_t wx, int16_t wy, int16_t ww, int16_t wh);
+String benchmarkRenderPaths();
+String benchmarkCompressedDecode(File& imageFile);
 uint16_t mapColorValue(uint8_t pixel_value);
 void loadWiFiCredentials();
 void saveWiFiCredentials(String ssid, String pass);
 void connectToWiFi();
+void onWiFiEvent(arduino_event_id_t event);
+bool waitForWiFi(uint32_t timeoutMs, bool failFast);
+void saveWiFiCache();
 void startAPMode();
 void setupWebServer();
 void handleUpload();
 void handleUploadComplete();
+void handleRawUpload();
+void finishUpload(size_t totalSize);
+bool startFlashWriter();
+void flashWriterTask(void* parameter);
+bool flashWriterBegin(const char* target);
+bool flashWriterWrite(const uint8_t* data, size_t length);
+bool flashWriterEnd();
+void flashWriterAbort();
+bool flashWriterFinish(FlashJobCommand command);
+bool flashWriterSubmitBlock();
+bool flashWriterStore(const uint8_t* data, size_t length);
+String flashWriterReport();
+bool isJpegUpload(const String& contentType, const String& filename);
+bool parseDuration(const String& arg, uint16_t& durationS);
+bool acceptsGzip(const String& acceptEncoding);
+FlashJobCommand jpegUploadDecode();
+size_t jpegUploadRead(void* context, uint8_t* buffer, size_t length);
+bool jpegUploadWrite(void* context, const uint8_t* row, size_t length);
+String jpegUploadReport();
+void uploadDiffBegin();
+void uploadDiffUpdate(const uint8_t* data, size_t length);
+void uploadDiffMark(uint32_t offset);
+void uploadDiffEnd();
+void displayRegionsFromSPIFFS(const char* path, const DirtyRect* rects, uint8_t count);
+bool renderBusy();
+bool startRenderTask();
+void renderTask(void* parameter);
+void queueRender(int32_t imageId = RENDER_UPLOADED_IMAGE, const DirtyRect* rects = nullptr, uint8_t rectCount = 0);
+void lockImageFile();
+void unlockImageFile();
+void setRenderState(RenderState state);
+void recoverImageFile();
+void imageCachePath(const ImageDigest& digest, char* path);
+void imageCacheBegin();
+int8_t imageCacheFind(const ImageDigest& digest);
+void imageCacheDrop(uint8_t slot);
+bool imageCacheMakeRoom(size_t bytes);
+void imageCacheKeepCurrent(const ImageDigest& newDigest);
+bool imageCacheRestore(uint8_t slot);
+bool replaceImageFile(const char* source, const ImageDigest& digest);
+bool currentImageDigest(ImageDigest& digest);
+ImageSource findImage(const String& hash, int16_t& index);
+void showImageFile(bool unchanged, const DirtyRect* rects = nullptr, uint8_t rectCount = 0);
+void finishLibraryUpload();
+void advancePlaylist();
+void showLibraryImage(uint16_t position);
+String libraryJson();
+String renderStatusJson();
+void restoreRtcState(esp_sleep_wakeup_cause_t wakeCause);
+void scheduledWake();
+void sleepWhenIdle();
+void enterDeepSleep();
+void keepAwake();
+int64_t rtcClockUs();
+String powerReport();
 
 /* ========================================
    SETUP - INITIALIZATION
@@ -69,6 +384,12 @@ void handleUploadComplete();
 
 void setup() {
   Serial.begin(115200);
+  esp_sleep_wakeup_cause_t wakeCause = esp_sleep_get_wakeup_cause();
+  restoreRtcState(wakeCause);
+  if (wakeCause == ESP_SLEEP_WAKEUP_TIMER) {
+    scheduledWake();  // Back to sleep, returns only if the slideshow cannot run
+  }
+  
   Serial.println("\n╔════════════════════════════════════╗");
   Serial.println("║   E-Paper Photo Frame v2.1         ║");
   Serial.println("╚════════════════════════════════════╝");
@@ -80,10 +401,25 @@ void setup() {
   Serial.printf("✓ SPIFFS initialized: %d / %d bytes\n", 
                 SPIFFS.usedBytes(), SPIFFS.totalBytes());
   
+  recoverImageFile();
+  if (library.begin(SPIFFS)) {
+    Serial.printf("✓ Image library: %u images\n", library.count());
+  }
+  imageCacheBegin();
+  if (!startFlashWriter()) {
+    Serial.println("✗ ERROR: Flash writer task failed to start!");
+  }
+  if (!startRenderTask()) {
+    Serial.println("⚠ Render task failed to start, refreshing inline");
+  }
+  
   initDisplay();
+  frameCacheBegin();
   
   preferences.begin("epaper", false);
   loadWiFiCredentials();
+  lowPowerMode = preferences.getBool("lowPower", false);
+  playlistPosition = rtcState.playlistPosition;
   
   if (savedSSID.length() > 0) {
     connectToWiFi();
@@ -112,6 +448,11 @@ void setup() {
     Serial.printf("║ http://%-27s ║\n", WiFi.softAPIP().toString().c_str());
   }
   Serial.println("╚════════════════════════════════════╝\n");
+  Serial.printf("✓ Ready %u ms after boot\n", (unsigned)millis());
+  if (lowPowerMode) {
+    Serial.printf("Low-power mode: deep sleep after %u s without requests\n", LOW_POWER_AWAKE_S);
+  }
+  keepAwake();
 }
 
 /* ========================================
@@ -120,6 +461,8 @@ void setup() {
 
 void loop() {
   server.handleClient();
+  advancePlaylist();
+  sleepWhenIdle();
   delay(10);
 }
 
@@ -131,7 +474,8 @@ void initDisplay() {
   Serial.print("Initializing display... ");
   display.init(115200, true, 2, false);
   display.setRotation(1);
-  Serial.println("✓ Done");
+  Serial.printf("✓ Done (page buffer %u rows, %u pages; stream bands up to %u rows)\n",
+                display.pageHeight(), display.pages(), streamBandRows());
 }
 
 void showBootScreen() {
@@ -267,33 +611,151 @@ void showBootScreen() {
   Serial.println("✓ Done");
 }
 
-void displayImageFromSPIFFS() {
+void displayImageFromSPIFFS(const char* path) {
   Serial.println("\n=== Updating Display ===");
-  File imageFile = SPIFFS.open(IMAGE_FILE, FILE_READ);
+  setRenderState(RENDER_LOADING);
+  lockImageFile();
+  File imageFile = SPIFFS.open(path, FILE_READ);
   if (!imageFile) {
     Serial.println("✗ ERROR: Cannot open image file!");
+    unlockImageFile();
     return;
   }
   
   Serial.printf("Image file size: %d bytes\n", imageFile.size());
   
+  // Shown before: the frame comes from PSRAM and the file is not read
+  ImageDigest digest;
+  bool cacheable = DIRECT_STREAM && frameCacheKey(path, digest);
+  if (cacheable && frameCacheShow(digest)) {
+    imageFile.close();
+    display.hibernate();
+    return;
+  }
+  
+  if (DIRECT_STREAM && streamImageToController(imageFile, cacheable ? frameCacheSlot(digest) : nullptr)) {
+    imageFile.close();
+    unlockImageFile();
+    display.hibernate();
+    return;
+  }
+  
+  bool compressed = isCompressedFile(imageFile);
+  EpzDecoder<File> decoder(imageFile);
+  if (compressed && (!decoder.begin() || decoder.width() != IMAGE_WIDTH ||
+                     decoder.height() != IMAGE_HEIGHT)) {
+    Serial.println("✗ ERROR: Corrupt compressed image!");
+    imageFile.close();
+    unlockImageFile();
+    return;
+  }
+  
   display.setFullWindow();
   display.firstPage();
   
   unsigned long startTime = millis();
+  unsigned long drawTime = 0;
+  uint16_t page = 0;
   do {
+    unsigned long drawStart = micros();
     display.fillScreen(GxEPD_WHITE);
-    drawImageFromSPIFFS(imageFile);
+    
+    // Only the rows/columns that land in the current page are read and drawn
+    int16_t wx, wy, ww, wh;
+    getPageWindow(page++, wx, wy, ww, wh);
+    if (compressed) {
+      drawCompressedWindow(imageFile, decoder, wx, wy, ww, wh);
+    } else {
+      drawImageWindowFromSPIFFS(imageFile, wx, wy, ww, wh);
+    }
+    drawTime += micros() - drawStart;
+    
+    // The last nextPage() refreshes the panel; the file can be replaced meanwhile
+    renderProgress = RENDER_LOAD_SHARE * page / display.pages();
+    if (page == display.pages()) {
+      imageFile.close();
+      unlockImageFile();
+      setRenderState(RENDER_REFRESHING);
+    }
   } while (display.nextPage());
   
   imageFile.close();
+  unlockImageFile();
   
   unsigned long elapsed = millis() - startTime;
-  Serial.printf("✓ Display updated in %lu ms\n", elapsed);
+  Serial.printf("✓ Display updated in %lu ms (%u pages, draw %lu ms)\n",
+                elapsed, page, drawTime / 1000);
+  
+  display.hibernate();
+}
+
+// Partial update of the changed regions of a raw image, for panels that
+// support it (see handleUploadComplete). Never reached with the 7-color
+// panel, whose controller has no partial update.
+void displayRegionsFromSPIFFS(const char* path, const DirtyRect* rects, uint8_t count) {
+  Serial.printf("\n=== Updating Display (%u regions) ===\n", count);
+  setRenderState(RENDER_LOADING);
+  lockImageFile();
+  File imageFile = SPIFFS.open(path, FILE_READ);
+  if (!imageFile) {
+    Serial.println("✗ ERROR: Cannot open image file!");
+    unlockImageFile();
+    return;
+  }
+  
+  unsigned long startTime = millis();
+  for (uint8_t i = 0; i < count; i++) {
+    DirtyRect r = alignRegion(rects[i]);
+    display.setPartialWindow(r.x, r.y, r.w, r.h);
+    display.firstPage();
+    uint16_t page = 0;
+    do {
+      display.fillScreen(GxEPD_WHITE);
+      // Only the part of the region in the current page is read
+      int16_t wx, wy, ww, wh;
+      getPartialPageWindow(page++, r, wx, wy, ww, wh);
+      drawImageWindowFromSPIFFS(imageFile, wx, wy, ww, wh);
+    } while (display.nextPage());
+    renderProgress = 100 * (i + 1) / count;
+    Serial.printf("   Region %u: %ux%u at (%u, %u)\n", i + 1, r.w, r.h, r.x, r.y);
+  }
+  imageFile.close();
+  unlockImageFile();
   
+  Serial.printf("✓ Display updated in %lu ms (partial)\n", millis() - startTime);
   display.hibernate();
 }
 
+/*
+ * Grows a region to the controller's partial window alignment. The driver
+ * pads the window itself, and the padding would otherwise be drawn white.
+ * Native x runs along image x in rotations 0 and 2, along image y in 1 and 3;
+ * the native width is a multiple of the alignment, so rounding the image
+ * coordinates is the same as rounding the native ones.
+ */
+DirtyRect alignRegion(const DirtyRect& r) {
+  static_assert(GxEPD2_DRIVER_CLASS::WIDTH % PARTIAL_WINDOW_ALIGN == 0, "native width not aligned");
+  bool alongX = display.getRotation() % 2 == 0;
+  uint16_t start = alongX ? r.x : r.y;
+  uint16_t end = start + (alongX ? r.w : r.h);
+  uint16_t limit = alongX ? IMAGE_WIDTH : IMAGE_HEIGHT;
+  start -= start % PARTIAL_WINDOW_ALIGN;
+  end = (end + PARTIAL_WINDOW_ALIGN - 1) / PARTIAL_WINDOW_ALIGN * PARTIAL_WINDOW_ALIGN;
+  if (end > limit) end = limit;
+  
+  DirtyRect aligned = r;
+  if (alongX) {
+    aligned.x = start; aligned.w = end - start;
+  } else {
+    aligned.y = start; aligned.h = end - start;
+  }
+  return aligned;
+}
+
+/*
+ * Legacy renderer: reads and draws the whole image on every call.
+ * Kept as the reference for benchmarkRenderPaths().
+ */
 void drawImageFromSPIFFS(File& file) {
   file.seek(0);
   uint8_t lineBuffer[IMAGE_WIDTH / 2];
@@ -320,6 +782,519 @@ void drawImageFromSPIFFS(File& file) {
   }
 }
 
+/*
+ * Draws only the part of the image inside the given window (in rotated
+ * display coordinates). Full-width windows are read sequentially, narrow
+ * windows seek to the bytes they need on every row.
+ */
+void drawImageWindowFromSPIFFS(File& file, int16_t wx, int16_t wy, int16_t ww, int16_t wh) {
+  int16_t x0 = wx < 0 ? 0 : wx;
+  int16_t y0 = wy < 0 ? 0 : wy;
+  int16_t x1 = wx + ww > IMAGE_WIDTH ? IMAGE_WIDTH : wx + ww;
+  int16_t y1 = wy + wh > IMAGE_HEIGHT ? IMAGE_HEIGHT : wy + wh;
+  if (x0 >= x1 || y0 >= y1) return;
+  
+  int16_t byteStart = x0 / 2;
+  size_t span = (x1 + 1) / 2 - byteStart;
+  bool contiguous = (span == IMAGE_ROW_BYTES);
+  uint8_t lineBuffer[IMAGE_ROW_BYTES];
+  
+  if (contiguous) {
+    file.seek((uint32_t)y0 * IMAGE_ROW_BYTES);
+  }
+  
+  for (int y = y0; y < y1; y++) {
+    if (!contiguous) {
+      file.seek((uint32_t)y * IMAGE_ROW_BYTES + byteStart);
+    }
+    size_t bytesRead = file.read(lineBuffer, span);
+    if (bytesRead != span) {
+      Serial.printf("⚠ Warning: Line %d - only %d bytes read\n", y, bytesRead);
+      break;
+    }
+    
+    for (int x = x0; x < x1; x++) {
+      uint8_t byte_data = lineBuffer[x / 2 - byteStart];
+      uint8_t pixel = (x & 1) ? (byte_data & 0x0F) : ((byte_data >> 4) & 0x0F);
+      display.drawPixel(x, y, mapColorValue(pixel));
+    }
+  }
+}
+
+/*
+ * Returns the window (in rotated display coordinates) covered by a page of
+ * the paged display. Pages are bands of native controller rows, so with
+ * rotation 1 or 3 a page is a band of image columns.
+ */
+void getPageWindow(uint16_t page, int16_t& wx, int16_t& wy, int16_t& ww, int16_t& wh) {
+  const int16_t nativeH = GxEPD2_DRIVER_CLASS::HEIGHT;
+  int16_t ys = page * display.pageHeight();
+  int16_t ye = ys + display.pageHeight() > nativeH ? nativeH : ys + display.pageHeight();
+  getNativeRowsWindow(ys, ye, wx, wy, ww, wh);
+}
+
+/*
+ * Same for a page of a partial window: pages then count from the top of the
+ * region in native rows. The result is also clipped to the region, an empty
+ * window (ww or wh 0) meaning nothing to draw.
+ */
+void getPartialPageWindow(uint16_t page, const DirtyRect& r, int16_t& wx, int16_t& wy, int16_t& ww, int16_t& wh) {
+  const int16_t nativeH = GxEPD2_DRIVER_CLASS::HEIGHT;
+  int16_t top, rows;
+  switch (display.getRotation()) {
+    case 1:  top = r.x;                 rows = r.w; break;
+    case 2:  top = nativeH - r.y - r.h; rows = r.h; break;
+    case 3:  top = nativeH - r.x - r.w; rows = r.w; break;
+    default: top = r.y;                 rows = r.h; break;
+  }
+  int16_t ys = top + page * display.pageHeight();
+  int16_t ye = ys + display.pageHeight() > top + rows ? top + rows : ys + display.pageHeight();
+  getNativeRowsWindow(ys, ye, wx, wy, ww, wh);
+  
+  int16_t x0 = wx > r.x ? wx : r.x;
+  int16_t y0 = wy > r.y ? wy : r.y;
+  int16_t x1 = wx + ww < r.x + r.w ? wx + ww : r.x + r.w;
+  int16_t y1 = wy + wh < r.y + r.h ? wy + wh : r.y + r.h;
+  wx = x0; wy = y0;
+  ww = x1 > x0 ? x1 - x0 : 0;
+  wh = y1 > y0 ? y1 - y0 : 0;
+}
+
+// Native rows [ys, ye) in rotated display coordinates
+void getNativeRowsWindow(int16_t ys, int16_t ye, int16_t& wx, int16_t& wy, int16_t& ww, int16_t& wh) {
+  const int16_t nativeW = GxEPD2_DRIVER_CLASS::WIDTH;
+  const int16_t nativeH = GxEPD2_DRIVER_CLASS::HEIGHT;
+  
+  switch (display.getRotation()) {
+    case 1:
+      wx = ys;           wy = 0; ww = ye - ys; wh = nativeW;
+      break;
+    case 2:
+      wx = 0; wy = nativeH - ye; ww = nativeW; wh = ye - ys;
+      break;
+    case 3:
+      wx = nativeH - ye; wy = 0; ww = ye - ys; wh = nativeW;
+      break;
+    default:
+      wx = 0; wy = ys;           ww = nativeW; wh = ye - ys;
+      break;
+  }
+}
+
+/*
+ * Builds the byte table that translates two packed file pixels into two
+ * packed controller pixels. Identity for every valid color index.
+ */
+void buildNativeLut() {
+  for (int i = 0; i < 256; i++) {
+    nativeByteLut[i] = (NATIVE_COLOR_CODES[i >> 4] << 4) | NATIVE_COLOR_CODES[i & 0x0F];
+  }
+}
+
+// Drivers with paged RAM writes (e.g. GxEPD2_565c) need to be told that the
+// frame arrives in bands; the paged display normally does this in firstPage()
+template <typename EPD>
+auto enablePagedWrites(EPD& epd, int) -> decltype(epd.setPaged(), void()) {
+  epd.setPaged();
+}
+
+template <typename EPD>
+void enablePagedWrites(EPD&, long) {}
+
+/*
+ * Frame cache: with PSRAM, the last FRAME_CACHE_FRAMES images keep their
+ * controller-format frame, so showing one again (playlist loop, library
+ * image re-selected, upload of a recent picture) is a single RAM write with
+ * no flash reads or conversion. Frames are keyed by the ImageDigest of the
+ * image file, like the image cache, so the same picture shown as an upload and
+ * from the library shares one frame. Without PSRAM nothing is allocated
+ * and every render streams from flash as before.
+ */
+void frameCacheBegin() {
+  if (FRAME_CACHE_FRAMES == 0) return;
+  if (!psramFound()) {
+    Serial.println("Frame cache off (no PSRAM)");
+    return;
+  }
+  const size_t frameBytes = (size_t)GxEPD2_DRIVER_CLASS::WIDTH * GxEPD2_DRIVER_CLASS::HEIGHT / 2;
+  while (frameCacheSize < FRAME_CACHE_FRAMES) {
+    uint8_t* frame = (uint8_t*)ps_malloc(frameBytes);
+    if (!frame) break;
+    frameCache[frameCacheSize++] = {frame, {}, 0, false};
+  }
+  Serial.printf("✓ Frame cache: %u frames in PSRAM (%u KB)\n",
+                frameCacheSize, (unsigned)(frameCacheSize * frameBytes / 1024));
+}
+
+// Image file locked: the digest that identifies the file at path
+bool frameCacheKey(const char* path, ImageDigest& digest) {
+  if (frameCacheSize == 0) return false;
+  if (strcmp(path, IMAGE_FILE) == 0) return currentImageDigest(digest);
+  for (uint16_t i = 0; i < library.count(); i++) {
+    char entryPath[LIBRARY_PATH_SIZE];
+    libraryImagePath(library.entry(i).id, entryPath);
+    if (strcmp(path, entryPath) == 0) {
+      digest = library.entry(i).digest();
+      return true;
+    }
+  }
+  return false;
+}
+
+// Image file locked: refreshes the panel from a cached frame, unlocking
+// the file right away; false (nothing done) on a miss
+bool frameCacheShow(const ImageDigest& digest) {
+  FrameCacheEntry* entry = nullptr;
+  for (uint8_t i = 0; i < frameCacheSize; i++) {
+    if (frameCache[i].valid && frameCache[i].digest == digest) entry = &frameCache[i];
+  }
+  if (!entry) {
+    frameCacheMisses++;
+    return false;
+  }
+  frameCacheHits++;
+  entry->lastUsed = ++frameCacheClock;
+  unlockImageFile();
+  
+  unsigned long startTime = millis();
+  enablePagedWrites(display.epd2, 0);
+  display.epd2.writeNative(entry->frame, nullptr, 0, 0, GxEPD2_DRIVER_CLASS::WIDTH,
+                           GxEPD2_DRIVER_CLASS::HEIGHT, false, false, false);
+  unsigned long loadTime = millis() - startTime;
+  setRenderState(RENDER_REFRESHING);
+  display.epd2.refresh(false);
+  display.epd2.powerOff();
+  
+  Serial.printf("✓ Display updated in %lu ms (frame cache, RAM loaded in %lu ms)\n",
+                millis() - startTime, loadTime);
+  return true;
+}
+
+// Entry to build the frame for digest in: a free one or the least recently shown
+FrameCacheEntry* frameCacheSlot(const ImageDigest& digest) {
+  FrameCacheEntry* entry = &frameCache[0];
+  for (uint8_t i = 0; i < frameCacheSize; i++) {
+    if (!frameCache[i].valid) {
+      entry = &frameCache[i];
+      break;
+    }
+    if (frameCache[i].lastUsed < entry->lastUsed) entry = &frameCache[i];
+  }
+  entry->digest = digest;
+  entry->lastUsed = ++frameCacheClock;
+  entry->valid = false;  // Until the stream completes
+  return entry;
+}
+
+/*
+ * Streams the image file straight into the controller RAM in bands of
+ * native rows, bypassing the GFX page buffer and drawPixel(). With a frame
+ * cache entry, the bands are built in place in PSRAM and kept for the next
+ * time. Returns false (nothing written) if the fast path can't be used.
+ */
+bool streamImageToController(File& file, FrameCacheEntry* cacheEntry) {
+  const uint16_t nativeW = GxEPD2_DRIVER_CLASS::WIDTH;
+  const uint16_t nativeH = GxEPD2_DRIVER_CLASS::HEIGHT;
+  
+  // The file is stored in rotated (portrait) order, only rotation 1 matches
+  bool compressed = isCompressedFile(file);
+  if (display.getRotation() != 1 || nativeW != IMAGE_HEIGHT || nativeH != IMAGE_WIDTH ||
+      (!compressed && file.size() != IMAGE_SIZE)) {
+    return false;
+  }
+  
+  EpzDecoder<File> decoder(file);
+  if (compressed && (!decoder.begin() || decoder.width() != IMAGE_WIDTH ||
+                     decoder.height() != IMAGE_HEIGHT)) {
+    Serial.println("✗ ERROR: Corrupt compressed image!");
+    return false;
+  }
+  
+  uint16_t rows = streamBandRows();
+  uint8_t* band = cacheEntry ? cacheEntry->frame : (uint8_t*)malloc((size_t)rows * nativeW / 2);
+  if (!band && rows > STREAM_BAND_MIN_ROWS) {
+    rows = STREAM_BAND_MIN_ROWS;  // The heap changed since it was measured
+    band = (uint8_t*)malloc((size_t)rows * nativeW / 2);
+  }
+  if (!band) {
+    Serial.println("⚠ Not enough memory for direct stream, using paged render");
+    return false;
+  }
+  
+  buildNativeLut();
+  
+  unsigned long startTime = millis();
+  enablePagedWrites(display.epd2, 0);
+  
+  bool complete = true;
+  for (uint16_t ys = 0; ys < nativeH; ys += rows) {
+    uint16_t h = ys + rows > nativeH ? nativeH - ys : rows;
+    if (cacheEntry) band = cacheEntry->frame + (size_t)ys * nativeW / 2;
+    bool filled = compressed ? fillNativeBandCompressed(decoder, band, h)
+                             : fillNativeBand(file, band, ys, h);
+    if (!filled) {
+      // Keep the controller transfer complete, the rest stays white
+      memset(band, nativeByteLut[0x11], (size_t)h * nativeW / 2);
+      complete = false;
+    }
+    display.epd2.writeNative(band, nullptr, 0, ys, nativeW, h, false, false, false);
+    renderProgress = RENDER_LOAD_SHARE * (ys + h) / nativeH;
+  }
+  if (cacheEntry) {
+    cacheEntry->valid = complete;  // A damaged file is read again next time
+  } else {
+    free(band);
+  }
+  
+  // The controller holds the image now; uploads may replace the file
+  file.close();
+  unlockImageFile();
+  setRenderState(RENDER_REFRESHING);
+  
+  unsigned long loadTime = millis() - startTime;
+  display.epd2.refresh(false);
+  display.epd2.powerOff();
+  
+  unsigned long elapsed = millis() - startTime;
+  Serial.printf("✓ Display updated in %lu ms (direct stream, %u bands of %u rows, RAM loaded in %lu ms)\n",
+                elapsed, (nativeH + rows - 1) / rows, rows, loadTime);
+  return true;
+}
+
+// Rows per direct-stream band: STREAM_BAND_ROWS, or as many as the largest
+// free heap block allows after STREAM_HEAP_RESERVE
+uint16_t streamBandRows() {
+  const uint16_t nativeH = GxEPD2_DRIVER_CLASS::HEIGHT;
+  const uint32_t rowBytes = GxEPD2_DRIVER_CLASS::WIDTH / 2;
+  if (STREAM_BAND_ROWS) return STREAM_BAND_ROWS;
+  
+  uint32_t heap = ESP.getMaxAllocHeap();
+  uint32_t rows = heap > STREAM_HEAP_RESERVE ? (heap - STREAM_HEAP_RESERVE) / rowBytes : 0;
+  if (rows > nativeH) rows = nativeH;
+  if (rows < STREAM_BAND_MIN_ROWS) rows = STREAM_BAND_MIN_ROWS;
+  return rows & ~1u;  // Bands start on even rows, see fillNativeBand()
+}
+
+/*
+ * Fills a band of native rows [ys, ys + h) from the portrait image file.
+ * Native row ys + i is image column ys + i read bottom to top, so two
+ * consecutive image rows make up one packed controller byte.
+ * Each pair of image rows is one read, from the span of the upper row to
+ * the end of the span of the lower one; the file only seeks when the
+ * spans are not back to back, so a full-width band is one sequential pass.
+ */
+bool fillNativeBand(File& file, uint8_t* band, uint16_t ys, uint16_t h) {
+  const uint16_t nativeBytes = GxEPD2_DRIVER_CLASS::WIDTH / 2;
+  const size_t span = (h + 1) / 2;
+  const size_t length = IMAGE_ROW_BYTES + span;
+  uint8_t pair[2 * IMAGE_ROW_BYTES];
+  const uint8_t* upper = pair;
+  const uint8_t* lower = pair + IMAGE_ROW_BYTES;
+  uint32_t position = UINT32_MAX;  // Unknown until the first seek
+  
+  for (uint16_t y = 0; y < IMAGE_HEIGHT; y += 2) {
+    uint32_t offset = (uint32_t)y * IMAGE_ROW_BYTES + ys / 2;
+    if (offset != position && !file.seek(offset)) return false;
+    if (file.read(pair, length) != length) return false;
+    position = offset + length;
+    
+    // Image row y lands on the odd native column, row y + 1 on the even one
+    uint8_t* dest = band + (nativeBytes - 1 - y / 2);
+    for (uint16_t i = 0; i < h; i++) {
+      uint8_t shift = (i & 1) ? 0 : 4;
+      uint8_t nibbles = (((lower[i / 2] >> shift) & 0x0F) << 4) | ((upper[i / 2] >> shift) & 0x0F);
+      dest[(size_t)i * nativeBytes] = nativeByteLut[nibbles];
+    }
+  }
+  return true;
+}
+
+// Compressed files start with the EPZ magic, raw files are plain pixels
+bool isCompressedFile(File& file) {
+  uint8_t header[EPZ_HEADER_SIZE];
+  file.seek(0);
+  size_t n = file.read(header, sizeof(header));
+  file.seek(0);
+  return isCompressedImage(header, n);
+}
+
+/*
+ * Compressed counterpart of fillNativeBand(). The stream is already in
+ * controller order, so each decoded run of 600 pixels is one native row.
+ */
+bool fillNativeBandCompressed(EpzDecoder<File>& decoder, uint8_t* band, uint16_t h) {
+  const uint16_t nativeW = GxEPD2_DRIVER_CLASS::WIDTH;
+  uint8_t row[GxEPD2_DRIVER_CLASS::WIDTH];
+  
+  for (uint16_t i = 0; i < h; i++) {
+    if (decoder.read(row, nativeW) != nativeW) return false;
+    uint8_t* dest = band + (size_t)i * nativeW / 2;
+    for (uint16_t x = 0; x < nativeW; x += 2) {
+      dest[x / 2] = nativeByteLut[(row[x] << 4) | row[x + 1]];
+    }
+  }
+  return true;
+}
+
+/*
+ * Compressed counterpart of drawImageWindowFromSPIFFS(). Image columns are
+ * stored one after the other, so the decoder carries on from the previous
+ * page and only restarts when a window lies behind its position.
+ */
+void drawCompressedWindow(File& file, EpzDecoder<File>& decoder, int16_t wx, int16_t wy, int16_t ww, int16_t wh) {
+  int16_t x0 = wx < 0 ? 0 : wx;
+  int16_t y0 = wy < 0 ? 0 : wy;
+  int16_t x1 = wx + ww > IMAGE_WIDTH ? IMAGE_WIDTH : wx + ww;
+  int16_t y1 = wy + wh > IMAGE_HEIGHT ? IMAGE_HEIGHT : wy + wh;
+  if (x0 >= x1 || y0 >= y1) return;
+  
+  uint32_t start = (uint32_t)x0 * IMAGE_HEIGHT;
+  if (decoder.position() > start) {
+    file.seek(0);
+    decoder.begin();
+  }
+  if (!decoder.skip(start - decoder.position())) {
+    Serial.println("⚠ Warning: Compressed image ended early");
+    return;
+  }
+  
+  uint8_t column[IMAGE_HEIGHT];
+  for (int x = x0; x < x1; x++) {
+    if (decoder.read(column, IMAGE_HEIGHT) != IMAGE_HEIGHT) {
+      Serial.printf("⚠ Warning: Column %d - compressed image ended early\n", x);
+      return;
+    }
+    // Columns are stored bottom to top
+    for (int y = y0; y < y1; y++) {
+      display.drawPixel(x, y, mapColorValue(column[IMAGE_HEIGHT - 1 - y]));
+    }
+  }
+}
+
+/*
+ * Compares the legacy full-scan renderer, the page-aware one and the
+ * direct stream at several band heights. None of them refreshes the panel:
+ * the GFX paths measure SPIFFS reads and per-pixel work, the stream also
+ * loads the controller RAM (the same image again).
+ */
+String benchmarkRenderPaths() {
+  File imageFile = SPIFFS.open(IMAGE_FILE, FILE_READ);
+  if (!imageFile) {
+    return "Error: Image file not found";
+  }
+  
+  if (isCompressedFile(imageFile)) {
+    String report = benchmarkCompressedDecode(imageFile);
+    imageFile.close();
+    Serial.println("\n=== Render Benchmark ===");
+    Serial.print(report);
+    return report;
+  }
+  
+  uint16_t pages = display.pages();
+  display.setFullWindow();
+  display.firstPage();
+  
+  unsigned long start = micros();
+  for (uint16_t page = 0; page < pages; page++) {
+    drawImageFromSPIFFS(imageFile);
+  }
+  unsigned long legacyTime = micros() - start;
+  uint32_t legacyBytes = (uint32_t)pages * IMAGE_ROW_BYTES * IMAGE_HEIGHT;
+  
+  uint32_t windowBytes = 0;
+  start = micros();
+  for (uint16_t page = 0; page < pages; page++) {
+    int16_t wx, wy, ww, wh;
+    getPageWindow(page, wx, wy, ww, wh);
+    drawImageWindowFromSPIFFS(imageFile, wx, wy, ww, wh);
+    windowBytes += (uint32_t)((wx + ww + 1) / 2 - wx / 2) * wh;
+  }
+  unsigned long windowTime = micros() - start;
+  
+  String report = "Render benchmark (" + String(pages) + " pages of " +
+                  String(display.pageHeight()) + " rows)\n";
+  report += "Full scan:   " + String(legacyTime / 1000) + " ms, " +
+            String(legacyBytes) + " bytes read\n";
+  report += "Page window: " + String(windowTime / 1000) + " ms, " +
+            String(windowBytes) + " bytes read\n";
+  report += benchmarkBandHeights(imageFile);
+  imageFile.close();
+  
+  Serial.println("\n=== Render Benchmark ===");
+  Serial.print(report);
+  return report;
+}
+
+/*
+ * Direct stream load time against band height: every band is one more
+ * pass over the file and one more controller write. The automatic choice
+ * is marked.
+ */
+String benchmarkBandHeights(File& imageFile) {
+  static const uint16_t bandRows[] = {16, 32, 64, 112, 224, GxEPD2_DRIVER_CLASS::HEIGHT};
+  const uint16_t nativeW = GxEPD2_DRIVER_CLASS::WIDTH;
+  const uint16_t nativeH = GxEPD2_DRIVER_CLASS::HEIGHT;
+  uint16_t automatic = streamBandRows();
+  
+  String report = "Direct stream (file, conversion and controller RAM; free heap " +
+                  String(ESP.getMaxAllocHeap()) + ", automatic " + String(automatic) + " rows):\n";
+  buildNativeLut();
+  enablePagedWrites(display.epd2, 0);
+  for (uint16_t rows : bandRows) {
+    uint8_t* band = (uint8_t*)malloc((size_t)rows * nativeW / 2);
+    if (!band) {
+      report += "  " + String(rows) + " rows: not enough heap\n";
+      continue;
+    }
+    unsigned long start = micros();
+    for (uint16_t ys = 0; ys < nativeH; ys += rows) {
+      uint16_t h = ys + rows > nativeH ? nativeH - ys : rows;
+      fillNativeBand(imageFile, band, ys, h);
+      display.epd2.writeNative(band, nullptr, 0, ys, nativeW, h, false, false, false);
+    }
+    unsigned long elapsed = micros() - start;
+    free(band);
+    report += "  " + String(rows) + " rows: " + String((nativeH + rows - 1) / rows) + " bands, " +
+              String(elapsed / 1000) + " ms, " + String((uint32_t)rows * nativeW / 2) + " bytes" +
+              (rows == automatic ? " (automatic)" : "") + "\n";
+  }
+  display.hibernate();
+  return report;
+}
+
+/*
+ * The raw-file paths don't apply to compressed images: times the decode
+ * into controller bands (the work done by the direct stream).
+ */
+String benchmarkCompressedDecode(File& imageFile) {
+  size_t fileSize = imageFile.size();
+  uint16_t rows = streamBandRows();
+  uint8_t* band = (uint8_t*)malloc((size_t)rows * GxEPD2_DRIVER_CLASS::WIDTH / 2);
+  EpzDecoder<File> decoder(imageFile);
+  if (!band || !decoder.begin()) {
+    free(band);
+    return "Error: Cannot decode compressed image";
+  }
+  
+  buildNativeLut();
+  unsigned long start = micros();
+  bool ok = true;
+  for (uint16_t ys = 0; ys < GxEPD2_DRIVER_CLASS::HEIGHT && ok; ys += rows) {
+    uint16_t h = ys + rows > GxEPD2_DRIVER_CLASS::HEIGHT ?
+                 GxEPD2_DRIVER_CLASS::HEIGHT - ys : rows;
+    ok = fillNativeBandCompressed(decoder, band, h);
+  }
+  unsigned long decodeTime = micros() - start;
+  free(band);
+  
+  String report = "Compressed image: " + String(fileSize) + " bytes (" +
+                  String(fileSize * 100 / IMAGE_SIZE) + "% of raw)\n";
+  report += "Decode to bands of " + String(rows) + " rows: " + String(decodeTime / 1000) + " ms" +
+            (ok ? "" : " (corrupt data)") + "\n";
+  return report;
+}
+
 uint16_t mapColorValue(uint8_t pixel_value) {
   switch (pixel_value) {
     case 0: return GxEPD_BLACK;
@@ -352,25 +1327,44 @@ void loadWiFiCredentials() {
 void saveWiFiCredentials(String ssid, String pass) {
   preferences.putString("ssid", ssid);
   preferences.putString("pass", pass);
+  preferences.remove("wifiCache");  // Belongs to the old network
   Serial.println("✓ WiFi credentials saved");
 }
 
 void connectToWiFi() {
   Serial.printf("Connecting to WiFi: %s ", savedSSID.c_str());
+  uint32_t start = millis();
   
+  if (!wifiEvent) {
+    wifiEvent = xSemaphoreCreateBinary();
+    WiFi.onEvent(onWiFiEvent, ARDUINO_EVENT_WIFI_STA_GOT_IP);
+    WiFi.onEvent(onWiFiEvent, ARDUINO_EVENT_WIFI_STA_DISCONNECTED);
+  }
+  WiFi.persistent(false);  // Credentials live in Preferences, no flash write per connect
   WiFi.mode(WIFI_STA);
-  WiFi.begin(savedSSID.c_str(), savedPass.c_str());
   
-  int attempts = 0;
-  while (WiFi.status() != WL_CONNECTED && attempts < 20) {
-    delay(500);
-    Serial.print(".");
-    attempts++;
+  // Fast path: no scan, no DHCP. A moved router fails it quickly.
+  WiFiCache cache;
+  bool cached = preferences.getBytesLength("wifiCache") == sizeof(cache) &&
+                preferences.getBytes("wifiCache", &cache, sizeof(cache)) == sizeof(cache);
+  if (cached) {
+    WiFi.config(IPAddress(cache.ip), IPAddress(cache.gateway), IPAddress(cache.subnet), IPAddress(cache.dns));
+    WiFi.begin(savedSSID.c_str(), savedPass.c_str(), cache.channel, cache.bssid);
+    if (!waitForWiFi(WIFI_FAST_TIMEOUT_MS, true)) {
+      Serial.print("(cache stale, scanning) ");
+      WiFi.disconnect();
+      WiFi.config(IPAddress(), IPAddress(), IPAddress());  // Back to DHCP
+      cached = false;
+    }
+  }
+  if (!cached) {
+    WiFi.begin(savedSSID.c_str(), savedPass.c_str());
+    if (waitForWiFi(WIFI_CONNECT_TIMEOUT_MS, false)) saveWiFiCache();
   }
   
   if (WiFi.status() == WL_CONNECTED) {
     wifiConfigured = true;
-    Serial.println(" ✓ Connected");
+    Serial.printf(" ✓ Connected in %u ms (%s)\n", (unsigned)(millis() - start), cached ? "cached" : "scan");
     Serial.printf("   IP Address: %s\n", WiFi.localIP().toString().c_str());
     Serial.printf("   Signal: %d dBm\n", WiFi.RSSI());
   } else {
@@ -380,6 +1374,37 @@ void connectToWiFi() {
   }
 }
 
+// Runs in the Wi-Fi event task
+void onWiFiEvent(arduino_event_id_t event) {
+  if (event == ARDUINO_EVENT_WIFI_STA_GOT_IP) wifiGotIp = true;
+  xSemaphoreGive(wifiEvent);
+}
+
+// Sleeps until the station has an address; failFast gives up on the first disconnect
+bool waitForWiFi(uint32_t timeoutMs, bool failFast) {
+  uint32_t start = millis();
+  while (!wifiGotIp) {
+    uint32_t elapsed = millis() - start;
+    if (elapsed >= timeoutMs) return false;
+    if (xSemaphoreTake(wifiEvent, pdMS_TO_TICKS(timeoutMs - elapsed)) == pdTRUE && !wifiGotIp && failFast) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void saveWiFiCache() {
+  WiFiCache cache;
+  memset(&cache, 0, sizeof(cache));
+  memcpy(cache.bssid, WiFi.BSSID(), sizeof(cache.bssid));
+  cache.channel = WiFi.channel();
+  cache.ip = WiFi.localIP();
+  cache.gateway = WiFi.gatewayIP();
+  cache.subnet = WiFi.subnetMask();
+  cache.dns = WiFi.dnsIP();
+  preferences.putBytes("wifiCache", &cache, sizeof(cache));
+}
+
 void startAPMode() {
   Serial.print("Starting Access Point... ");
   
@@ -399,13 +1424,70 @@ void startAPMode() {
 void setupWebServer() {
   Serial.print("Starting web server... ");
   
+  // Pre-compressed page; browsers revalidate with the ETag and get a 304.
+  // There is no uncompressed copy: every browser accepts gzip, the page is
+  // useless without one, and the copy would cost 79 KB of flash (inflating
+  // on the fly, a 32 KB window and 11 KB of state in heap). A client that
+  // refuses gzip gets 406 and a note instead of bytes it cannot read.
   server.on("/", HTTP_GET, []() {
+    keepAwake();
     server.sendHeader("Access-Control-Allow-Origin", "*");
-    server.send_P(200, "text/html", HTML_PAGE);
+    server.sendHeader("Vary", "Accept-Encoding");
+    if (!acceptsGzip(server.header("Accept-Encoding"))) {
+#if WEB_PAGE_IDENTITY
+      // Plain curl, captive-portal browsers, embedded clients: the page as it is.
+      // No ETag, the compressed one names the other representation
+      server.sendHeader("Cache-Control", "no-cache");
+      server.send_P(200, "text/html", HTML_PAGE);
+#else
+      server.send(406, "text/plain",
+                  "The web interface is served gzip-compressed only. Open it in a browser, "
+                  "or use curl --compressed.");
+#endif
+      return;
+    }
+    server.sendHeader("Cache-Control", "no-cache");
+    server.sendHeader("ETag", HTML_PAGE_ETAG);
+    if (server.header("If-None-Match") == HTML_PAGE_ETAG) {
+      server.send(304);
+      return;
+    }
+    server.sendHeader("Content-Encoding", "gzip");
+    server.send_P(200, "text/html", (PGM_P)HTML_PAGE_GZ, HTML_PAGE_GZ_SIZE);
   });
   
   server.on("/upload", HTTP_POST, handleUploadComplete, handleUpload);
   
+  // Body is the image itself (application/octet-stream), no multipart parsing
+  server.on("/image", HTTP_PUT, handleUploadComplete, handleRawUpload);
+  server.on("/image", HTTP_POST, handleUploadComplete, handleRawUpload);
+  
+  server.on("/status", HTTP_GET, []() {
+    keepAwake();
+    server.sendHeader("Access-Control-Allow-Origin", "*");
+    server.sendHeader("Cache-Control", "no-store");
+    server.send(200, "application/json", renderStatusJson());
+  });
+  
+  server.on("/upload/stats", HTTP_GET, []() {
+    server.sendHeader("Access-Control-Allow-Origin", "*");
+    String report = "Last upload: " + flashWriterReport();
+    if (uploadJpeg) report += "\nJPEG: " + jpegUploadReport();
+    server.send(200, "text/plain", report);
+  });
+  
+  server.on("/benchmark", HTTP_GET, []() {
+    server.sendHeader("Access-Control-Allow-Origin", "*");
+    if (displayMutex && xSemaphoreTake(displayMutex, 0) != pdTRUE) {
+      server.send(503, "text/plain", "Display busy, try again after the refresh");
+      return;
+    }
+    if (imageFileMutex) xSemaphoreTake(imageFileMutex, portMAX_DELAY);
+    server.send(200, "text/plain", benchmarkRenderPaths());
+    if (imageFileMutex) xSemaphoreGive(imageFileMutex);
+    if (displayMutex) xSemaphoreGive(displayMutex);
+  });
+  
   server.on("/config", HTTP_GET, []() {
     String html = "<!DOCTYPE html><html><head><meta charset='UTF-8'>";
     html += "<style>body{font-family:Arial;max-width:400px;margin:50px auto;padding:20px;}";
@@ -452,6 +1534,142 @@ void setupWebServer() {
     server.send(204);
   });
   
+  server.on("/image", HTTP_OPTIONS, []() {
+    server.sendHeader("Access-Control-Allow-Origin", "*");
+    server.sendHeader("Access-Control-Allow-Methods", "PUT, POST, OPTIONS");
+    server.sendHeader("Access-Control-Allow-Headers", "Content-Type");
+    server.send(204);
+  });
+  
+  // Image library: list, add (raw body, ?duration=seconds), delete, reorder, show
+  server.on("/library", HTTP_GET, []() {
+    keepAwake();
+    server.sendHeader("Access-Control-Allow-Origin", "*");
+    server.send(200, "application/json", libraryJson());
+  });
+  
+  server.on("/library", HTTP_PUT, handleUploadComplete, handleRawUpload);
+  server.on("/library", HTTP_POST, handleUploadComplete, handleRawUpload);
+  
+  server.on("/library", HTTP_DELETE, []() {
+    keepAwake();
+    server.sendHeader("Access-Control-Allow-Origin", "*");
+    int16_t position = library.find(server.arg("id").toInt());
+    if (position < 0) {
+      server.send(404, "text/plain", "Error: No such image");
+      return;
+    }
+    // A render may be reading the file
+    if (imageFileMutex) xSemaphoreTake(imageFileMutex, portMAX_DELAY);
+    bool removed = library.remove(library.entry(position).id);
+    if (imageFileMutex) xSemaphoreGive(imageFileMutex);
+    if (position <= playlistPosition) playlistPosition--;
+    server.send(removed ? 200 : 500, "application/json", libraryJson());
+  });
+  
+  server.on("/library/order", HTTP_POST, []() {
+    keepAwake();
+    server.sendHeader("Access-Control-Allow-Origin", "*");
+    uint16_t ids[LIBRARY_MAX_IMAGES];
+    uint16_t count = 0;
+    String list = server.arg("ids");
+    int start = 0;
+    while (start < (int)list.length() && count < LIBRARY_MAX_IMAGES) {
+      int end = list.indexOf(',', start);
+      if (end < 0) end = list.length();
+      ids[count++] = list.substring(start, end).toInt();
+      start = end + 1;
+    }
+    
+    int32_t currentId = playlistPosition >= 0 ? library.entry(playlistPosition).id : -1;
+    if (!library.reorder(ids, count)) {
+      server.send(400, "text/plain", "Error: ids must list every image once");
+      return;
+    }
+    if (currentId >= 0) playlistPosition = library.find(currentId);
+    server.send(200, "application/json", libraryJson());
+  });
+  
+  server.on("/library/show", HTTP_POST, []() {
+    keepAwake();
+    server.sendHeader("Access-Control-Allow-Origin", "*");
+    int16_t position = library.find(server.arg("id").toInt());
+    if (position < 0) {
+      server.send(404, "text/plain", "Error: No such image");
+      return;
+    }
+    showLibraryImage(position);
+    server.send(200, "text/plain", "OK");
+  });
+  
+  // Images by content (imageDigestText(): truncated SHA-256 and size): HEAD
+  // tells whether the frame already stores it, POST shows it without another upload
+  server.on(UriBraces("/image/{}"), HTTP_HEAD, []() {
+    keepAwake();
+    server.sendHeader("Access-Control-Allow-Origin", "*");
+    int16_t index;
+    ImageSource source = findImage(server.pathArg(0), index);
+    if (source == IMAGE_UNKNOWN) {
+      server.send(404);
+      return;
+    }
+    server.sendHeader("X-Image-Source", source == IMAGE_CURRENT ? "current" :
+                                        source == IMAGE_CACHED ? "cache" : "library");
+    server.send(200);
+  });
+  
+  server.on(UriBraces("/image/{}"), HTTP_POST, []() {
+    keepAwake();
+    server.sendHeader("Access-Control-Allow-Origin", "*");
+    int16_t index;
+    ImageSource source = findImage(server.pathArg(0), index);
+    if (source == IMAGE_UNKNOWN) {
+      server.send(404, "text/plain", "Error: No such image");
+      return;
+    }
+    if (source == IMAGE_LIBRARY) {
+      showLibraryImage(index);
+    } else {
+      if (source == IMAGE_CACHED && !imageCacheRestore(index)) {
+        server.send(500, "text/plain", "Error: Cannot restore the image");
+        return;
+      }
+      Serial.printf("✓ Image %s from %s, no upload needed\n", server.pathArg(0).c_str(),
+                    source == IMAGE_CURRENT ? "the current file" : "the cache");
+      showImageFile(source == IMAGE_CURRENT);
+    }
+    server.send(200, "text/plain", "OK");
+  });
+  
+  // Low-power mode on or off (?mode=low|on) and the power statistics
+  server.on("/power", HTTP_GET, []() {
+    keepAwake();
+    server.sendHeader("Access-Control-Allow-Origin", "*");
+    server.send(200, "text/plain", powerReport());
+  });
+  
+  server.on("/power", HTTP_POST, []() {
+    keepAwake();
+    server.sendHeader("Access-Control-Allow-Origin", "*");
+    String mode = server.arg("mode");
+    if (mode != "low" && mode != "on") {
+      server.send(400, "text/plain", "Error: mode must be low or on");
+      return;
+    }
+    lowPowerMode = mode == "low";
+    preferences.putBool("lowPower", lowPowerMode);
+    server.send(200, "text/plain", powerReport());
+  });
+  
+  server.on("/library", HTTP_OPTIONS, []() {
+    server.sendHeader("Access-Control-Allow-Origin", "*");
+    server.sendHeader("Access-Control-Allow-Methods", "GET, PUT, POST, DELETE, OPTIONS");
+    server.sendHeader("Access-Control-Allow-Headers", "Content-Type");
+    server.send(204);
+  });
+  
+  const char* headerKeys[] = {"If-None-Match", "Content-Type", "Accept-Encoding"};
+  server.collectHeaders(headerKeys, 3);
   server.begin();
   Serial.println("✓ Done");
 }
@@ -462,32 +1680,53 @@ void handleUpload() {
   if (upload.status == UPLOAD_FILE_START) {
     Serial.println("\n=== File Upload Started ===");
     Serial.printf("Filename: %s\n", upload.filename.c_str());
-    
-    uploadFile = SPIFFS.open(IMAGE_FILE, FILE_WRITE);
-    if (!uploadFile) {
-      Serial.println("✗ ERROR: Cannot open file for writing!");
-      return;
-    }
+    uploadToLibrary = false;
+    uploadJpeg = isJpegUpload(upload.type, upload.filename);
+    uploadDither = ditherAlgorithmFromId(server.arg("dither").c_str(), DITHER_FLOYD_STEINBERG);
+    uploadPalette = ditherPaletteFromId(server.arg("palette").c_str(), DITHER_PALETTE_IDEAL);
+    imageCacheMakeRoom(IMAGE_SIZE);  // Size unknown until the end, assume raw
+    uploadError = flashWriterBegin(IMAGE_FILE) ? 0 : 500;
   } 
   else if (upload.status == UPLOAD_FILE_WRITE) {
-    if (uploadFile) {
-      uploadFile.write(upload.buf, upload.currentSize);
-      if (uploadFile.size() % 10000 < upload.currentSize) {
-        Serial.printf("Progress: %d bytes\n", uploadFile.size());
-      }
+    if (uploadError) return;
+    if (!flashWriterWrite(upload.buf, upload.currentSize)) {
+      uploadError = 500;
+    } else if (flashStats.bytes % 10000 < upload.currentSize) {
+      Serial.printf("Progress: %d bytes\n", flashStats.bytes);
     }
   } 
   else if (upload.status == UPLOAD_FILE_END) {
-    if (uploadFile) {
-      uploadFile.close();
-      Serial.printf("✓ Upload complete: %d bytes\n", upload.totalSize);
-    }
+    finishUpload(upload.totalSize);
+  } 
+  else if (upload.status == UPLOAD_FILE_ABORTED) {
+    Serial.println("✗ ERROR: Upload aborted!");
+    uploadError = 400;
+    flashWriterAbort();
   }
 }
 
 void handleUploadComplete() {
+  keepAwake();
   server.sendHeader("Access-Control-Allow-Origin", "*");
   
+  if (uploadError) {
+    // A JPEG the ROM decoder cannot read fails the flash writer too
+    if (uploadError == 500 && uploadJpeg && jpegStats.result > JDR_INTR) {
+      server.send(415, "text/plain", "Error: Cannot decode the JPEG (baseline JPEG only)");
+    } else {
+      server.send(uploadError, "text/plain", uploadErrorText ? uploadErrorText : "Error: Upload failed");
+    }
+    uploadError = 0;
+    uploadErrorText = nullptr;
+    return;
+  }
+  
+  if (uploadToLibrary) {
+    uploadToLibrary = false;
+    finishLibraryUpload();
+    return;
+  }
+  
   if (!SPIFFS.exists(IMAGE_FILE)) {
     Serial.println("✗ ERROR: Image file not found!");
     server.send(400, "text/plain", "Error: File not found");
@@ -496,14 +1735,1026 @@ void handleUploadComplete() {
   
   File f = SPIFFS.open(IMAGE_FILE, FILE_READ);
   size_t fileSize = f.size();
+  bool compressed = isCompressedFile(f);
   f.close();
   
   uint32_t expectedSize = IMAGE_WIDTH * IMAGE_HEIGHT / 2;
   
-  if (fileSize != expectedSize) {
+  if (compressed) {
+    Serial.printf("✓ Compressed image: %d bytes (%d%% of raw)\n",
+                  fileSize, (int)(fileSize * 100 / expectedSize));
+  } else if (fileSize != expectedSize) {
     Serial.printf("⚠ Warning: File size %d, expected %d\n", fileSize, expectedSize);
   }
   
+  if (uploadDiff.regional) {
+    Serial.printf("Changed: %u bytes in %u regions\n", (unsigned)uploadDiff.changedBytes, uploadDiff.rectCount);
+  }
+  
+  // Partial refresh only on top of the previous upload; regional is never
+  // set on controllers without partial update (the 7-color panel)
+  uint8_t rectCount = 0;
+  if (uploadDiff.regional && panelImageId == RENDER_UPLOADED_IMAGE && !renderBusy()) {
+    rectCount = uploadDiff.rectCount;
+  }
+  
+  // Queued before the response, so /status already reports it
+  showImageFile(uploadDiff.identical, uploadDiff.rects, rectCount);
+  server.sendHeader("X-Image-Hash", imageDigestText(flashStats.digest));
   server.send(200, "text/plain", "OK");
-  displayImageFromSPIFFS();
-}
\ No newline at end of file
+}
+
+// Puts IMAGE_FILE on the panel unless it already shows these exact bytes;
+// the slideshow moves on after the usual duration
+void showImageFile(bool unchanged, const DirtyRect* rects, uint8_t rectCount) {
+  playlistShownAt = millis();
+  playlistDurationS = LIBRARY_DEFAULT_DURATION_S;
+  if (unchanged && panelImageId == RENDER_UPLOADED_IMAGE && !renderBusy()) {
+    renderSkipped++;
+    Serial.println("✓ Image unchanged, refresh skipped");
+    return;
+  }
+  queueRender(RENDER_UPLOADED_IMAGE, rects, rectCount);
+}
+
+void handleRawUpload() {
+  HTTPRaw& raw = server.raw();
+  
+  if (raw.status == RAW_START) {
+    size_t length = server.clientContentLength();
+    Serial.println("\n=== Raw Upload Started ===");
+    Serial.printf("Content-Length: %d\n", length);
+    
+    uploadJpeg = isJpegUpload(server.header("Content-Type"), "");
+    uploadDither = ditherAlgorithmFromId(server.arg("dither").c_str(), DITHER_FLOYD_STEINBERG);
+    uploadPalette = ditherPaletteFromId(server.arg("palette").c_str(), DITHER_PALETTE_IDEAL);
+    if (length == 0 || length > (uploadJpeg ? JPEG_MAX_UPLOAD : IMAGE_SIZE)) {
+      Serial.println("✗ ERROR: Invalid image size!");
+      uploadError = length == 0 ? 400 : 413;
+      return;
+    }
+    
+    // POST/PUT /library adds to the playlist instead of replacing IMAGE_FILE
+    uploadToLibrary = server.uri() == "/library";
+    char target[LIBRARY_PATH_SIZE] = IMAGE_FILE;
+    if (uploadToLibrary) {
+      if (!parseDuration(server.arg("duration"), uploadDurationS)) {
+        Serial.println("✗ ERROR: Invalid duration!");
+        static char message[64];
+        snprintf(message, sizeof(message), "Error: duration must be %u to %u seconds",
+                 LIBRARY_MIN_DURATION_S, LIBRARY_MAX_DURATION_S);
+        uploadError = 400;
+        uploadErrorText = message;
+        return;
+      }
+      if (library.full()) {
+        Serial.println("✗ ERROR: Image library is full!");
+        uploadError = 507;
+        return;
+      }
+    }
+    
+    // Accepted: only now do cached images give way to it
+    bool room = imageCacheMakeRoom(uploadJpeg ? IMAGE_SIZE : length);
+    if (uploadToLibrary) {
+      if (!room) {
+        Serial.println("✗ ERROR: No flash space for the library image!");
+        uploadError = 507;
+        return;
+      }
+      libraryImagePath(library.nextId(), target);
+    }
+    uploadError = flashWriterBegin(target) ? 0 : 500;
+  } 
+  else if (raw.status == RAW_WRITE) {
+    if (!uploadError && !flashWriterWrite(raw.buf, raw.currentSize)) uploadError = 500;
+  } 
+  else if (raw.status == RAW_END) {
+    finishUpload(raw.totalSize);
+  } 
+  else if (raw.status == RAW_ABORTED) {
+    Serial.println("✗ ERROR: Upload aborted!");
+    uploadError = 400;
+    flashWriterAbort();
+  }
+}
+
+void finishUpload(size_t totalSize) {
+  if (uploadError) {
+    flashWriterAbort();
+    return;
+  }
+  if (!flashWriterEnd()) {
+    uploadError = 500;
+    return;
+  }
+  Serial.printf("✓ Upload complete: %d bytes\n", totalSize);
+  Serial.printf("✓ Flash writer: %s\n", flashWriterReport().c_str());
+  if (uploadJpeg) Serial.printf("✓ JPEG: %s\n", jpegUploadReport().c_str());
+}
+
+// Accept-Encoding allows gzip: gzip or * listed without q=0; an explicit gzip
+// entry overrides *. Without the header any coding goes, but clients that
+// send none (plain curl, small HTTP libraries) rarely inflate, so they get
+// the plain page when the build has it
+bool acceptsGzip(const String& acceptEncoding) {
+  if (acceptEncoding.length() == 0) return !WEB_PAGE_IDENTITY;
+  int8_t gzip = -1, any = -1;  // -1 not listed, 0 refused, 1 accepted
+  int start = 0;
+  while (start <= (int)acceptEncoding.length()) {
+    int end = acceptEncoding.indexOf(',', start);
+    if (end < 0) end = acceptEncoding.length();
+    String coding = acceptEncoding.substring(start, end);
+    start = end + 1;
+    
+    int q = coding.indexOf(';');
+    bool refused = false;
+    if (q >= 0) {
+      String param = coding.substring(q + 1);
+      param.trim();
+      refused = param.startsWith("q=") && param.substring(2).toFloat() <= 0;
+      coding = coding.substring(0, q);
+    }
+    coding.trim();
+    coding.toLowerCase();
+    if (coding == "gzip" || coding == "x-gzip") gzip = !refused;
+    else if (coding == "*") any = !refused;
+  }
+  return gzip >= 0 ? gzip == 1 : any == 1;
+}
+
+// ?duration=seconds of a library upload: absent for the default, otherwise
+// digits only and within LIBRARY_MIN_DURATION_S..LIBRARY_MAX_DURATION_S
+bool parseDuration(const String& arg, uint16_t& durationS) {
+  durationS = 0;
+  if (arg.length() == 0) return true;
+  if (arg.length() > 5) return false;
+  uint32_t value = 0;
+  for (size_t i = 0; i < arg.length(); i++) {
+    if (arg[i] < '0' || arg[i] > '9') return false;
+    value = value * 10 + (arg[i] - '0');
+  }
+  if (value < LIBRARY_MIN_DURATION_S || value > LIBRARY_MAX_DURATION_S) return false;
+  durationS = value;
+  return true;
+}
+
+// Photos the frame decodes itself: image/jpeg, or a .jpg name for multipart
+bool isJpegUpload(const String& contentType, const String& filename) {
+  String name = filename;
+  name.toLowerCase();
+  return contentType.startsWith("image/jpeg") || name.endsWith(".jpg") || name.endsWith(".jpeg");
+}
+
+/* ========================================
+   FLASH WRITER
+   ======================================== */
+
+/*
+ * The web server copies each network chunk into a ring of sector-sized
+ * blocks and queues full blocks; a task on the other core writes them to
+ * SPIFFS and hands them back. Receiving only waits when every block is
+ * still queued for flash (counted as a stall), so an upload takes about
+ * as long as the slower of Wi-Fi and flash instead of their sum.
+ */
+bool startFlashWriter() {
+  flashJobs = xQueueCreate(FLASH_WRITER_BLOCKS + 2, sizeof(FlashJob));
+  flashFreeBlocks = xQueueCreate(FLASH_WRITER_BLOCKS, sizeof(uint8_t));
+  flashWriterDone = xSemaphoreCreateBinary();
+  if (!flashJobs || !flashFreeBlocks || !flashWriterDone) return false;
+  
+  for (uint8_t i = 0; i < FLASH_WRITER_BLOCKS; i++) {
+    xQueueSend(flashFreeBlocks, &i, 0);
+  }
+  // 6 KB: the JPEG decoder runs in the task
+  return xTaskCreatePinnedToCore(flashWriterTask, "flashWriter", 6144, nullptr, 2,
+                                 nullptr, FLASH_WRITER_CORE) == pdPASS;
+}
+
+void flashWriterTask(void* parameter) {
+  bool opened = false;
+  FlashJob job;
+  
+  for (;;) {
+    if (xQueueReceive(flashJobs, &job, portMAX_DELAY) != pdTRUE) continue;
+    
+    if (job.command == FLASH_JOB_OPEN || job.command == FLASH_JOB_DECODE) {
+      uploadFile = SPIFFS.open(IMAGE_TEMP_FILE, FILE_WRITE);
+      opened = uploadFile;
+      uploadDiffBegin();
+      uploadHasher.begin();
+      flashWriterOk = opened;
+      if (!opened) Serial.println("✗ ERROR: Cannot open file for writing!");
+      if (job.command == FLASH_JOB_OPEN) continue;
+      // The decoder takes the WRITE jobs of the upload, up to its CLOSE or ABORT
+      job.command = jpegUploadDecode();
+    }
+    
+    if (job.command == FLASH_JOB_WRITE) {
+      flashWriterStore(flashRing[job.block], job.length);
+      xQueueSend(flashFreeBlocks, &job.block, portMAX_DELAY);
+    } 
+    else {
+      if (job.command == FLASH_JOB_ABORT) flashWriterOk = false;
+      uploadDiffEnd();  // Before the rename replaces the previous file
+      flashStats.digest = uploadHasher.finish();
+      if (opened) {
+        uploadFile.close();
+        opened = false;
+        if (!flashWriterOk) {
+          SPIFFS.remove(IMAGE_TEMP_FILE);  // The current image stays
+        } else {
+          // SPIFFS cannot rename over a file; the lock keeps renders from
+          // seeing the moment in between
+          if (imageFileMutex) xSemaphoreTake(imageFileMutex, portMAX_DELAY);
+          bool replaced;
+          if (strcmp(uploadTarget, IMAGE_FILE) == 0) {
+            replaced = replaceImageFile(IMAGE_TEMP_FILE, flashStats.digest);
+          } else {
+            SPIFFS.remove(uploadTarget);
+            replaced = SPIFFS.rename(IMAGE_TEMP_FILE, uploadTarget);
+          }
+          if (!replaced) {
+            Serial.println("✗ ERROR: Cannot replace the image file!");
+            flashWriterOk = false;
+          }
+          if (imageFileMutex) xSemaphoreGive(imageFileMutex);
+        }
+      }
+      xSemaphoreGive(flashWriterDone);
+    }
+  }
+}
+
+bool flashWriterBegin(const char* target) {
+  if (!flashJobs) return false;
+  strncpy(uploadTarget, target, sizeof(uploadTarget) - 1);
+  memset(&flashStats, 0, sizeof(flashStats));
+  flashStats.startMs = millis();
+  flashBlock = -1;
+  flashBlockFill = 0;
+  flashWriterOk = true;  // Until the writer reports otherwise
+  flashSession = true;
+  memset(&jpegStats, 0, sizeof(jpegStats));
+  
+  FlashJob job = {uploadJpeg ? FLASH_JOB_DECODE : FLASH_JOB_OPEN, 0, 0};
+  return xQueueSend(flashJobs, &job, portMAX_DELAY) == pdTRUE;
+}
+
+bool flashWriterWrite(const uint8_t* data, size_t length) {
+  while (length > 0) {
+    if (!flashWriterOk) return false;
+    
+    if (flashBlock < 0) {
+      uint8_t block;
+      if (xQueueReceive(flashFreeBlocks, &block, 0) != pdTRUE) {
+        // Backpressure: every block is still waiting for flash
+        uint32_t start = millis();
+        flashStats.stalls++;
+        if (xQueueReceive(flashFreeBlocks, &block, pdMS_TO_TICKS(FLASH_WRITER_TIMEOUT_MS)) != pdTRUE) {
+          Serial.println("✗ ERROR: Flash writer not responding!");
+          return false;
+        }
+        flashStats.stallMs += millis() - start;
+      }
+      flashBlock = block;
+      flashBlockFill = 0;
+    }
+    
+    size_t n = FLASH_WRITER_BLOCK - flashBlockFill;
+    if (n > length) n = length;
+    memcpy(flashRing[flashBlock] + flashBlockFill, data, n);
+    flashBlockFill += n;
+    flashStats.bytes += n;
+    data += n;
+    length -= n;
+    
+    if (flashBlockFill == FLASH_WRITER_BLOCK && !flashWriterSubmitBlock()) return false;
+  }
+  return true;
+}
+
+bool flashWriterSubmitBlock() {
+  FlashJob job = {FLASH_JOB_WRITE, (uint8_t)flashBlock, flashBlockFill};
+  flashBlock = -1;
+  if (xQueueSend(flashJobs, &job, portMAX_DELAY) != pdTRUE) return false;
+  
+  flashStats.blocks++;
+  uint32_t queued = FLASH_WRITER_BLOCKS - uxQueueMessagesWaiting(flashFreeBlocks);
+  if (queued > flashStats.peakQueued) flashStats.peakQueued = queued;
+  return true;
+}
+
+// Writes the last partial block, closes the file and waits for the writer
+bool flashWriterEnd() {
+  return flashWriterFinish(FLASH_JOB_CLOSE);
+}
+
+// Drops the upload; the writer removes the partial file
+void flashWriterAbort() {
+  flashWriterFinish(FLASH_JOB_ABORT);
+}
+
+bool flashWriterFinish(FlashJobCommand command) {
+  if (!flashSession) return false;
+  flashSession = false;
+  
+  if (flashBlock >= 0) {
+    if (command == FLASH_JOB_CLOSE && flashWriterOk && flashBlockFill > 0) {
+      flashWriterSubmitBlock();
+    } else {
+      uint8_t block = flashBlock;
+      xQueueSend(flashFreeBlocks, &block, 0);
+      flashBlock = -1;
+    }
+  }
+  
+  FlashJob job = {command, 0, 0};
+  if (xQueueSend(flashJobs, &job, portMAX_DELAY) != pdTRUE ||
+      xSemaphoreTake(flashWriterDone, pdMS_TO_TICKS(FLASH_WRITER_TIMEOUT_MS)) != pdTRUE) {
+    Serial.println("✗ ERROR: Flash writer not responding!");
+    return false;
+  }
+  flashStats.totalMs = millis() - flashStats.startMs;
+  return flashWriterOk;
+}
+
+// Writer task: bytes for the file, counted in its digest and diff
+bool flashWriterStore(const uint8_t* data, size_t length) {
+  if (!flashWriterOk) return false;
+  uint32_t start = millis();
+  if (uploadFile.write(data, length) != length) {
+    Serial.println("✗ ERROR: Flash write failed!");
+    flashWriterOk = false;
+  }
+  flashStats.flashMs += millis() - start;
+  uploadHasher.update(data, length);
+  uploadDiffUpdate(data, length);
+  return flashWriterOk;
+}
+
+String flashWriterReport() {
+  char report[192];
+  uint32_t totalMs = flashStats.totalMs ? flashStats.totalMs : 1;
+  snprintf(report, sizeof(report),
+           "%u bytes in %u blocks, %u ms (%u KB/s), flash busy %u ms, "
+           "network stalled %u times (%u ms), peak queue %u/%u",
+           flashStats.bytes, flashStats.blocks, flashStats.totalMs,
+           (unsigned)((uint64_t)flashStats.bytes * 1000 / 1024 / totalMs),
+           flashStats.flashMs, flashStats.stalls, flashStats.stallMs,
+           flashStats.peakQueued, FLASH_WRITER_BLOCKS);
+  return String(report);
+}
+
+// Writer task: the upload is compared with IMAGE_FILE block by block as it
+// arrives, so the diff costs one extra read and no extra RAM
+void uploadDiffBegin() {
+  memset(&uploadDiff, 0, sizeof(uploadDiff));
+  diffOffset = 0;
+  if (strcmp(uploadTarget, IMAGE_FILE) != 0) return;  // Library uploads are new files
+  diffFile = SPIFFS.open(IMAGE_FILE, FILE_READ);
+  uploadDiff.identical = diffFile;
+  // Regions are only of use to controllers with partial update
+  uploadDiff.regional = GxEPD2_DRIVER_CLASS::hasPartialUpdate && diffFile &&
+                        diffFile.size() == IMAGE_SIZE && !isCompressedFile(diffFile);
+}
+
+void uploadDiffUpdate(const uint8_t* data, size_t length) {
+  if (!diffFile) return;
+  uint8_t previous[256];
+  for (size_t done = 0; done < length;) {
+    size_t n = length - done < sizeof(previous) ? length - done : sizeof(previous);
+    size_t got = diffFile.read(previous, n);
+    for (size_t i = 0; i < n; i++) {
+      if (i < got && previous[i] == data[done + i]) continue;
+      uploadDiff.identical = false;
+      uploadDiff.changedBytes++;
+      if (uploadDiff.regional) uploadDiffMark(diffOffset + done + i);
+    }
+    done += n;
+  }
+  diffOffset += length;
+}
+
+// Grows the last region or opens a new one; rows arrive in order
+void uploadDiffMark(uint32_t offset) {
+  if (offset >= IMAGE_SIZE) {
+    uploadDiff.regional = false;
+    return;
+  }
+  uint16_t x = (offset % IMAGE_ROW_BYTES) * 2;
+  uint16_t y = offset / IMAGE_ROW_BYTES;
+  
+  if (uploadDiff.rectCount > 0) {
+    DirtyRect& r = uploadDiff.rects[uploadDiff.rectCount - 1];
+    if (y < r.y + r.h + UPLOAD_DIFF_GAP_ROWS || uploadDiff.rectCount == UPLOAD_DIFF_MAX_RECTS) {
+      uint16_t x1 = max(r.x + r.w, x + 2);
+      r.x = min(r.x, x);
+      r.w = x1 - r.x;
+      r.h = y + 1 - r.y;
+      return;
+    }
+  }
+  uploadDiff.rects[uploadDiff.rectCount++] = {x, y, 2, 1};
+}
+
+void uploadDiffEnd() {
+  if (!diffFile) return;
+  // A shorter upload changed the tail too; the new file must be raw as well
+  if (diffOffset != diffFile.size()) uploadDiff.identical = false;
+  if (diffOffset != IMAGE_SIZE || uploadDiff.changedBytes == 0) uploadDiff.regional = false;
+  diffFile.close();
+}
+
+/* ========================================
+   JPEG UPLOAD
+   ======================================== */
+
+/*
+ * A JPEG comes through the ring of blocks like any upload, but the writer
+ * task hands the blocks to JpegDecoder and stores the dithered rows it
+ * returns. The photo itself never reaches flash, so its size only costs
+ * upload time; the digest and the diff see the frame, as for raw uploads.
+ */
+FlashJobCommand jpegUploadDecode() {
+  jpegBlock = -1;
+  jpegOffset = 0;
+  jpegLength = 0;
+  jpegEnd = FLASH_JOB_WRITE;
+  
+  uint32_t start = millis();
+  JpegDecoder decoder;
+  JRESULT result = JDR_INTR;
+  if (flashWriterOk) {
+    result = decoder.decode(jpegUploadRead, jpegUploadWrite, nullptr, uploadDither, ditherPalette(uploadPalette),
+                            IMAGE_WIDTH, IMAGE_HEIGHT);
+  }
+  uint32_t elapsedMs = millis() - start;
+  jpegStats.width = decoder.sourceWidth();
+  jpegStats.height = decoder.sourceHeight();
+  jpegStats.scale = decoder.scale();
+  jpegStats.orientation = decoder.orientation();
+  jpegStats.oriented = decoder.orientationApplied();
+  jpegStats.rows = decoder.rows();
+  jpegStats.memoryBytes = decoder.memoryBytes();
+  jpegStats.decodeMs = elapsedMs > jpegStats.waitMs ? elapsedMs - jpegStats.waitMs : 0;
+  
+  // Result first: the web server stops sending once flashWriterOk drops
+  jpegStats.result = result;
+  if (result != JDR_OK && flashWriterOk) {
+    Serial.printf("✗ ERROR: JPEG decoder failed (%d)\n", result);
+    flashWriterOk = false;
+  }
+  
+  // The rest of the upload (trailing bytes, or all of it after an error)
+  if (jpegBlock >= 0) {
+    uint8_t block = jpegBlock;
+    xQueueSend(flashFreeBlocks, &block, portMAX_DELAY);
+    jpegBlock = -1;
+  }
+  while (jpegEnd == FLASH_JOB_WRITE) {
+    FlashJob job;
+    if (xQueueReceive(flashJobs, &job, portMAX_DELAY) != pdTRUE) continue;
+    if (job.command == FLASH_JOB_WRITE) {
+      xQueueSend(flashFreeBlocks, &job.block, portMAX_DELAY);
+    } else {
+      jpegEnd = job.command;
+    }
+  }
+  return jpegEnd;
+}
+
+// Writer task: the next bytes of the upload, straight from the ring;
+// 0 once the web server closed or aborted it
+size_t jpegUploadRead(void* context, uint8_t* buffer, size_t length) {
+  size_t done = 0;
+  while (done < length) {
+    if (jpegBlock < 0) {
+      if (jpegEnd != FLASH_JOB_WRITE) break;
+      FlashJob job;
+      uint32_t start = millis();
+      if (xQueueReceive(flashJobs, &job, portMAX_DELAY) != pdTRUE) continue;
+      jpegStats.waitMs += millis() - start;
+      if (job.command != FLASH_JOB_WRITE) {
+        jpegEnd = job.command;
+        break;
+      }
+      jpegBlock = job.block;
+      jpegOffset = 0;
+      jpegLength = job.length;
+    }
+    
+    size_t n = jpegLength - jpegOffset;
+    if (n > length - done) n = length - done;
+    if (buffer) memcpy(buffer + done, flashRing[jpegBlock] + jpegOffset, n);  // nullptr: skip
+    jpegOffset += n;
+    done += n;
+    if (jpegOffset == jpegLength) {
+      uint8_t block = jpegBlock;
+      xQueueSend(flashFreeBlocks, &block, portMAX_DELAY);
+      jpegBlock = -1;
+    }
+  }
+  return done;
+}
+
+bool jpegUploadWrite(void* context, const uint8_t* row, size_t length) {
+  return flashWriterStore(row, length);
+}
+
+String jpegUploadReport() {
+  char report[256];
+  if (jpegStats.result != JDR_OK) {
+    snprintf(report, sizeof(report), "decoder failed (%d)", jpegStats.result);
+    return String(report);
+  }
+  uint32_t decodeMs = jpegStats.decodeMs ? jpegStats.decodeMs : 1;
+  char orientation[48] = "";
+  if (jpegStats.orientation != 1) {
+    snprintf(orientation, sizeof(orientation), jpegStats.oriented ? ", EXIF orientation %u" :
+             ", EXIF orientation %u NOT applied (no memory)", jpegStats.orientation);
+  }
+  snprintf(report, sizeof(report),
+           "%ux%u at 1/%u%s, %s, %s colors, %u rows in %u ms (%u rows/s), "
+           "waited %u ms for data, %u bytes working memory",
+           jpegStats.width, jpegStats.height, 1u << jpegStats.scale, orientation, DITHER_ALGORITHM_IDS[uploadDither],
+           DITHER_PALETTE_IDS[uploadPalette],
+           jpegStats.rows, jpegStats.decodeMs, (unsigned)((uint32_t)jpegStats.rows * 1000 / decodeMs),
+           jpegStats.waitMs, jpegStats.memoryBytes);
+  return String(report);
+}
+
+/* ========================================
+   RENDER TASK
+   ======================================== */
+
+/*
+ * Panel refreshes take tens of seconds, so they run in their own task and
+ * loop() keeps serving requests. Latest wins: the queue holds one job and
+ * a render always reads the current IMAGE_FILE, so any number of uploads
+ * during a refresh cause exactly one more refresh. The task shares core 1
+ * with loop() at a lower priority, so a request is served as soon as it
+ * arrives and core 0 stays free for the flash writer during uploads.
+ */
+bool startRenderTask() {
+  renderJobs = xQueueCreate(1, sizeof(RenderJob));
+  displayMutex = xSemaphoreCreateMutex();
+  imageFileMutex = xSemaphoreCreateMutex();
+  if (!renderJobs || !displayMutex || !imageFileMutex) {
+    renderJobs = nullptr;
+    return false;
+  }
+  return xTaskCreatePinnedToCore(renderTask, "render", 8192, nullptr, RENDER_PRIORITY,
+                                 nullptr, RENDER_CORE) == pdPASS;
+}
+
+void renderTask(void* parameter) {
+  RenderJob job;
+  for (;;) {
+    if (xQueueReceive(renderJobs, &job, portMAX_DELAY) != pdTRUE) continue;
+    
+    char path[LIBRARY_PATH_SIZE] = IMAGE_FILE;
+    if (job.imageId != RENDER_UPLOADED_IMAGE) libraryImagePath(job.imageId, path);
+    
+    xSemaphoreTake(displayMutex, portMAX_DELAY);
+    if (job.rectCount) {
+      displayRegionsFromSPIFFS(path, job.rects, job.rectCount);
+    } else {
+      displayImageFromSPIFFS(path);
+    }
+    panelImageId = job.imageId;
+    xSemaphoreGive(displayMutex);
+    
+    if (renderState == RENDER_REFRESHING) {
+      lastRefreshMs = millis() - renderPhaseStart;
+    }
+    renderCount++;
+    setRenderState(RENDER_IDLE);
+  }
+}
+
+void queueRender(int32_t imageId, const DirtyRect* rects, uint8_t rectCount) {
+  renderRequests++;
+  RenderJob job = {};
+  job.imageId = imageId;
+  // Regions only describe the upload relative to what the panel shows now
+  if (imageId == RENDER_UPLOADED_IMAGE && rects && rectCount) {
+    job.rectCount = rectCount;
+    memcpy(job.rects, rects, rectCount * sizeof(DirtyRect));
+  }
+  if (!renderJobs) {
+    char path[LIBRARY_PATH_SIZE] = IMAGE_FILE;
+    if (imageId != RENDER_UPLOADED_IMAGE) libraryImagePath(imageId, path);
+    if (job.rectCount) {
+      displayRegionsFromSPIFFS(path, job.rects, job.rectCount);
+    } else {
+      displayImageFromSPIFFS(path);
+    }
+    panelImageId = imageId;
+    if (renderState == RENDER_REFRESHING) {
+      lastRefreshMs = millis() - renderPhaseStart;
+    }
+    renderCount++;
+    setRenderState(RENDER_IDLE);
+    return;
+  }
+  if (xQueueSend(renderJobs, &job, 0) != pdTRUE) {
+    // Latest wins, as a full refresh: the regions were relative to the panel,
+    // which will show the queued image first
+    job.rectCount = 0;
+    xQueueOverwrite(renderJobs, &job);
+    renderCoalesced++;
+    Serial.printf("Refresh already queued, it will show the new image (%u merged)\n",
+                  (unsigned)renderCoalesced);
+  }
+}
+
+// An upload interrupted between removing IMAGE_FILE and the rename leaves
+// a complete temp file; anything else in it is a partial upload
+void recoverImageFile() {
+  if (!SPIFFS.exists(IMAGE_TEMP_FILE)) return;
+  if (!SPIFFS.exists(IMAGE_FILE) && SPIFFS.rename(IMAGE_TEMP_FILE, IMAGE_FILE)) {
+    Serial.println("✓ Recovered image from an interrupted upload");
+  } else {
+    SPIFFS.remove(IMAGE_TEMP_FILE);
+  }
+}
+
+void lockImageFile() {
+  if (imageFileMutex && !imageFileLocked) {
+    xSemaphoreTake(imageFileMutex, portMAX_DELAY);
+    imageFileLocked = true;
+  }
+}
+
+void unlockImageFile() {
+  if (imageFileLocked) {
+    imageFileLocked = false;
+    xSemaphoreGive(imageFileMutex);
+  }
+}
+
+void setRenderState(RenderState state) {
+  renderState = state;
+  renderPhaseStart = millis();
+  if (state == RENDER_LOADING) renderProgress = 0;
+  if (state == RENDER_REFRESHING) renderProgress = RENDER_LOAD_SHARE;
+}
+
+bool renderBusy() {
+  bool pending = renderJobs && uxQueueMessagesWaiting(renderJobs) > 0;
+  return renderState != RENDER_IDLE || pending;
+}
+
+String renderStatusJson() {
+  bool pending = renderJobs && uxQueueMessagesWaiting(renderJobs) > 0;
+  RenderState state = renderState;
+  uint32_t progress = renderProgress;
+  
+  const char* name = "idle";
+  if (state != RENDER_IDLE) {
+    name = "rendering";
+  } else if (pending) {
+    name = "queued";
+  } else if (flashSession) {
+    name = "busy";  // Upload being written to flash
+  }
+  
+  // The refresh itself reports nothing, so estimate it from the last one
+  if (state == RENDER_REFRESHING) {
+    uint32_t expected = lastRefreshMs ? lastRefreshMs : RENDER_REFRESH_ESTIMATE_MS;
+    uint32_t elapsed = millis() - renderPhaseStart;
+    progress = RENDER_LOAD_SHARE + (100 - RENDER_LOAD_SHARE) * (uint64_t)elapsed / expected;
+    if (progress > 99) progress = 99;
+  } else if (state == RENDER_IDLE) {
+    progress = pending ? 0 : 100;
+  }
+  
+  char json[320];
+  snprintf(json, sizeof(json),
+           "{\"state\":\"%s\",\"step\":\"%s\",\"progress\":%u,\"pending\":%s,"
+           "\"uploading\":%s,\"queueDepth\":%u,\"requests\":%u,\"coalesced\":%u,"
+           "\"renders\":%u,\"skipped\":%u,\"lastRefreshMs\":%u,"
+           "\"frameCache\":{\"frames\":%u,\"hits\":%u,\"misses\":%u}}",
+           name, state == RENDER_LOADING ? "loading" : state == RENDER_REFRESHING ? "refreshing" : "",
+           (unsigned)progress, pending && state != RENDER_IDLE ? "true" : "false",
+           flashSession ? "true" : "false", pending ? 1u : 0u, (unsigned)renderRequests,
+           (unsigned)renderCoalesced, (unsigned)renderCount, (unsigned)renderSkipped,
+           (unsigned)lastRefreshMs, frameCacheSize, (unsigned)frameCacheHits,
+           (unsigned)frameCacheMisses);
+  return String(json);
+}
+
+/* ========================================
+   IMAGE CACHE
+   ======================================== */
+
+/*
+ * Every stored image is identified by its ImageDigest (truncated SHA-256
+ * and size), as in the library index. An upload that replaces IMAGE_FILE
+ * moves the previous image aside instead of deleting it, so going back to
+ * a recent picture needs no transfer: the web interface asks with
+ * HEAD /image/<hash> first and only uploads after a 404. Cached files are
+ * named after the hash and are the first to go when an upload needs the
+ * space.
+ */
+void imageCachePath(const ImageDigest& digest, char* path) {
+  path[0] = '/';
+  path[1] = 'c';
+  for (uint8_t i = 0; i < IMAGE_DIGEST_SIZE; i++) {
+    snprintf(path + 2 + 2 * i, 3, "%02x", digest.hash[i]);
+  }
+  strcpy(path + 2 + IMAGE_DIGEST_HEX, ".bin");
+}
+
+// Picks up the files cached before the reboot; their age is lost. Files
+// of the CRC-32 cache (/cXXXXXXXX.bin) cannot be matched and are dropped.
+void imageCacheBegin() {
+  File root = SPIFFS.open("/");
+  for (File f = root.openNextFile(); f; f = root.openNextFile()) {
+    char path[LIBRARY_PATH_SIZE];
+    strncpy(path, f.path(), sizeof(path) - 1);
+    path[sizeof(path) - 1] = '\0';
+    size_t length = strlen(path);
+    ImageDigest digest;
+    digest.size = f.size();
+    f.close();
+    bool cached = length == 2 + IMAGE_DIGEST_HEX + 4 && strncmp(path, "/c", 2) == 0 &&
+                  strcmp(path + length - 4, ".bin") == 0 && parseDigestHash(path + 2, digest.hash);
+    unsigned crc;
+    bool crcCached = length == 14 && sscanf(path, "/c%8x.bin", &crc) == 1;
+    if (cached && imageCacheCount < IMAGE_CACHE_SLOTS) {
+      imageCache[imageCacheCount++] = digest;
+    } else if (cached || crcCached) {
+      SPIFFS.remove(path);
+    }
+  }
+  if (imageCacheCount) Serial.printf("✓ Image cache: %u images\n", imageCacheCount);
+}
+
+int8_t imageCacheFind(const ImageDigest& digest) {
+  for (uint8_t i = 0; i < imageCacheCount; i++) {
+    if (imageCache[i] == digest) return i;
+  }
+  return -1;
+}
+
+void imageCacheDrop(uint8_t slot) {
+  char path[LIBRARY_PATH_SIZE];
+  imageCachePath(imageCache[slot], path);
+  SPIFFS.remove(path);
+  memmove(&imageCache[slot], &imageCache[slot + 1], (imageCacheCount - slot - 1) * sizeof(ImageDigest));
+  imageCacheCount--;
+}
+
+// Evicts the oldest cached images until `bytes` fit; false if they still do not
+bool imageCacheMakeRoom(size_t bytes) {
+  while (SPIFFS.totalBytes() - SPIFFS.usedBytes() < bytes && imageCacheCount > 0) {
+    imageCacheDrop(0);
+  }
+  return SPIFFS.totalBytes() - SPIFFS.usedBytes() >= bytes;
+}
+
+// IMAGE_FILE locked: the image about to be replaced by newDigest moves into
+// the cache, unless it is the same picture or the library has a copy
+void imageCacheKeepCurrent(const ImageDigest& newDigest) {
+  int8_t slot = imageCacheFind(newDigest);
+  if (slot >= 0) imageCacheDrop(slot);  // Becomes IMAGE_FILE again
+  
+  ImageDigest digest;
+  if (!currentImageDigest(digest) || digest == newDigest || imageCacheFind(digest) >= 0 ||
+      library.findDigest(digest) >= 0) {
+    return;
+  }
+  if (imageCacheCount == IMAGE_CACHE_SLOTS) imageCacheDrop(0);
+  char path[LIBRARY_PATH_SIZE];
+  imageCachePath(digest, path);
+  if (SPIFFS.rename(IMAGE_FILE, path)) imageCache[imageCacheCount++] = digest;
+}
+
+// IMAGE_FILE locked: source becomes the current image
+bool replaceImageFile(const char* source, const ImageDigest& digest) {
+  imageCacheKeepCurrent(digest);
+  SPIFFS.remove(IMAGE_FILE);  // SPIFFS cannot rename over a file
+  imageFileDigest = digest;
+  imageFileDigestKnown = SPIFFS.rename(source, IMAGE_FILE);
+  return imageFileDigestKnown;
+}
+
+// Swaps a cached image with IMAGE_FILE
+bool imageCacheRestore(uint8_t slot) {
+  ImageDigest digest = imageCache[slot];
+  char path[LIBRARY_PATH_SIZE];
+  imageCachePath(digest, path);
+  memmove(&imageCache[slot], &imageCache[slot + 1], (imageCacheCount - slot - 1) * sizeof(ImageDigest));
+  imageCacheCount--;
+  
+  if (imageFileMutex) xSemaphoreTake(imageFileMutex, portMAX_DELAY);  // A render may be reading
+  bool restored = replaceImageFile(path, digest);
+  if (imageFileMutex) xSemaphoreGive(imageFileMutex);
+  return restored;
+}
+
+// Read once per boot, then kept up to date as IMAGE_FILE is replaced
+bool currentImageDigest(ImageDigest& digest) {
+  if (!imageFileDigestKnown) {
+    File f = SPIFFS.open(IMAGE_FILE, FILE_READ);
+    if (!f) return false;
+    imageFileDigestKnown = imageDigestFile(f, imageFileDigest);
+    f.close();
+    if (!imageFileDigestKnown) return false;
+  }
+  digest = imageFileDigest;
+  return true;
+}
+
+// index is the cache slot or the playlist position
+ImageSource findImage(const String& hash, int16_t& index) {
+  ImageDigest digest;
+  if (!parseImageDigest(hash, digest)) return IMAGE_UNKNOWN;
+  
+  ImageDigest current;
+  if (currentImageDigest(current) && current == digest) return IMAGE_CURRENT;
+  if ((index = imageCacheFind(digest)) >= 0) return IMAGE_CACHED;
+  if ((index = library.findDigest(digest)) >= 0) return IMAGE_LIBRARY;
+  return IMAGE_UNKNOWN;
+}
+
+/* ========================================
+   PLAYLIST
+   ======================================== */
+
+void finishLibraryUpload() {
+  File f = SPIFFS.open(uploadTarget, FILE_READ);
+  uint8_t format = isCompressedFile(f) ? LIBRARY_FORMAT_EPZ : LIBRARY_FORMAT_RAW;
+  f.close();
+  
+  // Same content as an image already in the playlist: keep the one stored
+  int16_t existing = library.findDigest(flashStats.digest);
+  if (existing >= 0) {
+    SPIFFS.remove(uploadTarget);
+    uint16_t id = library.entry(existing).id;
+    Serial.printf("✓ Image %u already in the library, upload dropped\n", id);
+    server.sendHeader("X-Image-Hash", imageDigestText(flashStats.digest));
+    server.send(200, "application/json", "{\"id\":" + String(id) + ",\"duplicate\":true}");
+    return;
+  }
+  
+  uint16_t id = library.nextId();
+  if (!library.add(flashStats.digest, format, uploadDurationS)) {
+    Serial.println("✗ ERROR: Cannot update the library index!");
+    SPIFFS.remove(uploadTarget);
+    server.send(500, "text/plain", "Error: Cannot update the library index");
+    return;
+  }
+  Serial.printf("✓ Added image %u to the library (%u images)\n", id, library.count());
+  int8_t cached = imageCacheFind(flashStats.digest);
+  if (cached >= 0) imageCacheDrop(cached);  // The library copy is enough
+  server.sendHeader("X-Image-Hash", imageDigestText(flashStats.digest));
+  server.send(200, "application/json", "{\"id\":" + String(id) + "}");
+}
+
+// Called from loop(): moves to the next image once the current one has had its time
+void advancePlaylist() {
+  if (library.count() == 0 || millis() - playlistShownAt < playlistDurationS * 1000UL) return;
+  
+  // Never stack a slideshow refresh on a busy panel or an upload in progress
+  if (renderBusy() || flashSession) return;
+  
+  showLibraryImage((playlistPosition + 1) % library.count());
+}
+
+// The render streams the stored file directly, nothing is copied first
+void showLibraryImage(uint16_t position) {
+  const LibraryEntry& e = library.entry(position);
+  playlistPosition = position;
+  playlistShownAt = millis();
+  playlistDurationS = e.durationS;
+  Serial.printf("Playlist: image %u (%u/%u, %u s)\n", e.id, position + 1, library.count(), e.durationS);
+  queueRender(e.id);
+}
+
+String libraryJson() {
+  String json = "{\"count\":" + String(library.count()) + ",\"max\":" + String(LIBRARY_MAX_IMAGES) +
+                ",\"position\":" + String(playlistPosition) + ",\"images\":[";
+  for (uint16_t i = 0; i < library.count(); i++) {
+    const LibraryEntry& e = library.entry(i);
+    char item[160];
+    snprintf(item, sizeof(item),
+             "%s{\"id\":%u,\"size\":%u,\"format\":\"%s\",\"duration\":%u,\"hash\":\"%s\"}",
+             i ? "," : "", e.id, (unsigned)e.size, e.format == LIBRARY_FORMAT_EPZ ? "epz" : "raw",
+             e.durationS, imageDigestText(e.digest()).c_str());
+    json += item;
+  }
+  json += "]}";
+  return json;
+}
+
+/* ========================================
+   LOW POWER
+   ======================================== */
+
+void restoreRtcState(esp_sleep_wakeup_cause_t wakeCause) {
+  if (wakeCause == ESP_SLEEP_WAKEUP_UNDEFINED || rtcState.magic != RTC_STATE_MAGIC) {
+    memset(&rtcState, 0, sizeof(rtcState));
+    rtcState.magic = RTC_STATE_MAGIC;
+    rtcState.playlistPosition = -1;
+    return;
+  }
+  // The RTC clock keeps running in deep sleep, so this is the real time asleep
+  int64_t sleptUs = rtcClockUs() - rtcState.sleptAtUs;
+  if (sleptUs > 0) rtcState.sleepMs += sleptUs / 1000;
+}
+
+// Timer wake: next slideshow image straight from flash, without Wi-Fi or the web server
+void scheduledWake() {
+  Serial.println("\n=== Scheduled Wake ===");
+  if (!SPIFFS.begin(false) || !library.begin(SPIFFS) || library.count() == 0) {
+    Serial.println("⚠ Nothing to show, starting the web interface");
+    return;
+  }
+  
+  lowPowerMode = true;  // Only low-power mode sleeps, Preferences can wait
+  initDisplay();
+  showLibraryImage((rtcState.playlistPosition + 1) % library.count());  // Inline, no render task
+  
+  uint32_t wakeToRefresh = millis();
+  rtcState.wakes++;
+  rtcState.wakeToRefreshMs += wakeToRefresh;
+  rtcState.lastWakeToRefreshMs = wakeToRefresh;
+  Serial.printf("✓ Wake to refresh: %u ms (image loaded after %u ms)\n",
+                (unsigned)wakeToRefresh, (unsigned)(wakeToRefresh - lastRefreshMs));
+  enterDeepSleep();
+}
+
+// Called from loop(): sleeps once the web interface has been idle long enough
+void sleepWhenIdle() {
+  if (!lowPowerMode || library.count() == 0) return;
+  if (millis() - lastActivityMs < LOW_POWER_AWAKE_S * 1000UL) return;
+  
+  if (renderBusy() || flashSession) return;
+  
+  enterDeepSleep();
+}
+
+// Sleeps until the current image has had its time, or the BOOT button
+void enterDeepSleep() {
+  uint32_t elapsedMs = millis() - playlistShownAt;
+  uint32_t slotMs = playlistDurationS * 1000UL;
+  uint32_t sleepMs = slotMs > elapsedMs ? slotMs - elapsedMs : 0;
+  if (sleepMs < LOW_POWER_MIN_SLEEP_S * 1000UL) sleepMs = LOW_POWER_MIN_SLEEP_S * 1000UL;
+  
+  Serial.println("Power: " + powerReport());
+  bool radio = WiFi.getMode() != WIFI_OFF;
+  if (radio) {
+    rtcState.wifiMs += millis();
+  } else {
+    rtcState.activeMs += millis();
+  }
+  rtcState.playlistPosition = playlistPosition;
+  rtcState.sleptAtUs = rtcClockUs();
+  
+  Serial.printf("Deep sleep for %u s\n", (unsigned)(sleepMs / 1000));
+  Serial.flush();
+  if (radio) {
+    WiFi.disconnect(true);
+    WiFi.mode(WIFI_OFF);
+  }
+  esp_sleep_enable_timer_wakeup((uint64_t)sleepMs * 1000ULL);
+  esp_sleep_enable_ext0_wakeup((gpio_num_t)LOW_POWER_WAKE_PIN, 0);
+  esp_deep_sleep_start();
+}
+
+void keepAwake() {
+  lastActivityMs = millis();
+}
+
+int64_t rtcClockUs() {
+  struct timeval now;
+  gettimeofday(&now, nullptr);
+  return (int64_t)now.tv_sec * 1000000LL + now.tv_usec;
+}
+
+// Measured time in each state, and the average current estimated from it
+// with the assumed POWER_* currents (the report says so)
+String powerReport() {
+  bool radio = WiFi.getMode() != WIFI_OFF;
+  uint64_t activeMs = rtcState.activeMs + (radio ? 0 : millis());
+  uint64_t wifiMs = rtcState.wifiMs + (radio ? millis() : 0);
+  uint64_t totalMs = activeMs + wifiMs + rtcState.sleepMs;
+  float averageMa = (activeMs * POWER_ACTIVE_MA + wifiMs * POWER_WIFI_MA +
+                     rtcState.sleepMs * POWER_SLEEP_UA / 1000.0f) / (totalMs ? totalMs : 1);
+  uint32_t averageWakeMs = rtcState.wakes ? rtcState.wakeToRefreshMs / rtcState.wakes : 0;
+  
+  char report[320];
+  snprintf(report, sizeof(report),
+           "%s, %u timer wakes, wake to refresh %u ms (avg %u ms), awake %u s (Wi-Fi %u s), "
+           "asleep %u s, estimated average current ~%.2f mA "
+           "(assumed %u mA awake, %u mA Wi-Fi, %u uA asleep; not measured)",
+           lowPowerMode ? "low power" : "always on", rtcState.wakes,
+           (unsigned)rtcState.lastWakeToRefreshMs, (unsigned)averageWakeMs,
+           (unsigned)((activeMs + wifiMs) / 1000), (unsigned)(wifiMs / 1000),
+           (unsigned)(rtcState.sleepMs / 1000), averageMa,
+           POWER_ACTIVE_MA, POWER_WIFI_MA, POWER_SLEEP_UA);
+  return String(report);
+}
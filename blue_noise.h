@@ -0,0 +1,282 @@
+/*
+ * Blue Noise Mask for E-Paper Photo Frame
+ * Generated by tools/blue_noise_mask.js - do not edit.
+ *
+ * Repository: https://github.com/9carlo6/E-Paper
+ * @author 9carlo6
+ * @date 2025
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (c) 2025 9carlo6
+ * All rights reserved.
+ */
+
+#ifndef BLUE_NOISE_H
+#define BLUE_NOISE_H
+
+#include <stdint.h>
+
+// Void-and-cluster (sigma 1.5), tiled over the image; 256 levels, 16 pixels each
+#define BLUE_NOISE_SIZE 64
+
+static const uint8_t BLUE_NOISE_MASK[BLUE_NOISE_SIZE][BLUE_NOISE_SIZE] = {
+  { 12,122, 44,218, 17,239,130, 24,225,115,  5,234,192,161, 69,252,
+   142, 75,218,124,184,221, 77,130, 54,216, 86, 47,107,153,184,132,
+    75,250, 30,196, 87, 16, 52, 96,  2,237, 49,193,252, 53,182,213,
+    80,249,101, 26,133,191, 36,236, 51,211, 74,239, 94,163, 36, 87},
+  { 62,196, 96,158,193, 78,163, 91,190, 46,170, 60,140, 17, 93,174,
+    36,192,239, 88, 28,143, 10,193, 25,173,237,139,205, 65, 95,230,
+    52,160,118, 58,135,229,160,186, 68,202,166, 97,  9,140,109, 23,
+   130,173, 67,201,153,225, 71,125,185,  8,135, 29, 60,190,113,216},
+  {147,243,  5,137, 59,111,212, 12,254,131, 82,208,102,222, 50,232,
+   113, 15,154, 46,175,253,106,213,153, 69,120,  3,225, 31,196, 16,
+   104,209,  1,238,170, 37,208,117,146, 22,123, 73,224,170, 68,240,
+    48,207,  9,119, 46, 94,173, 24,255,107,170,223,150,234, 20,179},
+  {107, 79,172,223, 26,242, 44,147, 64,179, 22,241, 35,183,125,204,
+    65,135,103,211, 70,122, 36, 89,241,102, 39,177, 82,164,118,243,
+   178,143, 86,185, 70,103, 10, 83,232, 42,245,152,206, 34,124,191,
+    93,142,231,184,247, 12,214,157, 85, 58,206, 43,102, 76,138, 50},
+  { 28,232, 40,122, 95,176,196,120, 97,203,157,111,144, 75,  1,159,
+    30,247,168,  5,234,149,180, 59, 13,189,211,132,247, 54,146, 78,
+    31, 50,225, 22,129,245,150,215, 61,181, 90, 19, 57,101,230,  2,
+   162, 35, 59,102, 78,138,115, 38,220,143, 15,126,195,  0,252,203},
+  {158,190, 63,210,154, 74,  1,233, 33,220, 11, 58,175,251,197, 96,
+   222, 77,189, 56, 97, 23,201,228,135,157, 64, 17,105,193,  6,218,
+   135,199,109,155,206, 55,189, 32,105,137,219,118,194,174,141, 82,
+   254,115,218,165, 28,178,199, 68,106,239,182, 66,229,165, 91,121},
+  {  9, 82,136, 15,251, 48,141,169, 61, 84,128,232, 93, 21, 51,116,
+   147, 38,125,208,138,165, 75,109, 45,251, 91,220,153, 40,238, 99,
+   174, 71,255, 43, 94, 13,118,168,252,  3,161, 70,235, 15, 46,199,
+    66,182, 15,147,230, 52,245,  8,172, 28, 87,153,114, 36, 61,221},
+  {100,244,175,106,197, 86,217,108,246,148,187, 32,202,134,166,238,
+    18,216, 84, 14,243, 43,215,  0,173,120, 31,180,127, 79,163, 55,
+    24,128,  7,166,235,141, 66,204, 85, 50,200, 33, 94,154,123,223,
+    26,134, 91,204, 73,126, 95,156,132,201, 47,246, 21,208,178,145},
+  { 27,213, 54, 32,161,123, 19, 41,193,  6,100,161, 68,223, 82,191,
+    62,177,154,109,187, 93,129,235, 84,206, 57,232, 21,199,111,208,
+   234,189,105,211, 78,181,226, 19,153,114,240,135,184,249, 61, 99,
+   160,241, 46,113,  1,186, 39,213, 75,225,107,190,137, 74,233, 47},
+  {192,153,126,237, 67,226,181,134, 74,209, 54,250,115, 42,  9,107,
+   131,248, 46,222, 65, 29,155,191, 26,139,162, 98, 68,250, 11,143,
+    87, 35,137, 56, 26,103, 42,129,216, 65,174, 12, 80, 38,211,  8,
+   191, 71,215,167,251,143,233, 18,118, 59,  3,169, 91, 12,127,107},
+  { 65,  2, 81,203, 12, 98, 52,156,235,119,171, 20,141,204,155,233,
+    34, 95,  4,140,169,255, 55,112, 72,245,  7,194,135,159, 46,181,
+    64,216,160,248,199,151,244,172, 94, 29,228,106,196,127,169,110,
+   145, 35,129, 22, 58,105, 80,159,180,253,150, 42,237,200,161,250},
+  {177,227,109,167,144,189,245, 21, 93, 31,219, 77,238, 92,184, 67,
+   212,172,197, 78,121,204, 10,217,179, 44,219,116, 32,225, 96,123,
+   237,  1,112, 81, 16,119, 61,  4,194,125, 46,158, 62,222, 27,244,
+    81,227,179, 87,211,191, 46,205, 31, 71,126,216,112, 57, 30, 88},
+  { 44,133, 20,255, 41, 76,114,202, 64,184,130,158,  0, 51,123, 15,
+   147,118, 53,225, 20,100,149, 81,124,156, 91, 59,180, 79,203, 25,
+   149,194, 50,171,220,186, 85,234,160, 71,254,205,  0,144, 93, 50,
+   198,  5,112,240,148, 12,115,137,230,100,191, 17, 79,182,139,220},
+  {156,198, 61, 94,214,136,  3,162,232,103, 41,200,110,178,216,251,
+    87, 26,240,153, 41,189,232, 33,241, 14,202,253,145,  5,164,248,
+    71,101,229,132, 30,146, 44,109,217, 17,136, 84,114,233,187,159,
+   124, 61,162, 42, 72,174,246, 86,  5,173, 48,244,159,210,  8,104},
+  { 24,236,171,119, 27,179,224, 51,145, 14,253, 66,226, 81, 36,165,
+    57,207,105,180, 85,129, 58,173,105, 67,130, 27,110,231, 53,114,
+    34,177, 13, 74, 97,251,198, 25,143, 93,183, 30,173, 42, 74, 16,
+   250,205, 98,225,128, 32,214, 59,156,219,133, 94, 34,115,247, 73},
+  {128, 51, 81,206,241, 68, 96,124,195, 83,173,138, 23,152,127, 97,
+   189,139,  2, 67,250,203,  7,143,197,224,167,189, 42, 91,199,131,
+   219,145,241,191,162, 62,122,176, 55,201,225, 60,246,132,217,108,
+   141, 32,175, 14,196, 82,144,186,113, 22, 66,202,149, 62,167,191},
+  {220,152,  5,138, 45,155, 16,247, 34,220,120, 53,188,245,  8,231,
+    33,218,120,163, 27,108,226, 92, 46, 23, 86, 61,218,151,179, 10,
+    84, 58,109, 43,213,  6,231, 79,245,  9,119,162, 98, 21,193, 56,
+   228, 90, 65,148,255,106,  9, 45,242, 88,230,180,  0,232, 43, 91},
+  {112,249,183,102,196,114,171,189, 70,105,  5,213, 77,107,158, 65,
+   172, 79,233, 52,186,135, 69,164,249,113,157,241,126, 20, 72,239,
+   155,207, 24,126,150, 93, 37,168,102,155, 40, 74,209,148, 85,164,
+     3,183,209,117, 51,170,221,200,138,164, 33,123, 99,136,213, 14},
+  { 38, 74, 21,231, 33,220, 83, 48,134,165,242,145, 31,205, 46,195,
+   114, 15,148, 95,240, 39,214, 19,187,139,  0,204, 36,109,224, 48,
+   101,183,253, 81,226,189,139,219, 23,131,236,188,  6,241, 37,112,
+   248,128, 35,229, 21, 75,123, 95, 17, 73,211, 49,254, 76,184,161},
+  {204,174,134, 90, 64,146,  6,234,203, 20, 87,183,126,232, 90,135,
+   254, 41,178,208, 10,151, 84,123, 57,220, 74, 98,166,195,140,171,
+    31,131,  2,167, 55, 18,114, 50,202, 85,169,107, 57,122,176,202,
+    53, 78,156, 98,179,239,157, 56,249,175,108,152,193, 21, 58,123},
+  {100, 52,212,160,253,199,125, 96,153, 60,219, 40, 69, 10,167, 23,
+   204, 85,129, 60,112,171,200,238,104, 34,176,255, 54, 82,  8,243,
+    90,196, 69,117,203,235, 76,179,251, 63, 16,224,142,214, 71, 15,
+   139,215,  9,194,134, 39,  2,188,128, 30,225,  9, 87,229,146,244},
+  {  3,227, 31,116, 14, 55,182, 37,247,118,170,103,250,150,214,110,
+    64,185,229, 27,244, 72, 46,  7,150,197,128, 15,150,222,119, 60,
+   210,151,231, 38,142, 99,160,  4,145,121,195, 45, 90, 29,155,228,
+    91,170,235, 57, 83,212,106,232, 84,202, 63,139,171,112, 35, 80},
+  {156,126,192, 71,176,108,225, 77, 24,190,  2,140,195, 79, 46,242,
+   142,  1,160, 92,144,219,130,180, 89,225, 50,112,202, 30,181,137,
+    41, 15, 94,175, 23,246, 44,207, 95, 32,238,158,184,254,105,191,
+    44,121, 29,111,246,146, 66,166, 43,154,103,245, 47,196,217,179},
+  { 60,242, 88,143,239, 21,151,131,215, 89,238, 56, 26,124,171, 94,
+    35,210,117, 43,188, 14,103,249, 62, 26,165,238, 73,101,247, 80,
+   169,238,126,218, 79,186,124, 68,228,174, 78,114,  1, 60,130, 18,
+   239, 67,154,181, 11,198, 22,116,215,  5,186, 23,127, 70, 14,104},
+  {207, 39, 10,213, 45, 92,201, 58,164, 42,149,117,208,230, 10,191,
+   234, 80,174,251, 64,209, 36,157,204,142, 84,187, 41,158,  2,216,
+   111, 67,192, 53,110, 18,216,151, 11,135, 52,212,149,199, 82,177,
+   142,197,224, 76,127, 53,174,251, 75,133,236, 85,219,153,250,136},
+  {187,158,105,179,122,168,235,  7,106,184,223, 73,161,100, 63,152,
+   129, 58, 22,137,110,168, 81,118,  3,231,124, 14,212,131, 55,186,
+    29,157, 10,144,242,166, 56,102,197,250, 21, 96,231, 33,244, 48,
+    94,  4, 40,100,209,231, 88,139, 29,172, 59,111,168, 44, 91, 27},
+  { 72,224, 53,252, 69, 32, 81,127,250, 28, 96, 12, 40,178,253, 27,
+   108,223,199, 89,230, 18,243,183, 48,100, 67,252,172,110,236,141,
+    93,254,201, 41, 88,128,233, 36, 82,180,118,165, 70,140,109,165,
+   217,118,253,164, 24,149, 39,194,101,224, 38,190,  9,202,233,117},
+  {  1,125,147, 16,191,140,220,177, 66,200,141,242,206,135, 79,210,
+    48,158,  6,179, 39,152, 58,131,222,194,150, 44, 89, 24, 74,198,
+    46,122, 77,218,176,  5,205,114,155, 60,216, 40,188,  7,223, 25,
+    63,180,132, 59,190,113, 69,238, 16,149,207,129, 78,143, 53,165},
+  {245, 83,206, 96,230,110, 13,156, 48,117,168, 83, 55,115,  4,185,
+   140,246,102, 61,218,113,207, 89, 30,164, 18,205,228,146,177,  7,
+   221,164, 19,107,151, 67,183, 27,239, 11,136,246, 86,128,196,152,
+    82,202, 18, 91,241,  0,211,158,120, 63, 92,255, 32,221, 98,197},
+  { 44,178, 26,164, 41, 61,207, 92,236,  1,217, 30,193,154,226, 96,
+    31, 74,192,133,166, 78,  8,143,244,110, 78,130, 99, 49,247,104,
+   133, 63,187,228, 33,250, 86,127,168, 74,198,108, 28,230, 51,102,
+   246, 37,155,222,137,176, 85, 47,185,227,  5,154,114,176, 18,138},
+  {113,226, 65,130,248,184,147, 33,181, 73,133,102,236, 19, 64,172,
+   234,120, 12,238, 29,227,194, 45,176, 60,223,191, 12,159, 71,207,
+    37,243, 87,125, 55,142,212, 43,225, 98, 49,175,155, 67,182, 11,
+   126,209,109, 52, 75, 29,126,249, 97, 35,169, 72,200, 56,237, 76},
+  { 14,151,211,105, 20, 80,122,223,108,255,163, 42,179, 90,126,214,
+    52,159,205, 94, 53,121,158, 97,209,  0,141, 38,240,184,121, 19,
+   169,144,  1,205,174, 18,106,188,  3,147,208, 16,242,116,212,148,
+    73,170,  6,192,163,229,198, 15,144,215,118,241, 22, 95,161,190},
+  {253, 92, 50,188,140,237, 10, 56,152, 24, 61,208,141,248, 37,146,
+   104, 25, 72,178,145,246, 18, 70,117,255,166, 87,111, 57,222, 80,
+   194, 51,235,101, 75,244,156, 70,119,254, 83,130, 41, 89, 21,240,
+    47,224, 93,252,117, 43,101,172, 58, 81,189, 48,147,228,123, 39},
+  {136,176,  5,229, 66,161,200, 94,214,187, 85,119, 16, 72,200,  8,
+   186,252,127,218, 36, 85,187,230,134, 25, 66,203,152, 30,137,252,
+    95,118,161, 33,130,198, 48,232, 26,177, 54,220,192,165,135,104,
+   197, 32,141, 63, 20,152, 73,204,235,  9,135,102,208,  2, 65,216},
+  { 26, 77,204, 99, 37,113,175, 42,133,  6,230,169,218,112,155, 87,
+   221, 62,165,  3,108,211, 57,169, 40,192,105,237,  8,216,178, 43,
+    11,211, 68,226,177,  9, 91,136,202,103,159,  7, 73,235, 56,177,
+    79,159,120,210,182,242,129, 28,116,161,249, 30,170, 84,186,107},
+  {243,164,119,151,250, 22,219, 75,247,106,144, 33, 54,185,244, 42,
+   121, 29, 96,240,180,128, 13, 98,152,223, 50,170,122, 72, 99,162,
+   131,185, 24,142, 54,113,215,165, 40, 77,240,144,117, 31,208,  3,
+   248, 19,228, 88, 53,  2,167,222, 84, 42,197, 71,126,240,154, 45},
+  { 63,215, 16, 55,182, 89,128,156, 25,202, 71,240, 99,  2, 66,172,
+   139,204,151, 44, 67,148,250,199, 77, 19,139, 83, 35,201,242, 59,
+   220, 79,247, 96,195,237, 68, 16,229,129, 20,213,183, 97,153,131,
+   109,189, 38,148,112,206, 95, 56,185,140, 97,223, 54, 20,211,139},
+  {188, 91,236,135,207,  0,237, 61,181, 47,161,125,205,148,228,103,
+    14,236, 80,194,221, 31,116, 53,236,111,204,251,181,146,  5,109,
+    33,152,117,  3,163, 34,149,184,106,195, 62, 88, 46,243, 69,222,
+    52,163, 75,240,187, 33,136,252, 23,213,  8,145,179,110, 87,  9},
+  {127, 37,110, 74,162, 45,196,116, 92,234, 12, 85,180, 24, 81,215,
+   183, 58,114,  8,167, 83,186,  4,175,157, 60, 13, 94, 49,130,233,
+   177,202, 47,229, 80,123,251, 84, 45,160,248,138,164, 10,194, 30,
+    92,201,132,  8, 64,223,159, 77,115,162, 63,246, 38,197,228,166},
+  {252,199,175, 27,218, 96,149, 21,218,134,172, 38,252,118, 48,127,
+    29,162,254,135,104,232,142,214, 93, 32,128,216,163,225,194, 85,
+    23, 69,139,209,171, 54, 12,141,221,  2,111, 32,208,104,126,171,
+   255, 22,215, 98,176,121, 14,196, 47,228,100,171, 79,123, 28, 70},
+  { 53,  5,147,233, 54,124,254, 77,192, 58,103,211, 64,157,232,198,
+   144, 94, 43,209, 20, 62, 37,120, 69,243,192, 76,114, 25, 63,170,
+   125,255, 97, 18,108,186,214, 98,192, 60,230,180, 71,234, 40, 78,
+   143,107, 54,153,244, 41, 92,234,129, 17,205,134,  3,237,154,102},
+  {139,210, 77,104,186,  9,171, 40,154,  4,239,143, 17,187, 92,  4,
+    69,227,188, 76,173,246,200,156,224, 11,142, 43,249,149,100,236,
+    13,161,193, 42,240,148, 69, 33,124,155, 90,132, 13,148,190,219,
+     0,237,182, 28, 72,205,168,145, 70,189, 36, 90,212, 48,186,222},
+  { 88,169, 21,133,239, 66,211,113,229, 87,121,201, 77,112, 39,248,
+   170,116, 12,149,123, 88, 24,106, 47,178,101,169,  3,209, 47,201,
+   117, 59,222, 89,132, 22,227,166,243, 18,200, 45,250, 94, 58,115,
+   165, 68,125,221,138,109,  3, 50,242,112,158,255,143, 74,115, 17},
+  {248,119,224, 43,158, 92,140, 19,182, 47,167, 24,244,175,207,133,
+    52,210, 34,238, 49,193,168,138,210, 84,238,125, 70,180,132, 28,
+    81,144,  0,180, 55,199, 86,111, 52, 77,219,116,158,182, 25,203,
+    37, 96,200, 14, 86,249,177,213, 83, 23,181, 57, 13,197,157, 39},
+  { 56,201, 71,189, 26,203, 52,249,101,213, 70,131, 45,147, 13,100,
+   159, 80,183, 98,214,  0, 68,228, 17, 61,198, 23,227, 89,218,162,
+   246,191,101,156,248,122,  6,212,186,136,173, 29, 64,222,133,243,
+   145,227, 52,158,188, 61, 35,125,151,201,100,127,221, 93,236,181},
+  {102,  4,148,109,244,124,169, 78,146,  7,235,196, 90,227, 59,217,
+    26,233,136, 59,146,115,252, 90,129,163, 37,149,114, 54,  8,106,
+    63, 39,227, 25, 75,175,150, 37,254, 11,100,239, 86, 11,107, 76,
+     7,174,121, 29,233,145,101,230, 17, 64,214, 40,170, 67, 26,134},
+  { 78,233,177, 51, 83,  8,221, 33,188,117,156, 30,108,166, 79,128,
+   178,113, 10,244,165, 27,181, 45,203,241, 98,189,253,173,140,235,
+   178,134,208,117, 47,235,102, 63,125,162, 56,189,145,205,167, 54,
+   193, 91,253, 68,111,  6,198, 76,175,239,136,  0,249,109,150,211},
+  {167,124, 22,210,134,190,106, 62,239, 86, 54,184,255,  2,198,241,
+    38, 67,205, 87, 42,217,102,153,  7,119, 64, 16, 80, 41,210, 30,
+    78, 14, 90,146,198, 19,215,181, 80,206, 32,229,120, 42,248,129,
+   219, 36,142,203,172,220, 41,159,116, 50, 95,155,188, 52,227, 14},
+  { 49,254, 68,154,234, 28,162,139,206, 13,222,137, 69,120, 25,141,
+    95,228,171,121,192, 73,135,225, 81,168,231,136,201,160, 96,126,
+   195,159,252, 60,167, 86,138, 26,226,111,140, 73, 17,182, 81, 23,
+   160,105, 14, 83, 53,133, 93,251, 10,195,220, 74, 27,130, 87,193},
+  {115, 93,182, 39, 98, 75,251, 46,121,172,102, 35,156,218, 56,190,
+   160, 17, 51,145,  6,236, 22, 56,193, 28,209, 49,114, 12,245, 51,
+   217,112, 37,228,  6,121,248, 50,154,  1,245,173,100,216,116,233,
+    66,183,242,151,226, 18,187, 70,143, 35,167,120,207,238,162, 32},
+  {147,201,  2,226,119,195,  7,181, 79, 23,243,204, 88,173,106,248,
+    72,115,200,253,100,157,183,118,250,104,148, 89,178,221, 67,144,
+     3, 72,185,101,194, 66,172,105,191, 89, 45,201, 60,156,  7,137,
+    48,210,120, 38,168,107,208,124,230, 84,246, 57,  6, 99, 64,219},
+  {244, 76,131,169, 52,144,215,103,227,160, 64,127,  9,235, 44, 25,
+   133,223, 83, 34, 61,214, 91, 38,161, 68,  1,242, 34,154, 99,190,
+   235,168,132, 28,148,212, 33,234, 63,221,163,129, 29,253, 88,194,
+   163, 95,  3, 78,237, 63, 29, 51,179, 20,107,146,177,200,134, 13},
+  {101, 55,217, 19,247, 71, 31,130, 51,197,144, 40,185, 76,143,213,
+   168,  1,185,142,175,127, 13,229,132,188,214,119, 58,202, 22,120,
+    43, 90,222, 55,245, 82,129, 15,147,116, 19,238,104,187, 43,222,
+    20,249,148,202,131,184,147,220, 92,157,212, 39,241, 82, 44,174},
+  {194, 34,159, 88,108,175,151,240, 89,  0,252, 99,220,114,196, 65,
+    99, 49,232,105, 25,241, 82,199, 55, 19, 85,171,227,137, 79,255,
+   157, 16,203,117,  9,164, 97,207,178, 41, 84,210, 65,149,127, 75,
+   112, 62,178, 49, 99, 12,254,113,  2,192, 73,130, 15,111,232,150},
+  {121,211,138,231,193, 43,206, 19,180,119, 71,171, 27,154, 13,246,
+   124,206,155, 68,190, 51,140,165,101,243,149, 38,103,  6,181,210,
+    65,134,179, 77,229,188, 36,253, 69,198,137,174,  6,231, 25,168,
+   206,136,227, 31,212, 83,170, 67,138,243, 50,223,163,190, 62, 22},
+  {248, 80,  5, 64, 24,123, 95, 66,226,158,209, 48,237, 90, 57,171,
+    34, 86, 11,250,120,215,  4,226, 34,122,195, 72,247,159, 49, 95,
+    29,239,104, 45,137, 62,152,122, 11,103,234, 49,118,184, 95,242,
+    45, 16,105,159,121,229, 44,199, 28,167,120, 97, 34,136,219, 94},
+  { 50,167,116,185,245,162,215,137, 35,104, 16,141,122,190,217,138,
+   234,192,134, 40, 80,157,108, 70,181, 59,221, 21,130,205,115,232,
+   149,194,  0,165,210, 19,236, 86,218,166, 27,155, 76,217, 59,142,
+   196, 85,247, 65,187, 21,153,106,217, 84, 11,205,253, 75,  8,182},
+  {206, 27,223,141, 82, 51,  7,242,192, 56,247,201, 76,  4,104, 23,
+    72,110,163,225,183, 21,197,254,132, 10,153, 89,179, 62, 15,172,
+    41, 74,125,251, 88,113,195, 47,129, 61,243, 93,196, 32,162,  0,
+   119,175,209,  7,142, 79,245, 58,131,234,185, 56,150,172,108,128},
+  {147, 70, 97, 36,199,110,182, 73,125,155, 88,176, 38,166,254,154,
+    47,215, 18, 62, 98,142, 37, 90,168,209,111,240, 36,224, 82,128,
+   207, 99,219, 23,184, 68,157,  4,176,207,140,  8,124,255,108,231,
+    69, 31,131, 53,233, 98,195,  4,160, 37, 73,122, 20,199, 39,241},
+  {  1,174,255,156, 22,237,150, 96, 25,216,  9,115,231, 60,127,206,
+   185, 93,245,122,203,238, 57,217, 26, 78, 48,166,141,105,183,249,
+    11,163, 54,145, 40,134,214,248, 97, 35, 73,223,173, 49, 85,187,
+   152,217,107,166,204, 40,123,177, 87,208,144,242, 97,228, 63, 89},
+  {230,113, 55,212,123, 62,221, 44,169,237, 70,139,208, 97, 30, 80,
+    11,143,174, 41, 13,170,109,151,125,246,193,  1,212, 24, 51,148,
+    69,236,118,200,241, 91, 28, 59,119,198,157,103, 20,141,207, 17,
+    44, 90,251, 72, 20,152,224, 30,252,106, 10,174, 34,136,160,193},
+  { 45,137,187, 12, 82,173,  2,133,195,110, 49,185, 15,150,176,240,
+   116, 65,229, 86,132, 71,224,  6,178, 65,101,132, 81,235,198,111,
+    31,188, 84,  5,173,110,164,226,147, 13,244, 57,185,239, 67,126,
+   236,176, 11,138,186,104, 76, 57,132,183, 65,221, 83,213, 17,107},
+  {203, 28, 92,233,146,206, 99,247, 76, 27,164,249, 77,224, 50,133,
+   214, 31,197,150,249,190, 32, 92,203, 36,227,161, 59,122,167, 88,
+   224,138, 47,231, 66, 25,191, 75, 39,177, 81,212,117, 34,164, 99,
+   197, 60,116,209, 49,245,170,204, 17,231, 39,151,121, 53,180, 72},
+  {151,247,169, 66,115, 38,182, 57,150,210, 92,128, 35,110,200,  4,
+   100,166, 55,  7,103, 49,160,243,112,146, 15,188,253, 18, 42,213,
+    10,176,103,152,213,124,254,140,216,108,133, 24,153, 86,226,  4,
+   145, 35,163,230, 83,  1,113,146, 89,161,111,195,  4,251,131,226},
+};
+
+#endif
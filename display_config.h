@@ -29,6 +29,14 @@
 #define GxEPD2_DISPLAY_CLASS GxEPD2_7C
 #define GxEPD2_DRIVER_CLASS GxEPD2_565c_GDEP0565D90
 
+// Controller nibble for each color index stored in the image file
+// (0 black, 1 white, 2 green, 3 blue, 4 red, 5 yellow, 6 orange).
+// Unused indices fall back to white, like mapColorValue() does.
+static const uint8_t NATIVE_COLOR_CODES[16] = {
+  0x0, 0x1, 0x2, 0x3, 0x4, 0x5, 0x6, 0x1,
+  0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1
+};
+
 /* ========================================
    PIN CONNECTIONS ESP32 -> DISPLAY
    Modify these values for different wiring
@@ -41,16 +49,47 @@
 
 /* ========================================
    MEMORY CONFIGURATION
-   ESP32 has ~320KB RAM, using 64KB for display buffer
+   ESP32 has ~320KB RAM: the page buffer is static, the stream band is
+   taken from the heap only during a refresh
    ======================================== */
 
-#define BUFFER_SIZE 5000ul
+// Page buffer of the paged GFX render (boot screen, partial refreshes and
+// the fallback when the image cannot be streamed). GxEPD2 takes the page
+// height as a template argument, so it is a compile-time profile:
+//   DISPLAY_MEMORY_SMALL    5 KB,  16-row pages, 28 passes per refresh
+//   DISPLAY_MEMORY_MEDIUM  19 KB,  64-row pages,  7 passes
+//   DISPLAY_MEMORY_LARGE   66 KB, 224-row pages,  2 passes
+// e.g. -DDISPLAY_MEMORY_PROFILE=DISPLAY_MEMORY_LARGE, or set BUFFER_SIZE
+#define DISPLAY_MEMORY_SMALL 5000ul
+#define DISPLAY_MEMORY_MEDIUM 19200ul
+#define DISPLAY_MEMORY_LARGE 67200ul
+
+#ifndef DISPLAY_MEMORY_PROFILE
+#define DISPLAY_MEMORY_PROFILE DISPLAY_MEMORY_SMALL
+#endif
+#ifndef BUFFER_SIZE
+#define BUFFER_SIZE DISPLAY_MEMORY_PROFILE
+#endif
 
 // Calculate maximum manageable height based on memory
 // 7-color display uses 4 bits per pixel = 2 pixels per byte
 #define MAX_HEIGHT(EPD) (EPD::HEIGHT <= BUFFER_SIZE / (EPD::WIDTH / 2) ? \
                         EPD::HEIGHT : BUFFER_SIZE / (EPD::WIDTH / 2))
 
+// Native rows per band when streaming an image straight to the controller
+// (allocated only during a refresh: rows * WIDTH / 2 bytes). Every band is
+// one more pass over the image file, so by default the band is sized at
+// each refresh from the largest free heap block, leaving STREAM_HEAP_RESERVE
+// for Wi-Fi and the web server. A fixed, even row count overrides it.
+#define STREAM_BAND_ROWS 0  // 0: automatic
+#define STREAM_BAND_MIN_ROWS 16
+#define STREAM_HEAP_RESERVE 49152
+
+// Boards with PSRAM keep the last few frames in controller format
+// (WIDTH * HEIGHT / 2 bytes each), so showing one again skips the flash
+// entirely; 0 disables the cache
+#define FRAME_CACHE_FRAMES 4
+
 /* ========================================
    GLOBAL DISPLAY INSTANCE
    ======================================== */
@@ -0,0 +1,787 @@
+/*
+ * Dithering Engine for E-Paper Photo Frame
+ * Native C++ version of the conversion algorithms of the web interface.
+ * Header-only and dependency-free, shared by the firmware and the host
+ * tools. Output is bit-identical to the JavaScript in web_interface.h.
+ *
+ * Repository: https://github.com/9carlo6/E-Paper
+ * @author 9carlo6
+ * @date 2025
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (c) 2025 9carlo6
+ * All rights reserved.
+ */
+
+#ifndef DITHERING_H
+#define DITHERING_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <vector>
+
+#include "blue_noise.h"
+#include "palette_lut.h"
+
+/* ========================================
+   PALETTE & ALGORITHMS
+   ======================================== */
+
+// Same order as COLORS in web_interface.h: index = value stored in the image file
+#define DITHER_PALETTE_SIZE 7
+static const uint8_t DITHER_PALETTE[DITHER_PALETTE_SIZE][3] = {
+  {0, 0, 0}, {255, 255, 255}, {0, 255, 0}, {0, 0, 255},
+  {255, 0, 0}, {255, 255, 0}, {255, 140, 0}
+};
+
+enum DitherAlgorithm {
+  DITHER_FLOYD_STEINBERG,
+  DITHER_ATKINSON,
+  DITHER_ORDERED,
+  DITHER_NONE,
+  DITHER_BLACK_WHITE,
+  DITHER_JARVIS,
+  DITHER_STUCKI,
+  DITHER_SIERRA,
+  DITHER_SERPENTINE,
+  DITHER_BLUE_NOISE,
+  DITHER_ALGORITHM_COUNT
+};
+
+static const char* const DITHER_ALGORITHM_IDS[DITHER_ALGORITHM_COUNT] = {
+  "floyd-steinberg", "atkinson", "ordered", "none", "bw", "jarvis", "stucki", "sierra", "serpentine",
+  "blue-noise"
+};
+
+// Panel profiles, same order as PALETTES in web_interface.h
+enum DitherPalette {
+  DITHER_PALETTE_IDEAL,  // DITHER_PALETTE, nearest in RGB
+  DITHER_PALETTE_ACEP,   // Measured ACeP inks, nearest in OKLab
+  DITHER_PALETTE_COUNT
+};
+
+static const char* const DITHER_PALETTE_IDS[DITHER_PALETTE_COUNT] = {"ideal", "acep"};
+
+/*
+ * The JavaScript reference compares Euclidean distances and keeps the
+ * diffused error in sixteenths of a level, each share truncated toward
+ * zero. Both are integer arithmetic, so the same results are computed
+ * here exactly. Only Black & White needs doubles (its luma weights are not
+ * exact). Build with -ffp-contract=off so no FMA changes that path.
+ */
+
+/* ========================================
+   NEAREST COLOR
+   ======================================== */
+
+// Nearest palette entry by squared distance, the first minimum wins
+inline uint8_t findClosestColorExact(int r, int g, int b) {
+  int32_t minDist = INT32_MAX;
+  uint8_t closestIndex = 0;
+  for (uint8_t i = 0; i < DITHER_PALETTE_SIZE; i++) {
+    int32_t dr = r - DITHER_PALETTE[i][0];
+    int32_t dg = g - DITHER_PALETTE[i][1];
+    int32_t db = b - DITHER_PALETTE[i][2];
+    int32_t dist = dr * dr + dg * dg + db * db;
+    if (dist < minDist) {
+      minDist = dist;
+      closestIndex = i;
+    }
+  }
+  return closestIndex;
+}
+
+// Same, for channels scaled by 8 (ordered dithering works in 1/8 steps)
+inline uint8_t findClosestColorScaled8(int r8, int g8, int b8) {
+  int32_t minDist = INT32_MAX;
+  uint8_t closestIndex = 0;
+  for (uint8_t i = 0; i < DITHER_PALETTE_SIZE; i++) {
+    int32_t dr = r8 - DITHER_PALETTE[i][0] * 8;
+    int32_t dg = g8 - DITHER_PALETTE[i][1] * 8;
+    int32_t db = b8 - DITHER_PALETTE[i][2] * 8;
+    int32_t dist = dr * dr + dg * dg + db * db;
+    if (dist < minDist) {
+      minDist = dist;
+      closestIndex = i;
+    }
+  }
+  return closestIndex;
+}
+
+/*
+ * 32x32x32 lookup cube. A cell covers 8 values per channel; it stores the
+ * palette index when all 8 corners of the cell agree, 0xFF otherwise.
+ * The set of colors mapping to one entry is convex (an intersection of
+ * half-spaces), so a cell whose corners agree maps entirely to that entry:
+ * the lookup is exact, and only the cells crossing a boundary (about 10%)
+ * fall back to the full search.
+ */
+#ifndef DITHER_NEAREST_LUT
+#define DITHER_NEAREST_LUT 1
+#endif
+
+#define NEAREST_LUT_BITS 5
+#define NEAREST_LUT_AMBIGUOUS 0xFF
+
+struct NearestColorLut {
+  uint8_t cells[1 << (3 * NEAREST_LUT_BITS)];
+
+  NearestColorLut() {
+    const int steps = (1 << NEAREST_LUT_BITS) + 1;
+    const int cellSize = 256 >> NEAREST_LUT_BITS;
+    std::vector<uint8_t> corners(steps * steps * steps);
+    for (int r = 0; r < steps; r++) {
+      for (int g = 0; g < steps; g++) {
+        for (int b = 0; b < steps; b++) {
+          corners[(r * steps + g) * steps + b] = findClosestColorExact(
+            r * cellSize < 255 ? r * cellSize : 255, g * cellSize < 255 ? g * cellSize : 255,
+            b * cellSize < 255 ? b * cellSize : 255);
+        }
+      }
+    }
+
+    const int side = 1 << NEAREST_LUT_BITS;
+    for (int r = 0; r < side; r++) {
+      for (int g = 0; g < side; g++) {
+        for (int b = 0; b < side; b++) {
+          uint8_t first = corners[(r * steps + g) * steps + b];
+          bool uniform = true;
+          for (int corner = 1; corner < 8 && uniform; corner++) {
+            uniform = corners[((r + (corner >> 2)) * steps + g + ((corner >> 1) & 1)) * steps + b + (corner & 1)] == first;
+          }
+          cells[(r << (2 * NEAREST_LUT_BITS)) | (g << NEAREST_LUT_BITS) | b] = uniform ? first : NEAREST_LUT_AMBIGUOUS;
+        }
+      }
+    }
+  }
+
+  static const NearestColorLut& instance() {
+    static const NearestColorLut lut;
+    return lut;
+  }
+};
+
+// Channels 0..255
+inline uint8_t findClosestColor(int r, int g, int b) {
+#if DITHER_NEAREST_LUT
+  const int shift = 8 - NEAREST_LUT_BITS;
+  uint8_t cached = NearestColorLut::instance().cells[((r >> shift) << (2 * NEAREST_LUT_BITS)) |
+                                                     ((g >> shift) << NEAREST_LUT_BITS) | (b >> shift)];
+  if (cached != NEAREST_LUT_AMBIGUOUS) return cached;
+#endif
+  return findClosestColorExact(r, g, b);
+}
+
+/* ========================================
+   NEAREST COLOR - BATCH (SIMD)
+   ======================================== */
+
+/*
+ * Nearest color for a run of independent pixels, given as planar channels
+ * multiplied by `scale` (1, or 8 for ordered dithering). Squared distances
+ * stay below 2^24, so float lanes are exact and the result matches the
+ * scalar search, ties included.
+ */
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define DITHER_SIMD_LANES 8
+#define DITHER_SIMD_NAME "AVX2"
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define DITHER_SIMD_LANES 4
+#define DITHER_SIMD_NAME "SSE2"
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define DITHER_SIMD_LANES 4
+#define DITHER_SIMD_NAME "NEON"
+#else
+#define DITHER_SIMD_LANES 1
+#define DITHER_SIMD_NAME "scalar"
+#endif
+
+inline void findClosestColorsPlanar(const float* r, const float* g, const float* b, size_t count,
+                                    float scale, uint8_t* indices) {
+  size_t i = 0;
+#if DITHER_SIMD_LANES == 8
+  for (; i + 8 <= count; i += 8) {
+    __m256 vr = _mm256_loadu_ps(r + i), vg = _mm256_loadu_ps(g + i), vb = _mm256_loadu_ps(b + i);
+    __m256 best = _mm256_set1_ps(3.4e38f);
+    __m256 bestIndex = _mm256_setzero_ps();
+    for (int c = 0; c < DITHER_PALETTE_SIZE; c++) {
+      __m256 dr = _mm256_sub_ps(vr, _mm256_set1_ps(DITHER_PALETTE[c][0] * scale));
+      __m256 dg = _mm256_sub_ps(vg, _mm256_set1_ps(DITHER_PALETTE[c][1] * scale));
+      __m256 db = _mm256_sub_ps(vb, _mm256_set1_ps(DITHER_PALETTE[c][2] * scale));
+      __m256 dist = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(dr, dr), _mm256_mul_ps(dg, dg)), _mm256_mul_ps(db, db));
+      __m256 closer = _mm256_cmp_ps(dist, best, _CMP_LT_OQ);
+      best = _mm256_blendv_ps(best, dist, closer);
+      bestIndex = _mm256_blendv_ps(bestIndex, _mm256_set1_ps((float)c), closer);
+    }
+    __m128i idx32lo = _mm_cvttps_epi32(_mm256_castps256_ps128(bestIndex));
+    __m128i idx32hi = _mm_cvttps_epi32(_mm256_extractf128_ps(bestIndex, 1));
+    __m128i idx16 = _mm_packs_epi32(idx32lo, idx32hi);
+    _mm_storel_epi64((__m128i*)(indices + i), _mm_packus_epi16(idx16, idx16));
+  }
+#elif DITHER_SIMD_LANES == 4 && defined(__SSE2__)
+  for (; i + 4 <= count; i += 4) {
+    __m128 vr = _mm_loadu_ps(r + i), vg = _mm_loadu_ps(g + i), vb = _mm_loadu_ps(b + i);
+    __m128 best = _mm_set1_ps(3.4e38f);
+    __m128i bestIndex = _mm_setzero_si128();
+    for (int c = 0; c < DITHER_PALETTE_SIZE; c++) {
+      __m128 dr = _mm_sub_ps(vr, _mm_set1_ps(DITHER_PALETTE[c][0] * scale));
+      __m128 dg = _mm_sub_ps(vg, _mm_set1_ps(DITHER_PALETTE[c][1] * scale));
+      __m128 db = _mm_sub_ps(vb, _mm_set1_ps(DITHER_PALETTE[c][2] * scale));
+      __m128 dist = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dr, dr), _mm_mul_ps(dg, dg)), _mm_mul_ps(db, db));
+      __m128i closer = _mm_castps_si128(_mm_cmplt_ps(dist, best));
+      best = _mm_min_ps(best, dist);
+      bestIndex = _mm_or_si128(_mm_andnot_si128(closer, bestIndex), _mm_and_si128(closer, _mm_set1_epi32(c)));
+    }
+    __m128i idx16 = _mm_packs_epi32(bestIndex, bestIndex);
+    uint32_t packed = _mm_cvtsi128_si32(_mm_packus_epi16(idx16, idx16));
+    memcpy(indices + i, &packed, 4);
+  }
+#elif DITHER_SIMD_LANES == 4
+  for (; i + 4 <= count; i += 4) {
+    float32x4_t vr = vld1q_f32(r + i), vg = vld1q_f32(g + i), vb = vld1q_f32(b + i);
+    float32x4_t best = vdupq_n_f32(3.4e38f);
+    uint32x4_t bestIndex = vdupq_n_u32(0);
+    for (int c = 0; c < DITHER_PALETTE_SIZE; c++) {
+      float32x4_t dr = vsubq_f32(vr, vdupq_n_f32(DITHER_PALETTE[c][0] * scale));
+      float32x4_t dg = vsubq_f32(vg, vdupq_n_f32(DITHER_PALETTE[c][1] * scale));
+      float32x4_t db = vsubq_f32(vb, vdupq_n_f32(DITHER_PALETTE[c][2] * scale));
+      float32x4_t dist = vaddq_f32(vaddq_f32(vmulq_f32(dr, dr), vmulq_f32(dg, dg)), vmulq_f32(db, db));
+      uint32x4_t closer = vcltq_f32(dist, best);
+      best = vminq_f32(best, dist);
+      bestIndex = vbslq_u32(closer, vdupq_n_u32(c), bestIndex);
+    }
+    uint16x4_t idx16 = vmovn_u32(bestIndex);
+    uint8x8_t idx8 = vmovn_u16(vcombine_u16(idx16, idx16));
+    vst1_lane_u32((uint32_t*)(indices + i), vreinterpret_u32_u8(idx8), 0);
+  }
+#endif
+  for (; i < count; i++) {
+    indices[i] = scale == 1 ? findClosestColorExact((int)r[i], (int)g[i], (int)b[i])
+                            : findClosestColorScaled8((int)r[i], (int)g[i], (int)b[i]);
+  }
+}
+
+/* ========================================
+   PALETTE PROFILES
+   ======================================== */
+
+/*
+ * What each palette index looks like on the panel. The ideal profile is
+ * DITHER_PALETTE with the RGB search above. A measured profile diffuses
+ * the error against the colors the inks really show, and takes the
+ * nearest one in OKLab from the cube of palette_lut.h: one lookup per
+ * pixel, from flash, nothing built on the device. The browser builds the
+ * same cube (buildPaletteLut), so the two agree to the last pixel.
+ */
+struct PaletteProfile {
+  const uint8_t (*colors)[3];
+  const uint8_t* lut;  // nullptr: RGB search
+
+  uint8_t match(int r, int g, int b) const {
+    if (lut) return lut[((r >> 3) << 10) | ((g >> 3) << 5) | (b >> 3)];
+    return findClosestColor(r, g, b);
+  }
+};
+
+static const PaletteProfile DITHER_PALETTE_PROFILES[DITHER_PALETTE_COUNT] = {
+  {DITHER_PALETTE, nullptr},
+  {PALETTE_ACEP_COLORS, PALETTE_ACEP_LUT}
+};
+
+#define DITHER_PALETTE_DEFAULT DITHER_PALETTE_PROFILES[DITHER_PALETTE_IDEAL]
+
+inline const PaletteProfile& ditherPalette(DitherPalette palette) {
+  return DITHER_PALETTE_PROFILES[palette >= 0 && palette < DITHER_PALETTE_COUNT ? palette : DITHER_PALETTE_IDEAL];
+}
+
+/* ========================================
+   ERROR DIFFUSION
+   ======================================== */
+
+/*
+ * A kernel is a type: its taps and divisor are template arguments, so each
+ * kernel gets its own row loop with the taps unrolled and their weights
+ * and offsets as constants. The error goes into a rolling buffer of the
+ * rows it reaches instead of a copy of the whole image. The buffer holds
+ * RGB in sixteenths of a level and is not clamped, so shares keep their
+ * fraction and a pushed-out value is not lost; only the value a pixel is
+ * matched with is clamped to 0..255. Serpentine kernels run the odd rows
+ * right to left with the taps mirrored. The error is taken against the
+ * colors of the palette profile.
+ */
+#define DIFFUSION_MAX_ROWS 3  // Current row and the two below it
+#define DIFFUSION_SHIFT 4     // Buffer values are level << DIFFUSION_SHIFT
+#define DIFFUSION_MAX (255 << DIFFUSION_SHIFT)
+
+// Buffer value clamped to the levels a pixel can have
+inline int diffusionClamp(int value) {
+  return value < 0 ? 0 : (value > DIFFUSION_MAX ? DIFFUSION_MAX : value);
+}
+
+// Clamped buffer value back to a level, halves up
+inline int diffusionLevel(int value) {
+  return (value + (1 << (DIFFUSION_SHIFT - 1))) >> DIFFUSION_SHIFT;
+}
+
+template <int DX, int DY, int WEIGHT>
+struct DiffusionTap {
+  enum { dx = DX, dy = DY, weight = WEIGHT };  // weight: numerator over the kernel divisor
+};
+
+// Rows a list of taps reaches, the current one included
+template <typename... Taps>
+struct DiffusionRows {
+  enum { value = 1 };
+};
+
+template <typename Tap, typename... Rest>
+struct DiffusionRows<Tap, Rest...> {
+  enum {
+    rest = DiffusionRows<Rest...>::value,
+    value = Tap::dy + 1 > rest ? Tap::dy + 1 : rest
+  };
+};
+
+// Adds the share of each tap to its neighbour, one instantiation per tap
+template <int Divisor>
+inline void diffuseTaps(int16_t* const*, int, int, int, int, int, int) {}
+
+template <int Divisor, typename Tap, typename... Rest>
+inline void diffuseTaps(int16_t* const* rows, int x, int width, int direction, int errR, int errG, int errB) {
+  int nx = x + Tap::dx * direction;
+  if (nx >= 0 && nx < width && rows[Tap::dy]) {
+    // At most one level of error reaches a pixel, so int16_t cannot overflow
+    int16_t* n = rows[Tap::dy] + nx * 3;
+    n[0] += errR * Tap::weight / Divisor;
+    n[1] += errG * Tap::weight / Divisor;
+    n[2] += errB * Tap::weight / Divisor;
+  }
+  diffuseTaps<Divisor, Rest...>(rows, x, width, direction, errR, errG, errB);
+}
+
+template <int DIVISOR, bool SERPENTINE, typename... Taps>
+struct DiffusionKernel {
+  enum { divisor = DIVISOR, serpentine = SERPENTINE, rows = DiffusionRows<Taps...>::value };
+  static_assert(rows <= DIFFUSION_MAX_ROWS, "kernel reaches too many rows");
+
+  // Quantizes pixel x of rows[0] and spreads its error; rows[dy] is nullptr
+  // below the last row of the image
+  static uint8_t pixel(int16_t* const* rows, int x, int width, int direction, const PaletteProfile& profile) {
+    const int16_t* p = rows[0] + x * 3;
+    int r = diffusionClamp(p[0]);
+    int g = diffusionClamp(p[1]);
+    int b = diffusionClamp(p[2]);
+
+    uint8_t colorIndex = profile.match(diffusionLevel(r), diffusionLevel(g), diffusionLevel(b));
+
+    int errR = r - (profile.colors[colorIndex][0] << DIFFUSION_SHIFT);
+    int errG = g - (profile.colors[colorIndex][1] << DIFFUSION_SHIFT);
+    int errB = b - (profile.colors[colorIndex][2] << DIFFUSION_SHIFT);
+    diffuseTaps<DIVISOR, Taps...>(rows, x, width, direction, errR, errG, errB);
+    return colorIndex;
+  }
+
+  static void row(int16_t* const* rows, int y, int width, uint8_t* quantized, const PaletteProfile& profile) {
+    // A local copy: the byte stores of the loop cannot alias it, so the
+    // profile stays in registers
+    const PaletteProfile local = profile;
+    if (SERPENTINE && (y & 1)) {
+      for (int x = width - 1; x >= 0; x--) quantized[x] = pixel(rows, x, width, -1, local);
+    } else {
+      for (int x = 0; x < width; x++) quantized[x] = pixel(rows, x, width, 1, local);
+    }
+  }
+};
+
+typedef DiffusionKernel<16, false,
+                        DiffusionTap<1, 0, 7>,
+                        DiffusionTap<-1, 1, 3>, DiffusionTap<0, 1, 5>, DiffusionTap<1, 1, 1>>
+  FloydSteinbergKernel;
+
+typedef DiffusionKernel<16, true,
+                        DiffusionTap<1, 0, 7>,
+                        DiffusionTap<-1, 1, 3>, DiffusionTap<0, 1, 5>, DiffusionTap<1, 1, 1>>
+  SerpentineKernel;
+
+// Spreads only 6/8 of the error: lighter, more contrast
+typedef DiffusionKernel<8, false,
+                        DiffusionTap<1, 0, 1>, DiffusionTap<2, 0, 1>,
+                        DiffusionTap<-1, 1, 1>, DiffusionTap<0, 1, 1>, DiffusionTap<1, 1, 1>,
+                        DiffusionTap<0, 2, 1>>
+  AtkinsonKernel;
+
+typedef DiffusionKernel<48, false,
+                        DiffusionTap<1, 0, 7>, DiffusionTap<2, 0, 5>,
+                        DiffusionTap<-2, 1, 3>, DiffusionTap<-1, 1, 5>, DiffusionTap<0, 1, 7>,
+                        DiffusionTap<1, 1, 5>, DiffusionTap<2, 1, 3>,
+                        DiffusionTap<-2, 2, 1>, DiffusionTap<-1, 2, 3>, DiffusionTap<0, 2, 5>,
+                        DiffusionTap<1, 2, 3>, DiffusionTap<2, 2, 1>>
+  JarvisKernel;
+
+typedef DiffusionKernel<42, false,
+                        DiffusionTap<1, 0, 8>, DiffusionTap<2, 0, 4>,
+                        DiffusionTap<-2, 1, 2>, DiffusionTap<-1, 1, 4>, DiffusionTap<0, 1, 8>,
+                        DiffusionTap<1, 1, 4>, DiffusionTap<2, 1, 2>,
+                        DiffusionTap<-2, 2, 1>, DiffusionTap<-1, 2, 2>, DiffusionTap<0, 2, 4>,
+                        DiffusionTap<1, 2, 2>, DiffusionTap<2, 2, 1>>
+  StuckiKernel;
+
+typedef DiffusionKernel<32, false,
+                        DiffusionTap<1, 0, 5>, DiffusionTap<2, 0, 3>,
+                        DiffusionTap<-2, 1, 2>, DiffusionTap<-1, 1, 4>, DiffusionTap<0, 1, 5>,
+                        DiffusionTap<1, 1, 4>, DiffusionTap<2, 1, 2>,
+                        DiffusionTap<-1, 2, 2>, DiffusionTap<0, 2, 3>, DiffusionTap<1, 2, 2>>
+  SierraKernel;
+
+// Black & White: Floyd-Steinberg on the luma, the error added to all channels.
+// Only black and white, the same with every palette profile
+struct BlackAndWhiteKernel {
+  enum { rows = 2 };
+
+  static uint8_t pixel(int16_t* const* rows, int x, int width) {
+    static const int8_t taps[4][3] = {{1, 0, 7}, {-1, 1, 3}, {0, 1, 5}, {1, 1, 1}};
+    const int16_t* p = rows[0] + x * 3;
+    // In sixteenths of a level, like the buffer
+    double gray = diffusionClamp(p[0]) * 0.299 + diffusionClamp(p[1]) * 0.587 + diffusionClamp(p[2]) * 0.114;
+
+    uint8_t colorIndex = gray > (127 << DIFFUSION_SHIFT) ? 1 : 0;
+
+    double error = gray - (colorIndex == 0 ? 0 : DIFFUSION_MAX);
+    for (int t = 0; t < 4; t++) {
+      int nx = x + taps[t][0];
+      if (nx >= 0 && nx < width && rows[taps[t][1]]) {
+        int16_t* n = rows[taps[t][1]] + nx * 3;
+        int share = (int)(error * taps[t][2] / 16);
+        n[0] += share;
+        n[1] += share;
+        n[2] += share;
+      }
+    }
+    return colorIndex;
+  }
+
+  static void row(int16_t* const* rows, int, int width, uint8_t* quantized, const PaletteProfile&) {
+    for (int x = 0; x < width; x++) quantized[x] = pixel(rows, x, width);
+  }
+};
+
+// Whole RGBA image through Kernel, holding Kernel::rows RGB rows at a time
+template <typename Kernel>
+inline void diffusionDithering(const uint8_t* pixels, int width, int height, uint8_t* quantized,
+                               const PaletteProfile& profile) {
+  std::vector<int16_t> ring((size_t)Kernel::rows * width * 3);
+  auto slot = [&](int y) { return &ring[(size_t)(y % Kernel::rows) * width * 3]; };
+  auto load = [&](int y) {
+    const uint8_t* src = pixels + (size_t)y * width * 4;
+    int16_t* dst = slot(y);
+    for (int x = 0; x < width; x++) {
+      dst[x * 3] = src[x * 4] << DIFFUSION_SHIFT;
+      dst[x * 3 + 1] = src[x * 4 + 1] << DIFFUSION_SHIFT;
+      dst[x * 3 + 2] = src[x * 4 + 2] << DIFFUSION_SHIFT;
+    }
+  };
+
+  for (int y = 0; y < Kernel::rows - 1 && y < height; y++) load(y);
+  for (int y = 0; y < height; y++) {
+    // The slot of the row just finished takes the next row the error reaches
+    if (y + Kernel::rows - 1 < height) load(y + Kernel::rows - 1);
+    int16_t* rows[DIFFUSION_MAX_ROWS];
+    for (int dy = 0; dy < DIFFUSION_MAX_ROWS; dy++) {
+      rows[dy] = dy < Kernel::rows && y + dy < height ? slot(y + dy) : nullptr;
+    }
+    Kernel::row(rows, y, width, quantized + (size_t)y * width, profile);
+  }
+}
+
+/* ========================================
+   ORDERED, BLUE NOISE, NO DITHERING
+   ======================================== */
+
+/*
+ * Threshold modes: every pixel is independent. A row goes through the
+ * batch kernel in chunks, so the scratch does not grow with the width;
+ * with a measured profile each pixel is one lookup instead.
+ */
+#define DITHER_PLANAR_CHUNK 64
+#define DITHER_PLANAR_FLOATS (3 * DITHER_PLANAR_CHUNK)  // Scratch of the row functions
+
+static const uint8_t BAYER_MATRIX_4X4[4][4] = {
+  {0, 8, 2, 10},
+  {12, 4, 14, 6},
+  {3, 11, 1, 9},
+  {15, 7, 13, 5}
+};
+
+// One row; stride 4 for RGBA, 3 for RGB. planar: DITHER_PLANAR_FLOATS of scratch
+inline void orderedDitherRow(const uint8_t* row, int stride, int width, int y, float* planar,
+                             uint8_t* quantized, const PaletteProfile& profile) {
+  const bool perceptual = profile.lut != nullptr;
+  float* r8 = planar;
+  float* g8 = r8 + DITHER_PLANAR_CHUNK;
+  float* b8 = g8 + DITHER_PLANAR_CHUNK;
+  for (int x0 = 0; x0 < width; x0 += DITHER_PLANAR_CHUNK) {
+    int count = width - x0 < DITHER_PLANAR_CHUNK ? width - x0 : DITHER_PLANAR_CHUNK;
+    for (int i = 0; i < count; i++) {
+      int x = x0 + i;
+      const uint8_t* p = row + x * stride;
+      // (m / 16 - 0.5) * 50 = (m - 8) * 3.125, i.e. (m - 8) * 25 / 8
+      int threshold8 = (BAYER_MATRIX_4X4[y % 4][x % 4] - 8) * 25;
+      int r = p[0] * 8 + threshold8;
+      int g = p[1] * 8 + threshold8;
+      int b = p[2] * 8 + threshold8;
+      r = r < 0 ? 0 : (r > 2040 ? 2040 : r);
+      g = g < 0 ? 0 : (g > 2040 ? 2040 : g);
+      b = b < 0 ? 0 : (b > 2040 ? 2040 : b);
+      if (perceptual) {
+        quantized[x] = profile.match(r >> 3, g >> 3, b >> 3);  // The cell of r / 8
+      } else {
+        r8[i] = r;
+        g8[i] = g;
+        b8[i] = b;
+      }
+    }
+    if (!perceptual) findClosestColorsPlanar(r8, g8, b8, count, 8, quantized + x0);
+  }
+}
+
+// Blue noise: one threshold per pixel from the void-and-cluster mask of
+// blue_noise.h, spanning a whole palette step (level - 128) where Bayer
+// adds +-25. No cross-hatching, and nothing carries over between pixels:
+// any slice of the image dithers alone and streaming keeps no error rows
+inline void blueNoiseDitherRow(const uint8_t* row, int stride, int width, int y, float* planar,
+                               uint8_t* quantized, const PaletteProfile& profile) {
+  const bool perceptual = profile.lut != nullptr;
+  const uint8_t* mask = BLUE_NOISE_MASK[y % BLUE_NOISE_SIZE];
+  float* r = planar;
+  float* g = r + DITHER_PLANAR_CHUNK;
+  float* b = g + DITHER_PLANAR_CHUNK;
+  for (int x0 = 0; x0 < width; x0 += DITHER_PLANAR_CHUNK) {
+    int count = width - x0 < DITHER_PLANAR_CHUNK ? width - x0 : DITHER_PLANAR_CHUNK;
+    for (int i = 0; i < count; i++) {
+      int x = x0 + i;
+      const uint8_t* p = row + x * stride;
+      int threshold = mask[x % BLUE_NOISE_SIZE] - 128;
+      int rt = p[0] + threshold;
+      int gt = p[1] + threshold;
+      int bt = p[2] + threshold;
+      rt = rt < 0 ? 0 : (rt > 255 ? 255 : rt);
+      gt = gt < 0 ? 0 : (gt > 255 ? 255 : gt);
+      bt = bt < 0 ? 0 : (bt > 255 ? 255 : bt);
+      if (perceptual) {
+        quantized[x] = profile.match(rt, gt, bt);
+      } else {
+        r[i] = rt;
+        g[i] = gt;
+        b[i] = bt;
+      }
+    }
+    if (!perceptual) findClosestColorsPlanar(r, g, b, count, 1, quantized + x0);
+  }
+}
+
+inline void nearestColorRow(const uint8_t* row, int stride, int width, float* planar, uint8_t* quantized,
+                            const PaletteProfile& profile) {
+  if (profile.lut) {
+    for (int x = 0; x < width; x++) {
+      const uint8_t* p = row + x * stride;
+      quantized[x] = profile.match(p[0], p[1], p[2]);
+    }
+    return;
+  }
+  float* r = planar;
+  float* g = r + DITHER_PLANAR_CHUNK;
+  float* b = g + DITHER_PLANAR_CHUNK;
+  for (int x0 = 0; x0 < width; x0 += DITHER_PLANAR_CHUNK) {
+    int count = width - x0 < DITHER_PLANAR_CHUNK ? width - x0 : DITHER_PLANAR_CHUNK;
+    for (int i = 0; i < count; i++) {
+      const uint8_t* p = row + (x0 + i) * stride;
+      r[i] = p[0];
+      g[i] = p[1];
+      b[i] = p[2];
+    }
+    findClosestColorsPlanar(r, g, b, count, 1, quantized + x0);
+  }
+}
+
+inline void orderedDithering(const uint8_t* pixels, int width, int height, uint8_t* quantized,
+                             const PaletteProfile& profile) {
+  float planar[DITHER_PLANAR_FLOATS];
+  for (int y = 0; y < height; y++) {
+    orderedDitherRow(pixels + (size_t)y * width * 4, 4, width, y, planar, quantized + (size_t)y * width, profile);
+  }
+}
+
+inline void blueNoiseDithering(const uint8_t* pixels, int width, int height, uint8_t* quantized,
+                               const PaletteProfile& profile) {
+  float planar[DITHER_PLANAR_FLOATS];
+  for (int y = 0; y < height; y++) {
+    blueNoiseDitherRow(pixels + (size_t)y * width * 4, 4, width, y, planar, quantized + (size_t)y * width, profile);
+  }
+}
+
+inline void noDithering(const uint8_t* pixels, int width, int height, uint8_t* quantized,
+                        const PaletteProfile& profile) {
+  float planar[DITHER_PLANAR_FLOATS];
+  for (int y = 0; y < height; y++) {
+    nearestColorRow(pixels + (size_t)y * width * 4, 4, width, planar, quantized + (size_t)y * width, profile);
+  }
+}
+
+/* ========================================
+   ROW STREAMING
+   ======================================== */
+
+// Rows the error of an algorithm reaches, the current one included
+inline int ditherAlgorithmRows(DitherAlgorithm algorithm) {
+  switch (algorithm) {
+    case DITHER_ATKINSON: return AtkinsonKernel::rows;
+    case DITHER_ORDERED:
+    case DITHER_NONE:
+    case DITHER_BLUE_NOISE: return 1;
+    case DITHER_BLACK_WHITE: return BlackAndWhiteKernel::rows;
+    case DITHER_JARVIS: return JarvisKernel::rows;
+    case DITHER_STUCKI: return StuckiKernel::rows;
+    case DITHER_SIERRA: return SierraKernel::rows;
+    case DITHER_SERPENTINE: return SerpentineKernel::rows;
+    default: return FloydSteinbergKernel::rows;
+  }
+}
+
+/*
+ * The same algorithms for images that arrive one RGB row at a time (the
+ * on-device JPEG decoder), holding only the rows the error still reaches.
+ * A row is dithered once every row below it that its error can reach has
+ * arrived, so the shares are added in the same order and the output is
+ * bit-identical to ditherImage().
+ */
+class RowDitherer {
+ public:
+  void begin(DitherAlgorithm algorithm, int width, const PaletteProfile& profile = DITHER_PALETTE_DEFAULT) {
+    _algorithm = algorithm;
+    _profile = profile;
+    _width = width;
+    _lag = ditherAlgorithmRows(algorithm) - 1;
+    // Threshold modes carry nothing between rows and read each row in place
+    _rows.assign(_lag > 0 ? (size_t)(_lag + 1) * width * 3 : 0, 0);
+    _planar.assign(_lag == 0 ? DITHER_PLANAR_FLOATS : 0, 0);
+    _rowsIn = 0;
+    _rowsOut = 0;
+  }
+
+  size_t memoryBytes() const { return _rows.size() * sizeof(int16_t) + _planar.size() * sizeof(float); }
+
+  // Dithers the row `lag` rows back into quantized, once there is one
+  bool pushRow(const uint8_t* rgb, uint8_t* quantized) {
+    if (_lag == 0) {
+      _rowsIn++;
+      thresholdRow(rgb, _rowsOut++, quantized);
+      return true;
+    }
+    int16_t* dst = row(_rowsIn);
+    for (int i = 0; i < _width * 3; i++) dst[i] = rgb[i] << DIFFUSION_SHIFT;
+    _rowsIn++;
+    if (_rowsIn <= _lag) return false;
+    ditherRow(quantized);
+    return true;
+  }
+
+  // After the last row: the rows still held, one per call
+  bool flushRow(uint8_t* quantized) {
+    if (_rowsOut >= _rowsIn) return false;
+    ditherRow(quantized);
+    return true;
+  }
+
+ private:
+  DitherAlgorithm _algorithm = DITHER_FLOYD_STEINBERG;
+  PaletteProfile _profile = DITHER_PALETTE_DEFAULT;
+  int _width = 0;
+  int _lag = 0;
+  int _rowsIn = 0;
+  int _rowsOut = 0;
+  std::vector<int16_t> _rows;   // Ring of _lag + 1 RGB rows, error diffusion only
+  std::vector<float> _planar;   // Threshold modes only
+
+  int16_t* row(int y) { return &_rows[(size_t)(y % (_lag + 1)) * _width * 3]; }
+
+  void ditherRow(uint8_t* quantized) {
+    int y = _rowsOut++;
+    int16_t* rows[DIFFUSION_MAX_ROWS];
+    for (int dy = 0; dy < DIFFUSION_MAX_ROWS; dy++) {
+      rows[dy] = dy <= _lag && y + dy < _rowsIn ? row(y + dy) : nullptr;
+    }
+    switch (_algorithm) {
+      case DITHER_ATKINSON: AtkinsonKernel::row(rows, y, _width, quantized, _profile); break;
+      case DITHER_BLACK_WHITE: BlackAndWhiteKernel::row(rows, y, _width, quantized, _profile); break;
+      case DITHER_JARVIS: JarvisKernel::row(rows, y, _width, quantized, _profile); break;
+      case DITHER_STUCKI: StuckiKernel::row(rows, y, _width, quantized, _profile); break;
+      case DITHER_SIERRA: SierraKernel::row(rows, y, _width, quantized, _profile); break;
+      case DITHER_SERPENTINE: SerpentineKernel::row(rows, y, _width, quantized, _profile); break;
+      default: FloydSteinbergKernel::row(rows, y, _width, quantized, _profile); break;
+    }
+  }
+
+  void thresholdRow(const uint8_t* rgb, int y, uint8_t* quantized) {
+    switch (_algorithm) {
+      case DITHER_ORDERED: orderedDitherRow(rgb, 3, _width, y, _planar.data(), quantized, _profile); break;
+      case DITHER_BLUE_NOISE: blueNoiseDitherRow(rgb, 3, _width, y, _planar.data(), quantized, _profile); break;
+      default: nearestColorRow(rgb, 3, _width, _planar.data(), quantized, _profile); break;
+    }
+  }
+};
+
+/* ========================================
+   ENTRY POINTS
+   ======================================== */
+
+// Algorithm for an id of DITHER_ALGORITHM_IDS, fallback for anything else
+inline DitherAlgorithm ditherAlgorithmFromId(const char* id, DitherAlgorithm fallback) {
+  for (int i = 0; i < DITHER_ALGORITHM_COUNT; i++) {
+    if (strcmp(id, DITHER_ALGORITHM_IDS[i]) == 0) return (DitherAlgorithm)i;
+  }
+  return fallback;
+}
+
+// Palette for an id of DITHER_PALETTE_IDS, fallback for anything else
+inline DitherPalette ditherPaletteFromId(const char* id, DitherPalette fallback) {
+  for (int i = 0; i < DITHER_PALETTE_COUNT; i++) {
+    if (strcmp(id, DITHER_PALETTE_IDS[i]) == 0) return (DitherPalette)i;
+  }
+  return fallback;
+}
+
+// pixels: RGBA (like canvas ImageData), quantized: one palette index per pixel
+inline void ditherImage(DitherAlgorithm algorithm, const uint8_t* pixels, int width, int height,
+                        uint8_t* quantized, const PaletteProfile& profile = DITHER_PALETTE_DEFAULT) {
+  switch (algorithm) {
+    case DITHER_ATKINSON: diffusionDithering<AtkinsonKernel>(pixels, width, height, quantized, profile); break;
+    case DITHER_ORDERED: orderedDithering(pixels, width, height, quantized, profile); break;
+    case DITHER_NONE: noDithering(pixels, width, height, quantized, profile); break;
+    case DITHER_BLACK_WHITE: diffusionDithering<BlackAndWhiteKernel>(pixels, width, height, quantized, profile); break;
+    case DITHER_JARVIS: diffusionDithering<JarvisKernel>(pixels, width, height, quantized, profile); break;
+    case DITHER_STUCKI: diffusionDithering<StuckiKernel>(pixels, width, height, quantized, profile); break;
+    case DITHER_SIERRA: diffusionDithering<SierraKernel>(pixels, width, height, quantized, profile); break;
+    case DITHER_SERPENTINE: diffusionDithering<SerpentineKernel>(pixels, width, height, quantized, profile); break;
+    case DITHER_BLUE_NOISE: blueNoiseDithering(pixels, width, height, quantized, profile); break;
+    default: diffusionDithering<FloydSteinbergKernel>(pixels, width, height, quantized, profile); break;
+  }
+}
+
+// Same layout as generateBinary(): two pixels per byte, left pixel in the high nibble
+inline void packImage(const uint8_t* quantized, int width, int height, uint8_t* packed) {
+  size_t bufferIndex = 0;
+  for (int y = 0; y < height; y++) {
+    for (int x = 0; x < width; x += 2) {
+      uint8_t p1 = quantized[(size_t)y * width + x] & 0x0F;
+      uint8_t p2 = x + 1 < width ? quantized[(size_t)y * width + x + 1] & 0x0F : 0;
+      packed[bufferIndex++] = (p1 << 4) | p2;
+    }
+  }
+}
+
+#endif
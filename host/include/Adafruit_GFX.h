@@ -0,0 +1,109 @@
+/*
+ * Host Simulation - Adafruit GFX
+ * Primitive drawing on top of drawPixel(). Text is drawn as one solid
+ * 5x7 cell per glyph, enough to see layout and count draw calls.
+ *
+ * Repository: https://github.com/9carlo6/E-Paper
+ * @author 9carlo6
+ * @date 2025
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (c) 2025 9carlo6
+ * All rights reserved.
+ */
+
+#ifndef HOST_ADAFRUIT_GFX_H
+#define HOST_ADAFRUIT_GFX_H
+
+#include <Arduino.h>
+
+#include "sim.h"
+
+class Adafruit_GFX : public Print {
+public:
+  Adafruit_GFX(int16_t w, int16_t h) : WIDTH(w), HEIGHT(h), _width(w), _height(h) {}
+
+  virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+
+  virtual void fillScreen(uint16_t color) {
+    fillRect(0, 0, _width, _height, color);
+  }
+
+  virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    simDisplayStats.fillRect++;
+    for (int16_t j = y; j < y + h; j++) {
+      for (int16_t i = x; i < x + w; i++) drawPixel(i, j, color);
+    }
+  }
+
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    for (int16_t i = x; i < x + w; i++) drawPixel(i, y, color);
+  }
+
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    for (int16_t j = y; j < y + h; j++) drawPixel(x, j, color);
+  }
+
+  void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    simDisplayStats.drawRect++;
+    drawFastHLine(x, y, w, color);
+    drawFastHLine(x, y + h - 1, w, color);
+    drawFastVLine(x, y, h, color);
+    drawFastVLine(x + w - 1, y, h, color);
+  }
+
+  virtual void setRotation(uint8_t r) {
+    _rotation = r & 3;
+    _width = (_rotation & 1) ? HEIGHT : WIDTH;
+    _height = (_rotation & 1) ? WIDTH : HEIGHT;
+  }
+  uint8_t getRotation() const { return _rotation; }
+  int16_t width() const { return _width; }
+  int16_t height() const { return _height; }
+
+  void setCursor(int16_t x, int16_t y) { _cursorX = x; _cursorY = y; }
+  int16_t getCursorX() const { return _cursorX; }
+  int16_t getCursorY() const { return _cursorY; }
+  void setTextSize(uint8_t s) { _textSize = s ? s : 1; }
+  void setTextColor(uint16_t c) { _textColor = c; }
+  void setTextColor(uint16_t c, uint16_t bg) { _textColor = c; (void)bg; }
+  void setTextWrap(bool w) { _wrap = w; }
+
+  size_t write(uint8_t c) override {
+    if (c == '\n') {
+      _cursorX = 0;
+      _cursorY += 8 * _textSize;
+    } else if (c != '\r') {
+      // UTF-8 continuation bytes don't advance the cursor
+      if ((c & 0xC0) == 0x80) return 1;
+      if (_wrap && _cursorX + 6 * _textSize > _width) {
+        _cursorX = 0;
+        _cursorY += 8 * _textSize;
+      }
+      if (c != ' ') {
+        simDisplayStats.textChars++;
+        for (int16_t j = 0; j < 7 * _textSize; j++) {
+          drawFastHLine(_cursorX, _cursorY + j, 5 * _textSize, _textColor);
+        }
+      }
+      _cursorX += 6 * _textSize;
+    }
+    return 1;
+  }
+  using Print::write;
+
+protected:
+  const int16_t WIDTH;
+  const int16_t HEIGHT;
+  int16_t _width;
+  int16_t _height;
+  uint8_t _rotation = 0;
+  int16_t _cursorX = 0;
+  int16_t _cursorY = 0;
+  uint8_t _textSize = 1;
+  uint16_t _textColor = 0;
+  bool _wrap = true;
+};
+
+#endif
@@ -0,0 +1,264 @@
+/*
+ * Host Simulation - GxEPD2 7-color display
+ * Paged display template and GDEP0565D90 driver with the same paging,
+ * rotation and native write behavior as GxEPD2. The driver keeps a copy
+ * of the controller RAM and dumps it as a PNG on every refresh.
+ *
+ * Repository: https://github.com/9carlo6/E-Paper
+ * @author 9carlo6
+ * @date 2025
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (c) 2025 9carlo6
+ * All rights reserved.
+ */
+
+#ifndef HOST_GXEPD2_7C_H
+#define HOST_GXEPD2_7C_H
+
+#include <Adafruit_GFX.h>
+#include <vector>
+
+#include "sim.h"
+
+#define GxEPD_BLACK     0x0000
+#define GxEPD_WHITE     0xFFFF
+#define GxEPD_GREEN     0x07E0
+#define GxEPD_BLUE      0x001F
+#define GxEPD_RED       0xF800
+#define GxEPD_YELLOW    0xFFE0
+#define GxEPD_ORANGE    0xFC00
+
+/* ========================================
+   DRIVER: GDEP0565D90 (600x448, 7 colors)
+   ======================================== */
+
+class GxEPD2_565c_GDEP0565D90 {
+public:
+  static const uint16_t WIDTH = 600;
+  static const uint16_t WIDTH_VISIBLE = WIDTH;
+  static const uint16_t HEIGHT = 448;
+  static const bool hasColor = true;
+  static const bool hasPartialUpdate = false;
+  static const bool hasFastPartialUpdate = false;
+
+  GxEPD2_565c_GDEP0565D90(int16_t cs, int16_t dc, int16_t rst, int16_t busy);
+
+  void init(uint32_t serial_diag_bitrate = 0);
+  void init(uint32_t serial_diag_bitrate, bool initial, uint16_t reset_duration = 10,
+            bool pulldown_rst_mode = false);
+  void clearScreen(uint8_t value = 0x11);
+  void writeScreenBuffer(uint8_t value = 0x11);
+  void setPaged() { _paged = true; }
+  void writeNative(const uint8_t* data1, const uint8_t* data2, int16_t x, int16_t y, int16_t w,
+                   int16_t h, bool invert = false, bool mirror_y = false, bool pgm = false);
+  void refresh(bool partial_update_mode = false);
+  void refresh(int16_t x, int16_t y, int16_t w, int16_t h);
+  void powerOff() { _power_is_on = false; }
+  void hibernate() { _power_is_on = false; _hibernating = true; }
+
+  // Simulation only: rotation used for the PNG dump and the controller RAM
+  uint8_t simRotation = 0;
+  const std::vector<uint8_t>& simRam() const { return _ram; }
+
+private:
+  std::vector<uint8_t> _ram;
+  bool _paged = false;
+  bool _power_is_on = false;
+  bool _hibernating = false;
+};
+
+/* ========================================
+   PAGED DISPLAY TEMPLATE
+   ======================================== */
+
+template <typename GxEPD2_Type, const uint16_t page_height>
+class GxEPD2_7C : public Adafruit_GFX {
+public:
+  GxEPD2_Type epd2;
+
+  GxEPD2_7C(GxEPD2_Type epd2_instance)
+    : Adafruit_GFX(GxEPD2_Type::WIDTH, GxEPD2_Type::HEIGHT), epd2(epd2_instance),
+      _buffer((GxEPD2_Type::WIDTH / 2) * page_height) {
+    _page_height = page_height;
+    _pages = (HEIGHT / _page_height) + ((HEIGHT % _page_height) > 0);
+    setFullWindow();
+  }
+
+  void init(uint32_t serial_diag_bitrate = 0) {
+    epd2.init(serial_diag_bitrate);
+  }
+
+  void init(uint32_t serial_diag_bitrate, bool initial, uint16_t reset_duration = 10,
+            bool pulldown_rst_mode = false) {
+    epd2.init(serial_diag_bitrate, initial, reset_duration, pulldown_rst_mode);
+  }
+
+  void setRotation(uint8_t r) override {
+    Adafruit_GFX::setRotation(r);
+    epd2.simRotation = getRotation();
+  }
+
+  uint16_t pages() { return _pages; }
+  uint16_t pageHeight() { return _page_height; }
+
+  void fillScreen(uint16_t color) override {
+    simDisplayStats.fillScreen++;
+    uint8_t pv = color7(color);
+    uint8_t pv2 = (pv << 4) | pv;
+    std::fill(_buffer.begin(), _buffer.end(), pv2);
+  }
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+    simDisplayStats.drawPixel++;
+    if ((x < 0) || (x >= width()) || (y < 0) || (y >= height())) {
+      simDisplayStats.drawPixelClipped++;
+      return;
+    }
+    rotate(x, y);
+    if (_using_partial_mode) {
+      if ((x < _pw_x) || (x >= _pw_x + _pw_w) || (y < _pw_y) || (y >= _pw_y + _pw_h)) {
+        simDisplayStats.drawPixelClipped++;
+        return;
+      }
+      x -= _pw_x;
+      y -= _pw_y;
+    }
+    y -= _current_page * _page_height;
+    if ((y < 0) || (y >= _page_height)) {
+      simDisplayStats.drawPixelClipped++;
+      return;
+    }
+    uint16_t stride = (_using_partial_mode ? _pw_w : WIDTH) / 2;
+    uint32_t i = x / 2 + uint32_t(y) * stride;
+    uint8_t cv7 = color7(color);
+    if (x & 1) {
+      _buffer[i] = (_buffer[i] & 0xF0) | cv7;
+    } else {
+      _buffer[i] = (_buffer[i] & 0x0F) | (cv7 << 4);
+    }
+  }
+
+  void setFullWindow() {
+    _using_partial_mode = false;
+    _pw_x = 0;
+    _pw_y = 0;
+    _pw_w = WIDTH;
+    _pw_h = HEIGHT;
+    _pages = (HEIGHT / _page_height) + ((HEIGHT % _page_height) > 0);
+  }
+
+  void setPartialWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+    int16_t px = std::min<int16_t>(x, width());
+    int16_t py = std::min<int16_t>(y, height());
+    int16_t pw = std::min<int16_t>(w, width() - px);
+    int16_t ph = std::min<int16_t>(h, height() - py);
+    rotateRect(px, py, pw, ph);
+    // Controller windows start and end on a byte (two pixels)
+    pw += px % 2;
+    if (pw % 2 > 0) pw += 2 - pw % 2;
+    px -= px % 2;
+    _pw_x = px;
+    _pw_y = py;
+    _pw_w = pw;
+    _pw_h = ph;
+    _using_partial_mode = true;
+    _pages = (_pw_h / _page_height) + ((_pw_h % _page_height) > 0);
+  }
+
+  void firstPage() {
+    fillScreen(GxEPD_WHITE);
+    _current_page = 0;
+    epd2.setPaged();
+  }
+
+  bool nextPage() {
+    simDisplayStats.pages++;
+    uint16_t page_ys = _current_page * _page_height;
+    if (_using_partial_mode) {
+      uint16_t page_ye = std::min<uint16_t>(page_ys + _page_height, _pw_h);
+      epd2.writeNative(_buffer.data(), nullptr, _pw_x, _pw_y + page_ys, _pw_w, page_ye - page_ys,
+                       false, false, false);
+    } else {
+      uint16_t page_ye = std::min<uint16_t>(page_ys + _page_height, HEIGHT);
+      epd2.writeNative(_buffer.data(), nullptr, 0, page_ys, WIDTH, page_ye - page_ys,
+                       false, false, false);
+    }
+    _current_page++;
+    if (_current_page == _pages) {
+      _current_page = 0;
+      if (_using_partial_mode) {
+        epd2.refresh(_pw_x, _pw_y, _pw_w, _pw_h);
+      } else {
+        epd2.refresh(false);
+      }
+      epd2.powerOff();
+      return false;
+    }
+    fillScreen(GxEPD_WHITE);
+    return true;
+  }
+
+  void hibernate() { epd2.hibernate(); }
+  void powerOff() { epd2.powerOff(); }
+
+private:
+  static uint8_t color7(uint16_t color) {
+    switch (color) {
+      case GxEPD_BLACK: return 0x00;
+      case GxEPD_WHITE: return 0x01;
+      case GxEPD_GREEN: return 0x02;
+      case GxEPD_BLUE: return 0x03;
+      case GxEPD_RED: return 0x04;
+      case GxEPD_YELLOW: return 0x05;
+      case GxEPD_ORANGE: return 0x06;
+      default: return ((color >> 11) + ((color >> 5) & 0x3F) / 2 + (color & 0x1F)) > 48 ? 0x01 : 0x00;
+    }
+  }
+
+  void rotate(int16_t& x, int16_t& y) {
+    switch (getRotation()) {
+      case 1:
+        std::swap(x, y);
+        x = WIDTH - x - 1;
+        break;
+      case 2:
+        x = WIDTH - x - 1;
+        y = HEIGHT - y - 1;
+        break;
+      case 3:
+        std::swap(x, y);
+        y = HEIGHT - y - 1;
+        break;
+    }
+  }
+
+  void rotateRect(int16_t& x, int16_t& y, int16_t& w, int16_t& h) {
+    switch (getRotation()) {
+      case 1:
+        std::swap(x, y);
+        std::swap(w, h);
+        x = WIDTH - x - w;
+        break;
+      case 2:
+        x = WIDTH - x - w;
+        y = HEIGHT - y - h;
+        break;
+      case 3:
+        std::swap(x, y);
+        std::swap(w, h);
+        y = HEIGHT - y - h;
+        break;
+    }
+  }
+
+  std::vector<uint8_t> _buffer;
+  bool _using_partial_mode = false;
+  int16_t _pw_x = 0, _pw_y = 0, _pw_w = 0, _pw_h = 0;
+  uint16_t _page_height;
+  uint16_t _pages;
+  uint16_t _current_page = 0;
+};
+
+#endif
@@ -0,0 +1,39 @@
+/*
+ * Host Simulation - QRCode
+ * Same API as the QRCode library. The modules are finder patterns plus a
+ * hash of the text: right size and layout, but not a scannable code.
+ *
+ * Repository: https://github.com/9carlo6/E-Paper
+ * @author 9carlo6
+ * @date 2025
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (c) 2025 9carlo6
+ * All rights reserved.
+ */
+
+#ifndef HOST_QRCODE_LIBRARY_H
+#define HOST_QRCODE_LIBRARY_H
+
+#include <cstdint>
+
+#define ECC_LOW      0
+#define ECC_MEDIUM   1
+#define ECC_QUARTILE 2
+#define ECC_HIGH     3
+
+typedef struct QRCode {
+  uint8_t version;
+  uint8_t size;
+  uint8_t ecc;
+  uint8_t mode;
+  uint8_t mask;
+  uint8_t* modules;
+} QRCode;
+
+uint16_t qrcode_getBufferSize(uint8_t version);
+int8_t qrcode_initText(QRCode* qrcode, uint8_t* modules, uint8_t version, uint8_t ecc, const char* data);
+bool qrcode_getModule(QRCode* qrcode, uint8_t x, uint8_t y);
+
+#endif
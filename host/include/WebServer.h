@@ -0,0 +1,168 @@
+/*
+ * Host Simulation - WebServer
+ * Single-client HTTP/1.1 server on a local TCP socket with the same
+ * handler, argument, multipart and raw upload API as the ESP32 WebServer.
+ *
+ * Repository: https://github.com/9carlo6/E-Paper
+ * @author 9carlo6
+ * @date 2025
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (c) 2025 9carlo6
+ * All rights reserved.
+ */
+
+#ifndef HOST_WEBSERVER_H
+#define HOST_WEBSERVER_H
+
+#include <Arduino.h>
+#include <uri/UriBraces.h>
+#include <functional>
+#include <vector>
+#include <utility>
+
+#define HTTP_UPLOAD_BUFLEN 1436
+#define HTTP_RAW_BUFLEN 1436
+#define CONTENT_LENGTH_UNKNOWN ((size_t)-1)
+
+enum HTTPMethod {
+  HTTP_ANY,
+  HTTP_DELETE,
+  HTTP_GET,
+  HTTP_HEAD,
+  HTTP_POST,
+  HTTP_PUT,
+  HTTP_PATCH,
+  HTTP_OPTIONS
+};
+
+enum HTTPUploadStatus {
+  UPLOAD_FILE_START,
+  UPLOAD_FILE_WRITE,
+  UPLOAD_FILE_END,
+  UPLOAD_FILE_ABORTED
+};
+
+enum HTTPRawStatus {
+  RAW_START,
+  RAW_WRITE,
+  RAW_END,
+  RAW_ABORTED
+};
+
+struct HTTPRaw {
+  HTTPRawStatus status;
+  size_t totalSize;
+  size_t currentSize;
+  uint8_t buf[HTTP_RAW_BUFLEN];
+  void* data;
+};
+
+struct HTTPUpload {
+  HTTPUploadStatus status;
+  String filename;
+  String name;
+  String type;
+  size_t totalSize;
+  size_t currentSize;
+  uint8_t buf[HTTP_UPLOAD_BUFLEN];
+};
+
+class WebServer {
+public:
+  typedef std::function<void(void)> THandlerFunction;
+
+  WebServer(int port = 80);
+  ~WebServer();
+
+  void begin();
+  void begin(uint16_t port);
+  void close();
+  void stop() { close(); }
+  void handleClient();
+
+  void on(const String& uri, THandlerFunction handler) { on(uri, HTTP_ANY, handler); }
+  void on(const String& uri, HTTPMethod method, THandlerFunction fn) { on(uri, method, fn, nullptr); }
+  void on(const String& uri, HTTPMethod method, THandlerFunction fn, THandlerFunction ufn);
+  void on(const UriBraces& uri, HTTPMethod method, THandlerFunction fn, THandlerFunction ufn = nullptr);
+  void onNotFound(THandlerFunction fn) { _notFoundHandler = fn; }
+
+  String uri() const { return _currentUri; }
+  HTTPMethod method() const { return _currentMethod; }
+  HTTPUpload& upload() { return _upload; }
+  HTTPRaw& raw() { return _raw; }
+  size_t clientContentLength() const { return _clientContentLength; }
+
+  String arg(const String& name) const;
+  String arg(int i) const;
+  String argName(int i) const;
+  int args() const { return (int)_args.size(); }
+  bool hasArg(const String& name) const;
+  String pathArg(unsigned int i) const { return i < _pathArgs.size() ? _pathArgs[i] : String(); }
+
+  void collectHeaders(const char* headerKeys[], const size_t headerKeysCount);
+  String header(const String& name) const;
+  bool hasHeader(const String& name) const;
+  int headers() const { return (int)_headers.size(); }
+
+  void send(int code, const char* contentType = nullptr, const String& content = String());
+  void send(int code, const String& contentType, const String& content) {
+    send(code, contentType.c_str(), content);
+  }
+  void send(int code, const char* contentType, const char* content) {
+    send(code, contentType, String(content));
+  }
+  void send_P(int code, PGM_P contentType, PGM_P content);
+  void send_P(int code, PGM_P contentType, PGM_P content, size_t contentLength);
+  void sendHeader(const String& name, const String& value, bool first = false);
+  void setContentLength(const size_t contentLength) {
+    _contentLength = contentLength;
+    _contentLengthSet = true;
+  }
+  void sendContent(const String& content) { sendContent(content.c_str(), content.length()); }
+  void sendContent(const char* content, size_t size);
+
+private:
+  struct Handler {
+    String uri;
+    HTTPMethod method;
+    THandlerFunction fn;
+    THandlerFunction ufn;
+    bool braces;
+  };
+
+  void handleRequest();
+  bool readLine(std::string& line);
+  bool readBytes(std::string& out, size_t len);
+  bool parseMultipart(const std::string& body, const std::string& boundary, Handler* handler);
+  void deliverRaw(const std::string& body, Handler* handler, bool aborted);
+  void parseArguments(const std::string& data);
+  void sendResponseHead(int code, const char* contentType, size_t contentLength);
+  void writeClient(const char* data, size_t len);
+
+  int _port;
+  int _listenFd = -1;
+  int _clientFd = -1;
+  std::string _readBuffer;
+
+  std::vector<Handler> _handlers;
+  THandlerFunction _notFoundHandler;
+
+  String _currentUri;
+  HTTPMethod _currentMethod = HTTP_ANY;
+  std::vector<std::pair<String, String>> _args;
+  std::vector<String> _pathArgs;
+  std::vector<String> _collectedHeaderKeys;
+  std::vector<std::pair<String, String>> _headers;
+  std::vector<std::pair<String, String>> _responseHeaders;
+  HTTPUpload _upload;
+  HTTPRaw _raw;
+  size_t _clientContentLength = 0;
+  size_t _contentLength = CONTENT_LENGTH_UNKNOWN;
+  bool _contentLengthSet = false;
+  bool _responseStarted = false;
+  bool _chunked = false;
+};
+
+#endif
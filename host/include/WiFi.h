@@ -0,0 +1,110 @@
+/*
+ * Host Simulation - WiFi
+ * Station mode "connects" to the loopback interface unless
+ * SimConfig::wifiFail is set. The connect runs in the background and ends
+ * with an event, like on the ESP32; a scan and DHCP can be made slow.
+ *
+ * Repository: https://github.com/9carlo6/E-Paper
+ * @author 9carlo6
+ * @date 2025
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (c) 2025 9carlo6
+ * All rights reserved.
+ */
+
+#ifndef HOST_WIFI_H
+#define HOST_WIFI_H
+
+#include <Arduino.h>
+
+typedef enum {
+  WL_NO_SHIELD = 255,
+  WL_IDLE_STATUS = 0,
+  WL_NO_SSID_AVAIL = 1,
+  WL_SCAN_COMPLETED = 2,
+  WL_CONNECTED = 3,
+  WL_CONNECT_FAILED = 4,
+  WL_CONNECTION_LOST = 5,
+  WL_DISCONNECTED = 6
+} wl_status_t;
+
+typedef enum {
+  WIFI_OFF = 0,
+  WIFI_STA = 1,
+  WIFI_AP = 2,
+  WIFI_AP_STA = 3
+} wifi_mode_t;
+
+typedef enum {
+  ARDUINO_EVENT_WIFI_STA_CONNECTED,
+  ARDUINO_EVENT_WIFI_STA_DISCONNECTED,
+  ARDUINO_EVENT_WIFI_STA_GOT_IP,
+  ARDUINO_EVENT_MAX
+} arduino_event_id_t;
+
+typedef void (*WiFiEventCb)(arduino_event_id_t event);
+typedef size_t wifi_event_id_t;
+
+class IPAddress {
+public:
+  IPAddress() : _addr{0, 0, 0, 0} {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : _addr{a, b, c, d} {}
+  explicit IPAddress(uint32_t addr) {
+    memcpy(_addr, &addr, 4);
+  }
+
+  operator uint32_t() const {
+    uint32_t addr;
+    memcpy(&addr, _addr, 4);
+    return addr;
+  }
+  uint8_t operator[](int index) const { return _addr[index]; }
+  uint8_t& operator[](int index) { return _addr[index]; }
+  bool operator==(const IPAddress& rhs) const { return memcmp(_addr, rhs._addr, 4) == 0; }
+
+  bool fromString(const char* address);
+  bool fromString(const String& address) { return fromString(address.c_str()); }
+  String toString() const;
+
+private:
+  uint8_t _addr[4];
+};
+
+class WiFiClass {
+public:
+  bool mode(wifi_mode_t m) { _mode = m; return true; }
+  wifi_mode_t getMode() const { return _mode; }
+
+  void persistent(bool persistent) { (void)persistent; }
+  wl_status_t begin(const char* ssid, const char* passphrase = nullptr, int32_t channel = 0,
+                    const uint8_t* bssid = nullptr, bool connect = true);
+  bool config(IPAddress localIP, IPAddress gateway, IPAddress subnet,
+              IPAddress dns1 = IPAddress(), IPAddress dns2 = IPAddress());
+  bool disconnect(bool wifiOff = false, bool eraseAp = false);
+  wl_status_t status() const;
+  wifi_event_id_t onEvent(WiFiEventCb callback, arduino_event_id_t event = ARDUINO_EVENT_MAX);
+
+  IPAddress localIP() const { return status() == WL_CONNECTED ? IPAddress(127, 0, 0, 1) : IPAddress(); }
+  IPAddress gatewayIP() const { return status() == WL_CONNECTED ? IPAddress(127, 0, 0, 254) : IPAddress(); }
+  IPAddress subnetMask() const { return status() == WL_CONNECTED ? IPAddress(255, 255, 255, 0) : IPAddress(); }
+  IPAddress dnsIP(uint8_t index = 0) const { return status() == WL_CONNECTED && index == 0 ? gatewayIP() : IPAddress(); }
+  int8_t RSSI() const { return status() == WL_CONNECTED ? -55 : 0; }
+  String SSID() const { return _ssid; }
+  uint8_t* BSSID();
+  int32_t channel() const { return status() == WL_CONNECTED ? 6 : 0; }
+
+  bool softAP(const char* ssid, const char* passphrase = nullptr, int channel = 1,
+              int ssidHidden = 0, int maxConnection = 4);
+  IPAddress softAPIP() const { return IPAddress(127, 0, 0, 1); }
+
+private:
+  wifi_mode_t _mode = WIFI_OFF;
+  String _ssid;
+  bool _staticIP = false;
+};
+
+extern WiFiClass WiFi;
+
+#endif
@@ -0,0 +1,56 @@
+/*
+ * Host Simulation - TJpgDec, the JPEG decoder in the ESP32 ROM
+ * Same API and output order: RGB888 blocks of one MCU, left to right and
+ * top to bottom, in the coordinates of the 1/2^scale image. Built on
+ * libjpeg when CMake finds it; without it every JPEG is unsupported.
+ *
+ * Repository: https://github.com/9carlo6/E-Paper
+ * @author 9carlo6
+ * @date 2025
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (c) 2025 9carlo6
+ * All rights reserved.
+ */
+
+#ifndef HOST_TJPGD_H
+#define HOST_TJPGD_H
+
+#include <cstdint>
+
+typedef enum {
+  JDR_OK = 0,  // Succeeded
+  JDR_INTR,    // Interrupted by the output function
+  JDR_INP,     // Input stream ended or failed
+  JDR_MEM1,    // Pool too small
+  JDR_MEM2,    // Pool too small
+  JDR_PAR,     // Bad parameter
+  JDR_FMT1,    // Data format error (may be damaged data)
+  JDR_FMT2,    // Right format but not supported
+  JDR_FMT3     // Not supported JPEG standard (progressive, grayscale)
+} JRESULT;
+
+typedef struct {
+  uint16_t left, right, top, bottom;
+} JRECT;
+
+typedef struct JDEC JDEC;
+
+// Only the public fields of the ROM structure; the rest is private state
+struct JDEC {
+  uint8_t scale;
+  uint8_t msx, msy;  // MCU size in 8x8 blocks
+  uint32_t width, height;
+  void* workbuf;     // Host: the libjpeg decoder
+  void* pool;
+  uint32_t sz_pool;
+  uint32_t (*infunc)(JDEC*, uint8_t*, uint32_t);  // buffer nullptr: skip
+  void* device;
+};
+
+JRESULT jd_prepare(JDEC* jd, uint32_t (*infunc)(JDEC*, uint8_t*, uint32_t), void* pool, uint32_t sz_pool,
+                   void* dev);
+JRESULT jd_decomp(JDEC* jd, uint32_t (*outfunc)(JDEC*, void*, JRECT*), uint8_t scale);
+
+#endif
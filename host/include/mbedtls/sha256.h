@@ -0,0 +1,36 @@
+/*
+ * Host Simulation - mbedTLS SHA-256
+ * The calls the sketch makes, in software; the ESP32 build uses the
+ * hardware-accelerated mbedTLS of the Arduino core.
+ *
+ * Repository: https://github.com/9carlo6/E-Paper
+ * @author 9carlo6
+ * @date 2025
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (c) 2025 9carlo6
+ * All rights reserved.
+ */
+
+#ifndef HOST_MBEDTLS_SHA256_H
+#define HOST_MBEDTLS_SHA256_H
+
+#include <cstddef>
+#include <cstdint>
+
+struct mbedtls_sha256_context {
+  uint32_t state[8];
+  uint64_t length;  // Bytes hashed so far
+  uint8_t block[64];
+  size_t used;      // Bytes waiting in block
+  bool is224;
+};
+
+void mbedtls_sha256_init(mbedtls_sha256_context* ctx);
+void mbedtls_sha256_free(mbedtls_sha256_context* ctx);
+int mbedtls_sha256_starts(mbedtls_sha256_context* ctx, int is224);
+int mbedtls_sha256_update(mbedtls_sha256_context* ctx, const unsigned char* input, size_t ilen);
+int mbedtls_sha256_finish(mbedtls_sha256_context* ctx, unsigned char* output);
+
+#endif
@@ -0,0 +1,60 @@
+/*
+ * Host Simulation - Runtime settings and statistics
+ * Shared between the mocks and the simulator entry point.
+ *
+ * Repository: https://github.com/9carlo6/E-Paper
+ * @author 9carlo6
+ * @date 2025
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (c) 2025 9carlo6
+ * All rights reserved.
+ */
+
+#ifndef HOST_SIM_H
+#define HOST_SIM_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <esp_sleep.h>
+
+struct SimConfig {
+  std::string dataDir = "sim_data";     // SPIFFS and Preferences live here
+  std::string pngPath = "";             // Panel dump after every refresh (default: dataDir/display.png)
+  uint16_t httpPort = 8080;             // Replaces port 80 of the sketch
+  uint32_t freeHeap = 200000;           // Reported by ESP.getFreeHeap()
+  uint32_t psramSize = 0;               // Available to ps_malloc() (0: no PSRAM)
+  bool wifiFail = false;                // Make WiFi.begin() never connect
+  uint32_t wifiScanMs = 0;              // Emulated scan, skipped when channel and BSSID are given
+  uint32_t wifiDhcpMs = 0;              // Emulated DHCP, skipped with a static address
+  uint32_t refreshMs = 0;               // Panel busy time emulated by every refresh
+  uint32_t maxSleepMs = 0;              // Caps deep sleep so timer wakes come sooner (0: real time)
+  esp_sleep_wakeup_cause_t wakeCause = ESP_SLEEP_WAKEUP_UNDEFINED;
+  std::vector<std::string> args;        // Command line, to restart after deep sleep
+};
+
+struct SimDisplayStats {
+  uint64_t drawPixel = 0;        // drawPixel() calls
+  uint64_t drawPixelClipped = 0; // ... of which outside the current page
+  uint64_t fillScreen = 0;
+  uint64_t fillRect = 0;
+  uint64_t drawRect = 0;
+  uint64_t textChars = 0;
+  uint64_t pages = 0;            // nextPage() calls
+  uint64_t writeNative = 0;      // controller RAM writes
+  uint64_t writeNativeBytes = 0;
+  uint64_t refreshes = 0;
+};
+
+extern SimConfig simConfig;
+extern SimDisplayStats simDisplayStats;
+
+void simPrintDisplayStats();
+void simResetDisplayStats();
+std::string simPath(const char* path);
+bool simLoadRtcMemory();
+
+#endif
@@ -0,0 +1,55 @@
+/*
+ * Host Simulation - UriBraces
+ * Route pattern where every "{}" matches one path segment, read back with
+ * WebServer::pathArg().
+ *
+ * Repository: https://github.com/9carlo6/E-Paper
+ * @author 9carlo6
+ * @date 2025
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (c) 2025 9carlo6
+ * All rights reserved.
+ */
+
+#ifndef HOST_URI_BRACES_H
+#define HOST_URI_BRACES_H
+
+#include <Arduino.h>
+
+#include <vector>
+
+class UriBraces {
+public:
+  explicit UriBraces(const char* uri) : _uri(uri) {}
+  explicit UriBraces(const String& uri) : _uri(uri) {}
+
+  const String& pattern() const { return _uri; }
+
+  bool match(const String& path, std::vector<String>& pathArgs) const {
+    pathArgs.clear();
+    unsigned int u = 0, p = 0;
+    while (u < _uri.length()) {
+      if (_uri.substring(u, u + 2) == "{}") {
+        unsigned int end = p;
+        while (end < path.length() && path[end] != '/') end++;
+        if (end == p) return false;
+        pathArgs.push_back(path.substring(p, end));
+        u += 2;
+        p = end;
+      } else if (p < path.length() && _uri[u] == path[p]) {
+        u++;
+        p++;
+      } else {
+        return false;
+      }
+    }
+    return p == path.length();
+  }
+
+private:
+  String _uri;
+};
+
+#endif
@@ -0,0 +1,127 @@
+/*
+ * Host Simulation - Entry point
+ * Compiles the sketch as a regular C++ translation unit against the mocks
+ * in host/include and drives setup()/loop(), or runs a single refresh so
+ * the hot paths can be profiled (perf, valgrind, sanitizers).
+ *
+ * Repository: https://github.com/9carlo6/E-Paper
+ * @author 9carlo6
+ * @date 2025
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (c) 2025 9carlo6
+ * All rights reserved.
+ */
+
+#include <Arduino.h>
+
+#include "../E-Paper.ino"
+
+#include <fstream>
+#include <iterator>
+
+#include "sim.h"
+
+SimConfig simConfig;
+
+static void printUsage(const char* argv0) {
+  printf("Usage: %s [options]\n"
+         "  --data DIR        Directory holding SPIFFS and Preferences (default: sim_data)\n"
+         "  --port N          HTTP port replacing port 80 (default: 8080)\n"
+         "  --png FILE        Panel dump written on every refresh (default: DIR/display.png)\n"
+         "  --heap BYTES      Free heap reported by ESP.getFreeHeap() (default: 200000)\n"
+         "  --psram BYTES     PSRAM of the board, enables the frame cache (default: 0)\n"
+         "  --wifi-fail       Station mode never connects (exercises the AP fallback)\n"
+         "  --wifi-scan-ms N  Emulated Wi-Fi scan time, skipped by a cached BSSID (default: 0)\n"
+         "  --wifi-dhcp-ms N  Emulated DHCP time, skipped by a cached address (default: 0)\n"
+         "  --refresh-ms N    Emulated panel refresh time (default: 0)\n"
+         "  --max-sleep-ms N  Cap on every deep sleep, for quick timer wakes (default: real time)\n"
+         "  --wake CAUSE      Boot as a deep sleep wake (timer or button) with the saved RTC memory\n"
+         "  --render FILE     Store FILE as %s, refresh the display once and exit\n"
+         "  --repeat N        Refresh N times with --render (default: 1)\n"
+         "  --benchmark       Run the render benchmark on %s and exit\n"
+         "  --run-for SEC     Exit after SEC seconds of loop() (default: run forever)\n",
+         argv0, IMAGE_FILE, IMAGE_FILE);
+}
+
+static bool storeImage(const char* source) {
+  std::ifstream in(source, std::ios::binary);
+  if (!in) {
+    printf("✗ Cannot read %s\n", source);
+    return false;
+  }
+  std::string data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+  File f = SPIFFS.open(IMAGE_FILE, FILE_WRITE);
+  if (!f) return false;
+  f.write((const uint8_t*)data.data(), data.size());
+  f.close();
+  return true;
+}
+
+// Anything else boots as a power-on
+static esp_sleep_wakeup_cause_t parseWakeCause(const char* cause) {
+  if (strcmp(cause, "timer") == 0) return ESP_SLEEP_WAKEUP_TIMER;
+  if (strcmp(cause, "button") == 0) return ESP_SLEEP_WAKEUP_EXT0;
+  return ESP_SLEEP_WAKEUP_UNDEFINED;
+}
+
+int main(int argc, char** argv) {
+  const char* renderFile = nullptr;
+  int repeat = 1;
+  bool benchmark = false;
+  long runFor = 0;
+
+  simConfig.args.assign(argv, argv + argc);
+  for (int i = 1; i < argc; i++) {
+    String arg = argv[i];
+    bool hasValue = i + 1 < argc;
+    if (arg == "--data" && hasValue) simConfig.dataDir = argv[++i];
+    else if (arg == "--port" && hasValue) simConfig.httpPort = atoi(argv[++i]);
+    else if (arg == "--png" && hasValue) simConfig.pngPath = argv[++i];
+    else if (arg == "--heap" && hasValue) simConfig.freeHeap = strtoul(argv[++i], nullptr, 10);
+    else if (arg == "--psram" && hasValue) simConfig.psramSize = strtoul(argv[++i], nullptr, 10);
+    else if (arg == "--wifi-fail") simConfig.wifiFail = true;
+    else if (arg == "--wifi-scan-ms" && hasValue) simConfig.wifiScanMs = strtoul(argv[++i], nullptr, 10);
+    else if (arg == "--wifi-dhcp-ms" && hasValue) simConfig.wifiDhcpMs = strtoul(argv[++i], nullptr, 10);
+    else if (arg == "--refresh-ms" && hasValue) simConfig.refreshMs = strtoul(argv[++i], nullptr, 10);
+    else if (arg == "--max-sleep-ms" && hasValue) simConfig.maxSleepMs = strtoul(argv[++i], nullptr, 10);
+    else if (arg == "--wake" && hasValue) simConfig.wakeCause = parseWakeCause(argv[++i]);
+    else if (arg == "--render" && hasValue) renderFile = argv[++i];
+    else if (arg == "--repeat" && hasValue) repeat = atoi(argv[++i]);
+    else if (arg == "--benchmark") benchmark = true;
+    else if (arg == "--run-for" && hasValue) runFor = atol(argv[++i]);
+    else {
+      printUsage(argv[0]);
+      return arg == "--help" || arg == "-h" ? 0 : 1;
+    }
+  }
+  setvbuf(stdout, nullptr, _IOLBF, 0);
+
+  if (renderFile || benchmark) {
+    SPIFFS.begin(true);
+    initDisplay();
+    frameCacheBegin();
+    if (renderFile && !storeImage(renderFile)) return 1;
+
+    if (benchmark) {
+      benchmarkRenderPaths();
+    }
+    for (int i = 0; renderFile && i < repeat; i++) {
+      simResetDisplayStats();
+      displayImageFromSPIFFS();
+      simPrintDisplayStats();
+    }
+    return 0;
+  }
+
+  if (simConfig.wakeCause != ESP_SLEEP_WAKEUP_UNDEFINED && !simLoadRtcMemory()) {
+    printf("⚠ No RTC memory saved in %s, waking with it cleared\n", simConfig.dataDir.c_str());
+  }
+  setup();
+  unsigned long start = millis();
+  while (runFor <= 0 || millis() - start < (unsigned long)runFor * 1000) {
+    loop();
+  }
+  return 0;
+}
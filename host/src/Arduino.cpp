@@ -0,0 +1,264 @@
+/*
+ * Host Simulation - Arduino core implementation
+ *
+ * Repository: https://github.com/9carlo6/E-Paper
+ * @author 9carlo6
+ * @date 2025
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (c) 2025 9carlo6
+ * All rights reserved.
+ */
+
+#include <Arduino.h>
+
+#include <chrono>
+#include <thread>
+#include <cctype>
+
+#include "sim.h"
+
+HardwareSerial Serial;
+EspClass ESP;
+
+/* ========================================
+   TIMING & GPIO
+   ======================================== */
+
+static const auto simStartTime = std::chrono::steady_clock::now();
+
+unsigned long millis() {
+  return (unsigned long)std::chrono::duration_cast<std::chrono::milliseconds>(
+    std::chrono::steady_clock::now() - simStartTime).count();
+}
+
+unsigned long micros() {
+  return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - simStartTime).count();
+}
+
+void delay(unsigned long ms) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void delayMicroseconds(unsigned int us) {
+  std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+void yield() {
+  std::this_thread::yield();
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {
+  (void)pin;
+  (void)mode;
+}
+
+void digitalWrite(uint8_t pin, uint8_t val) {
+  (void)pin;
+  (void)val;
+}
+
+int digitalRead(uint8_t pin) {
+  (void)pin;
+  return HIGH;
+}
+
+/* ========================================
+   STRING
+   ======================================== */
+
+static std::string formatInteger(unsigned long long value, bool negative, unsigned char base) {
+  if (base < 2 || base > 36) base = 10;
+  std::string digits;
+  do {
+    int d = value % base;
+    digits.insert(digits.begin(), (char)(d < 10 ? '0' + d : 'a' + d - 10));
+    value /= base;
+  } while (value);
+  if (negative) digits.insert(digits.begin(), '-');
+  return digits;
+}
+
+String::String(int value, unsigned char base)
+  : _s(formatInteger(value < 0 ? -(long long)value : value, value < 0, base)) {}
+String::String(unsigned int value, unsigned char base) : _s(formatInteger(value, false, base)) {}
+String::String(long value, unsigned char base)
+  : _s(formatInteger(value < 0 ? -(long long)value : value, value < 0, base)) {}
+String::String(unsigned long value, unsigned char base) : _s(formatInteger(value, false, base)) {}
+String::String(long long value, unsigned char base)
+  : _s(formatInteger(value < 0 ? -(unsigned long long)value : value, value < 0, base)) {}
+String::String(unsigned long long value, unsigned char base) : _s(formatInteger(value, false, base)) {}
+
+String::String(double value, unsigned int decimals) {
+  char buf[64];
+  snprintf(buf, sizeof(buf), "%.*f", (int)decimals, value);
+  _s = buf;
+}
+
+String::String(float value, unsigned int decimals) : String((double)value, decimals) {}
+
+bool String::equalsIgnoreCase(const String& s) const {
+  if (_s.size() != s._s.size()) return false;
+  for (size_t i = 0; i < _s.size(); i++) {
+    if (tolower((unsigned char)_s[i]) != tolower((unsigned char)s._s[i])) return false;
+  }
+  return true;
+}
+
+int String::indexOf(char c, unsigned int from) const {
+  size_t pos = _s.find(c, from);
+  return pos == std::string::npos ? -1 : (int)pos;
+}
+
+int String::indexOf(const String& s, unsigned int from) const {
+  size_t pos = _s.find(s._s, from);
+  return pos == std::string::npos ? -1 : (int)pos;
+}
+
+int String::lastIndexOf(char c) const {
+  size_t pos = _s.rfind(c);
+  return pos == std::string::npos ? -1 : (int)pos;
+}
+
+bool String::endsWith(const String& suffix) const {
+  return _s.size() >= suffix._s.size() &&
+         _s.compare(_s.size() - suffix._s.size(), suffix._s.size(), suffix._s) == 0;
+}
+
+String String::substring(unsigned int from, unsigned int to) const {
+  if (from > to) std::swap(from, to);
+  if (from >= _s.size()) return String();
+  return String(_s.substr(from, to - from));
+}
+
+void String::toLowerCase() {
+  for (auto& c : _s) c = (char)tolower((unsigned char)c);
+}
+
+void String::toUpperCase() {
+  for (auto& c : _s) c = (char)toupper((unsigned char)c);
+}
+
+void String::trim() {
+  size_t start = _s.find_first_not_of(" \t\r\n");
+  size_t end = _s.find_last_not_of(" \t\r\n");
+  _s = (start == std::string::npos) ? std::string() : _s.substr(start, end - start + 1);
+}
+
+void String::replace(const String& find, const String& with) {
+  if (find._s.empty()) return;
+  size_t pos = 0;
+  while ((pos = _s.find(find._s, pos)) != std::string::npos) {
+    _s.replace(pos, find._s.size(), with._s);
+    pos += with._s.size();
+  }
+}
+
+void String::remove(unsigned int index, unsigned int count) {
+  if (index < _s.size()) _s.erase(index, count);
+}
+
+String operator+(const String& lhs, const String& rhs) {
+  return String(lhs.str() + rhs.str());
+}
+
+String operator+(const char* lhs, const String& rhs) {
+  return String(std::string(lhs ? lhs : "") + rhs.str());
+}
+
+String operator+(const String& lhs, const char* rhs) {
+  return String(lhs.str() + (rhs ? rhs : ""));
+}
+
+String operator+(const String& lhs, char rhs) {
+  return String(lhs.str() + rhs);
+}
+
+/* ========================================
+   PRINT & SERIAL
+   ======================================== */
+
+size_t Print::write(const uint8_t* buffer, size_t size) {
+  size_t n = 0;
+  while (size--) n += write(*buffer++);
+  return n;
+}
+
+size_t Print::printf(const char* format, ...) {
+  char stackBuf[256];
+  va_list args;
+  va_start(args, format);
+  va_list copy;
+  va_copy(copy, args);
+  int len = vsnprintf(stackBuf, sizeof(stackBuf), format, copy);
+  va_end(copy);
+  if (len < 0) {
+    va_end(args);
+    return 0;
+  }
+  if ((size_t)len < sizeof(stackBuf)) {
+    va_end(args);
+    return write((const uint8_t*)stackBuf, len);
+  }
+  std::string heapBuf(len + 1, '\0');
+  vsnprintf(&heapBuf[0], heapBuf.size(), format, args);
+  va_end(args);
+  return write((const uint8_t*)heapBuf.data(), len);
+}
+
+void HardwareSerial::flush() {
+  fflush(stdout);
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+  return fputc(c, stdout) == EOF ? 0 : 1;
+}
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size) {
+  return fwrite(buffer, 1, size, stdout);
+}
+
+/* ========================================
+   ESP OBJECT
+   ======================================== */
+
+void EspClass::restart() {
+  Serial.println("[sim] ESP.restart() requested - exiting");
+  fflush(stdout);
+  exit(0);
+}
+
+uint32_t EspClass::getFreeHeap() {
+  return simConfig.freeHeap;
+}
+
+uint32_t EspClass::getMaxAllocHeap() {
+  return simConfig.freeHeap;
+}
+
+uint32_t EspClass::getHeapSize() {
+  return 327680;
+}
+
+static size_t psramUsed = 0;
+
+uint32_t EspClass::getPsramSize() {
+  return simConfig.psramSize;
+}
+
+uint32_t EspClass::getFreePsram() {
+  return simConfig.psramSize - psramUsed;
+}
+
+bool psramFound() {
+  return simConfig.psramSize > 0;
+}
+
+// Never returned to the pool: the sketch allocates its PSRAM once at boot
+void* ps_malloc(size_t size) {
+  if (psramUsed + size > simConfig.psramSize) return nullptr;
+  psramUsed += size;
+  return malloc(size);
+}
@@ -0,0 +1,243 @@
+/*
+ * Host Simulation - FS and SPIFFS implementation
+ *
+ * Repository: https://github.com/9carlo6/E-Paper
+ * @author 9carlo6
+ * @date 2025
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (c) 2025 9carlo6
+ * All rights reserved.
+ */
+
+#include <FS.h>
+#include <SPIFFS.h>
+
+#include <filesystem>
+#include <vector>
+#include <sys/stat.h>
+
+#include "sim.h"
+
+namespace stdfs = std::filesystem;
+
+SPIFFSFS SPIFFS;
+
+static const size_t SPIFFS_TOTAL_BYTES = 1441792;  // Default 4MB partition scheme
+
+std::string simPath(const char* path) {
+  std::string p = path ? path : "";
+  if (p.empty() || p[0] != '/') p = "/" + p;
+  return simConfig.dataDir + "/spiffs" + p;
+}
+
+namespace fs {
+
+struct FileImpl {
+  FILE* fp = nullptr;
+  std::string path;
+  std::string name;
+  bool directory = false;
+  std::vector<std::string> entries;
+  size_t nextEntry = 0;
+
+  ~FileImpl() {
+    if (fp) fclose(fp);
+  }
+};
+
+size_t File::write(uint8_t c) {
+  return write(&c, 1);
+}
+
+size_t File::write(const uint8_t* buf, size_t size) {
+  if (!_impl || !_impl->fp) return 0;
+  return fwrite(buf, 1, size, _impl->fp);
+}
+
+int File::available() {
+  if (!_impl || !_impl->fp) return 0;
+  return (int)(size() - position());
+}
+
+int File::read() {
+  uint8_t c;
+  return read(&c, 1) == 1 ? c : -1;
+}
+
+size_t File::read(uint8_t* buf, size_t size) {
+  if (!_impl || !_impl->fp) return 0;
+  return fread(buf, 1, size, _impl->fp);
+}
+
+int File::peek() {
+  if (!_impl || !_impl->fp) return -1;
+  int c = fgetc(_impl->fp);
+  if (c != EOF) ungetc(c, _impl->fp);
+  return c == EOF ? -1 : c;
+}
+
+void File::flush() {
+  if (_impl && _impl->fp) fflush(_impl->fp);
+}
+
+bool File::seek(uint32_t pos, SeekMode mode) {
+  if (!_impl || !_impl->fp) return false;
+  int whence = mode == SeekCur ? SEEK_CUR : (mode == SeekEnd ? SEEK_END : SEEK_SET);
+  return fseek(_impl->fp, (long)pos, whence) == 0;
+}
+
+size_t File::position() const {
+  if (!_impl || !_impl->fp) return 0;
+  long pos = ftell(_impl->fp);
+  return pos < 0 ? 0 : (size_t)pos;
+}
+
+size_t File::size() const {
+  if (!_impl || !_impl->fp) return 0;
+  fflush(_impl->fp);
+  struct stat st;
+  return fstat(fileno(_impl->fp), &st) == 0 ? (size_t)st.st_size : 0;
+}
+
+void File::close() {
+  _impl.reset();
+}
+
+File::operator bool() const {
+  return _impl && (_impl->fp || _impl->directory);
+}
+
+const char* File::name() const {
+  return _impl ? _impl->name.c_str() : "";
+}
+
+const char* File::path() const {
+  return _impl ? _impl->path.c_str() : "";
+}
+
+bool File::isDirectory() const {
+  return _impl && _impl->directory;
+}
+
+File File::openNextFile(const char* mode) {
+  if (!_impl || !_impl->directory || _impl->nextEntry >= _impl->entries.size()) {
+    return File();
+  }
+  return SPIFFS.open(_impl->entries[_impl->nextEntry++].c_str(), mode);
+}
+
+void File::rewindDirectory() {
+  if (_impl) _impl->nextEntry = 0;
+}
+
+time_t File::getLastWrite() {
+  if (!_impl) return 0;
+  struct stat st;
+  return stat(simPath(_impl->path.c_str()).c_str(), &st) == 0 ? st.st_mtime : 0;
+}
+
+/* ========================================
+   FILE SYSTEM
+   ======================================== */
+
+File FS::open(const char* path, const char* mode, bool create) {
+  (void)create;
+  std::string hostPath = simPath(path);
+  auto impl = std::make_shared<FileImpl>();
+  impl->path = path;
+  impl->name = stdfs::path(path).filename().string();
+
+  std::error_code ec;
+  if (stdfs::is_directory(hostPath, ec)) {
+    // SPIFFS is flat: a directory lists every file below it
+    impl->directory = true;
+    std::string root = simPath("/");
+    for (auto& entry : stdfs::recursive_directory_iterator(hostPath, ec)) {
+      if (entry.is_regular_file()) {
+        impl->entries.push_back("/" + stdfs::relative(entry.path(), root).generic_string());
+      }
+    }
+    std::sort(impl->entries.begin(), impl->entries.end());
+    return File(impl);
+  }
+
+  std::string fmode = mode;
+  if (fmode.find('b') == std::string::npos) fmode += "b";
+  if (fmode[0] == 'r') {
+    if (fmode.find('+') == std::string::npos && !stdfs::exists(hostPath, ec)) return File();
+  } else {
+    stdfs::create_directories(stdfs::path(hostPath).parent_path(), ec);
+  }
+
+  impl->fp = fopen(hostPath.c_str(), fmode.c_str());
+  if (!impl->fp) return File();
+  return File(impl);
+}
+
+bool FS::exists(const char* path) {
+  std::error_code ec;
+  return stdfs::exists(simPath(path), ec);
+}
+
+bool FS::remove(const char* path) {
+  std::error_code ec;
+  return stdfs::remove(simPath(path), ec);
+}
+
+bool FS::rename(const char* from, const char* to) {
+  std::error_code ec;
+  // Like SPIFFS, refuse to replace an existing file
+  if (!stdfs::exists(simPath(from), ec) || stdfs::exists(simPath(to), ec)) return false;
+  stdfs::create_directories(stdfs::path(simPath(to)).parent_path(), ec);
+  stdfs::rename(simPath(from), simPath(to), ec);
+  return !ec;
+}
+
+bool FS::mkdir(const char* path) {
+  std::error_code ec;
+  stdfs::create_directories(simPath(path), ec);
+  return !ec;
+}
+
+bool FS::rmdir(const char* path) {
+  std::error_code ec;
+  return stdfs::remove(simPath(path), ec);
+}
+
+}  // namespace fs
+
+/* ========================================
+   SPIFFS
+   ======================================== */
+
+bool SPIFFSFS::begin(bool formatOnFail, const char* basePath, uint8_t maxOpenFiles,
+                     const char* partitionLabel) {
+  (void)formatOnFail;
+  (void)basePath;
+  (void)maxOpenFiles;
+  (void)partitionLabel;
+  std::error_code ec;
+  stdfs::create_directories(simPath("/"), ec);
+  return !ec;
+}
+
+bool SPIFFSFS::format() {
+  std::error_code ec;
+  stdfs::remove_all(simPath("/"), ec);
+  return begin();
+}
+
+size_t SPIFFSFS::totalBytes() {
+  return SPIFFS_TOTAL_BYTES;
+}
+
+size_t SPIFFSFS::usedBytes() {
+  size_t used = 0;
+  std::error_code ec;
+  for (auto& entry : stdfs::recursive_directory_iterator(simPath("/"), ec)) {
+    if (entry.is_regular_file()) used += entry.file_size();
+  }
+  return used;
+}
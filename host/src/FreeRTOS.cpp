@@ -0,0 +1,219 @@
+/*
+ * Host Simulation - FreeRTOS implementation
+ *
+ * Repository: https://github.com/9carlo6/E-Paper
+ * @author 9carlo6
+ * @date 2025
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (c) 2025 9carlo6
+ * All rights reserved.
+ */
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/* ========================================
+   TASKS
+   ======================================== */
+
+struct TaskControl {
+  std::string name;
+  BaseType_t coreId;
+};
+
+// Setup and loop run on core 1 with the Arduino core
+static thread_local BaseType_t currentCoreId = 1;
+
+static const auto tickStartTime = std::chrono::steady_clock::now();
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t code, const char* name, uint32_t, void* parameters,
+                                   UBaseType_t, TaskHandle_t* createdTask, BaseType_t coreId) {
+  TaskControl* task = new TaskControl{name ? name : "", coreId == tskNO_AFFINITY ? 0 : coreId};
+  if (createdTask) *createdTask = task;
+  // Tasks never return in FreeRTOS; the thread lives until the process exits
+  std::thread([=]() {
+    currentCoreId = task->coreId;
+    code(parameters);
+  }).detach();
+  return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t code, const char* name, uint32_t stackDepth, void* parameters,
+                       UBaseType_t priority, TaskHandle_t* createdTask) {
+  return xTaskCreatePinnedToCore(code, name, stackDepth, parameters, priority, createdTask, tskNO_AFFINITY);
+}
+
+void vTaskDelete(TaskHandle_t) {
+  // Deleting the calling task (nullptr) is the usual pattern; park the thread
+  while (true) std::this_thread::sleep_for(std::chrono::hours(1));
+}
+
+void vTaskDelay(TickType_t ticks) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(ticks * portTICK_PERIOD_MS));
+}
+
+TickType_t xTaskGetTickCount() {
+  return (TickType_t)std::chrono::duration_cast<std::chrono::milliseconds>(
+    std::chrono::steady_clock::now() - tickStartTime).count() / portTICK_PERIOD_MS;
+}
+
+BaseType_t xPortGetCoreID() {
+  return currentCoreId;
+}
+
+/* ========================================
+   QUEUES
+   ======================================== */
+
+struct QueueDefinition {
+  std::mutex mutex;
+  std::condition_variable notEmpty;
+  std::condition_variable notFull;
+  std::vector<uint8_t> storage;
+  UBaseType_t length;
+  UBaseType_t itemSize;
+  UBaseType_t head = 0;
+  UBaseType_t count = 0;
+};
+
+// Waits on cv until ready() holds; false on timeout
+template <typename Predicate>
+static bool waitFor(std::condition_variable& cv, std::unique_lock<std::mutex>& lock, TickType_t ticks, Predicate ready) {
+  if (ticks == portMAX_DELAY) {
+    cv.wait(lock, ready);
+    return true;
+  }
+  return cv.wait_for(lock, std::chrono::milliseconds(ticks * portTICK_PERIOD_MS), ready);
+}
+
+static BaseType_t queueSend(QueueHandle_t queue, const void* item, TickType_t ticksToWait, bool front) {
+  std::unique_lock<std::mutex> lock(queue->mutex);
+  if (!waitFor(queue->notFull, lock, ticksToWait, [&]() { return queue->count < queue->length; })) {
+    return errQUEUE_FULL;
+  }
+  UBaseType_t slot;
+  if (front) {
+    queue->head = (queue->head + queue->length - 1) % queue->length;
+    slot = queue->head;
+  } else {
+    slot = (queue->head + queue->count) % queue->length;
+  }
+  if (queue->itemSize) memcpy(&queue->storage[slot * queue->itemSize], item, queue->itemSize);
+  queue->count++;
+  queue->notEmpty.notify_one();
+  return pdPASS;
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize) {
+  if (length == 0) return nullptr;
+  QueueDefinition* queue = new QueueDefinition();
+  queue->length = length;
+  queue->itemSize = itemSize;
+  queue->storage.resize((size_t)length * itemSize);
+  return queue;
+}
+
+void vQueueDelete(QueueHandle_t queue) {
+  delete queue;
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t ticksToWait) {
+  return queueSend(queue, item, ticksToWait, false);
+}
+
+BaseType_t xQueueSendToBack(QueueHandle_t queue, const void* item, TickType_t ticksToWait) {
+  return queueSend(queue, item, ticksToWait, false);
+}
+
+BaseType_t xQueueSendToFront(QueueHandle_t queue, const void* item, TickType_t ticksToWait) {
+  return queueSend(queue, item, ticksToWait, true);
+}
+
+// Length 1 queues only, like the kernel: replaces the item if there is one
+BaseType_t xQueueOverwrite(QueueHandle_t queue, const void* item) {
+  std::lock_guard<std::mutex> lock(queue->mutex);
+  if (queue->itemSize) memcpy(&queue->storage[queue->head * queue->itemSize], item, queue->itemSize);
+  if (queue->count == 0) {
+    queue->count = 1;
+    queue->notEmpty.notify_one();
+  }
+  return pdPASS;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void* buffer, TickType_t ticksToWait) {
+  std::unique_lock<std::mutex> lock(queue->mutex);
+  if (!waitFor(queue->notEmpty, lock, ticksToWait, [&]() { return queue->count > 0; })) {
+    return errQUEUE_EMPTY;
+  }
+  if (queue->itemSize) memcpy(buffer, &queue->storage[queue->head * queue->itemSize], queue->itemSize);
+  queue->head = (queue->head + 1) % queue->length;
+  queue->count--;
+  queue->notFull.notify_one();
+  return pdPASS;
+}
+
+BaseType_t xQueueReset(QueueHandle_t queue) {
+  std::lock_guard<std::mutex> lock(queue->mutex);
+  queue->head = 0;
+  queue->count = 0;
+  queue->notFull.notify_all();
+  return pdPASS;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue) {
+  std::lock_guard<std::mutex> lock(queue->mutex);
+  return queue->count;
+}
+
+UBaseType_t uxQueueSpacesAvailable(QueueHandle_t queue) {
+  std::lock_guard<std::mutex> lock(queue->mutex);
+  return queue->length - queue->count;
+}
+
+/* ========================================
+   SEMAPHORES
+   ======================================== */
+
+SemaphoreHandle_t xSemaphoreCreateBinary() {
+  return xQueueCreate(1, 0);
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex() {
+  SemaphoreHandle_t mutex = xQueueCreate(1, 0);
+  xSemaphoreGive(mutex);
+  return mutex;
+}
+
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t maxCount, UBaseType_t initialCount) {
+  SemaphoreHandle_t semaphore = xQueueCreate(maxCount, 0);
+  while (semaphore && initialCount--) xSemaphoreGive(semaphore);
+  return semaphore;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticksToWait) {
+  return xQueueReceive(semaphore, nullptr, ticksToWait);
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore) {
+  return xQueueSend(semaphore, nullptr, 0);
+}
+
+UBaseType_t uxSemaphoreGetCount(SemaphoreHandle_t semaphore) {
+  return uxQueueMessagesWaiting(semaphore);
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t semaphore) {
+  vQueueDelete(semaphore);
+}
@@ -0,0 +1,241 @@
+/*
+ * Host Simulation - GDEP0565D90 driver, PNG dump and display statistics
+ *
+ * Repository: https://github.com/9carlo6/E-Paper
+ * @author 9carlo6
+ * @date 2025
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (c) 2025 9carlo6
+ * All rights reserved.
+ */
+
+#include <GxEPD2_7C.h>
+
+#include <chrono>
+#include <thread>
+
+#include "sim.h"
+
+SimDisplayStats simDisplayStats;
+
+// Approximate ink colors used for the PNG dump (index = controller code)
+static const uint8_t PANEL_PALETTE[8][3] = {
+  {0, 0, 0}, {255, 255, 255}, {0, 160, 0}, {0, 0, 200},
+  {200, 0, 0}, {255, 230, 0}, {255, 128, 0}, {220, 220, 220}
+};
+
+/* ========================================
+   PNG WRITER (stored deflate blocks)
+   ======================================== */
+
+static uint32_t crc32Update(uint32_t crc, const uint8_t* data, size_t len) {
+  static uint32_t table[256];
+  static bool tableReady = false;
+  if (!tableReady) {
+    for (uint32_t n = 0; n < 256; n++) {
+      uint32_t c = n;
+      for (int k = 0; k < 8; k++) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+      table[n] = c;
+    }
+    tableReady = true;
+  }
+  crc = ~crc;
+  while (len--) crc = table[(crc ^ *data++) & 0xFF] ^ (crc >> 8);
+  return ~crc;
+}
+
+static void putU32(std::vector<uint8_t>& out, uint32_t v) {
+  out.push_back(v >> 24);
+  out.push_back(v >> 16);
+  out.push_back(v >> 8);
+  out.push_back(v);
+}
+
+static void writeChunk(FILE* f, const char* type, const std::vector<uint8_t>& data) {
+  std::vector<uint8_t> chunk;
+  putU32(chunk, data.size());
+  chunk.insert(chunk.end(), type, type + 4);
+  chunk.insert(chunk.end(), data.begin(), data.end());
+  putU32(chunk, crc32Update(0, chunk.data() + 4, chunk.size() - 4));
+  fwrite(chunk.data(), 1, chunk.size(), f);
+}
+
+static bool writeIndexedPng(const std::string& path, const std::vector<uint8_t>& pixels,
+                            uint32_t width, uint32_t height) {
+  FILE* f = fopen(path.c_str(), "wb");
+  if (!f) return false;
+
+  static const uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+  fwrite(signature, 1, sizeof(signature), f);
+
+  std::vector<uint8_t> ihdr;
+  putU32(ihdr, width);
+  putU32(ihdr, height);
+  ihdr.insert(ihdr.end(), {8, 3, 0, 0, 0});  // 8-bit palette, no interlace
+  writeChunk(f, "IHDR", ihdr);
+
+  std::vector<uint8_t> plte;
+  for (auto& c : PANEL_PALETTE) plte.insert(plte.end(), c, c + 3);
+  writeChunk(f, "PLTE", plte);
+
+  std::vector<uint8_t> raw;
+  raw.reserve((width + 1) * height);
+  for (uint32_t y = 0; y < height; y++) {
+    raw.push_back(0);  // Filter: none
+    raw.insert(raw.end(), pixels.begin() + y * width, pixels.begin() + (y + 1) * width);
+  }
+
+  std::vector<uint8_t> zlib = {0x78, 0x01};
+  uint32_t a = 1, b = 0;
+  for (uint8_t v : raw) {
+    a = (a + v) % 65521;
+    b = (b + a) % 65521;
+  }
+  for (size_t pos = 0; pos < raw.size(); pos += 65535) {
+    size_t len = std::min<size_t>(65535, raw.size() - pos);
+    zlib.push_back(pos + len == raw.size() ? 1 : 0);
+    zlib.push_back(len & 0xFF);
+    zlib.push_back(len >> 8);
+    zlib.push_back(~len & 0xFF);
+    zlib.push_back((~len >> 8) & 0xFF);
+    zlib.insert(zlib.end(), raw.begin() + pos, raw.begin() + pos + len);
+  }
+  putU32(zlib, (b << 16) | a);
+  writeChunk(f, "IDAT", zlib);
+  writeChunk(f, "IEND", {});
+
+  fclose(f);
+  return true;
+}
+
+/* ========================================
+   DRIVER
+   ======================================== */
+
+GxEPD2_565c_GDEP0565D90::GxEPD2_565c_GDEP0565D90(int16_t cs, int16_t dc, int16_t rst, int16_t busy)
+  : _ram(WIDTH / 2 * HEIGHT, 0x11) {
+  (void)cs;
+  (void)dc;
+  (void)rst;
+  (void)busy;
+}
+
+void GxEPD2_565c_GDEP0565D90::init(uint32_t serial_diag_bitrate) {
+  init(serial_diag_bitrate, true, 10, false);
+}
+
+void GxEPD2_565c_GDEP0565D90::init(uint32_t serial_diag_bitrate, bool initial,
+                                   uint16_t reset_duration, bool pulldown_rst_mode) {
+  (void)serial_diag_bitrate;
+  (void)initial;
+  (void)reset_duration;
+  (void)pulldown_rst_mode;
+  _hibernating = false;
+}
+
+void GxEPD2_565c_GDEP0565D90::clearScreen(uint8_t value) {
+  writeScreenBuffer(value);
+  refresh(false);
+}
+
+void GxEPD2_565c_GDEP0565D90::writeScreenBuffer(uint8_t value) {
+  std::fill(_ram.begin(), _ram.end(), value);
+}
+
+void GxEPD2_565c_GDEP0565D90::writeNative(const uint8_t* data1, const uint8_t* data2, int16_t x,
+                                          int16_t y, int16_t w, int16_t h, bool invert,
+                                          bool mirror_y, bool pgm) {
+  (void)data2;
+  (void)invert;
+  (void)pgm;
+  if (!data1) return;
+  // Like GxEPD2, a hibernating controller is reset before the write
+  _hibernating = false;
+  simDisplayStats.writeNative++;
+  simDisplayStats.writeNativeBytes += (uint32_t)w / 2 * h;
+
+  for (int16_t row = 0; row < h; row++) {
+    int16_t srcRow = mirror_y ? h - 1 - row : row;
+    int16_t ny = y + row;
+    if (ny < 0 || ny >= HEIGHT) continue;
+    for (int16_t col = 0; col < w; col++) {
+      int16_t nx = x + col;
+      if (nx < 0 || nx >= WIDTH) continue;
+      uint8_t src = data1[(uint32_t)srcRow * (w / 2) + col / 2];
+      uint8_t pixel = (col & 1) ? (src & 0x0F) : (src >> 4);
+      uint8_t& dest = _ram[(uint32_t)ny * (WIDTH / 2) + nx / 2];
+      dest = (nx & 1) ? ((dest & 0xF0) | pixel) : ((dest & 0x0F) | (pixel << 4));
+    }
+  }
+}
+
+void GxEPD2_565c_GDEP0565D90::refresh(bool partial_update_mode) {
+  (void)partial_update_mode;
+  refresh(0, 0, WIDTH, HEIGHT);
+}
+
+void GxEPD2_565c_GDEP0565D90::refresh(int16_t x, int16_t y, int16_t w, int16_t h) {
+  (void)x;
+  (void)y;
+  (void)w;
+  (void)h;
+  simDisplayStats.refreshes++;
+  _paged = false;
+  _power_is_on = true;
+  if (simConfig.refreshMs) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(simConfig.refreshMs));
+  }
+
+  // Dump what the viewer sees, i.e. the RAM in the sketch's rotation
+  bool portrait = simRotation & 1;
+  uint32_t outW = portrait ? HEIGHT : WIDTH;
+  uint32_t outH = portrait ? WIDTH : HEIGHT;
+  std::vector<uint8_t> pixels(outW * outH);
+  for (uint32_t ly = 0; ly < outH; ly++) {
+    for (uint32_t lx = 0; lx < outW; lx++) {
+      int16_t nx = lx, ny = ly;
+      switch (simRotation) {
+        case 1: nx = WIDTH - 1 - ly; ny = lx; break;
+        case 2: nx = WIDTH - 1 - lx; ny = HEIGHT - 1 - ly; break;
+        case 3: nx = ly; ny = HEIGHT - 1 - lx; break;
+      }
+      uint8_t b = _ram[(uint32_t)ny * (WIDTH / 2) + nx / 2];
+      uint8_t code = (nx & 1) ? (b & 0x0F) : (b >> 4);
+      pixels[ly * outW + lx] = code < 8 ? code : 7;
+    }
+  }
+
+  std::string path = simConfig.pngPath.empty() ? simConfig.dataDir + "/display.png" : simConfig.pngPath;
+  if (writeIndexedPng(path, pixels, outW, outH)) {
+    printf("[sim] Panel refreshed -> %s\n", path.c_str());
+  } else {
+    printf("[sim] ⚠ Cannot write %s\n", path.c_str());
+  }
+}
+
+/* ========================================
+   STATISTICS
+   ======================================== */
+
+void simResetDisplayStats() {
+  simDisplayStats = SimDisplayStats();
+}
+
+void simPrintDisplayStats() {
+  printf("[sim] Display calls:\n");
+  printf("      drawPixel   %llu (%llu clipped)\n",
+         (unsigned long long)simDisplayStats.drawPixel,
+         (unsigned long long)simDisplayStats.drawPixelClipped);
+  printf("      fillScreen  %llu, fillRect %llu, drawRect %llu, text chars %llu\n",
+         (unsigned long long)simDisplayStats.fillScreen,
+         (unsigned long long)simDisplayStats.fillRect,
+         (unsigned long long)simDisplayStats.drawRect,
+         (unsigned long long)simDisplayStats.textChars);
+  printf("      pages       %llu\n", (unsigned long long)simDisplayStats.pages);
+  printf("      writeNative %llu (%llu bytes)\n",
+         (unsigned long long)simDisplayStats.writeNative,
+         (unsigned long long)simDisplayStats.writeNativeBytes);
+  printf("      refreshes   %llu\n", (unsigned long long)simDisplayStats.refreshes);
+}
@@ -0,0 +1,92 @@
+/*
+ * Host Simulation - Preferences implementation
+ *
+ * Repository: https://github.com/9carlo6/E-Paper
+ * @author 9carlo6
+ * @date 2025
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (c) 2025 9carlo6
+ * All rights reserved.
+ */
+
+#include <Preferences.h>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+#include "sim.h"
+
+namespace stdfs = std::filesystem;
+
+bool Preferences::begin(const char* name, bool readOnly, const char* partitionLabel) {
+  (void)partitionLabel;
+  _namespace = name ? name : "";
+  _readOnly = readOnly;
+  std::error_code ec;
+  stdfs::create_directories(simConfig.dataDir + "/nvs/" + _namespace, ec);
+  _started = !ec;
+  return _started;
+}
+
+void Preferences::end() {
+  _started = false;
+}
+
+std::string Preferences::keyPath(const char* key) const {
+  return simConfig.dataDir + "/nvs/" + _namespace + "/" + key;
+}
+
+bool Preferences::clear() {
+  if (!_started || _readOnly) return false;
+  std::error_code ec;
+  for (auto& entry : stdfs::directory_iterator(simConfig.dataDir + "/nvs/" + _namespace, ec)) {
+    stdfs::remove(entry.path(), ec);
+  }
+  return true;
+}
+
+bool Preferences::remove(const char* key) {
+  if (!_started || _readOnly) return false;
+  std::error_code ec;
+  return stdfs::remove(keyPath(key), ec);
+}
+
+bool Preferences::isKey(const char* key) {
+  std::error_code ec;
+  return _started && stdfs::exists(keyPath(key), ec);
+}
+
+size_t Preferences::getBytesLength(const char* key) {
+  std::error_code ec;
+  if (!isKey(key)) return 0;
+  auto size = stdfs::file_size(keyPath(key), ec);
+  return ec ? 0 : (size_t)size;
+}
+
+size_t Preferences::putBytes(const char* key, const void* value, size_t len) {
+  if (!_started || _readOnly) return 0;
+  std::ofstream out(keyPath(key), std::ios::binary | std::ios::trunc);
+  out.write((const char*)value, len);
+  return out ? len : 0;
+}
+
+size_t Preferences::getBytes(const char* key, void* buf, size_t maxLen) {
+  size_t len = getBytesLength(key);
+  if (len == 0 || len > maxLen) return 0;
+  std::ifstream in(keyPath(key), std::ios::binary);
+  in.read((char*)buf, len);
+  return in ? len : 0;
+}
+
+size_t Preferences::putString(const char* key, const String& value) {
+  return putBytes(key, value.c_str(), value.length());
+}
+
+String Preferences::getString(const char* key, const String& defaultValue) {
+  if (!isKey(key)) return defaultValue;
+  std::ifstream in(keyPath(key), std::ios::binary);
+  return String(std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()));
+}
@@ -0,0 +1,76 @@
+/*
+ * Host Simulation - QRCode placeholder implementation
+ *
+ * Repository: https://github.com/9carlo6/E-Paper
+ * @author 9carlo6
+ * @date 2025
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (c) 2025 9carlo6
+ * All rights reserved.
+ */
+
+#include <QRCode_Library.h>
+
+#include <cstring>
+
+uint16_t qrcode_getBufferSize(uint8_t version) {
+  uint16_t size = version * 4 + 17;
+  return (size * size + 7) / 8;
+}
+
+static void setModule(QRCode* qrcode, int x, int y, bool on) {
+  uint32_t offset = y * qrcode->size + x;
+  if (on) {
+    qrcode->modules[offset >> 3] |= 1 << (7 - (offset & 7));
+  } else {
+    qrcode->modules[offset >> 3] &= ~(1 << (7 - (offset & 7)));
+  }
+}
+
+static bool isFinder(int size, int x, int y) {
+  const int corners[3][2] = {{0, 0}, {size - 7, 0}, {0, size - 7}};
+  for (auto& c : corners) {
+    int dx = x - c[0], dy = y - c[1];
+    if (dx >= 0 && dx < 7 && dy >= 0 && dy < 7) return true;
+  }
+  return false;
+}
+
+int8_t qrcode_initText(QRCode* qrcode, uint8_t* modules, uint8_t version, uint8_t ecc, const char* data) {
+  qrcode->version = version;
+  qrcode->size = version * 4 + 17;
+  qrcode->ecc = ecc;
+  qrcode->mode = 0;
+  qrcode->mask = 0;
+  qrcode->modules = modules;
+  memset(modules, 0, qrcode_getBufferSize(version));
+
+  uint32_t hash = 2166136261u;
+  for (const char* p = data; p && *p; p++) hash = (hash ^ (uint8_t)*p) * 16777619u;
+
+  for (int y = 0; y < qrcode->size; y++) {
+    for (int x = 0; x < qrcode->size; x++) {
+      if (isFinder(qrcode->size, x, y)) {
+        int cx = x < 7 ? x : x - (qrcode->size - 7);
+        int cy = y < 7 ? y : y - (qrcode->size - 7);
+        bool ring = cx == 0 || cx == 6 || cy == 0 || cy == 6;
+        bool core = cx >= 2 && cx <= 4 && cy >= 2 && cy <= 4;
+        setModule(qrcode, x, y, ring || core);
+      } else {
+        hash ^= hash << 13;
+        hash ^= hash >> 17;
+        hash ^= hash << 5;
+        setModule(qrcode, x, y, hash & 1);
+      }
+    }
+  }
+  return 0;
+}
+
+bool qrcode_getModule(QRCode* qrcode, uint8_t x, uint8_t y) {
+  if (x >= qrcode->size || y >= qrcode->size) return false;
+  uint32_t offset = y * qrcode->size + x;
+  return (qrcode->modules[offset >> 3] & (1 << (7 - (offset & 7)))) != 0;
+}
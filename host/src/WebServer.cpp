@@ -0,0 +1,521 @@
+/*
+ * Host Simulation - WebServer implementation
+ *
+ * Repository: https://github.com/9carlo6/E-Paper
+ * @author 9carlo6
+ * @date 2025
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (c) 2025 9carlo6
+ * All rights reserved.
+ */
+
+#include <WebServer.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <cctype>
+
+#include "sim.h"
+
+static const size_t MAX_BODY_SIZE = 32 * 1024 * 1024;
+
+/* ========================================
+   HELPERS
+   ======================================== */
+
+static const char* reasonPhrase(int code) {
+  switch (code) {
+    case 200: return "OK";
+    case 201: return "Created";
+    case 204: return "No Content";
+    case 304: return "Not Modified";
+    case 400: return "Bad Request";
+    case 404: return "Not Found";
+    case 405: return "Method Not Allowed";
+    case 406: return "Not Acceptable";
+    case 409: return "Conflict";
+    case 413: return "Payload Too Large";
+    case 415: return "Unsupported Media Type";
+    case 500: return "Internal Server Error";
+    case 503: return "Service Unavailable";
+    case 507: return "Insufficient Storage";
+    default: return "";
+  }
+}
+
+static HTTPMethod parseMethod(const std::string& method) {
+  if (method == "GET") return HTTP_GET;
+  if (method == "HEAD") return HTTP_HEAD;
+  if (method == "POST") return HTTP_POST;
+  if (method == "PUT") return HTTP_PUT;
+  if (method == "PATCH") return HTTP_PATCH;
+  if (method == "DELETE") return HTTP_DELETE;
+  if (method == "OPTIONS") return HTTP_OPTIONS;
+  return HTTP_ANY;
+}
+
+static std::string urlDecode(const std::string& text) {
+  std::string decoded;
+  for (size_t i = 0; i < text.size(); i++) {
+    if (text[i] == '+') {
+      decoded += ' ';
+    } else if (text[i] == '%' && i + 2 < text.size() &&
+               isxdigit((unsigned char)text[i + 1]) && isxdigit((unsigned char)text[i + 2])) {
+      decoded += (char)strtol(text.substr(i + 1, 2).c_str(), nullptr, 16);
+      i += 2;
+    } else {
+      decoded += text[i];
+    }
+  }
+  return decoded;
+}
+
+static std::string lowercase(std::string text) {
+  for (auto& c : text) c = (char)tolower((unsigned char)c);
+  return text;
+}
+
+static std::string headerParam(const std::string& header, const std::string& param) {
+  std::string key = param + "=";
+  size_t pos = lowercase(header).find(key);
+  if (pos == std::string::npos) return "";
+  pos += key.size();
+  if (pos < header.size() && header[pos] == '"') {
+    size_t end = header.find('"', pos + 1);
+    return header.substr(pos + 1, end == std::string::npos ? std::string::npos : end - pos - 1);
+  }
+  size_t end = header.find(';', pos);
+  std::string value = header.substr(pos, end == std::string::npos ? std::string::npos : end - pos);
+  while (!value.empty() && isspace((unsigned char)value.back())) value.pop_back();
+  return value;
+}
+
+/* ========================================
+   SERVER LIFECYCLE
+   ======================================== */
+
+WebServer::WebServer(int port) : _port(port) {}
+
+WebServer::~WebServer() {
+  close();
+}
+
+void WebServer::begin() {
+  // The sketch's port 80 is replaced by the simulator's port
+  begin(simConfig.httpPort ? simConfig.httpPort : _port);
+}
+
+void WebServer::begin(uint16_t port) {
+  close();
+  _listenFd = socket(AF_INET, SOCK_STREAM, 0);
+  if (_listenFd < 0) {
+    perror("[sim] socket");
+    return;
+  }
+  int yes = 1;
+  setsockopt(_listenFd, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+
+  sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  addr.sin_port = htons(port);
+  if (bind(_listenFd, (sockaddr*)&addr, sizeof(addr)) < 0 || listen(_listenFd, 8) < 0) {
+    perror("[sim] bind/listen");
+    ::close(_listenFd);
+    _listenFd = -1;
+    return;
+  }
+  printf("[sim] HTTP server listening on http://localhost:%u\n", port);
+}
+
+void WebServer::close() {
+  if (_listenFd >= 0) {
+    ::close(_listenFd);
+    _listenFd = -1;
+  }
+}
+
+void WebServer::on(const String& uri, HTTPMethod method, THandlerFunction fn, THandlerFunction ufn) {
+  _handlers.push_back({uri, method, fn, ufn, false});
+}
+
+void WebServer::on(const UriBraces& uri, HTTPMethod method, THandlerFunction fn, THandlerFunction ufn) {
+  _handlers.push_back({uri.pattern(), method, fn, ufn, true});
+}
+
+void WebServer::handleClient() {
+  if (_listenFd < 0) return;
+
+  pollfd pfd = {_listenFd, POLLIN, 0};
+  if (poll(&pfd, 1, 0) <= 0) return;
+
+  _clientFd = accept(_listenFd, nullptr, nullptr);
+  if (_clientFd < 0) return;
+
+  timeval timeout = {5, 0};
+  setsockopt(_clientFd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+  int yes = 1;
+  setsockopt(_clientFd, IPPROTO_TCP, TCP_NODELAY, &yes, sizeof(yes));
+
+  handleRequest();
+
+  if (_chunked) writeClient("0\r\n\r\n", 5);
+  ::close(_clientFd);
+  _clientFd = -1;
+  _readBuffer.clear();
+  _args.clear();
+  _pathArgs.clear();
+  _headers.clear();
+  _responseHeaders.clear();
+  _contentLength = CONTENT_LENGTH_UNKNOWN;
+  _contentLengthSet = false;
+  _clientContentLength = 0;
+  _responseStarted = false;
+  _chunked = false;
+}
+
+/* ========================================
+   REQUEST PARSING
+   ======================================== */
+
+bool WebServer::readLine(std::string& line) {
+  while (true) {
+    size_t pos = _readBuffer.find('\n');
+    if (pos != std::string::npos) {
+      line = _readBuffer.substr(0, pos);
+      if (!line.empty() && line.back() == '\r') line.pop_back();
+      _readBuffer.erase(0, pos + 1);
+      return true;
+    }
+    char chunk[4096];
+    ssize_t n = recv(_clientFd, chunk, sizeof(chunk), 0);
+    if (n <= 0) return false;
+    _readBuffer.append(chunk, n);
+  }
+}
+
+bool WebServer::readBytes(std::string& out, size_t len) {
+  out = _readBuffer.substr(0, len);
+  _readBuffer.erase(0, out.size());
+  while (out.size() < len) {
+    char chunk[16384];
+    ssize_t n = recv(_clientFd, chunk, std::min(sizeof(chunk), len - out.size()), 0);
+    if (n <= 0) return false;
+    out.append(chunk, n);
+  }
+  return true;
+}
+
+void WebServer::parseArguments(const std::string& data) {
+  size_t start = 0;
+  while (start < data.size()) {
+    size_t end = data.find('&', start);
+    if (end == std::string::npos) end = data.size();
+    std::string pair = data.substr(start, end - start);
+    if (!pair.empty()) {
+      size_t eq = pair.find('=');
+      std::string key = urlDecode(pair.substr(0, eq));
+      std::string value = eq == std::string::npos ? "" : urlDecode(pair.substr(eq + 1));
+      _args.push_back({String(key), String(value)});
+    }
+    start = end + 1;
+  }
+}
+
+void WebServer::handleRequest() {
+  std::string requestLine;
+  if (!readLine(requestLine)) return;
+
+  size_t sp1 = requestLine.find(' ');
+  size_t sp2 = requestLine.find(' ', sp1 + 1);
+  if (sp1 == std::string::npos || sp2 == std::string::npos) return;
+
+  std::string url = requestLine.substr(sp1 + 1, sp2 - sp1 - 1);
+  _currentMethod = parseMethod(requestLine.substr(0, sp1));
+  size_t query = url.find('?');
+  _currentUri = String(urlDecode(url.substr(0, query)));
+  if (query != std::string::npos) parseArguments(url.substr(query + 1));
+
+  std::string contentType;
+  size_t contentLength = 0;
+  std::string line;
+  while (readLine(line) && !line.empty()) {
+    size_t colon = line.find(':');
+    if (colon == std::string::npos) continue;
+    std::string name = line.substr(0, colon);
+    std::string value = line.substr(colon + 1);
+    value.erase(0, value.find_first_not_of(' '));
+
+    std::string key = lowercase(name);
+    if (key == "content-type") contentType = value;
+    if (key == "content-length") contentLength = strtoul(value.c_str(), nullptr, 10);
+    for (auto& collected : _collectedHeaderKeys) {
+      if (lowercase(collected.str()) == key) _headers.push_back({collected, String(value)});
+    }
+  }
+
+  Handler* handler = nullptr;
+  for (auto& h : _handlers) {
+    if (h.method != HTTP_ANY && h.method != _currentMethod) continue;
+    if (h.braces ? UriBraces(h.uri).match(_currentUri, _pathArgs) : h.uri == _currentUri) {
+      handler = &h;
+      break;
+    }
+  }
+
+  _clientContentLength = contentLength;
+  if (contentLength > MAX_BODY_SIZE) {
+    send(413, "text/plain", "Payload too large");
+    return;
+  }
+
+  // Like the ESP32 server: any other body goes to an upload handler as raw chunks
+  bool canRaw = handler && handler->ufn && _currentMethod != HTTP_GET;
+  std::string type = lowercase(contentType);
+
+  std::string body;
+  if (contentLength > 0 && !readBytes(body, contentLength)) {
+    printf("[sim] Client closed the connection before sending the body\n");
+    if (canRaw && type.rfind("multipart/form-data", 0) != 0) deliverRaw(body, handler, true);
+    return;
+  }
+
+  if (type.rfind("multipart/form-data", 0) == 0) {
+    if (!parseMultipart(body, headerParam(contentType, "boundary"), handler)) {
+      send(400, "text/plain", "Malformed multipart body");
+      return;
+    }
+  } else if (canRaw) {
+    deliverRaw(body, handler, false);
+  } else if (type.rfind("application/x-www-form-urlencoded", 0) == 0) {
+    parseArguments(body);
+  } else if (!body.empty()) {
+    _args.push_back({String("plain"), String(body)});
+  }
+
+  if (handler && handler->fn) {
+    handler->fn();
+  } else if (_notFoundHandler) {
+    _notFoundHandler();
+  } else {
+    send(404, "text/plain", String("Not found: ") + _currentUri);
+  }
+
+  if (!_responseStarted) {
+    printf("[sim] Handler for %s sent no response\n", _currentUri.c_str());
+  }
+}
+
+bool WebServer::parseMultipart(const std::string& body, const std::string& boundary, Handler* handler) {
+  if (boundary.empty()) return false;
+  const std::string delimiter = "--" + boundary;
+  bool canUpload = handler && handler->ufn && (handler->method == HTTP_POST || handler->method == HTTP_ANY);
+
+  size_t pos = body.find(delimiter);
+  if (pos == std::string::npos) return false;
+
+  while (true) {
+    pos += delimiter.size();
+    if (body.compare(pos, 2, "--") == 0) return true;  // Closing delimiter
+    pos = body.find("\r\n", pos);
+    if (pos == std::string::npos) return false;
+    pos += 2;
+
+    size_t headersEnd = body.find("\r\n\r\n", pos);
+    if (headersEnd == std::string::npos) return false;
+    std::string partHeaders = body.substr(pos, headersEnd - pos);
+    size_t dataStart = headersEnd + 4;
+    size_t dataEnd = body.find("\r\n" + delimiter, dataStart);
+    if (dataEnd == std::string::npos) return false;
+
+    std::string name, filename, partType = "text/plain";
+    size_t lineStart = 0;
+    while (lineStart < partHeaders.size()) {
+      size_t lineEnd = partHeaders.find("\r\n", lineStart);
+      if (lineEnd == std::string::npos) lineEnd = partHeaders.size();
+      std::string headerLine = partHeaders.substr(lineStart, lineEnd - lineStart);
+      std::string key = lowercase(headerLine.substr(0, headerLine.find(':')));
+      if (key == "content-disposition") {
+        name = headerParam(headerLine, "name");
+        filename = headerParam(headerLine, "filename");
+      } else if (key == "content-type") {
+        partType = headerLine.substr(headerLine.find(':') + 1);
+        partType.erase(0, partType.find_first_not_of(' '));
+      }
+      lineStart = lineEnd + 2;
+    }
+
+    if (filename.empty()) {
+      _args.push_back({String(name), String(body.substr(dataStart, dataEnd - dataStart))});
+    } else if (canUpload) {
+      // Deliver the file part in HTTP_UPLOAD_BUFLEN chunks like the ESP32 server
+      _upload.status = UPLOAD_FILE_START;
+      _upload.name = String(name);
+      _upload.filename = String(filename);
+      _upload.type = String(partType);
+      _upload.totalSize = 0;
+      _upload.currentSize = 0;
+      handler->ufn();
+
+      _upload.status = UPLOAD_FILE_WRITE;
+      for (size_t offset = dataStart; offset < dataEnd; offset += HTTP_UPLOAD_BUFLEN) {
+        size_t chunk = std::min((size_t)HTTP_UPLOAD_BUFLEN, dataEnd - offset);
+        memcpy(_upload.buf, body.data() + offset, chunk);
+        _upload.currentSize = chunk;
+        _upload.totalSize += chunk;
+        handler->ufn();
+      }
+
+      _upload.status = UPLOAD_FILE_END;
+      _upload.currentSize = 0;
+      handler->ufn();
+    }
+
+    pos = dataEnd + 2;
+  }
+}
+
+void WebServer::deliverRaw(const std::string& body, Handler* handler, bool aborted) {
+  _raw.status = RAW_START;
+  _raw.totalSize = 0;
+  _raw.currentSize = 0;
+  _raw.data = nullptr;
+  handler->ufn();
+
+  _raw.status = RAW_WRITE;
+  for (size_t offset = 0; offset < body.size(); offset += HTTP_RAW_BUFLEN) {
+    size_t chunk = std::min((size_t)HTTP_RAW_BUFLEN, body.size() - offset);
+    memcpy(_raw.buf, body.data() + offset, chunk);
+    _raw.currentSize = chunk;
+    _raw.totalSize += chunk;
+    handler->ufn();
+  }
+
+  _raw.status = aborted ? RAW_ABORTED : RAW_END;
+  _raw.currentSize = 0;
+  handler->ufn();
+}
+
+/* ========================================
+   ARGUMENTS & HEADERS
+   ======================================== */
+
+String WebServer::arg(const String& name) const {
+  for (auto& a : _args) {
+    if (a.first == name) return a.second;
+  }
+  return String();
+}
+
+String WebServer::arg(int i) const {
+  return i >= 0 && i < (int)_args.size() ? _args[i].second : String();
+}
+
+String WebServer::argName(int i) const {
+  return i >= 0 && i < (int)_args.size() ? _args[i].first : String();
+}
+
+bool WebServer::hasArg(const String& name) const {
+  for (auto& a : _args) {
+    if (a.first == name) return true;
+  }
+  return false;
+}
+
+void WebServer::collectHeaders(const char* headerKeys[], const size_t headerKeysCount) {
+  _collectedHeaderKeys.clear();
+  for (size_t i = 0; i < headerKeysCount; i++) {
+    _collectedHeaderKeys.push_back(String(headerKeys[i]));
+  }
+}
+
+String WebServer::header(const String& name) const {
+  for (auto& h : _headers) {
+    if (h.first.equalsIgnoreCase(name)) return h.second;
+  }
+  return String();
+}
+
+bool WebServer::hasHeader(const String& name) const {
+  for (auto& h : _headers) {
+    if (h.first.equalsIgnoreCase(name)) return true;
+  }
+  return false;
+}
+
+/* ========================================
+   RESPONSES
+   ======================================== */
+
+void WebServer::writeClient(const char* data, size_t len) {
+  while (len > 0 && _clientFd >= 0) {
+    ssize_t n = ::send(_clientFd, data, len, MSG_NOSIGNAL);
+    if (n <= 0) return;
+    data += n;
+    len -= n;
+  }
+}
+
+void WebServer::sendHeader(const String& name, const String& value, bool first) {
+  if (first) {
+    _responseHeaders.insert(_responseHeaders.begin(), {name, value});
+  } else {
+    _responseHeaders.push_back({name, value});
+  }
+}
+
+void WebServer::sendResponseHead(int code, const char* contentType, size_t contentLength) {
+  std::string head = "HTTP/1.1 " + std::to_string(code) + " " + reasonPhrase(code) + "\r\n";
+  if (contentType && *contentType) head += std::string("Content-Type: ") + contentType + "\r\n";
+  if (contentLength == CONTENT_LENGTH_UNKNOWN) {
+    head += "Transfer-Encoding: chunked\r\n";
+    _chunked = true;
+  } else {
+    head += "Content-Length: " + std::to_string(contentLength) + "\r\n";
+  }
+  head += "Connection: close\r\n";
+  for (auto& h : _responseHeaders) {
+    head += h.first.str() + ": " + h.second.str() + "\r\n";
+  }
+  head += "\r\n";
+  writeClient(head.data(), head.size());
+  _responseStarted = true;
+}
+
+void WebServer::send(int code, const char* contentType, const String& content) {
+  // setContentLength() before send() announces a body that follows through sendContent()
+  size_t length = _contentLengthSet ? _contentLength : content.length();
+  sendResponseHead(code, contentType, length);
+  if (_currentMethod != HTTP_HEAD && content.length() > 0) {
+    sendContent(content);
+  }
+}
+
+void WebServer::send_P(int code, PGM_P contentType, PGM_P content) {
+  send_P(code, contentType, content, strlen(content));
+}
+
+void WebServer::send_P(int code, PGM_P contentType, PGM_P content, size_t contentLength) {
+  sendResponseHead(code, contentType, contentLength);
+  if (_currentMethod != HTTP_HEAD) writeClient(content, contentLength);
+}
+
+void WebServer::sendContent(const char* content, size_t size) {
+  if (!_responseStarted) sendResponseHead(200, "text/plain", CONTENT_LENGTH_UNKNOWN);
+  if (_chunked) {
+    if (size == 0) return;
+    char header[16];
+    int n = snprintf(header, sizeof(header), "%zx\r\n", size);
+    writeClient(header, n);
+    writeClient(content, size);
+    writeClient("\r\n", 2);
+  } else {
+    writeClient(content, size);
+  }
+}
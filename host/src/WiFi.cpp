@@ -0,0 +1,134 @@
+/*
+ * Host Simulation - WiFi implementation
+ *
+ * Repository: https://github.com/9carlo6/E-Paper
+ * @author 9carlo6
+ * @date 2025
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (c) 2025 9carlo6
+ * All rights reserved.
+ */
+
+#include <WiFi.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "sim.h"
+
+WiFiClass WiFi;
+
+bool IPAddress::fromString(const char* address) {
+  unsigned int a, b, c, d;
+  char extra;
+  if (!address || sscanf(address, "%u.%u.%u.%u%c", &a, &b, &c, &d, &extra) != 4 ||
+      a > 255 || b > 255 || c > 255 || d > 255) {
+    return false;
+  }
+  _addr[0] = a;
+  _addr[1] = b;
+  _addr[2] = c;
+  _addr[3] = d;
+  return true;
+}
+
+String IPAddress::toString() const {
+  char buf[16];
+  snprintf(buf, sizeof(buf), "%u.%u.%u.%u", _addr[0], _addr[1], _addr[2], _addr[3]);
+  return String(buf);
+}
+
+/* ========================================
+   STATION
+   ======================================== */
+
+static std::atomic<int> stationStatus{WL_IDLE_STATUS};
+static std::atomic<uint32_t> connectGeneration{0};  // A disconnect cancels the connect in flight
+static std::mutex eventMutex;
+static std::vector<std::pair<WiFiEventCb, arduino_event_id_t>> eventCallbacks;
+static uint8_t stationBssid[6] = {0x02, 0x00, 0x00, 0x00, 0x00, 0x01};
+
+static void fireEvent(arduino_event_id_t event) {
+  std::lock_guard<std::mutex> lock(eventMutex);
+  for (auto& callback : eventCallbacks) {
+    if (callback.second == ARDUINO_EVENT_MAX || callback.second == event) callback.first(event);
+  }
+}
+
+wl_status_t WiFiClass::begin(const char* ssid, const char* passphrase, int32_t channel,
+                             const uint8_t* bssid, bool connect) {
+  (void)passphrase;
+  _ssid = ssid ? ssid : "";
+  stationStatus = WL_DISCONNECTED;
+  if (!connect) return WL_DISCONNECTED;
+
+  // Channel and BSSID skip the scan, a static address skips DHCP
+  uint32_t delayMs = (channel && bssid ? 0 : simConfig.wifiScanMs) + (_staticIP ? 0 : simConfig.wifiDhcpMs);
+  uint32_t generation = ++connectGeneration;
+  std::thread([=]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(delayMs));
+    if (generation != connectGeneration) return;
+    if (simConfig.wifiFail) {
+      stationStatus = WL_NO_SSID_AVAIL;
+      fireEvent(ARDUINO_EVENT_WIFI_STA_DISCONNECTED);
+      return;
+    }
+    stationStatus = WL_CONNECTED;
+    fireEvent(ARDUINO_EVENT_WIFI_STA_CONNECTED);
+    fireEvent(ARDUINO_EVENT_WIFI_STA_GOT_IP);
+  }).detach();
+  return WL_DISCONNECTED;
+}
+
+bool WiFiClass::config(IPAddress localIP, IPAddress gateway, IPAddress subnet, IPAddress dns1,
+                       IPAddress dns2) {
+  (void)gateway;
+  (void)subnet;
+  (void)dns1;
+  (void)dns2;
+  _staticIP = (uint32_t)localIP != 0;  // 0.0.0.0 goes back to DHCP
+  return true;
+}
+
+bool WiFiClass::disconnect(bool wifiOff, bool eraseAp) {
+  (void)eraseAp;
+  connectGeneration++;
+  bool wasConnected = stationStatus == WL_CONNECTED;
+  stationStatus = WL_DISCONNECTED;
+  if (wifiOff) _mode = WIFI_OFF;
+  if (wasConnected) fireEvent(ARDUINO_EVENT_WIFI_STA_DISCONNECTED);
+  return true;
+}
+
+wl_status_t WiFiClass::status() const {
+  return (wl_status_t)stationStatus.load();
+}
+
+wifi_event_id_t WiFiClass::onEvent(WiFiEventCb callback, arduino_event_id_t event) {
+  std::lock_guard<std::mutex> lock(eventMutex);
+  eventCallbacks.push_back({callback, event});
+  return eventCallbacks.size();
+}
+
+uint8_t* WiFiClass::BSSID() {
+  return status() == WL_CONNECTED ? stationBssid : nullptr;
+}
+
+/* ========================================
+   ACCESS POINT
+   ======================================== */
+
+bool WiFiClass::softAP(const char* ssid, const char* passphrase, int channel, int ssidHidden,
+                       int maxConnection) {
+  (void)ssid;
+  (void)passphrase;
+  (void)channel;
+  (void)ssidHidden;
+  (void)maxConnection;
+  return true;
+}
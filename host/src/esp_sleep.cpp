@@ -0,0 +1,100 @@
+/*
+ * Host Simulation - Deep sleep implementation
+ *
+ * Repository: https://github.com/9carlo6/E-Paper
+ * @author 9carlo6
+ * @date 2025
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (c) 2025 9carlo6
+ * All rights reserved.
+ */
+
+#include <Arduino.h>
+#include <esp_sleep.h>
+
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include "sim.h"
+
+// Bounds of the RTC_DATA_ATTR section, provided by the linker
+extern "C" char __start_rtc_data[] __attribute__((weak));
+extern "C" char __stop_rtc_data[] __attribute__((weak));
+
+static uint64_t timerWakeUs = 0;
+static bool buttonWake = false;
+
+static std::string rtcMemoryPath() {
+  return simConfig.dataDir + "/rtc.bin";
+}
+
+static size_t rtcMemorySize() {
+  return __start_rtc_data ? __stop_rtc_data - __start_rtc_data : 0;
+}
+
+// Restores RTC memory saved by the previous esp_deep_sleep_start()
+bool simLoadRtcMemory() {
+  std::ifstream in(rtcMemoryPath(), std::ios::binary);
+  std::vector<char> data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+  if (data.size() != rtcMemorySize()) return false;
+  if (!data.empty()) memcpy(__start_rtc_data, data.data(), data.size());
+  return true;
+}
+
+esp_err_t esp_sleep_enable_timer_wakeup(uint64_t timeUs) {
+  timerWakeUs = timeUs;
+  return ESP_OK;
+}
+
+esp_err_t esp_sleep_enable_ext0_wakeup(gpio_num_t, int) {
+  buttonWake = true;
+  return ESP_OK;
+}
+
+esp_sleep_wakeup_cause_t esp_sleep_get_wakeup_cause() {
+  return simConfig.wakeCause;
+}
+
+void esp_deep_sleep_start() {
+  std::ofstream out(rtcMemoryPath(), std::ios::binary);
+  out.write(__start_rtc_data, rtcMemorySize());
+  out.close();
+
+  if (!timerWakeUs) {
+    printf("[sim] Deep sleep without a timer%s - exiting\n",
+           buttonWake ? ", wake with --wake button" : "");
+    fflush(stdout);
+    exit(0);
+  }
+
+  uint64_t sleepMs = timerWakeUs / 1000;
+  if (simConfig.maxSleepMs && sleepMs > simConfig.maxSleepMs) sleepMs = simConfig.maxSleepMs;
+  printf("[sim] Deep sleep, timer wake in %llu ms\n", (unsigned long long)sleepMs);
+  fflush(stdout);
+  std::this_thread::sleep_for(std::chrono::milliseconds(sleepMs));
+
+  // Reboot: a fresh process with the same options, as a timer wake
+  std::vector<char*> args;
+  for (size_t i = 0; i < simConfig.args.size(); i++) {
+    if (simConfig.args[i] == "--wake") {
+      i++;
+      continue;
+    }
+    args.push_back(&simConfig.args[i][0]);
+  }
+  static char wake[] = "--wake";
+  static char timer[] = "timer";
+  args.push_back(wake);
+  args.push_back(timer);
+  args.push_back(nullptr);
+  execv("/proc/self/exe", args.data());
+  perror("[sim] execv");
+  exit(1);
+}
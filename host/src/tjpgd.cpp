@@ -0,0 +1,216 @@
+/*
+ * Host Simulation - TJpgDec implementation
+ * libjpeg pulls the input through infunc in small chunks, like the ROM
+ * decoder, and decodes one MCU row at a time, so the upload path sees the
+ * same interleaving of network blocks and output rows.
+ *
+ * Repository: https://github.com/9carlo6/E-Paper
+ * @author 9carlo6
+ * @date 2025
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (c) 2025 9carlo6
+ * All rights reserved.
+ */
+
+#include <esp32/rom/tjpgd.h>
+
+#ifdef EPAPER_HAVE_JPEG
+
+#include <csetjmp>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include <jpeglib.h>
+
+#define TJPGD_INPUT_CHUNK 512  // JD_SZBUF of the ROM build
+#define TJPGD_MIN_POOL 3100    // Smallest pool the ROM decoder works with
+
+struct HostDecoder {
+  jpeg_decompress_struct cinfo;
+  jpeg_error_mgr errors;
+  jpeg_source_mgr source;
+  jmp_buf failed;
+  JDEC* jd;
+  bool inputEnded;
+  JOCTET buffer[TJPGD_INPUT_CHUNK];
+};
+
+static void hostErrorExit(j_common_ptr cinfo) {
+  longjmp(((HostDecoder*)cinfo->client_data)->failed, 1);
+}
+
+static void hostOutputMessage(j_common_ptr) {
+  // Warnings of damaged data surface as results, not on the console
+}
+
+static void hostInitSource(j_decompress_ptr) {
+}
+
+static boolean hostFillInput(j_decompress_ptr cinfo) {
+  HostDecoder* decoder = (HostDecoder*)cinfo->client_data;
+  uint32_t n = decoder->jd->infunc(decoder->jd, decoder->buffer, TJPGD_INPUT_CHUNK);
+  if (n == 0) {
+    // Fake an end of image, as libjpeg's own sources do
+    decoder->inputEnded = true;
+    decoder->buffer[0] = 0xFF;
+    decoder->buffer[1] = JPEG_EOI;
+    n = 2;
+  }
+  decoder->source.next_input_byte = decoder->buffer;
+  decoder->source.bytes_in_buffer = n;
+  return TRUE;
+}
+
+static void hostSkipInput(j_decompress_ptr cinfo, long count) {
+  HostDecoder* decoder = (HostDecoder*)cinfo->client_data;
+  if (count <= 0) return;
+  if ((size_t)count <= decoder->source.bytes_in_buffer) {
+    decoder->source.next_input_byte += count;
+    decoder->source.bytes_in_buffer -= count;
+    return;
+  }
+  uint32_t rest = count - decoder->source.bytes_in_buffer;
+  decoder->source.bytes_in_buffer = 0;
+  if (decoder->jd->infunc(decoder->jd, nullptr, rest) != rest) decoder->inputEnded = true;
+}
+
+static void hostTermSource(j_decompress_ptr) {
+}
+
+static void hostRelease(JDEC* jd) {
+  HostDecoder* decoder = (HostDecoder*)jd->workbuf;
+  if (!decoder) return;
+  jpeg_destroy_decompress(&decoder->cinfo);
+  delete decoder;
+  jd->workbuf = nullptr;
+}
+
+JRESULT jd_prepare(JDEC* jd, uint32_t (*infunc)(JDEC*, uint8_t*, uint32_t), void* pool, uint32_t sz_pool,
+                   void* dev) {
+  memset(jd, 0, sizeof(*jd));
+  jd->pool = pool;
+  jd->sz_pool = sz_pool;
+  jd->infunc = infunc;
+  jd->device = dev;
+  if (!pool || sz_pool < TJPGD_MIN_POOL) return JDR_MEM1;
+
+  // The ROM keeps its state in the pool; libjpeg needs more, so it lives
+  // on the host heap until jd_decomp finishes
+  HostDecoder* decoder = new HostDecoder();
+  decoder->jd = jd;
+  jd->workbuf = decoder;
+  decoder->cinfo.err = jpeg_std_error(&decoder->errors);
+  decoder->errors.error_exit = hostErrorExit;
+  decoder->errors.output_message = hostOutputMessage;
+  if (setjmp(decoder->failed)) {
+    JRESULT result = decoder->inputEnded ? JDR_INP : JDR_FMT1;
+    hostRelease(jd);
+    return result;
+  }
+  jpeg_create_decompress(&decoder->cinfo);
+  decoder->cinfo.client_data = decoder;
+  decoder->source.init_source = hostInitSource;
+  decoder->source.fill_input_buffer = hostFillInput;
+  decoder->source.skip_input_data = hostSkipInput;
+  decoder->source.resync_to_restart = jpeg_resync_to_restart;
+  decoder->source.term_source = hostTermSource;
+  decoder->cinfo.src = &decoder->source;
+
+  if (jpeg_read_header(&decoder->cinfo, TRUE) != JPEG_HEADER_OK || decoder->inputEnded) {
+    hostRelease(jd);
+    return JDR_INP;
+  }
+
+  // What TJpgDec supports: baseline YCbCr with 4:4:4, 4:2:2 or 4:2:0
+  jpeg_decompress_struct& cinfo = decoder->cinfo;
+  int msx = cinfo.comp_info[0].h_samp_factor;
+  int msy = cinfo.comp_info[0].v_samp_factor;
+  if (cinfo.progressive_mode || cinfo.num_components != 3 || msx > 2 || msy > 2 || msy > msx) {
+    hostRelease(jd);
+    return JDR_FMT3;
+  }
+  jd->width = cinfo.image_width;
+  jd->height = cinfo.image_height;
+  jd->msx = msx;
+  jd->msy = msy;
+  return JDR_OK;
+}
+
+JRESULT jd_decomp(JDEC* jd, uint32_t (*outfunc)(JDEC*, void*, JRECT*), uint8_t scale) {
+  HostDecoder* decoder = (HostDecoder*)jd->workbuf;
+  if (!decoder) return JDR_PAR;
+  if (scale > 3) {
+    hostRelease(jd);
+    return JDR_PAR;
+  }
+  jd->scale = scale;
+
+  jpeg_decompress_struct& cinfo = decoder->cinfo;
+  std::vector<uint8_t> band;
+  std::vector<uint8_t> block;
+  if (setjmp(decoder->failed)) {
+    JRESULT result = decoder->inputEnded ? JDR_INP : JDR_FMT1;
+    hostRelease(jd);
+    return result;
+  }
+  cinfo.scale_num = 1;
+  cinfo.scale_denom = 1 << scale;
+  cinfo.out_color_space = JCS_RGB;
+  cinfo.dct_method = JDCT_ISLOW;
+  jpeg_start_decompress(&cinfo);
+
+  uint32_t width = cinfo.output_width;
+  uint32_t height = cinfo.output_height;
+  uint32_t mcuWidth = (8u * jd->msx) >> scale;
+  uint32_t mcuHeight = (8u * jd->msy) >> scale;
+  band.resize((size_t)mcuHeight * width * 3);
+  block.resize((size_t)mcuWidth * mcuHeight * 3);
+
+  JRESULT result = JDR_OK;
+  for (uint32_t top = 0; top < height && result == JDR_OK; top += mcuHeight) {
+    uint32_t rows = height - top < mcuHeight ? height - top : mcuHeight;
+    for (uint32_t y = 0; y < rows;) {
+      JSAMPROW row = &band[(size_t)y * width * 3];
+      y += jpeg_read_scanlines(&cinfo, &row, 1);
+    }
+    if (decoder->inputEnded) {
+      result = JDR_INP;
+      break;
+    }
+    for (uint32_t left = 0; left < width; left += mcuWidth) {
+      uint32_t columns = width - left < mcuWidth ? width - left : mcuWidth;
+      for (uint32_t y = 0; y < rows; y++) {
+        memcpy(&block[(size_t)y * columns * 3], &band[((size_t)y * width + left) * 3], columns * 3);
+      }
+      JRECT rect = {(uint16_t)left, (uint16_t)(left + columns - 1), (uint16_t)top, (uint16_t)(top + rows - 1)};
+      if (!outfunc(jd, block.data(), &rect)) {
+        result = JDR_INTR;
+        break;
+      }
+    }
+  }
+  // Like the ROM decoder, stop after the last MCU without reading the rest
+  hostRelease(jd);
+  return result;
+}
+
+#else
+
+JRESULT jd_prepare(JDEC* jd, uint32_t (*infunc)(JDEC*, uint8_t*, uint32_t), void* pool, uint32_t sz_pool,
+                   void* dev) {
+  jd->infunc = infunc;
+  jd->pool = pool;
+  jd->sz_pool = sz_pool;
+  jd->device = dev;
+  jd->workbuf = nullptr;
+  return JDR_FMT3;  // Built without libjpeg
+}
+
+JRESULT jd_decomp(JDEC*, uint32_t (*)(JDEC*, void*, JRECT*), uint8_t) {
+  return JDR_PAR;
+}
+
+#endif
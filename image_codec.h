@@ -0,0 +1,311 @@
+/*
+ * Compressed Image Format (EPZ) for E-Paper Photo Frame
+ * Encoder and streaming decoder, shared by the firmware and the host
+ * tools. The web interface has a JavaScript port of the encoder that
+ * produces the same bytes.
+ *
+ * Repository: https://github.com/9carlo6/E-Paper
+ * @author 9carlo6
+ * @date 2025
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (c) 2025 9carlo6
+ * All rights reserved.
+ */
+
+#ifndef IMAGE_CODEC_H
+#define IMAGE_CODEC_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+/*
+ * Layout: "EPZ1", u16 width, u16 height (little endian, portrait image
+ * size), then a token stream of palette indices. Pixels are stored column
+ * by column from the left, each column from the bottom up. That is the
+ * scan order of the controller with rotation 1, so the frame decodes
+ * straight into controller rows.
+ *
+ *   0NNNNNNN           literal: N+1 pixels, 3 bits each (LSB first), byte aligned
+ *   10CCCLLL [len]     run of color C: LLL+2 pixels, LLL=7: 9+len
+ *   11DDDLLL [len]     copy from EPZ_DISTANCES[D] pixels back: LLL+3, LLL=7: 10+len
+ *
+ * [len] is a LEB128 varint. Copies refer to the last EPZ_WINDOW pixels.
+ */
+#define EPZ_MAGIC "EPZ1"
+#define EPZ_HEADER_SIZE 8
+#define EPZ_WINDOW 4096  // Power of two, larger than the longest distance
+#define EPZ_MAX_LITERAL 128
+#define EPZ_MIN_BREAK 6  // Shortest run/copy worth closing a pending literal for
+
+// Neighbours in the scan: same column (2, 4, 8 for dither patterns),
+// previous columns (600 = one image column back, with the diagonals)
+static const uint16_t EPZ_DISTANCES[8] = {2, 4, 8, 599, 600, 601, 1200, 2400};
+
+inline bool isCompressedImage(const uint8_t* header, size_t size) {
+  return size >= EPZ_HEADER_SIZE && memcmp(header, EPZ_MAGIC, 4) == 0;
+}
+
+/* ========================================
+   DECODER
+   ======================================== */
+
+/*
+ * Streaming decoder: pixels come out in scan order, one palette index per
+ * byte. Memory use is the copy window plus a small input buffer,
+ * independent of the image size. Source needs read(uint8_t*, size_t)
+ * (fs::File works).
+ */
+template <typename Source>
+class EpzDecoder {
+ public:
+  explicit EpzDecoder(Source& source) : _source(source) {}
+  ~EpzDecoder() { free(_window); }
+
+  // Reads the header; the source must be at the start of the file
+  bool begin() {
+    if (!_window) _window = (uint8_t*)malloc(EPZ_WINDOW);
+    _inPos = _inLen = 0;
+    _position = 0;
+    _remaining = 0;
+    _error = !_window;
+    uint8_t header[EPZ_HEADER_SIZE];
+    for (uint8_t i = 0; i < EPZ_HEADER_SIZE && !_error; i++) {
+      _error = !nextByte(header[i]);
+    }
+    if (_error || !isCompressedImage(header, EPZ_HEADER_SIZE)) {
+      _error = true;
+      return false;
+    }
+    _width = header[4] | (header[5] << 8);
+    _height = header[6] | (header[7] << 8);
+    return true;
+  }
+
+  uint16_t width() const { return _width; }
+  uint16_t height() const { return _height; }
+  uint32_t position() const { return _position; }
+  bool failed() const { return _error; }
+
+  // Decodes up to count pixels, returns fewer only at the end or on corrupt data
+  size_t read(uint8_t* out, size_t count) {
+    size_t produced = 0;
+    while (produced < count && !_error) {
+      if (_remaining == 0 && !nextToken()) break;
+      size_t n = count - produced < _remaining ? count - produced : _remaining;
+      for (size_t i = 0; i < n; i++) {
+        uint8_t pixel;
+        if (_type == TOKEN_RUN) {
+          pixel = _color;
+        } else if (_type == TOKEN_COPY) {
+          pixel = _window[(_position - _distance) & (EPZ_WINDOW - 1)];
+        } else {
+          if (_bitCount < 3) {
+            uint8_t b;
+            if (!nextByte(b)) {
+              _error = true;
+              return produced + i;
+            }
+            _bitBuf |= (uint16_t)b << _bitCount;
+            _bitCount += 8;
+          }
+          pixel = _bitBuf & 0x07;
+          _bitBuf >>= 3;
+          _bitCount -= 3;
+        }
+        _window[_position & (EPZ_WINDOW - 1)] = pixel;
+        _position++;
+        out[produced + i] = pixel;
+      }
+      produced += n;
+      _remaining -= n;
+    }
+    return produced;
+  }
+
+  // Decodes and drops count pixels
+  bool skip(uint32_t count) {
+    uint8_t scratch[64];
+    while (count > 0) {
+      size_t n = count < sizeof(scratch) ? count : sizeof(scratch);
+      if (read(scratch, n) != n) return false;
+      count -= n;
+    }
+    return true;
+  }
+
+ private:
+  enum TokenType { TOKEN_LITERAL, TOKEN_RUN, TOKEN_COPY };
+
+  Source& _source;
+  uint8_t* _window = nullptr;
+  uint8_t _in[64];
+  uint8_t _inPos = 0;
+  uint8_t _inLen = 0;
+  uint16_t _width = 0;
+  uint16_t _height = 0;
+  uint32_t _position = 0;
+  uint32_t _remaining = 0;
+  TokenType _type = TOKEN_LITERAL;
+  uint8_t _color = 0;
+  uint16_t _distance = 0;
+  uint16_t _bitBuf = 0;
+  uint8_t _bitCount = 0;
+  bool _error = false;
+
+  bool nextByte(uint8_t& b) {
+    if (_inPos == _inLen) {
+      _inLen = _source.read(_in, sizeof(_in));
+      _inPos = 0;
+      if (_inLen == 0) return false;
+    }
+    b = _in[_inPos++];
+    return true;
+  }
+
+  bool nextVarint(uint32_t& value) {
+    value = 0;
+    for (uint8_t shift = 0; shift < 28; shift += 7) {
+      uint8_t b;
+      if (!nextByte(b)) return false;
+      value |= (uint32_t)(b & 0x7F) << shift;
+      if (!(b & 0x80)) return true;
+    }
+    return false;
+  }
+
+  bool nextToken() {
+    uint8_t token;
+    if (!nextByte(token)) return false;  // Clean end of stream
+    if (!(token & 0x80)) {
+      _type = TOKEN_LITERAL;
+      _remaining = (token & 0x7F) + 1;
+      _bitBuf = 0;
+      _bitCount = 0;
+      return true;
+    }
+
+    uint32_t extra = 0;
+    if ((token & 0x07) == 7 && !nextVarint(extra)) {
+      _error = true;
+      return false;
+    }
+    if (!(token & 0x40)) {
+      _type = TOKEN_RUN;
+      _color = (token >> 3) & 0x07;
+      _remaining = (token & 0x07) == 7 ? 9 + extra : (token & 0x07) + 2;
+    } else {
+      _type = TOKEN_COPY;
+      _distance = EPZ_DISTANCES[(token >> 3) & 0x07];
+      _remaining = (token & 0x07) == 7 ? 10 + extra : (token & 0x07) + 3;
+      if (_distance > _position) {
+        _error = true;
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+/* ========================================
+   ENCODER
+   ======================================== */
+
+inline void epzPutVarint(std::vector<uint8_t>& out, uint32_t value) {
+  while (value >= 0x80) {
+    out.push_back((value & 0x7F) | 0x80);
+    value >>= 7;
+  }
+  out.push_back(value);
+}
+
+inline void epzFlushLiteral(std::vector<uint8_t>& out, const uint8_t* pixels, uint32_t start, uint32_t end) {
+  while (start < end) {
+    uint32_t n = end - start < EPZ_MAX_LITERAL ? end - start : EPZ_MAX_LITERAL;
+    out.push_back(n - 1);
+    uint32_t bitBuf = 0;
+    int bitCount = 0;
+    for (uint32_t i = 0; i < n; i++) {
+      bitBuf |= (uint32_t)(pixels[start + i] & 0x07) << bitCount;
+      bitCount += 3;
+      while (bitCount >= 8) {
+        out.push_back(bitBuf & 0xFF);
+        bitBuf >>= 8;
+        bitCount -= 8;
+      }
+    }
+    if (bitCount > 0) out.push_back(bitBuf & 0xFF);
+    start += n;
+  }
+}
+
+/*
+ * Greedy encoder: at each pixel the longest of the run and the eight
+ * copies wins (run first, then table order, on ties). Runs need 2 pixels
+ * and copies 3, or EPZ_MIN_BREAK while a literal is pending (closing it
+ * costs a token and the padding); other pixels go into literals.
+ * quantized: portrait image, row-major, one palette index per pixel.
+ */
+inline std::vector<uint8_t> encodeCompressedImage(const uint8_t* quantized, uint16_t width, uint16_t height) {
+  const uint32_t count = (uint32_t)width * height;
+  std::vector<uint8_t> scan(count);
+  for (uint32_t x = 0, i = 0; x < width; x++) {
+    for (int32_t y = height - 1; y >= 0; y--) scan[i++] = quantized[(uint32_t)y * width + x];
+  }
+
+  std::vector<uint8_t> out = {'E', 'P', 'Z', '1', (uint8_t)(width & 0xFF), (uint8_t)(width >> 8),
+                              (uint8_t)(height & 0xFF), (uint8_t)(height >> 8)};
+  uint32_t literalStart = 0;
+  uint32_t pos = 0;
+  while (pos < count) {
+    uint32_t runLen = 1;
+    while (pos + runLen < count && scan[pos + runLen] == scan[pos]) runLen++;
+    bool inLiteral = pos > literalStart;
+    uint32_t bestLen = runLen >= (inLiteral ? EPZ_MIN_BREAK : 2) ? runLen : 0;
+    int bestDistance = -1;
+
+    for (int d = 0; d < 8; d++) {
+      uint32_t distance = EPZ_DISTANCES[d];
+      if (distance > pos) continue;
+      uint32_t len = 0;
+      while (pos + len < count && scan[pos + len] == scan[pos + len - distance]) len++;
+      if (len >= (inLiteral ? EPZ_MIN_BREAK : 3) && len > bestLen) {
+        bestLen = len;
+        bestDistance = d;
+      }
+    }
+
+    if (bestLen == 0) {
+      pos++;
+      continue;
+    }
+    epzFlushLiteral(out, scan.data(), literalStart, pos);
+    if (bestDistance < 0) {
+      uint8_t token = 0x80 | ((scan[pos] & 0x07) << 3);
+      if (bestLen <= 8) {
+        out.push_back(token | (bestLen - 2));
+      } else {
+        out.push_back(token | 7);
+        epzPutVarint(out, bestLen - 9);
+      }
+    } else {
+      uint8_t token = 0xC0 | (bestDistance << 3);
+      if (bestLen <= 9) {
+        out.push_back(token | (bestLen - 3));
+      } else {
+        out.push_back(token | 7);
+        epzPutVarint(out, bestLen - 10);
+      }
+    }
+    pos += bestLen;
+    literalStart = pos;
+  }
+  epzFlushLiteral(out, scan.data(), literalStart, count);
+  return out;
+}
+
+#endif
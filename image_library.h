@@ -0,0 +1,338 @@
+/*
+ * Image Library for E-Paper Photo Frame
+ * Playlist of stored images with a compact binary index, so the frame can
+ * cycle through many pictures without scanning the filesystem.
+ *
+ * Repository: https://github.com/9carlo6/E-Paper
+ * @author 9carlo6
+ * @date 2025
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (c) 2025 9carlo6
+ * All rights reserved.
+ */
+
+#ifndef IMAGE_LIBRARY_H
+#define IMAGE_LIBRARY_H
+
+#include <FS.h>
+#include <mbedtls/sha256.h>
+
+/*
+ * Index file: LibraryIndexHeader followed by `count` LibraryEntry records
+ * in playlist order (little endian, as stored in RAM). The whole index is
+ * kept in RAM; image paths are derived from the ID, so lookups never touch
+ * the filesystem.
+ */
+#define LIBRARY_INDEX_FILE "/library.idx"
+#define LIBRARY_INDEX_TEMP "/library.tmp"
+#define LIBRARY_MAGIC "EPL2"
+#define LIBRARY_MAGIC_CRC "EPL1"  // Previous index, keyed by CRC-32; converted on load
+#define LIBRARY_MAX_IMAGES 64
+#define LIBRARY_DEFAULT_DURATION_S 300
+#define LIBRARY_MIN_DURATION_S 30     // About one 7-color refresh
+#define LIBRARY_MAX_DURATION_S 64800  // 18 hours, within the uint16_t of the index
+#define LIBRARY_PATH_SIZE 32  // SPIFFS object names, with the terminator
+
+/*
+ * Stored images are identified by content: the SHA-256 of the file
+ * (mbedtls, in hardware on the ESP32) truncated to IMAGE_DIGEST_SIZE bytes,
+ * together with the file size. 96 bits leave the hex form short enough for
+ * a SPIFFS name (the image cache files are named after it) and make an
+ * accidental match between two of the frame's images out of reach; the
+ * size must match as well.
+ */
+#define IMAGE_DIGEST_SIZE 12
+#define IMAGE_DIGEST_HEX (2 * IMAGE_DIGEST_SIZE)
+
+enum LibraryFormat : uint8_t {
+  LIBRARY_FORMAT_RAW,  // 4-bit packed, IMAGE_SIZE bytes
+  LIBRARY_FORMAT_EPZ   // image_codec.h
+};
+
+struct LibraryIndexHeader {
+  char magic[4];
+  uint16_t count;
+  uint16_t nextId;
+};
+
+struct ImageDigest {
+  uint8_t hash[IMAGE_DIGEST_SIZE];  // SHA-256 of the file, truncated
+  uint32_t size;                    // Of the file
+
+  bool operator==(const ImageDigest& other) const {
+    return size == other.size && memcmp(hash, other.hash, IMAGE_DIGEST_SIZE) == 0;
+  }
+  bool operator!=(const ImageDigest& other) const { return !(*this == other); }
+};
+
+struct LibraryEntry {
+  uint16_t id;
+  uint16_t durationS;  // How long the slideshow shows it
+  uint32_t size;
+  uint8_t hash[IMAGE_DIGEST_SIZE];  // ImageDigest of the file, with size
+  uint8_t format;      // LibraryFormat
+  uint8_t reserved[3];
+
+  ImageDigest digest() const {
+    ImageDigest d;
+    memcpy(d.hash, hash, IMAGE_DIGEST_SIZE);
+    d.size = size;
+    return d;
+  }
+};
+
+// LibraryEntry of LIBRARY_MAGIC_CRC indexes
+struct LibraryEntryCrc {
+  uint16_t id;
+  uint16_t durationS;
+  uint32_t size;
+  uint32_t checksum;
+  uint8_t format;
+  uint8_t reserved[3];
+};
+
+static_assert(sizeof(LibraryIndexHeader) == 8, "index header layout");
+static_assert(sizeof(LibraryEntry) == 24, "index entry layout");
+static_assert(sizeof(LibraryEntryCrc) == 16, "previous index entry layout");
+
+// Incremental ImageDigest, for data that arrives in pieces
+class ImageHasher {
+ public:
+  void begin() {
+    mbedtls_sha256_init(&_context);
+    mbedtls_sha256_starts(&_context, 0);  // 0: SHA-256, not SHA-224
+    _size = 0;
+  }
+
+  void update(const uint8_t* data, size_t length) {
+    mbedtls_sha256_update(&_context, data, length);
+    _size += length;
+  }
+
+  ImageDigest finish() {
+    uint8_t full[32];
+    mbedtls_sha256_finish(&_context, full);
+    mbedtls_sha256_free(&_context);
+    ImageDigest digest;
+    memcpy(digest.hash, full, IMAGE_DIGEST_SIZE);
+    digest.size = _size;
+    return digest;
+  }
+
+ private:
+  mbedtls_sha256_context _context;
+  uint32_t _size = 0;
+};
+
+// Digest of a whole file, read from the start
+inline bool imageDigestFile(File& file, ImageDigest& digest) {
+  if (!file || !file.seek(0)) return false;
+  ImageHasher hasher;
+  hasher.begin();
+  uint8_t buffer[512];
+  size_t n;
+  while ((n = file.read(buffer, sizeof(buffer))) > 0) hasher.update(buffer, n);
+  digest = hasher.finish();
+  return digest.size == file.size();
+}
+
+// Text form for URLs and headers: the hash in hex, a dash and the size
+inline String imageDigestText(const ImageDigest& digest) {
+  char text[IMAGE_DIGEST_HEX + 12];
+  for (uint8_t i = 0; i < IMAGE_DIGEST_SIZE; i++) {
+    snprintf(text + 2 * i, 3, "%02x", digest.hash[i]);
+  }
+  snprintf(text + IMAGE_DIGEST_HEX, sizeof(text) - IMAGE_DIGEST_HEX, "-%u", (unsigned)digest.size);
+  return String(text);
+}
+
+// Parses the hex part of a digest (exactly IMAGE_DIGEST_HEX digits)
+inline bool parseDigestHash(const char* text, uint8_t* hash) {
+  for (uint8_t i = 0; i < IMAGE_DIGEST_SIZE; i++) {
+    uint8_t value = 0;
+    for (uint8_t k = 0; k < 2; k++) {
+      char c = text[2 * i + k];
+      uint8_t nibble;
+      if (c >= '0' && c <= '9') nibble = c - '0';
+      else if (c >= 'a' && c <= 'f') nibble = c - 'a' + 10;
+      else if (c >= 'A' && c <= 'F') nibble = c - 'A' + 10;
+      else return false;
+      value = value << 4 | nibble;
+    }
+    hash[i] = value;
+  }
+  return true;
+}
+
+// Inverse of imageDigestText()
+inline bool parseImageDigest(const String& text, ImageDigest& digest) {
+  if (text.length() < IMAGE_DIGEST_HEX + 2 || text.length() > IMAGE_DIGEST_HEX + 11 ||
+      text[IMAGE_DIGEST_HEX] != '-' || !parseDigestHash(text.c_str(), digest.hash)) {
+    return false;
+  }
+  uint64_t size = 0;
+  for (size_t i = IMAGE_DIGEST_HEX + 1; i < text.length(); i++) {
+    if (text[i] < '0' || text[i] > '9') return false;
+    size = size * 10 + (text[i] - '0');
+  }
+  if (size > UINT32_MAX) return false;
+  digest.size = size;
+  return true;
+}
+
+inline void libraryImagePath(uint16_t id, char* path) {
+  snprintf(path, LIBRARY_PATH_SIZE, "/img%u.bin", id);
+}
+
+class ImageLibrary {
+ public:
+  // Loads the index; a missing or damaged index starts an empty library
+  bool begin(fs::FS& fs) {
+    _fs = &fs;
+    _count = 0;
+    _nextId = 1;
+    if (!fs.exists(LIBRARY_INDEX_FILE) && fs.exists(LIBRARY_INDEX_TEMP)) {
+      fs.rename(LIBRARY_INDEX_TEMP, LIBRARY_INDEX_FILE);  // Cut between remove and rename
+    }
+
+    File file = fs.open(LIBRARY_INDEX_FILE, FILE_READ);
+    if (!file) return false;
+    LibraryIndexHeader header;
+    bool valid = file.read((uint8_t*)&header, sizeof(header)) == sizeof(header) &&
+                 header.count <= LIBRARY_MAX_IMAGES;
+    if (valid && memcmp(header.magic, LIBRARY_MAGIC_CRC, 4) == 0) {
+      return convertCrcIndex(file, header);
+    }
+    valid = valid && memcmp(header.magic, LIBRARY_MAGIC, 4) == 0;
+    size_t bytes = valid ? header.count * sizeof(LibraryEntry) : 0;
+    valid = valid && file.read((uint8_t*)_entries, bytes) == bytes;
+    file.close();
+    if (!valid) return false;
+
+    _count = header.count;
+    _nextId = header.nextId ? header.nextId : 1;
+    return true;
+  }
+
+  uint16_t count() const { return _count; }
+  bool full() const { return _count >= LIBRARY_MAX_IMAGES; }
+  const LibraryEntry& entry(uint16_t position) const { return _entries[position]; }
+
+  // ID the next add() will use, so the upload can be written to its final path
+  uint16_t nextId() const { return _nextId; }
+
+  // Position of the image in the playlist, -1 if unknown
+  int16_t find(uint16_t id) const {
+    for (uint16_t i = 0; i < _count; i++) {
+      if (_entries[i].id == id) return i;
+    }
+    return -1;
+  }
+
+  // Position of the first image with this content (hash and size), -1 if none
+  int16_t findDigest(const ImageDigest& digest) const {
+    for (uint16_t i = 0; i < _count; i++) {
+      if (_entries[i].digest() == digest) return i;
+    }
+    return -1;
+  }
+
+  // Appends the image already stored under libraryImagePath(nextId())
+  bool add(const ImageDigest& digest, uint8_t format, uint16_t durationS) {
+    if (full()) return false;
+    LibraryEntry& e = _entries[_count];
+    memset(&e, 0, sizeof(e));
+    e.id = _nextId;
+    e.durationS = durationS ? durationS : LIBRARY_DEFAULT_DURATION_S;
+    e.size = digest.size;
+    memcpy(e.hash, digest.hash, IMAGE_DIGEST_SIZE);
+    e.format = format;
+    _count++;
+    _nextId = _nextId == 0xFFFF ? 1 : _nextId + 1;
+    return save();
+  }
+
+  // Drops the entry and its file
+  bool remove(uint16_t id) {
+    int16_t position = find(id);
+    if (position < 0) return false;
+    memmove(&_entries[position], &_entries[position + 1], (_count - position - 1) * sizeof(LibraryEntry));
+    _count--;
+    char path[LIBRARY_PATH_SIZE];
+    libraryImagePath(id, path);
+    _fs->remove(path);
+    return save();
+  }
+
+  // New playlist order; ids must list every image exactly once
+  bool reorder(const uint16_t* ids, uint16_t count) {
+    if (count != _count) return false;
+    LibraryEntry reordered[LIBRARY_MAX_IMAGES];
+    for (uint16_t i = 0; i < count; i++) {
+      int16_t position = find(ids[i]);
+      if (position < 0) return false;
+      for (uint16_t j = 0; j < i; j++) {
+        if (ids[j] == ids[i]) return false;
+      }
+      reordered[i] = _entries[position];
+    }
+    memcpy(_entries, reordered, count * sizeof(LibraryEntry));
+    return save();
+  }
+
+ private:
+  fs::FS* _fs = nullptr;
+  LibraryEntry _entries[LIBRARY_MAX_IMAGES];
+  uint16_t _count = 0;
+  uint16_t _nextId = 1;
+
+  // Index from before the SHA-256 digests: the images are hashed once and
+  // the index rewritten; entries whose file is gone are dropped
+  bool convertCrcIndex(File& file, const LibraryIndexHeader& header) {
+    LibraryEntryCrc old;
+    _nextId = header.nextId ? header.nextId : 1;
+    for (uint16_t i = 0; i < header.count; i++) {
+      if (file.read((uint8_t*)&old, sizeof(old)) != sizeof(old)) break;
+      char path[LIBRARY_PATH_SIZE];
+      libraryImagePath(old.id, path);
+      File image = _fs->open(path, FILE_READ);
+      ImageDigest digest;
+      bool hashed = imageDigestFile(image, digest);
+      image.close();
+      if (!hashed) continue;
+      LibraryEntry& e = _entries[_count++];
+      memset(&e, 0, sizeof(e));
+      e.id = old.id;
+      e.durationS = old.durationS;
+      e.size = digest.size;
+      memcpy(e.hash, digest.hash, IMAGE_DIGEST_SIZE);
+      e.format = old.format;
+    }
+    file.close();
+    return save();
+  }
+
+  // Written aside and renamed, so a power cut keeps the previous index
+  bool save() {
+    File file = _fs->open(LIBRARY_INDEX_TEMP, FILE_WRITE);
+    if (!file) return false;
+    LibraryIndexHeader header;
+    memcpy(header.magic, LIBRARY_MAGIC, 4);
+    header.count = _count;
+    header.nextId = _nextId;
+    size_t bytes = _count * sizeof(LibraryEntry);
+    bool written = file.write((const uint8_t*)&header, sizeof(header)) == sizeof(header) &&
+                   file.write((const uint8_t*)_entries, bytes) == bytes;
+    file.close();
+    if (!written) {
+      _fs->remove(LIBRARY_INDEX_TEMP);
+      return false;
+    }
+    _fs->remove(LIBRARY_INDEX_FILE);
+    return _fs->rename(LIBRARY_INDEX_TEMP, LIBRARY_INDEX_FILE);
+  }
+};
+
+#endif
@@ -0,0 +1,530 @@
+/*
+ * JPEG Decoder for E-Paper Photo Frame
+ * Turns a JPEG stream into the 4-bit frame format on the device, so a
+ * photo can be pushed without the dithering of the web interface.
+ *
+ * Repository: https://github.com/9carlo6/E-Paper
+ * @author 9carlo6
+ * @date 2025
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (c) 2025 9carlo6
+ * All rights reserved.
+ */
+
+#ifndef JPEG_DECODER_H
+#define JPEG_DECODER_H
+
+#include <esp32/rom/tjpgd.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "dithering.h"
+
+/*
+ * TJpgDec (in the ROM) decodes one MCU at a time and can prescale by 1/2,
+ * 1/4 or 1/8 in the IDCT; the largest prescale that still covers the frame
+ * is used, and the rest of the cover crop (less than 2x) is an area
+ * average: each frame pixel is the mean of the prescaled pixels it covers.
+ * The column averages of one MCU row are kept until the row is complete,
+ * then its rows are summed into the frame rows they cover and each
+ * finished row goes through RowDitherer and out as a packed row. The
+ * working memory does not depend on the size of the photo: at most about
+ * 35 KB for the 448x600 frame (4:2:0 without prescale), less once a
+ * prescale applies.
+ *
+ * The EXIF Orientation tag is read from the header bytes as they pass.
+ * Rows then come out of the photo in a different order than the frame's,
+ * so a rotated or mirrored photo is dithered in its own row order into a
+ * packed frame (width * height / 2 bytes, in PSRAM when the board has
+ * it) that is written out at the end. Without the memory for it the photo
+ * is decoded as stored, and orientationApplied() says so.
+ */
+#define JPEG_DECODER_POOL 3500  // TJpgDec work area (3100 bytes minimum)
+#define JPEG_MAX_SCALE 3        // 1/8
+#define JPEG_MAX_BAND_ROWS 16   // MCU height of 4:2:0
+#define JPEG_EXIF_ORIENTATION 0x0112
+
+/*
+ * Orientation of the Exif APP1 segment, from the stream bytes up to the
+ * first scan. Forward only: the TIFF header, the IFD0 entry count and the
+ * entries are picked up as they go by, so nothing of the segment (or its
+ * thumbnail) is kept.
+ */
+class ExifOrientation {
+ public:
+  void begin() {
+    _state = STATE_SOI;
+    _count = 0;
+    _orientation = 1;
+  }
+
+  bool active() const { return _state != STATE_DONE; }
+  uint8_t value() const { return _orientation; }  // 1 to 8, 1 without a tag
+
+  void feed(const uint8_t* data, size_t length) {
+    for (size_t i = 0; i < length && _state != STATE_DONE; i++) feedByte(data[i]);
+  }
+
+ private:
+  enum State : uint8_t { STATE_SOI, STATE_MARKER, STATE_SEGMENT, STATE_DONE };
+  enum Step : uint8_t { STEP_HEADER, STEP_COUNT, STEP_ENTRY, STEP_SKIP };
+
+  State _state = STATE_DONE;
+  Step _step = STEP_SKIP;
+  uint8_t _orientation = 1;
+  uint8_t _count = 0;
+  uint8_t _field[12];
+  bool _bigEndian = false;
+  uint16_t _entries = 0;
+  uint32_t _offset = 0;   // In the segment payload
+  uint32_t _length = 0;   // Of the segment payload
+  uint32_t _want = 0;     // TIFF offset of the next field
+
+  void feedByte(uint8_t b) {
+    switch (_state) {
+      case STATE_SOI:
+        if (b != (_count == 0 ? 0xFF : 0xD8)) {
+          _state = STATE_DONE;
+        } else if (++_count == 2) {
+          _state = STATE_MARKER;
+          _count = 0;
+        }
+        break;
+
+      case STATE_MARKER:
+        if (_count == 0 && b != 0xFF) {
+          _state = STATE_DONE;  // Not a marker: leave the rest to the decoder
+          break;
+        }
+        if (_count == 1 && b == 0xFF) break;  // Fill byte
+        _field[_count++] = b;
+        if (_count == 4) {
+          uint8_t marker = _field[1];
+          _length = ((uint32_t)_field[2] << 8 | _field[3]);
+          if (marker == 0xDA || marker == 0xD9 || _length < 2) {
+            _state = STATE_DONE;  // Scan data (or no image): no Exif after this
+            break;
+          }
+          _length -= 2;
+          _offset = 0;
+          _count = 0;
+          _step = marker == 0xE1 ? STEP_HEADER : STEP_SKIP;
+          _want = 0;
+          _state = _length ? STATE_SEGMENT : STATE_MARKER;
+        }
+        break;
+
+      case STATE_SEGMENT:
+        if (_step != STEP_SKIP) segmentByte(b);
+        if (++_offset == _length && _state == STATE_SEGMENT) {
+          _state = STATE_MARKER;
+          _count = 0;
+        }
+        break;
+
+      case STATE_DONE:
+        break;
+    }
+  }
+
+  // Payload byte of an APP1: "Exif\0\0", then a TIFF file
+  void segmentByte(uint8_t b) {
+    static const char EXIF_ID[6] = {'E', 'x', 'i', 'f', 0, 0};
+    if (_offset < 6) {
+      if (b != (uint8_t)EXIF_ID[_offset]) _step = STEP_SKIP;
+      return;
+    }
+    uint32_t t = _offset - 6;
+    uint8_t need = _step == STEP_HEADER ? 8 : (_step == STEP_COUNT ? 2 : 12);
+    if (t < _want || t >= _want + need) return;
+    _field[t - _want] = b;
+    if (t != _want + need - 1) return;
+
+    switch (_step) {
+      case STEP_HEADER:
+        _bigEndian = _field[0] == 'M';
+        if ((_field[0] != 'I' && _field[0] != 'M') || _field[1] != _field[0] || read16(2) != 42) {
+          _step = STEP_SKIP;
+          break;
+        }
+        _want = read32(4);
+        _step = _want >= 8 ? STEP_COUNT : STEP_SKIP;
+        break;
+      case STEP_COUNT:
+        _entries = read16(0);
+        _want += 2;
+        _step = _entries ? STEP_ENTRY : STEP_SKIP;
+        break;
+      case STEP_ENTRY: {
+        uint16_t tag = read16(0);
+        if (tag == JPEG_EXIF_ORIENTATION) {
+          uint16_t value = read16(8);  // SHORT, left-aligned in the value field
+          if (value >= 1 && value <= 8) _orientation = value;
+          _state = STATE_DONE;
+        } else if (tag > JPEG_EXIF_ORIENTATION || --_entries == 0) {
+          _step = STEP_SKIP;  // Entries are sorted by tag
+        } else {
+          _want += 12;
+        }
+        break;
+      }
+      case STEP_SKIP:
+        break;
+    }
+  }
+
+  uint16_t read16(int i) const {
+    return _bigEndian ? (uint16_t)(_field[i] << 8 | _field[i + 1]) : (uint16_t)(_field[i + 1] << 8 | _field[i]);
+  }
+
+  uint32_t read32(int i) const {
+    return _bigEndian ? (uint32_t)read16(i) << 16 | read16(i + 2) : (uint32_t)read16(i + 2) << 16 | read16(i);
+  }
+};
+
+class JpegDecoder {
+ public:
+  // Next bytes of the JPEG; buffer nullptr skips length bytes. 0 at the end
+  typedef size_t (*ReadFunction)(void* context, uint8_t* buffer, size_t length);
+  // One packed row of the frame (width / 2 bytes), top to bottom
+  typedef bool (*WriteFunction)(void* context, const uint8_t* row, size_t length);
+
+  JRESULT decode(ReadFunction read, WriteFunction write, void* context,
+                 DitherAlgorithm algorithm, const PaletteProfile& palette, int width, int height) {
+    _read = read;
+    _write = write;
+    _context = context;
+    _width = width;
+    _height = height;
+    _rowsOut = 0;
+    _memoryBytes = 0;
+    _orientation = 1;
+    _exif.begin();
+
+    JRESULT result = JDR_MEM1;
+    void* pool = malloc(JPEG_DECODER_POOL);
+    if (pool) {
+      JDEC jd;
+      result = jd_prepare(&jd, input, pool, JPEG_DECODER_POOL, this);
+      if (result == JDR_OK) {
+        _sourceWidth = jd.width;
+        _sourceHeight = jd.height;
+        result = begin(jd, algorithm, palette);
+        if (result == JDR_OK) result = jd_decomp(&jd, output, _scale);
+        if (result == JDR_OK) result = finish();
+        end();
+      }
+      free(pool);
+    }
+    return result;
+  }
+
+  uint32_t sourceWidth() const { return _sourceWidth; }
+  uint32_t sourceHeight() const { return _sourceHeight; }
+  uint8_t scale() const { return _scale; }              // Prescale 1/2^scale
+  int rows() const { return _rowsOut; }                 // Frame rows written
+  size_t memoryBytes() const { return _memoryBytes; }   // Peak working memory
+  uint8_t orientation() const { return _exif.value(); } // EXIF Orientation, 1 to 8
+  bool orientationApplied() const { return _orientation == _exif.value(); }
+
+ private:
+  ReadFunction _read = nullptr;
+  WriteFunction _write = nullptr;
+  void* _context = nullptr;
+  int _width = 0;
+  int _height = 0;
+  uint32_t _sourceWidth = 0;
+  uint32_t _sourceHeight = 0;
+  uint8_t _scale = 0;
+  size_t _memoryBytes = 0;
+  ExifOrientation _exif;
+
+  // The photo's own grid: the frame turned back by the orientation, so its
+  // rows follow the decoded rows. _gridWidth x _gridHeight
+  uint8_t _orientation = 1;     // Applied, 1 when decoded as stored
+  int _gridWidth = 0;
+  int _gridHeight = 0;
+  uint8_t* _frame = nullptr;    // Packed frame for orientations other than 1
+
+  // Cover crop of the prescaled image: grid pixel (x, y) averages source
+  // columns [_columns[x], _columns[x + 1]) and the rows from rowStart(y)
+  uint16_t* _columns = nullptr;
+  float _zoom = 1;
+  float _cropTop = 0;
+  uint32_t _scaledWidth = 0;
+  uint32_t _scaledHeight = 0;
+
+  uint8_t* _band = nullptr;     // Column averages of one MCU row, RGB
+  uint16_t _bandRows = 0;       // MCU height in the prescaled image
+  uint16_t _bandFilled = 0;     // Rows of the current band (fewer at the bottom)
+  int32_t _bandTop = -1;        // Source row of the band, -1 if empty
+  uint16_t _blockColumn = 0;    // First grid column the next block can fill
+  uint16_t _carry[JPEG_MAX_BAND_ROWS][3];  // Column sums split between two blocks
+  uint16_t _carryCount = 0;
+  uint16_t* _rowSums = nullptr; // Grid row split between two bands
+  uint16_t _rowCount = 0;
+  uint8_t* _row = nullptr;      // Averaged grid row, RGB
+  uint8_t* _quantized = nullptr;
+  uint8_t* _packed = nullptr;
+  RowDitherer _ditherer;
+  int _rowsIn = 0;              // Grid rows given to the ditherer
+  int _rowsDithered = 0;
+  int _rowsOut = 0;
+  bool _writeFailed = false;
+
+  JRESULT begin(const JDEC& jd, DitherAlgorithm algorithm, const PaletteProfile& palette) {
+    // Orientations 5 to 8 swap the axes: the photo's rows become columns
+    uint8_t orientation = _exif.value();
+    bool transposed = orientation >= 5;
+    _gridWidth = transposed ? _height : _width;
+    _gridHeight = transposed ? _width : _height;
+
+    _scale = 0;
+    while (_scale < JPEG_MAX_SCALE && (jd.width >> (_scale + 1)) >= (uint32_t)_gridWidth &&
+           (jd.height >> (_scale + 1)) >= (uint32_t)_gridHeight) {
+      _scale++;
+    }
+    _scaledWidth = jd.width >> _scale;
+    _scaledHeight = jd.height >> _scale;
+    if (_scaledWidth == 0 || _scaledHeight == 0) return JDR_FMT1;
+
+    // Fill the frame and center, like the Fit button of the web interface
+    float zoomX = (float)_gridWidth / _scaledWidth;
+    float zoomY = (float)_gridHeight / _scaledHeight;
+    _zoom = zoomX > zoomY ? zoomX : zoomY;
+    float cropLeft = (_scaledWidth - _gridWidth / _zoom) / 2;
+    _cropTop = (_scaledHeight - _gridHeight / _zoom) / 2;
+
+    _bandRows = (8 * jd.msy) >> _scale;
+    if (_bandRows == 0) _bandRows = 1;
+    if (_bandRows > JPEG_MAX_BAND_ROWS) return JDR_FMT3;
+    size_t frameBytes = (size_t)(_width + 1) / 2 * _height;
+    _columns = (uint16_t*)malloc((_gridWidth + 1) * sizeof(uint16_t));
+    _band = (uint8_t*)malloc((size_t)_bandRows * _gridWidth * 3);
+    _rowSums = (uint16_t*)calloc((size_t)_gridWidth * 3, sizeof(uint16_t));
+    _row = (uint8_t*)malloc((size_t)_gridWidth * 3);
+    _quantized = (uint8_t*)malloc(_gridWidth);
+    _packed = (uint8_t*)malloc((_width + 1) / 2);
+    if (!_columns || !_band || !_rowSums || !_row || !_quantized || !_packed) return JDR_MEM1;
+
+    // A rotated photo needs the whole frame; without it, decode as stored
+    _orientation = 1;
+    if (orientation != 1) {
+      _frame = (uint8_t*)malloc(frameBytes);
+      if (_frame) {
+        memset(_frame, 0, frameBytes);
+        _orientation = orientation;
+      }
+    }
+
+    for (int x = 0; x <= _gridWidth; x++) {
+      _columns[x] = boundary(x, cropLeft, _scaledWidth);
+    }
+    _ditherer.begin(algorithm, _gridWidth, palette);
+    _bandTop = -1;
+    _bandFilled = 0;
+    _blockColumn = 0;
+    _carryCount = 0;
+    memset(_carry, 0, sizeof(_carry));
+    _rowCount = 0;
+    _rowsIn = 0;
+    _rowsDithered = 0;
+    _writeFailed = false;
+    _memoryBytes = JPEG_DECODER_POOL + (_gridWidth + 1) * sizeof(uint16_t) + (size_t)_bandRows * _gridWidth * 3 +
+                   (size_t)_gridWidth * 3 * sizeof(uint16_t) + (size_t)_gridWidth * 3 + _gridWidth +
+                   (_width + 1) / 2 + _ditherer.memoryBytes() + (_frame ? frameBytes : 0);
+    return JDR_OK;
+  }
+
+  void end() {
+    free(_columns);
+    free(_band);
+    free(_rowSums);
+    free(_row);
+    free(_quantized);
+    free(_packed);
+    free(_frame);
+    _columns = nullptr;
+    _band = nullptr;
+    _rowSums = nullptr;
+    _row = nullptr;
+    _quantized = nullptr;
+    _packed = nullptr;
+    _frame = nullptr;
+  }
+
+  // First source pixel of grid pixel i along an axis, size at the far end
+  uint16_t boundary(int i, float offset, uint32_t size) const {
+    int s = (int)floorf(i / _zoom + offset);
+    return s < 0 ? 0 : (s > (int)size ? size : s);
+  }
+
+  // Source span [start, end) of grid pixel i; at least one pixel when enlarging
+  static void span(uint16_t start, uint16_t next, uint32_t size, int& first, int& last) {
+    first = start < size ? start : size - 1;
+    last = next > first ? next : first + 1;
+  }
+
+  void rowSpan(int y, int& first, int& last) const {
+    span(boundary(y, _cropTop, _scaledHeight), boundary(y + 1, _cropTop, _scaledHeight), _scaledHeight, first, last);
+  }
+
+  static uint32_t input(JDEC* jd, uint8_t* buffer, uint32_t length) {
+    JpegDecoder* self = (JpegDecoder*)jd->device;
+    if (!self->_exif.active()) return self->_read(self->_context, buffer, length);
+    if (buffer) {
+      uint32_t n = self->_read(self->_context, buffer, length);
+      self->_exif.feed(buffer, n);
+      return n;
+    }
+    // A skipped segment may be the Exif one: read it while the tag is looked for
+    uint8_t scratch[64];
+    uint32_t done = 0;
+    while (done < length && self->_exif.active()) {
+      size_t chunk = length - done < sizeof(scratch) ? length - done : sizeof(scratch);
+      size_t n = self->_read(self->_context, scratch, chunk);
+      if (n == 0) return done;
+      self->_exif.feed(scratch, n);
+      done += n;
+    }
+    if (done < length) done += self->_read(self->_context, nullptr, length - done);
+    return done;
+  }
+
+  static uint32_t output(JDEC* jd, void* bitmap, JRECT* rect) {
+    JpegDecoder* self = (JpegDecoder*)jd->device;
+    return self->addBlock((const uint8_t*)bitmap, *rect) ? 1 : 0;
+  }
+
+  // Blocks arrive left to right; a new top means the previous row is complete
+  bool addBlock(const uint8_t* rgb, const JRECT& rect) {
+    if (rect.top != _bandTop) {
+      if (_bandTop >= 0 && !flushBand()) return false;
+      _bandTop = rect.top;
+      _blockColumn = 0;
+      _carryCount = 0;
+      memset(_carry, 0, sizeof(_carry));
+    }
+    int blockWidth = rect.right - rect.left + 1;
+    int blockRows = rect.bottom - rect.top + 1;
+    if (blockRows > _bandRows) blockRows = _bandRows;
+    _bandFilled = blockRows;
+    while (_blockColumn < _gridWidth) {
+      int first, last;
+      span(_columns[_blockColumn], _columns[_blockColumn + 1], _scaledWidth, first, last);
+      if (first > rect.right) break;
+      int from = first > rect.left ? first : rect.left;
+      int to = last - 1 < rect.right ? last - 1 : rect.right;
+      for (int y = 0; y < blockRows; y++) {
+        for (int sx = from; sx <= to; sx++) {
+          const uint8_t* pixel = &rgb[((size_t)y * blockWidth + sx - rect.left) * 3];
+          _carry[y][0] += pixel[0];
+          _carry[y][1] += pixel[1];
+          _carry[y][2] += pixel[2];
+        }
+      }
+      if (to >= from) _carryCount += to - from + 1;
+      if (last - 1 > rect.right) break;  // The rest is in the next block
+
+      uint16_t count = _carryCount ? _carryCount : 1;
+      for (int y = 0; y < blockRows; y++) {
+        uint8_t* out = &_band[((size_t)y * _gridWidth + _blockColumn) * 3];
+        for (int c = 0; c < 3; c++) {
+          out[c] = (_carry[y][c] + count / 2) / count;
+          _carry[y][c] = 0;
+        }
+      }
+      _carryCount = 0;
+      _blockColumn++;
+    }
+    return true;
+  }
+
+  // Grid rows covered by the band, dithered as far as the error allows
+  bool flushBand() {
+    int bandEnd = _bandTop + _bandFilled;
+    while (_rowsIn < _gridHeight) {
+      int first, last;
+      rowSpan(_rowsIn, first, last);
+      if (first >= bandEnd) break;
+      int from = first > _bandTop ? first : _bandTop;
+      int to = last < bandEnd ? last : bandEnd;
+      for (int sy = from; sy < to; sy++) {
+        const uint8_t* in = &_band[(size_t)(sy - _bandTop) * _gridWidth * 3];
+        for (int i = 0; i < _gridWidth * 3; i++) _rowSums[i] += in[i];
+        _rowCount++;
+      }
+      if (last > bandEnd) break;  // The rest is in the next band
+
+      if (_rowCount == 0) {
+        // Only with a damaged block order: take the band as it is
+        memcpy(_row, _band, (size_t)_gridWidth * 3);
+      } else {
+        for (int i = 0; i < _gridWidth * 3; i++) {
+          _row[i] = (_rowSums[i] + _rowCount / 2) / _rowCount;
+          _rowSums[i] = 0;
+        }
+      }
+      _rowCount = 0;
+      if (_ditherer.pushRow(_row, _quantized) && !ditheredRow()) return false;
+      _rowsIn++;
+    }
+    return true;
+  }
+
+  JRESULT finish() {
+    if (_writeFailed) return JDR_INTR;
+    if (_bandTop >= 0 && !flushBand()) return JDR_INTR;
+    if (_rowsIn < _gridHeight) return JDR_FMT1;  // Fewer rows than the header promised
+    while (_ditherer.flushRow(_quantized)) {
+      if (!ditheredRow()) return JDR_INTR;
+    }
+    if (_frame) {
+      size_t rowBytes = (_width + 1) / 2;
+      for (int y = 0; y < _height; y++) {
+        if (!writeRow(&_frame[(size_t)y * rowBytes])) return JDR_INTR;
+      }
+    }
+    return JDR_OK;
+  }
+
+  // Next row of the grid out of the ditherer: out now, or into the frame
+  bool ditheredRow() {
+    int y = _rowsDithered++;
+    if (!_frame) {
+      packImage(_quantized, _width, 1, _packed);
+      return writeRow(_packed);
+    }
+    size_t rowBytes = (_width + 1) / 2;
+    int w = _gridWidth, h = _gridHeight;
+    for (int x = 0; x < w; x++) {
+      int fx, fy;
+      switch (_orientation) {
+        case 2: fx = w - 1 - x; fy = y; break;          // Mirrored
+        case 3: fx = w - 1 - x; fy = h - 1 - y; break;  // Upside down
+        case 4: fx = x; fy = h - 1 - y; break;          // Mirrored, upside down
+        case 5: fx = y; fy = x; break;                  // Transposed
+        case 6: fx = h - 1 - y; fy = x; break;          // Turned right (portrait phone photo)
+        case 7: fx = h - 1 - y; fy = w - 1 - x; break;  // Transverse
+        default: fx = y; fy = w - 1 - x; break;         // 8: turned left
+      }
+      uint8_t* cell = &_frame[(size_t)fy * rowBytes + fx / 2];
+      *cell = fx & 1 ? (*cell & 0xF0) | (_quantized[x] & 0x0F) : (*cell & 0x0F) | (_quantized[x] << 4);
+    }
+    return true;
+  }
+
+  bool writeRow(const uint8_t* packed) {
+    if (!_write(_context, packed, (_width + 1) / 2)) {
+      _writeFailed = true;
+      return false;
+    }
+    _rowsOut++;
+    return true;
+  }
+};
+
+#endif
@@ -0,0 +1,215 @@
+#!/usr/bin/env node
+/*
+ * Blue Noise Mask Generator
+ * Builds the 64x64 void-and-cluster threshold mask of the blue-noise
+ * dithering mode, as blue_noise.h for the C++ code and as the
+ * BLUE_NOISE_MASK string of web_interface.h for the browser:
+ *
+ *   node tools/blue_noise_mask.js
+ *
+ * The mask is generated once and committed; the seed is fixed, so running
+ * the tool again gives the same tables. Run node tools/gzip_web_interface.js
+ * afterwards when web_interface.h changed.
+ *
+ * Repository: https://github.com/9carlo6/E-Paper
+ * @author 9carlo6
+ * @date 2025
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (c) 2025 9carlo6
+ * All rights reserved.
+ */
+
+'use strict';
+
+const fs = require('fs');
+const path = require('path');
+
+const ROOT = path.join(__dirname, '..');
+const SIZE = 64;
+const SIGMA = 1.5;           // Gaussian of the energy filter (Ulichney)
+const INITIAL_DENSITY = 0.1; // Share of pixels set in the initial pattern
+const SEED = 0x9e3779b9;
+
+/* ========================================
+   VOID AND CLUSTER
+   ======================================== */
+
+// Energy of a set pixel at every offset, wrapping around like the tiled mask
+function gaussianKernel() {
+    const kernel = new Float64Array(SIZE * SIZE);
+    for (let dy = 0; dy < SIZE; dy++) {
+        for (let dx = 0; dx < SIZE; dx++) {
+            const wx = Math.min(dx, SIZE - dx);
+            const wy = Math.min(dy, SIZE - dy);
+            kernel[dy * SIZE + dx] = Math.exp(-(wx * wx + wy * wy) / (2 * SIGMA * SIGMA));
+        }
+    }
+    return kernel;
+}
+
+class Pattern {
+    constructor(kernel) {
+        this.kernel = kernel;
+        this.bits = new Uint8Array(SIZE * SIZE);
+        this.energy = new Float64Array(SIZE * SIZE);
+        this.count = 0;
+    }
+
+    copy() {
+        const other = new Pattern(this.kernel);
+        other.bits.set(this.bits);
+        other.energy.set(this.energy);
+        other.count = this.count;
+        return other;
+    }
+
+    set(index, value) {
+        if (this.bits[index] === value) return;
+        this.bits[index] = value;
+        this.count += value ? 1 : -1;
+        const sign = value ? 1 : -1;
+        const px = index % SIZE;
+        const py = (index / SIZE) | 0;
+        for (let y = 0; y < SIZE; y++) {
+            const row = ((y - py + SIZE) % SIZE) * SIZE;
+            for (let x = 0; x < SIZE; x++) {
+                this.energy[y * SIZE + x] += sign * this.kernel[row + (x - px + SIZE) % SIZE];
+            }
+        }
+    }
+
+    // Set pixel with the most set neighbours
+    tightestCluster() {
+        let best = -1;
+        for (let i = 0; i < this.bits.length; i++) {
+            if (this.bits[i] && (best < 0 || this.energy[i] > this.energy[best])) best = i;
+        }
+        return best;
+    }
+
+    // Unset pixel with the fewest set neighbours
+    largestVoid() {
+        let best = -1;
+        for (let i = 0; i < this.bits.length; i++) {
+            if (!this.bits[i] && (best < 0 || this.energy[i] < this.energy[best])) best = i;
+        }
+        return best;
+    }
+}
+
+function random(seed) {
+    let state = seed >>> 0;
+    return () => {
+        state = (Math.imul(state, 1664525) + 1013904223) >>> 0;
+        return state / 4294967296;
+    };
+}
+
+// Rank of every pixel, 0 .. SIZE * SIZE - 1; lower ranks turn on first
+function voidAndCluster() {
+    const kernel = gaussianKernel();
+    const next = random(SEED);
+    const initial = new Pattern(kernel);
+    const target = Math.round(SIZE * SIZE * INITIAL_DENSITY);
+    while (initial.count < target) initial.set(Math.floor(next() * SIZE * SIZE), 1);
+
+    // Spread the initial pattern: move the tightest cluster into the largest void
+    for (;;) {
+        const cluster = initial.tightestCluster();
+        initial.set(cluster, 0);
+        const hole = initial.largestVoid();
+        initial.set(hole, 1);
+        if (hole === cluster) break;
+    }
+
+    const ranks = new Uint16Array(SIZE * SIZE);
+    const removing = initial.copy();
+    for (let rank = initial.count - 1; rank >= 0; rank--) {
+        const cluster = removing.tightestCluster();
+        removing.set(cluster, 0);
+        ranks[cluster] = rank;
+    }
+    // Past half the voids of the set pixels are the clusters of the unset ones
+    const adding = initial;
+    for (let rank = initial.count; rank < SIZE * SIZE; rank++) {
+        const hole = adding.largestVoid();
+        adding.set(hole, 1);
+        ranks[hole] = rank;
+    }
+    return ranks;
+}
+
+/* ========================================
+   OUTPUT
+   ======================================== */
+
+// 256 levels, each used by the same number of pixels
+function toLevels(ranks) {
+    const levels = new Uint8Array(ranks.length);
+    for (let i = 0; i < ranks.length; i++) levels[i] = (ranks[i] * 256 / ranks.length) | 0;
+    return levels;
+}
+
+function toHeader(levels) {
+    const lines = [];
+    for (let y = 0; y < SIZE; y++) {
+        const row = Array.from(levels.subarray(y * SIZE, (y + 1) * SIZE), (v) => String(v).padStart(3));
+        for (let i = 0; i < row.length; i += 16) {
+            lines.push((i === 0 ? '  {' : '   ') + row.slice(i, i + 16).join(',') + (i + 16 < row.length ? ',' : '},'));
+        }
+    }
+    return [
+        '/*',
+        ' * Blue Noise Mask for E-Paper Photo Frame',
+        ' * Generated by tools/blue_noise_mask.js - do not edit.',
+        ' *',
+        ' * Repository: https://github.com/9carlo6/E-Paper',
+        ' * @author 9carlo6',
+        ' * @date 2025',
+        ' * @version 1.0',
+        ' *',
+        ' * @copyright',
+        ' * Copyright (c) 2025 9carlo6',
+        ' * All rights reserved.',
+        ' */',
+        '',
+        '#ifndef BLUE_NOISE_H',
+        '#define BLUE_NOISE_H',
+        '',
+        '#include <stdint.h>',
+        '',
+        '// Void-and-cluster (sigma ' + SIGMA + '), tiled over the image; 256 levels, '
+            + (SIZE * SIZE / 256) + ' pixels each',
+        '#define BLUE_NOISE_SIZE ' + SIZE,
+        '',
+        'static const uint8_t BLUE_NOISE_MASK[BLUE_NOISE_SIZE][BLUE_NOISE_SIZE] = {',
+        ...lines,
+        '};',
+        '',
+        '#endif',
+        ''
+    ].join('\n');
+}
+
+// Replaces the BLUE_NOISE_MASK line of the page, keeping its CRLF endings
+function updatePage(file, levels) {
+    const source = fs.readFileSync(file, 'utf8');
+    const pattern = /^([ \t]*const BLUE_NOISE_MASK = )'[^']*';/m;
+    if (!pattern.test(source)) throw new Error('const BLUE_NOISE_MASK not found in ' + path.basename(file));
+    const updated = source.replace(pattern, (match, prefix) =>
+        prefix + "'" + Buffer.from(levels).toString('base64') + "';");
+    if (updated !== source) fs.writeFileSync(file, updated);
+}
+
+function main() {
+    const levels = toLevels(voidAndCluster());
+    const header = path.join(ROOT, 'blue_noise.h');
+    fs.writeFileSync(header, toHeader(levels));
+    updatePage(path.join(ROOT, 'web_interface.h'), levels);
+    console.log('✓ ' + path.basename(header) + ' and web_interface.h: ' + SIZE + 'x' + SIZE + ' mask');
+    return 0;
+}
+
+process.exitCode = main();
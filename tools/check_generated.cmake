@@ -0,0 +1,14 @@
+# Fails the host build when a committed generated header no longer matches
+# a fresh copy built from web_interface.h. The Arduino IDE compiles the
+# committed one, so it must not drift. Run by CMakeLists.txt:
+#
+#   cmake -DFRESH=<copy in the build tree> -DCOMMITTED=<header in the sketch> -P check_generated.cmake
+
+execute_process(COMMAND ${CMAKE_COMMAND} -E compare_files ${FRESH} ${COMMITTED}
+                RESULT_VARIABLE different)
+if(different)
+  get_filename_component(name ${COMMITTED} NAME)
+  message(FATAL_ERROR "${name} is out of date with web_interface.h. Regenerate it with\n"
+                      "  cmake --build <build dir> --target generated_headers\n"
+                      "and commit the result.")
+endif()
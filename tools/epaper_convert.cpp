@@ -0,0 +1,401 @@
+/*
+ * E-Paper Image Converter
+ * Batch-converts PPM/PNG photos into the /current.bin layout used by the
+ * frame (448x600, 4 bits per pixel), with the same dithering algorithms
+ * as the web interface. Files are converted in parallel.
+ *
+ * Repository: https://github.com/9carlo6/E-Paper
+ * @author 9carlo6
+ * @date 2025
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (c) 2025 9carlo6
+ * All rights reserved.
+ */
+
+#include <math.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../dithering.h"
+#include "../image_codec.h"
+#include "image_io.h"
+
+/* ========================================
+   CONFIGURATION
+   ======================================== */
+#define TARGET_WIDTH 448
+#define TARGET_HEIGHT 600
+#define BINARY_SIZE (TARGET_WIDTH * TARGET_HEIGHT / 2)
+
+struct ConvertOptions {
+  std::vector<DitherAlgorithm> algorithms;
+  std::string outputDir;
+  std::string compareDir;
+  DitherPalette palette = DITHER_PALETTE_IDEAL;
+  uint8_t background = 255;  // 255 white, 0 black (like the crop editor)
+  bool compress = true;      // EPZ, like generateBinary() in the web interface
+  unsigned jobs = 0;
+};
+
+static std::mutex logMutex;
+
+/* ========================================
+   FUNCTION DECLARATIONS
+   ======================================== */
+static void printUsage(const char* argv0);
+static bool parseAlgorithm(const std::string& name, std::vector<DitherAlgorithm>& algorithms);
+static void fitImage(const RgbaImage& source, uint8_t background, std::vector<uint8_t>& target);
+static std::string outputName(const std::string& input, DitherAlgorithm algorithm, bool suffix);
+static bool convertFile(const std::string& input, const ConvertOptions& options, std::string& report);
+static void benchmarkNearestColor();
+static void benchmarkDithering();
+
+/* ========================================
+   MAIN
+   ======================================== */
+int main(int argc, char** argv) {
+  ConvertOptions options;
+  std::vector<std::string> inputs;
+
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    bool hasValue = i + 1 < argc;
+    if ((arg == "-a" || arg == "--algorithm") && hasValue) {
+      if (!parseAlgorithm(argv[++i], options.algorithms)) {
+        fprintf(stderr, "✗ Unknown algorithm: %s\n", argv[i]);
+        return 2;
+      }
+    } else if ((arg == "-o" || arg == "--output") && hasValue) {
+      options.outputDir = argv[++i];
+    } else if ((arg == "-p" || arg == "--palette") && hasValue) {
+      options.palette = ditherPaletteFromId(argv[++i], DITHER_PALETTE_COUNT);
+      if (options.palette == DITHER_PALETTE_COUNT) {
+        fprintf(stderr, "✗ Unknown palette: %s\n", argv[i]);
+        return 2;
+      }
+    } else if ((arg == "-b" || arg == "--background") && hasValue) {
+      std::string color = argv[++i];
+      if (color != "white" && color != "black") {
+        fprintf(stderr, "✗ Background must be white or black\n");
+        return 2;
+      }
+      options.background = color == "white" ? 255 : 0;
+    } else if ((arg == "-f" || arg == "--format") && hasValue) {
+      std::string format = argv[++i];
+      if (format != "epz" && format != "raw") {
+        fprintf(stderr, "✗ Format must be epz or raw\n");
+        return 2;
+      }
+      options.compress = format == "epz";
+    } else if ((arg == "-j" || arg == "--jobs") && hasValue) {
+      options.jobs = atoi(argv[++i]);
+    } else if (arg == "--compare" && hasValue) {
+      options.compareDir = argv[++i];
+    } else if (arg == "--benchmark") {
+      benchmarkNearestColor();
+      benchmarkDithering();
+      return 0;
+    } else if (arg == "-h" || arg == "--help") {
+      printUsage(argv[0]);
+      return 0;
+    } else if (arg.size() > 1 && arg[0] == '-') {
+      printUsage(argv[0]);
+      return 2;
+    } else {
+      inputs.push_back(arg);
+    }
+  }
+
+  if (inputs.empty()) {
+    printUsage(argv[0]);
+    return 2;
+  }
+  if (options.algorithms.empty()) options.algorithms.push_back(DITHER_FLOYD_STEINBERG);
+  if (options.jobs == 0) options.jobs = std::max(1u, std::thread::hardware_concurrency());
+  options.jobs = std::min<unsigned>(options.jobs, inputs.size());
+
+  auto start = std::chrono::steady_clock::now();
+  std::atomic<size_t> next(0);
+  std::atomic<size_t> failures(0);
+
+  // Each worker takes the next file until the list is exhausted
+  auto worker = [&]() {
+    for (size_t i = next++; i < inputs.size(); i = next++) {
+      std::string report;
+      bool ok = convertFile(inputs[i], options, report);
+      if (!ok) failures++;
+      std::lock_guard<std::mutex> lock(logMutex);
+      printf("%s %s%s\n", ok ? "✓" : "✗", inputs[i].c_str(), report.c_str());
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (unsigned t = 1; t < options.jobs; t++) threads.emplace_back(worker);
+  worker();
+  for (auto& t : threads) t.join();
+
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  printf("%zu file(s), %zu failed, %.2f s (%.1f files/s, %u threads)\n", inputs.size(),
+         failures.load(), seconds, inputs.size() / (seconds > 0 ? seconds : 1), options.jobs);
+  return failures ? 1 : 0;
+}
+
+/* ========================================
+   COMMAND LINE
+   ======================================== */
+static void printUsage(const char* argv0) {
+  printf("Usage: %s [options] IMAGE...\n"
+         "Converts PPM/PNG images into the 448x600 4bpp frame format (.bin)\n"
+         "  -a, --algorithm NAME  floyd-steinberg, atkinson, ordered, none, bw, jarvis,\n"
+         "                        stucki, sierra, serpentine, blue-noise or all\n"
+         "                        (repeatable, default: floyd-steinberg)\n"
+         "  -p, --palette NAME    Panel colors: ideal (RGB matching, default) or acep\n"
+         "                        (measured inks, OKLab matching)\n"
+         "  -o, --output DIR      Output directory (default: next to each input)\n"
+         "  -b, --background C    white or black, fills uncovered or transparent areas\n"
+         "  -f, --format F        epz (compressed, raw if smaller) or raw (default: epz)\n"
+         "  -j, --jobs N          Worker threads (default: one per CPU)\n"
+         "  --compare DIR         Check every output against DIR/<name>.bin\n"
+         "  --benchmark           Time the nearest-color and dithering kernels and exit\n"
+         "Images that are not 448x600 are scaled to cover the frame and centered,\n"
+         "like the Fit button of the web interface.\n",
+         argv0);
+}
+
+static bool parseAlgorithm(const std::string& name, std::vector<DitherAlgorithm>& algorithms) {
+  for (int i = 0; i < DITHER_ALGORITHM_COUNT; i++) {
+    if (name == "all" || name == DITHER_ALGORITHM_IDS[i]) {
+      algorithms.push_back((DitherAlgorithm)i);
+      if (name != "all") return true;
+    }
+  }
+  return name == "all";
+}
+
+/* ========================================
+   CONVERSION
+   ======================================== */
+
+// Cover + center crop, box filter when shrinking, bilinear when enlarging
+static void fitImage(const RgbaImage& source, uint8_t background, std::vector<uint8_t>& target) {
+  target.assign((size_t)TARGET_WIDTH * TARGET_HEIGHT * 4, 255);
+
+  if (source.width == TARGET_WIDTH && source.height == TARGET_HEIGHT) {
+    for (size_t i = 0; i < target.size(); i += 4) {
+      const uint8_t* s = &source.pixels[i];
+      for (int c = 0; c < 3; c++) target[i + c] = (s[c] * s[3] + background * (255 - s[3]) + 127) / 255;
+    }
+    return;
+  }
+
+  double scale = std::max((double)TARGET_WIDTH / source.width, (double)TARGET_HEIGHT / source.height);
+  double offsetX = (source.width * scale - TARGET_WIDTH) / 2;
+  double offsetY = (source.height * scale - TARGET_HEIGHT) / 2;
+
+  for (int y = 0; y < TARGET_HEIGHT; y++) {
+    double sy0 = (y + offsetY) / scale;
+    double sy1 = (y + 1 + offsetY) / scale;
+    for (int x = 0; x < TARGET_WIDTH; x++) {
+      double sx0 = (x + offsetX) / scale;
+      double sx1 = (x + 1 + offsetX) / scale;
+      double sum[4] = {0, 0, 0, 0};
+      double total = 0;
+
+      if (scale >= 1) {
+        double fx = std::min(std::max((sx0 + sx1) / 2 - 0.5, 0.0), source.width - 1.0);
+        double fy = std::min(std::max((sy0 + sy1) / 2 - 0.5, 0.0), source.height - 1.0);
+        int ix = (int)fx, iy = (int)fy;
+        int ix1 = std::min(ix + 1, source.width - 1), iy1 = std::min(iy + 1, source.height - 1);
+        double ax = fx - ix, ay = fy - iy;
+        const int xs[2] = {ix, ix1}, ys[2] = {iy, iy1};
+        const double wx[2] = {1 - ax, ax}, wy[2] = {1 - ay, ay};
+        for (int j = 0; j < 2; j++) {
+          for (int i = 0; i < 2; i++) {
+            const uint8_t* p = &source.pixels[((size_t)ys[j] * source.width + xs[i]) * 4];
+            double w = wx[i] * wy[j];
+            for (int c = 0; c < 4; c++) sum[c] += p[c] * w;
+            total += w;
+          }
+        }
+      } else {
+        int iy0 = std::max(0, (int)sy0), iy1 = std::min(source.height, (int)ceil(sy1));
+        int ix0 = std::max(0, (int)sx0), ix1 = std::min(source.width, (int)ceil(sx1));
+        for (int sy = iy0; sy < iy1; sy++) {
+          double wy = std::min(sy + 1.0, sy1) - std::max((double)sy, sy0);
+          for (int sx = ix0; sx < ix1; sx++) {
+            double w = wy * (std::min(sx + 1.0, sx1) - std::max((double)sx, sx0));
+            const uint8_t* p = &source.pixels[((size_t)sy * source.width + sx) * 4];
+            for (int c = 0; c < 4; c++) sum[c] += p[c] * w;
+            total += w;
+          }
+        }
+      }
+
+      uint8_t* out = &target[((size_t)y * TARGET_WIDTH + x) * 4];
+      double alpha = total > 0 ? sum[3] / total / 255 : 0;
+      for (int c = 0; c < 3; c++) {
+        double v = total > 0 ? sum[c] / total : background;
+        out[c] = (uint8_t)(v * alpha + background * (1 - alpha) + 0.5);
+      }
+    }
+  }
+}
+
+static std::string outputName(const std::string& input, DitherAlgorithm algorithm, bool suffix) {
+  size_t slash = input.find_last_of('/');
+  std::string base = slash == std::string::npos ? input : input.substr(slash + 1);
+  size_t dot = base.find_last_of('.');
+  if (dot != std::string::npos && dot > 0) base = base.substr(0, dot);
+  if (suffix) base += std::string(".") + DITHER_ALGORITHM_IDS[algorithm];
+  return base + ".bin";
+}
+
+static bool convertFile(const std::string& input, const ConvertOptions& options, std::string& report) {
+  RgbaImage image;
+  std::string error;
+  if (!loadImage(input, image, error)) {
+    report = ": " + error;
+    return false;
+  }
+
+  std::vector<uint8_t> pixels;
+  fitImage(image, options.background, pixels);
+
+  std::vector<uint8_t> quantized((size_t)TARGET_WIDTH * TARGET_HEIGHT);
+  std::vector<uint8_t> packed(BINARY_SIZE);
+  std::string dir = options.outputDir;
+  if (dir.empty()) {
+    size_t slash = input.find_last_of('/');
+    dir = slash == std::string::npos ? "." : input.substr(0, slash);
+  }
+
+  bool ok = true;
+  bool suffix = options.algorithms.size() > 1;
+  for (DitherAlgorithm algorithm : options.algorithms) {
+    ditherImage(algorithm, pixels.data(), TARGET_WIDTH, TARGET_HEIGHT, quantized.data(),
+                ditherPalette(options.palette));
+    packImage(quantized.data(), TARGET_WIDTH, TARGET_HEIGHT, packed.data());
+    std::vector<uint8_t> output = packed;
+    if (options.compress) {
+      std::vector<uint8_t> compressed = encodeCompressedImage(quantized.data(), TARGET_WIDTH, TARGET_HEIGHT);
+      if (compressed.size() < output.size()) output.swap(compressed);
+    }
+
+    std::string name = outputName(input, algorithm, suffix);
+    if (!writeWholeFile(dir + "/" + name, output.data(), output.size())) {
+      report += " [" + name + ": write failed]";
+      ok = false;
+      continue;
+    }
+
+    if (!options.compareDir.empty()) {
+      std::vector<uint8_t> reference;
+      if (!readWholeFile(options.compareDir + "/" + name, reference)) {
+        report += " [" + name + ": no reference]";
+        ok = false;
+      } else if (reference != output) {
+        size_t diff = reference.size() > output.size() ? reference.size() - output.size() : 0;
+        for (size_t i = 0; i < output.size(); i++) {
+          if (i >= reference.size() || reference[i] != output[i]) diff++;
+        }
+        report += " [" + name + ": " + std::to_string(diff) + " bytes differ]";
+        ok = false;
+      } else {
+        report += " [" + name + ": identical]";
+      }
+    } else {
+      report += " -> " + dir + "/" + name + " (" + std::to_string(output.size()) + " bytes)";
+    }
+  }
+  return ok;
+}
+
+/* ========================================
+   BENCHMARK
+   ======================================== */
+static void benchmarkNearestColor() {
+  const size_t count = (size_t)TARGET_WIDTH * TARGET_HEIGHT;
+  const int rounds = 20;
+  std::vector<uint8_t> rgb(count * 3);
+  uint32_t seed = 12345;
+  for (auto& v : rgb) {
+    seed = seed * 1103515245u + 12345u;
+    v = seed >> 24;
+  }
+  std::vector<float> planar(count * 3);
+  for (size_t i = 0; i < count; i++) {
+    for (int c = 0; c < 3; c++) planar[c * count + i] = rgb[i * 3 + c];
+  }
+
+  std::vector<uint8_t> exact(count), lut(count), simd(count), oklab(count);
+  auto time = [&](const char* name, std::vector<uint8_t>& out, auto kernel) {
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++) kernel(out.data());
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / rounds;
+    printf("  %-22s %7.2f ms/image %8.1f Mpx/s\n", name, ms, count / ms / 1000);
+  };
+
+  NearestColorLut::instance();  // Built once, outside the timing
+  printf("Nearest color, %zu random pixels:\n", count);
+  time("exact search", exact, [&](uint8_t* out) {
+    for (size_t i = 0; i < count; i++) out[i] = findClosestColorExact(rgb[i * 3], rgb[i * 3 + 1], rgb[i * 3 + 2]);
+  });
+  time("lookup cube", lut, [&](uint8_t* out) {
+    for (size_t i = 0; i < count; i++) out[i] = findClosestColor(rgb[i * 3], rgb[i * 3 + 1], rgb[i * 3 + 2]);
+  });
+  time("batch (" DITHER_SIMD_NAME ")", simd, [&](uint8_t* out) {
+    findClosestColorsPlanar(&planar[0], &planar[count], &planar[count * 2], count, 1, out);
+  });
+  const PaletteProfile& acep = ditherPalette(DITHER_PALETTE_ACEP);
+  time("OKLab cube (acep)", oklab, [&](uint8_t* out) {
+    for (size_t i = 0; i < count; i++) out[i] = acep.match(rgb[i * 3], rgb[i * 3 + 1], rgb[i * 3 + 2]);
+  });
+  printf("  results %s\n", exact == lut && exact == simd ? "identical" : "DIFFER");
+}
+
+// Every algorithm on a full frame: gradients with some noise, like a photo
+static void benchmarkDithering() {
+  const size_t count = (size_t)TARGET_WIDTH * TARGET_HEIGHT;
+  const int rounds = 10;
+  std::vector<uint8_t> rgba(count * 4);
+  uint32_t seed = 12345;
+  for (int y = 0; y < TARGET_HEIGHT; y++) {
+    for (int x = 0; x < TARGET_WIDTH; x++) {
+      uint8_t* p = &rgba[((size_t)y * TARGET_WIDTH + x) * 4];
+      seed = seed * 1103515245u + 12345u;
+      int noise = (int)(seed >> 28) - 8;
+      p[0] = std::min(255, std::max(0, x * 255 / TARGET_WIDTH + noise));
+      p[1] = std::min(255, std::max(0, y * 255 / TARGET_HEIGHT + noise));
+      p[2] = std::min(255, std::max(0, (x + y) * 255 / (TARGET_WIDTH + TARGET_HEIGHT) - noise));
+      p[3] = 255;
+    }
+  }
+
+  std::vector<uint8_t> quantized(count);
+  auto time = [&](DitherAlgorithm algorithm, DitherPalette palette) {
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++) {
+      ditherImage(algorithm, rgba.data(), TARGET_WIDTH, TARGET_HEIGHT, quantized.data(), ditherPalette(palette));
+    }
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / rounds;
+  };
+
+  printf("Dithering, %dx%d frame (ideal palette, then acep):\n", TARGET_WIDTH, TARGET_HEIGHT);
+  for (int i = 0; i < DITHER_ALGORITHM_COUNT; i++) {
+    DitherAlgorithm algorithm = (DitherAlgorithm)i;
+    double ms = time(algorithm, DITHER_PALETTE_IDEAL);
+    double acepMs = time(algorithm, DITHER_PALETTE_ACEP);
+    RowDitherer streaming;  // What the on-device JPEG decoder holds for it
+    streaming.begin(algorithm, TARGET_WIDTH);
+    printf("  %-22s %7.2f ms/image %8.1f Mpx/s %7.2f ms acep %6zu bytes streaming\n", DITHER_ALGORITHM_IDS[i],
+           ms, count / ms / 1000, acepMs, streaming.memoryBytes());
+  }
+}
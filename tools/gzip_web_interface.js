@@ -0,0 +1,94 @@
+#!/usr/bin/env node
+/*
+ * Web Interface Compressor
+ * Builds web_interface_gz.h, the gzip-compressed page the frame serves,
+ * from the HTML in web_interface.h. Run it after editing the web interface:
+ *
+ *   node tools/gzip_web_interface.js
+ *
+ * The output is deterministic (no timestamp in the gzip header), so an
+ * unchanged page gives an unchanged file and ETag. The host build checks
+ * the committed header against a fresh copy and fails when it is stale.
+ *
+ * Repository: https://github.com/9carlo6/E-Paper
+ * @author 9carlo6
+ * @date 2025
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (c) 2025 9carlo6
+ * All rights reserved.
+ */
+
+'use strict';
+
+const crypto = require('crypto');
+const fs = require('fs');
+const path = require('path');
+const zlib = require('zlib');
+
+const ROOT = path.join(__dirname, '..');
+const START = 'R"rawliteral(';
+const END = ')rawliteral"';
+
+function extractPage(source) {
+    const start = source.indexOf(START);
+    const end = source.indexOf(END, start);
+    if (start < 0 || end < 0) throw new Error('HTML_PAGE raw literal not found in web_interface.h');
+    // The compiler stores the lines of a raw literal with \n endings
+    return source.slice(start + START.length, end).replace(/\r\n/g, '\n');
+}
+
+function toHeader(page, gzip) {
+    const etag = crypto.createHash('sha256').update(gzip).digest('hex').slice(0, 16);
+    const lines = [];
+    for (let i = 0; i < gzip.length; i += 16) {
+        const row = Array.from(gzip.subarray(i, i + 16), (b) => '0x' + b.toString(16).padStart(2, '0'));
+        lines.push('  ' + row.join(', ') + ',');
+    }
+    return [
+        '/*',
+        ' * Web Interface for E-Paper Photo Frame, gzip-compressed',
+        ' * Generated from web_interface.h by tools/gzip_web_interface.js - do not edit.',
+        ' *',
+        ' * Repository: https://github.com/9carlo6/E-Paper',
+        ' * @author 9carlo6',
+        ' * @date 2025',
+        ' * @version 1.0',
+        ' *',
+        ' * @copyright',
+        ' * Copyright (c) 2025 9carlo6',
+        ' * All rights reserved.',
+        ' */',
+        '',
+        '#ifndef WEB_INTERFACE_GZ_H',
+        '#define WEB_INTERFACE_GZ_H',
+        '',
+        '#define HTML_PAGE_SIZE ' + Buffer.byteLength(page) + '  // Uncompressed',
+        '#define HTML_PAGE_GZ_SIZE ' + gzip.length,
+        '#define HTML_PAGE_ETAG "\\"' + etag + '\\""  // Strong ETag: hash of the compressed page',
+        '',
+        'const uint8_t HTML_PAGE_GZ[] PROGMEM = {',
+        ...lines,
+        '};',
+        '',
+        '#endif',
+        ''
+    ].join('\n');
+}
+
+function main(argv) {
+    const input = argv[0] || path.join(ROOT, 'web_interface.h');
+    const output = argv[1] || path.join(ROOT, 'web_interface_gz.h');
+    const page = extractPage(fs.readFileSync(input, 'utf8'));
+    const gzip = zlib.gzipSync(Buffer.from(page, 'utf8'), { level: 9 });
+    const header = toHeader(page, gzip);
+    // Leave the file alone when nothing changed, so the build does not redo the sketch
+    if (!fs.existsSync(output) || fs.readFileSync(output, 'utf8') !== header) {
+        fs.writeFileSync(output, header);
+    }
+    console.log('✓ ' + path.basename(output) + ': ' + Buffer.byteLength(page) + ' -> ' + gzip.length + ' bytes');
+    return 0;
+}
+
+process.exitCode = main(process.argv.slice(2));
@@ -0,0 +1,450 @@
+/*
+ * Image Input for the E-Paper host tools
+ * Minimal PPM (P3/P6) and PNG readers, no external libraries.
+ * PNG: 1-16 bit gray, gray+alpha, RGB, RGBA and palette, non-interlaced.
+ *
+ * Repository: https://github.com/9carlo6/E-Paper
+ * @author 9carlo6
+ * @date 2025
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (c) 2025 9carlo6
+ * All rights reserved.
+ */
+
+#ifndef IMAGE_IO_H
+#define IMAGE_IO_H
+
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+// 8-bit RGBA, same layout as canvas ImageData
+struct RgbaImage {
+  int width = 0;
+  int height = 0;
+  std::vector<uint8_t> pixels;
+};
+
+/* ========================================
+   FILE HELPERS
+   ======================================== */
+
+inline bool readWholeFile(const std::string& path, std::vector<uint8_t>& data) {
+  FILE* f = fopen(path.c_str(), "rb");
+  if (!f) return false;
+  uint8_t chunk[65536];
+  size_t n;
+  data.clear();
+  while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) {
+    data.insert(data.end(), chunk, chunk + n);
+  }
+  fclose(f);
+  return true;
+}
+
+inline bool writeWholeFile(const std::string& path, const uint8_t* data, size_t size) {
+  FILE* f = fopen(path.c_str(), "wb");
+  if (!f) return false;
+  bool ok = fwrite(data, 1, size, f) == size;
+  return fclose(f) == 0 && ok;
+}
+
+/* ========================================
+   PPM
+   ======================================== */
+
+inline bool ppmReadToken(const std::vector<uint8_t>& data, size_t& pos, long& value) {
+  while (pos < data.size()) {
+    if (data[pos] == '#') {
+      while (pos < data.size() && data[pos] != '\n') pos++;
+    } else if (isspace(data[pos])) {
+      pos++;
+    } else {
+      break;
+    }
+  }
+  if (pos >= data.size() || !isdigit(data[pos])) return false;
+  value = 0;
+  while (pos < data.size() && isdigit(data[pos])) {
+    value = value * 10 + (data[pos++] - '0');
+    if (value > 1000000) return false;
+  }
+  return true;
+}
+
+inline bool decodePpm(const std::vector<uint8_t>& data, RgbaImage& image, std::string& error) {
+  bool ascii = data[1] == '3';
+  size_t pos = 2;
+  long width, height, maxval;
+  if (!ppmReadToken(data, pos, width) || !ppmReadToken(data, pos, height) ||
+      !ppmReadToken(data, pos, maxval) || width <= 0 || height <= 0 || maxval <= 0 || maxval > 65535) {
+    error = "invalid PPM header";
+    return false;
+  }
+  pos++;  // Single whitespace before the raster
+
+  image.width = width;
+  image.height = height;
+  image.pixels.assign((size_t)width * height * 4, 255);
+  size_t samples = (size_t)width * height * 3;
+  int sampleBytes = maxval > 255 ? 2 : 1;
+  if (!ascii && data.size() < pos + samples * sampleBytes) {
+    error = "truncated PPM raster";
+    return false;
+  }
+
+  for (size_t i = 0; i < samples; i++) {
+    long v;
+    if (ascii) {
+      if (!ppmReadToken(data, pos, v)) {
+        error = "truncated PPM raster";
+        return false;
+      }
+    } else if (sampleBytes == 2) {
+      v = (data[pos + i * 2] << 8) | data[pos + i * 2 + 1];
+    } else {
+      v = data[pos + i];
+    }
+    if (v > maxval) v = maxval;
+    image.pixels[i / 3 * 4 + i % 3] = (uint8_t)((v * 255 + maxval / 2) / maxval);
+  }
+  return true;
+}
+
+/* ========================================
+   INFLATE (RFC 1951)
+   ======================================== */
+
+class Inflater {
+ public:
+  Inflater(const uint8_t* data, size_t size) : _data(data), _size(size) {}
+
+  bool run(std::vector<uint8_t>& out) {
+    bool last = false;
+    while (!last) {
+      last = bits(1);
+      int type = bits(2);
+      bool ok;
+      if (type == 0) ok = storedBlock(out);
+      else if (type == 1) ok = fixedBlock(out);
+      else if (type == 2) ok = dynamicBlock(out);
+      else ok = false;
+      if (!ok || _overrun) return false;
+    }
+    return true;
+  }
+
+ private:
+  struct Huffman {
+    uint16_t counts[16];
+    uint16_t symbols[288];
+  };
+
+  const uint8_t* _data;
+  size_t _size;
+  size_t _pos = 0;
+  uint32_t _bitBuf = 0;
+  int _bitCount = 0;
+  bool _overrun = false;
+
+  uint32_t bits(int need) {
+    while (_bitCount < need) {
+      if (_pos >= _size) {
+        _overrun = true;
+        return 0;
+      }
+      _bitBuf |= (uint32_t)_data[_pos++] << _bitCount;
+      _bitCount += 8;
+    }
+    uint32_t v = _bitBuf & ((1u << need) - 1);
+    _bitBuf >>= need;
+    _bitCount -= need;
+    return v;
+  }
+
+  static bool build(Huffman& h, const uint8_t* lengths, int n) {
+    memset(h.counts, 0, sizeof(h.counts));
+    for (int i = 0; i < n; i++) h.counts[lengths[i]]++;
+    h.counts[0] = 0;
+    uint16_t offsets[16];
+    offsets[1] = 0;
+    for (int i = 1; i < 15; i++) offsets[i + 1] = offsets[i] + h.counts[i];
+    for (int i = 0; i < n; i++) {
+      if (lengths[i]) h.symbols[offsets[lengths[i]]++] = i;
+    }
+    return true;
+  }
+
+  int decode(const Huffman& h) {
+    int code = 0, first = 0, index = 0;
+    for (int len = 1; len < 16; len++) {
+      code |= bits(1);
+      int count = h.counts[len];
+      if (code - count < first) return h.symbols[index + (code - first)];
+      index += count;
+      first = (first + count) << 1;
+      code <<= 1;
+      if (_overrun) return -1;
+    }
+    return -1;
+  }
+
+  bool storedBlock(std::vector<uint8_t>& out) {
+    _bitBuf = 0;
+    _bitCount = 0;
+    if (_pos + 4 > _size) return false;
+    uint16_t len = _data[_pos] | (_data[_pos + 1] << 8);
+    uint16_t nlen = _data[_pos + 2] | (_data[_pos + 3] << 8);
+    _pos += 4;
+    if ((uint16_t)~nlen != len || _pos + len > _size) return false;
+    out.insert(out.end(), _data + _pos, _data + _pos + len);
+    _pos += len;
+    return true;
+  }
+
+  bool fixedBlock(std::vector<uint8_t>& out) {
+    uint8_t lengths[288];
+    int i = 0;
+    for (; i < 144; i++) lengths[i] = 8;
+    for (; i < 256; i++) lengths[i] = 9;
+    for (; i < 280; i++) lengths[i] = 7;
+    for (; i < 288; i++) lengths[i] = 8;
+    Huffman lit, dist;
+    build(lit, lengths, 288);
+    for (i = 0; i < 30; i++) lengths[i] = 5;
+    build(dist, lengths, 30);
+    return codes(out, lit, dist);
+  }
+
+  bool dynamicBlock(std::vector<uint8_t>& out) {
+    static const uint8_t order[19] = {16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+    int nlen = bits(5) + 257;
+    int ndist = bits(5) + 1;
+    int ncode = bits(4) + 4;
+    if (nlen > 286 || ndist > 30) return false;
+
+    uint8_t lengths[320] = {0};
+    for (int i = 0; i < ncode; i++) lengths[order[i]] = bits(3);
+    Huffman lencode;
+    build(lencode, lengths, 19);
+
+    memset(lengths, 0, sizeof(lengths));
+    int index = 0;
+    while (index < nlen + ndist) {
+      int symbol = decode(lencode);
+      if (symbol < 0) return false;
+      if (symbol < 16) {
+        lengths[index++] = symbol;
+        continue;
+      }
+      int repeat, value = 0;
+      if (symbol == 16) {
+        if (index == 0) return false;
+        value = lengths[index - 1];
+        repeat = 3 + bits(2);
+      } else if (symbol == 17) {
+        repeat = 3 + bits(3);
+      } else {
+        repeat = 11 + bits(7);
+      }
+      if (index + repeat > nlen + ndist) return false;
+      while (repeat--) lengths[index++] = value;
+    }
+
+    Huffman lit, dist;
+    build(lit, lengths, nlen);
+    build(dist, lengths + nlen, ndist);
+    return codes(out, lit, dist);
+  }
+
+  bool codes(std::vector<uint8_t>& out, const Huffman& lit, const Huffman& dist) {
+    static const uint16_t lenBase[29] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+                                         35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+    static const uint8_t lenExtra[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2,
+                                         2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+    static const uint16_t distBase[30] = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129,
+                                          193, 257, 385, 513, 769, 1025, 1537, 2049, 3073,
+                                          4097, 6145, 8193, 12289, 16385, 24577};
+    static const uint8_t distExtra[30] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6,
+                                          6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+    for (;;) {
+      int symbol = decode(lit);
+      if (symbol < 0) return false;
+      if (symbol < 256) {
+        out.push_back(symbol);
+      } else if (symbol == 256) {
+        return true;
+      } else {
+        symbol -= 257;
+        if (symbol >= 29) return false;
+        size_t len = lenBase[symbol] + bits(lenExtra[symbol]);
+        int ds = decode(dist);
+        if (ds < 0 || ds >= 30) return false;
+        size_t d = distBase[ds] + bits(distExtra[ds]);
+        if (d > out.size()) return false;
+        size_t from = out.size() - d;
+        for (size_t i = 0; i < len; i++) out.push_back(out[from + i]);
+      }
+    }
+  }
+};
+
+/* ========================================
+   PNG
+   ======================================== */
+
+inline uint32_t pngU32(const uint8_t* p) {
+  return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+inline bool decodePng(const std::vector<uint8_t>& data, RgbaImage& image, std::string& error) {
+  uint32_t width = 0, height = 0;
+  uint8_t depth = 0, colorType = 0, interlace = 0;
+  std::vector<uint8_t> idat, palette, transparency;
+
+  for (size_t pos = 8; pos + 12 <= data.size();) {
+    uint32_t len = pngU32(&data[pos]);
+    if (pos + 12 + len > data.size()) break;
+    const uint8_t* type = &data[pos + 4];
+    const uint8_t* body = &data[pos + 8];
+    if (!memcmp(type, "IHDR", 4) && len >= 13) {
+      width = pngU32(body);
+      height = pngU32(body + 4);
+      depth = body[8];
+      colorType = body[9];
+      interlace = body[12];
+    } else if (!memcmp(type, "PLTE", 4)) {
+      palette.assign(body, body + len);
+    } else if (!memcmp(type, "tRNS", 4)) {
+      transparency.assign(body, body + len);
+    } else if (!memcmp(type, "IDAT", 4)) {
+      idat.insert(idat.end(), body, body + len);
+    } else if (!memcmp(type, "IEND", 4)) {
+      break;
+    }
+    pos += 12 + len;
+  }
+
+  int channels = colorType == 0 ? 1 : colorType == 2 ? 3 : colorType == 3 ? 1 : colorType == 4 ? 2 : colorType == 6 ? 4 : 0;
+  if (!width || !height || width > 20000 || height > 20000 || !channels) {
+    error = "unsupported PNG header";
+    return false;
+  }
+  if (interlace) {
+    error = "interlaced PNG is not supported";
+    return false;
+  }
+  if (idat.size() < 2) {
+    error = "missing PNG image data";
+    return false;
+  }
+
+  std::vector<uint8_t> raw;
+  Inflater inflater(idat.data() + 2, idat.size() - 2);  // Skip the zlib header
+  if (!inflater.run(raw)) {
+    error = "corrupt PNG image data";
+    return false;
+  }
+
+  size_t bitsPerPixel = (size_t)channels * depth;
+  size_t stride = (width * bitsPerPixel + 7) / 8;
+  size_t bpp = (bitsPerPixel + 7) / 8;
+  if (raw.size() < (stride + 1) * height) {
+    error = "truncated PNG image data";
+    return false;
+  }
+
+  // Undo the per-row filters in place
+  std::vector<uint8_t> prev(stride, 0);
+  for (uint32_t y = 0; y < height; y++) {
+    uint8_t filter = raw[y * (stride + 1)];
+    uint8_t* row = &raw[y * (stride + 1) + 1];
+    for (size_t i = 0; i < stride; i++) {
+      int a = i >= bpp ? row[i - bpp] : 0;
+      int b = prev[i];
+      int c = i >= bpp ? prev[i - bpp] : 0;
+      switch (filter) {
+        case 1: row[i] += a; break;
+        case 2: row[i] += b; break;
+        case 3: row[i] += (a + b) / 2; break;
+        case 4: {
+          int p = a + b - c;
+          int pa = abs(p - a), pb = abs(p - b), pc = abs(p - c);
+          row[i] += (pa <= pb && pa <= pc) ? a : (pb <= pc ? b : c);
+          break;
+        }
+      }
+    }
+    memcpy(prev.data(), row, stride);
+  }
+
+  image.width = width;
+  image.height = height;
+  image.pixels.assign((size_t)width * height * 4, 255);
+  for (uint32_t y = 0; y < height; y++) {
+    const uint8_t* row = &raw[y * (stride + 1) + 1];
+    for (uint32_t x = 0; x < width; x++) {
+      uint16_t s[4];
+      for (int c = 0; c < channels; c++) {
+        size_t index = (size_t)x * channels + c;
+        if (depth == 16) {
+          s[c] = row[index * 2];  // High byte
+        } else if (depth == 8) {
+          s[c] = row[index];
+        } else {
+          size_t bit = index * depth;
+          s[c] = (row[bit / 8] >> (8 - depth - bit % 8)) & ((1 << depth) - 1);
+          if (colorType != 3) s[c] = s[c] * 255 / ((1 << depth) - 1);
+        }
+      }
+      uint8_t* out = &image.pixels[((size_t)y * width + x) * 4];
+      switch (colorType) {
+        case 0: out[0] = out[1] = out[2] = s[0]; break;
+        case 2: out[0] = s[0]; out[1] = s[1]; out[2] = s[2]; break;
+        case 4: out[0] = out[1] = out[2] = s[0]; out[3] = s[1]; break;
+        case 6: out[0] = s[0]; out[1] = s[1]; out[2] = s[2]; out[3] = s[3]; break;
+        case 3:
+          if ((size_t)s[0] * 3 + 2 >= palette.size()) {
+            error = "PNG palette index out of range";
+            return false;
+          }
+          out[0] = palette[s[0] * 3];
+          out[1] = palette[s[0] * 3 + 1];
+          out[2] = palette[s[0] * 3 + 2];
+          if (s[0] < transparency.size()) out[3] = transparency[s[0]];
+          break;
+      }
+    }
+  }
+  return true;
+}
+
+/* ========================================
+   ENTRY POINT
+   ======================================== */
+
+inline bool loadImage(const std::string& path, RgbaImage& image, std::string& error) {
+  std::vector<uint8_t> data;
+  if (!readWholeFile(path, data)) {
+    error = "cannot read file";
+    return false;
+  }
+  static const uint8_t pngSignature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+  if (data.size() >= 8 && !memcmp(data.data(), pngSignature, 8)) {
+    return decodePng(data, image, error);
+  }
+  if (data.size() >= 3 && data[0] == 'P' && (data[1] == '3' || data[1] == '6')) {
+    return decodePpm(data, image, error);
+  }
+  error = "unknown format (expected PPM or PNG)";
+  return false;
+}
+
+#endif
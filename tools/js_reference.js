@@ -0,0 +1,194 @@
+#!/usr/bin/env node
+/*
+ * JavaScript Reference Converter
+ * Runs the dithering functions embedded in web_interface.h under Node.js,
+ * so the output of epaper_convert can be checked against the browser code:
+ *
+ *   node tools/js_reference.js -a all -o ref/ corpus/*.ppm
+ *   epaper_convert -a all -o out/ --compare ref/ corpus/*.ppm
+ *
+ * Input: binary PPM (P6, maxval 255), already 448x600.
+ *
+ * Repository: https://github.com/9carlo6/E-Paper
+ * @author 9carlo6
+ * @date 2025
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (c) 2025 9carlo6
+ * All rights reserved.
+ */
+
+'use strict';
+
+const fs = require('fs');
+const path = require('path');
+const vm = require('vm');
+
+const ALGORITHMS = {
+    'floyd-steinberg': 'floydSteinbergDithering',
+    'atkinson': 'atkinsonDithering',
+    'ordered': 'orderedDithering',
+    'none': 'noDithering',
+    'bw': 'blackAndWhiteDithering',
+    'jarvis': 'jarvisDithering',
+    'stucki': 'stuckiDithering',
+    'sierra': 'sierraDithering',
+    'serpentine': 'serpentineDithering',
+    'blue-noise': 'blueNoiseDithering'
+};
+
+/* ========================================
+   EXTRACT THE BROWSER CODE
+   ======================================== */
+function extractFunction(source, name) {
+    const start = source.indexOf('function ' + name + '(');
+    if (start < 0) throw new Error('function ' + name + ' not found in web_interface.h');
+    let depth = 0;
+    for (let i = source.indexOf('{', start); i < source.length; i++) {
+        if (source[i] === '{') depth++;
+        else if (source[i] === '}' && --depth === 0) return source.slice(start, i + 1);
+    }
+    throw new Error('unterminated function ' + name);
+}
+
+function extractConstant(source, name) {
+    // At the start of a line, not inside the source string built for the workers
+    const match = source.match(new RegExp('^[ \\t]*(const ' + name + ' = [^;]*;)', 'm'));
+    if (!match) throw new Error('const ' + name + ' not found in web_interface.h');
+    return match[1];
+}
+
+function loadReference() {
+    const header = fs.readFileSync(path.join(__dirname, '..', 'web_interface.h'), 'utf8');
+    const code = [
+        extractConstant(header, 'TARGET_WIDTH'),
+        extractConstant(header, 'TARGET_HEIGHT'),
+        extractConstant(header, 'COLORS'),
+        extractConstant(header, 'EPZ_DISTANCES'),
+        extractConstant(header, 'EPZ_MAX_LITERAL'),
+        extractConstant(header, 'EPZ_MIN_BREAK'),
+        extractFunction(header, 'findClosestColorExact'),
+        extractFunction(header, 'buildNearestLut'),
+        extractConstant(header, 'NEAREST_LUT'),
+        extractFunction(header, 'findClosestColor'),
+        extractConstant(header, 'PALETTES'),
+        extractFunction(header, 'paletteRoot'),
+        extractFunction(header, 'srgbToLinear'),
+        extractFunction(header, 'toOklab'),
+        extractFunction(header, 'buildPaletteLut'),
+        extractFunction(header, 'createPalette'),
+        extractFunction(header, 'matchColor'),
+        extractConstant(header, 'FLOYD_STEINBERG_TAPS'),
+        extractConstant(header, 'BLUE_NOISE_SIZE'),
+        extractConstant(header, 'BLUE_NOISE_MASK'),
+        extractConstant(header, 'BLUE_NOISE'),
+        extractFunction(header, 'diffusionBuffer'),
+        extractFunction(header, 'diffuseErrorDithering'),
+        extractFunction(header, 'generateRawBinary'),
+        extractFunction(header, 'encodeCompressed'),
+        extractFunction(header, 'generateBinary'),
+        ...Object.values(ALGORITHMS).map((name) => extractFunction(header, name))
+    ].join('\n');
+    const context = { atob };  // Not part of the language, the page gets it from the browser
+    vm.createContext(context);
+    vm.runInContext(code + '\nthis.api = { TARGET_WIDTH, TARGET_HEIGHT, PALETTES, createPalette, generateBinary, generateRawBinary, ' +
+                    Object.values(ALGORITHMS).join(', ') + ' };', context);
+    return context.api;
+}
+
+/* ========================================
+   PPM INPUT
+   ======================================== */
+function readPpm(file) {
+    const data = fs.readFileSync(file);
+    if (data[0] !== 0x50 || data[1] !== 0x36) throw new Error('not a binary PPM (P6)');
+    const fields = [];
+    let pos = 2;
+    while (fields.length < 3) {
+        while (/\s/.test(String.fromCharCode(data[pos]))) pos++;
+        if (data[pos] === 0x23) {
+            while (data[pos] !== 0x0A) pos++;
+            continue;
+        }
+        let token = '';
+        while (/\d/.test(String.fromCharCode(data[pos]))) token += String.fromCharCode(data[pos++]);
+        fields.push(parseInt(token, 10));
+    }
+    const [width, height, maxval] = fields;
+    if (maxval !== 255) throw new Error('only maxval 255 is supported');
+    pos++;
+
+    const pixels = new Uint8ClampedArray(width * height * 4);
+    for (let i = 0; i < width * height; i++) {
+        pixels[i * 4] = data[pos + i * 3];
+        pixels[i * 4 + 1] = data[pos + i * 3 + 1];
+        pixels[i * 4 + 2] = data[pos + i * 3 + 2];
+        pixels[i * 4 + 3] = 255;
+    }
+    return { width, height, pixels };
+}
+
+/* ========================================
+   MAIN
+   ======================================== */
+function main(argv) {
+    const algorithms = [];
+    const inputs = [];
+    let outputDir = null;
+    let format = 'epz';
+    let palette = 'ideal';
+
+    for (let i = 0; i < argv.length; i++) {
+        if ((argv[i] === '-a' || argv[i] === '--algorithm') && i + 1 < argv.length) {
+            const name = argv[++i];
+            if (name === 'all') algorithms.push(...Object.keys(ALGORITHMS));
+            else if (ALGORITHMS[name]) algorithms.push(name);
+            else throw new Error('unknown algorithm ' + name);
+        } else if ((argv[i] === '-o' || argv[i] === '--output') && i + 1 < argv.length) {
+            outputDir = argv[++i];
+        } else if ((argv[i] === '-p' || argv[i] === '--palette') && i + 1 < argv.length) {
+            palette = argv[++i];
+        } else if ((argv[i] === '-f' || argv[i] === '--format') && i + 1 < argv.length) {
+            format = argv[++i];
+            if (format !== 'epz' && format !== 'raw') throw new Error('format must be epz or raw');
+        } else {
+            inputs.push(argv[i]);
+        }
+    }
+    if (!inputs.length) {
+        console.log('Usage: node tools/js_reference.js [-a NAME|all] [-p ideal|acep] [-f epz|raw] [-o DIR] IMAGE.ppm...');
+        return 2;
+    }
+    if (!algorithms.length) algorithms.push('floyd-steinberg');
+
+    const api = loadReference();
+    if (!api.PALETTES[palette]) throw new Error('unknown palette ' + palette);
+    const profile = api.createPalette(palette);
+    let failures = 0;
+    for (const input of inputs) {
+        try {
+            const image = readPpm(input);
+            if (image.width !== api.TARGET_WIDTH || image.height !== api.TARGET_HEIGHT) {
+                throw new Error('must be ' + api.TARGET_WIDTH + 'x' + api.TARGET_HEIGHT);
+            }
+            // Same naming as epaper_convert, so --compare finds the files
+            const base = path.basename(input).replace(/\.[^.]*$/, '');
+            for (const algorithm of algorithms) {
+                const quantized = api[ALGORITHMS[algorithm]](
+                    new Uint8ClampedArray(image.pixels), image.width, image.height, profile);
+                const name = base + (algorithms.length > 1 ? '.' + algorithm : '') + '.bin';
+                const dir = outputDir || path.dirname(input);
+                const binary = format === 'raw' ? api.generateRawBinary(quantized) : api.generateBinary(quantized);
+                fs.writeFileSync(path.join(dir, name), binary);
+            }
+            console.log('✓ ' + input);
+        } catch (err) {
+            console.log('✗ ' + input + ': ' + err.message);
+            failures++;
+        }
+    }
+    return failures ? 1 : 0;
+}
+
+process.exitCode = main(process.argv.slice(2));
@@ -0,0 +1,140 @@
+#!/usr/bin/env node
+/*
+ * Palette LUT Generator
+ * Builds palette_lut.h, the measured panel palettes of web_interface.h with
+ * their OKLab lookup cubes, for the C++ code:
+ *
+ *   node tools/palette_lut.js [output.h]
+ *
+ * The page builds the same cubes at run time; this runs its PALETTES and
+ * buildPaletteLut() (taken from web_interface.h), so the tables match it
+ * by construction. The output is deterministic, so an unchanged page gives
+ * an unchanged file; the host build checks the committed one against it.
+ *
+ * Repository: https://github.com/9carlo6/E-Paper
+ * @author 9carlo6
+ * @date 2025
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (c) 2025 9carlo6
+ * All rights reserved.
+ */
+
+'use strict';
+
+const fs = require('fs');
+const path = require('path');
+const vm = require('vm');
+
+const ROOT = path.join(__dirname, '..');
+
+/* ========================================
+   EXTRACT THE BROWSER CODE
+   ======================================== */
+function extractFunction(source, name) {
+    const start = source.indexOf('function ' + name + '(');
+    if (start < 0) throw new Error('function ' + name + ' not found in web_interface.h');
+    let depth = 0;
+    for (let i = source.indexOf('{', start); i < source.length; i++) {
+        if (source[i] === '{') depth++;
+        else if (source[i] === '}' && --depth === 0) return source.slice(start, i + 1);
+    }
+    throw new Error('unterminated function ' + name);
+}
+
+function extractConstant(source, name) {
+    const match = source.match(new RegExp('^[ \\t]*(const ' + name + ' = [^;]*;)', 'm'));
+    if (!match) throw new Error('const ' + name + ' not found in web_interface.h');
+    return match[1];
+}
+
+function loadPalettes() {
+    const header = fs.readFileSync(path.join(ROOT, 'web_interface.h'), 'utf8');
+    const code = [
+        extractConstant(header, 'COLORS'),
+        extractConstant(header, 'PALETTES'),
+        extractFunction(header, 'paletteRoot'),
+        extractFunction(header, 'srgbToLinear'),
+        extractFunction(header, 'toOklab'),
+        extractFunction(header, 'buildPaletteLut')
+    ].join('\n');
+    const context = {};
+    vm.createContext(context);
+    vm.runInContext(code + '\nthis.api = { PALETTES, buildPaletteLut };', context);
+    return context.api;
+}
+
+/* ========================================
+   OUTPUT
+   ======================================== */
+function toArray(values, perLine) {
+    const lines = [];
+    for (let i = 0; i < values.length; i += perLine) {
+        lines.push('  ' + Array.from(values.slice(i, i + perLine)).join(',') + ',');
+    }
+    return lines;
+}
+
+function toHeader(api) {
+    const ids = Object.keys(api.PALETTES);
+    const tables = [];
+    for (const id of ids) {
+        const profile = api.PALETTES[id];
+        if (!profile.perceptual) continue;
+        const name = 'PALETTE_' + id.toUpperCase();
+        tables.push(
+            '// ' + profile.name,
+            'static const uint8_t ' + name + '_COLORS[7][3] = {',
+            ...profile.colors.map((c) => '  {' + c.join(', ') + '},'),
+            '};',
+            '',
+            'static const uint8_t ' + name + '_LUT[PALETTE_LUT_SIZE] = {',
+            ...toArray(api.buildPaletteLut(profile.colors), 64),
+            '};',
+            ''
+        );
+    }
+    return [
+        '/*',
+        ' * Measured Palettes for E-Paper Photo Frame',
+        ' * Generated from PALETTES in web_interface.h by tools/palette_lut.js - do not edit.',
+        ' *',
+        ' * Repository: https://github.com/9carlo6/E-Paper',
+        ' * @author 9carlo6',
+        ' * @date 2025',
+        ' * @version 1.0',
+        ' *',
+        ' * @copyright',
+        ' * Copyright (c) 2025 9carlo6',
+        ' * All rights reserved.',
+        ' */',
+        '',
+        '#ifndef PALETTE_LUT_H',
+        '#define PALETTE_LUT_H',
+        '',
+        '#include <stdint.h>',
+        '',
+        '// Nearest color in OKLab of each 8x8x8 cell center, index (r >> 3) << 10 | (g >> 3) << 5 | b >> 3',
+        '#define PALETTE_LUT_SIZE (32 * 32 * 32)',
+        '',
+        ...tables,
+        '#endif',
+        ''
+    ].join('\n');
+}
+
+function main(argv) {
+    const api = loadPalettes();
+    const output = argv[0] || path.join(ROOT, 'palette_lut.h');
+    const header = toHeader(api);
+    // Leave the file alone when nothing changed, so the build does not redo the sketch
+    if (!fs.existsSync(output) || fs.readFileSync(output, 'utf8') !== header) {
+        fs.writeFileSync(output, header);
+    }
+    const count = Object.values(api.PALETTES).filter((p) => p.perceptual).length;
+    console.log('✓ ' + path.basename(output) + ': ' + count + ' measured palette' + (count === 1 ? '' : 's'));
+    return 0;
+}
+
+process.exitCode = main(process.argv.slice(2));
@@ -159,6 +159,11 @@ const char HTML_PAGE[] PROGMEM = R"rawliteral(
             background: black;
             color: white;
         }
+        .bg-btn-palette {
+            width: 100px;
+            background: white;
+            color: #333;
+        }
         .algorithm-selection {
             display: none;
             margin: 20px 0;
@@ -194,6 +199,14 @@ const char HTML_PAGE[] PROGMEM = R"rawliteral(
             border-radius: 5px;
             image-rendering: pixelated;
         }
+        .algorithm-option.pending {
+            cursor: wait;
+            opacity: 0.5;
+            pointer-events: none;
+        }
+        .algorithm-option.pending canvas {
+            background: #eee;
+        }
         .algorithm-name {
             font-weight: 600;
             margin-top: 10px;
@@ -320,6 +333,12 @@ const char HTML_PAGE[] PROGMEM = R"rawliteral(
                 Click on your preferred version
             </p>
             
+            <div class="background-controls">
+                <span style="font-weight: 600; margin-right: 10px;">Panel colors:</span>
+                <div class="bg-btn bg-btn-palette selected" id="paletteIdeal" onclick="setPalette('ideal')" title="Pure colors, nearest in RGB">Ideal</div>
+                <div class="bg-btn bg-btn-palette" id="paletteAcep" onclick="setPalette('acep')" title="Measured ACeP inks, nearest in OKLab">Measured</div>
+            </div>
+            
             <div class="algorithm-grid" id="algorithmGrid"></div>
             
             <button onclick="confirmAlgorithm()" id="confirmAlgorithmBtn" disabled class="confirm-button-large">
@@ -352,10 +371,41 @@ const char HTML_PAGE[] PROGMEM = R"rawliteral(
            ======================================== */
         const TARGET_WIDTH = 448;
         const TARGET_HEIGHT = 600;
+        const PREVIEW_SCALE = 4;  // Thumbnails are dithered at 1/4 of the width and height
+        const EPZ_DISTANCES = [2, 4, 8, 599, 600, 601, 1200, 2400];
+        const EPZ_MAX_LITERAL = 128;
+        const EPZ_MIN_BREAK = 6;
         const COLORS = [
             [0, 0, 0], [255, 255, 255], [0, 255, 0], [0, 0, 255],
             [255, 0, 0], [255, 255, 0], [255, 140, 0]
         ];
+        const NEAREST_LUT = buildNearestLut();
+        
+        // Panel profiles: what each color of COLORS looks like on the panel. 'ideal'
+        // matches in RGB against COLORS (the default); measured profiles diffuse
+        // the error against the measured inks and match in OKLab through
+        // buildPaletteLut().
+        const PALETTES = {
+            ideal: { name: 'Ideal', colors: COLORS, perceptual: false },
+            acep: { name: 'Measured ACeP', colors: [
+                [57, 48, 57], [255, 255, 255], [58, 91, 70], [61, 59, 94],
+                [156, 72, 75], [208, 190, 71], [177, 106, 73]
+            ], perceptual: true }
+        };
+        
+        // cost: relative run time, the cheapest previews are dispatched first
+        const ALGORITHMS = [
+            { name: 'Floyd-Steinberg', desc: 'Balanced, natural look', func: floydSteinbergDithering, cost: 2 },
+            { name: 'Atkinson', desc: 'Softer, less noise', func: atkinsonDithering, cost: 2 },
+            { name: 'Ordered (Bayer)', desc: 'Retro, patterned', func: orderedDithering, cost: 1 },
+            { name: 'No Dithering', desc: 'Pure colors, cartoon style', func: noDithering, cost: 1 },
+            { name: 'Black & White', desc: 'Classic B&W, 2 colors', func: blackAndWhiteDithering, cost: 2 },
+            { name: 'Jarvis-Judice-Ninke', desc: 'Smooth gradients, wide spread', func: jarvisDithering, cost: 3 },
+            { name: 'Stucki', desc: 'Like Jarvis, a bit sharper', func: stuckiDithering, cost: 3 },
+            { name: 'Sierra', desc: 'Between Floyd-Steinberg and Jarvis', func: sierraDithering, cost: 3 },
+            { name: 'Serpentine F-S', desc: 'Floyd-Steinberg without streaks', func: serpentineDithering, cost: 2 },
+            { name: 'Blue Noise', desc: 'Fine grain, no patterns', func: blueNoiseDithering, cost: 1 }
+        ];
         
         /* ========================================
            STATE VARIABLES
@@ -371,6 +421,8 @@ const char HTML_PAGE[] PROGMEM = R"rawliteral(
         let lastMouseX = 0;
         let lastMouseY = 0;
         let backgroundColor = 'white';
+        let paletteId = 'ideal';
+        let paletteCache = {};
         
         let isPinching = false;
         let initialPinchDistance = 0;
@@ -380,6 +432,11 @@ const char HTML_PAGE[] PROGMEM = R"rawliteral(
         let algorithmResults = {};
         let selectedAlgorithm = null;
         
+        let ditherWorkers = null;
+        let ditherQueue = [];
+        let ditherMainThreadBusy = false;
+        let processingRun = 0;
+        
         /* ========================================
            BACKGROUND COLOR SELECTION
            ======================================== */
@@ -398,6 +455,28 @@ const char HTML_PAGE[] PROGMEM = R"rawliteral(
             drawCropPreview();
         }
         
+        /* ========================================
+           PANEL PALETTE SELECTION
+           ======================================== */
+        function setPalette(id) {
+            if (id === paletteId) return;
+            paletteId = id;
+            
+            document.getElementById('paletteIdeal').classList.toggle('selected', id === 'ideal');
+            document.getElementById('paletteAcep').classList.toggle('selected', id === 'acep');
+            
+            // Every preview and full resolution changes with the palette
+            selectedAlgorithm = null;
+            document.getElementById('confirmAlgorithmBtn').disabled = true;
+            if (croppedImageData) processWithAllAlgorithms();
+        }
+        
+        // The LUT of a measured profile is built on first use, then kept
+        function getPalette(id) {
+            if (!paletteCache[id]) paletteCache[id] = createPalette(id);
+            return paletteCache[id];
+        }
+        
         /* ========================================
            DRAG & DROP FILE HANDLING
            ======================================== */
@@ -721,93 +800,232 @@ const char HTML_PAGE[] PROGMEM = R"rawliteral(
             const algorithmSection = document.getElementById('algorithmSelection');
             algorithmSection.style.display = 'block';
             
-            const grid = document.getElementById('algorithmGrid');
-            grid.innerHTML = '<p style="text-align:center;padding:20px;">⏳ Processing with different algorithms...</p>';
-            
-            setTimeout(() => {
-                processWithAllAlgorithms();
-            }, 100);
+            processWithAllAlgorithms();
         }
         
         /* ========================================
            ALGORITHM PROCESSING & COMPARISON
            ======================================== */
         function processWithAllAlgorithms() {
-            const algorithms = [
-                {
-                    name: 'Floyd-Steinberg',
-                    desc: 'Balanced, natural look',
-                    func: floydSteinbergDithering
-                },
-                {
-                    name: 'Atkinson',
-                    desc: 'Softer, less noise',
-                    func: atkinsonDithering
-                },
-                {
-                    name: 'Ordered (Bayer)',
-                    desc: 'Retro, patterned',
-                    func: orderedDithering
-                },
-                {
-                    name: 'No Dithering',
-                    desc: 'Pure colors, cartoon style',
-                    func: noDithering
-                },
-                {
-                    name: 'Black & White',
-                    desc: 'Classic B&W, 2 colors',
-                    func: blackAndWhiteDithering
-                }
-            ];
+            const run = ++processingRun;
+            algorithmResults = {};
+            cancelDitherJobs();
             
             const grid = document.getElementById('algorithmGrid');
             grid.innerHTML = '';
             
-            algorithms.forEach((algo) => {
-                const quantizedPixels = algo.func(
-                    new Uint8ClampedArray(croppedImageData.data),
-                    TARGET_WIDTH,
-                    TARGET_HEIGHT
-                );
-                
-                algorithmResults[algo.name] = quantizedPixels;
-                
-                const option = document.createElement('div');
-                option.className = 'algorithm-option';
-                option.onclick = () => selectAlgorithm(algo.name);
-                
-                const canvas = document.createElement('canvas');
-                canvas.width = TARGET_WIDTH;
-                canvas.height = TARGET_HEIGHT;
-                const ctx = canvas.getContext('2d');
-                const imageData = ctx.createImageData(TARGET_WIDTH, TARGET_HEIGHT);
-                
-                for (let i = 0; i < quantizedPixels.length; i++) {
-                    const [r, g, b] = COLORS[quantizedPixels[i]];
-                    const idx = i * 4;
-                    imageData.data[idx] = r;
-                    imageData.data[idx + 1] = g;
-                    imageData.data[idx + 2] = b;
-                    imageData.data[idx + 3] = 255;
-                }
-                ctx.putImageData(imageData, 0, 0);
-                
-                const name = document.createElement('div');
-                name.className = 'algorithm-name';
-                name.textContent = algo.name;
-                
-                const desc = document.createElement('div');
-                desc.className = 'algorithm-desc';
-                desc.textContent = algo.desc;
-                
-                option.appendChild(canvas);
-                option.appendChild(name);
-                option.appendChild(desc);
-                grid.appendChild(option);
+            const preview = createPreviewPixels();
+            const palette = getPalette(paletteId);
+            const jobs = ALGORITHMS.slice().sort((a, b) => a.cost - b.cost);
+            const options = {};
+            ALGORITHMS.forEach((algo) => {
+                options[algo.name] = createAlgorithmOption(algo, preview.width, preview.height);
+                grid.appendChild(options[algo.name]);
+            });
+            
+            jobs.forEach((algo) => {
+                runDitherJob(algo, palette, preview.data, preview.width, preview.height).then((quantizedPixels) => {
+                    if (run !== processingRun) return;
+                    showAlgorithmResult(options[algo.name], algo, quantizedPixels, preview.width, preview.height);
+                }, ignoreCancelled);
+            });
+        }
+        
+        // Downscaled copy of the crop, used for the thumbnails only
+        function createPreviewPixels() {
+            const canvas = document.createElement('canvas');
+            canvas.width = TARGET_WIDTH / PREVIEW_SCALE;
+            canvas.height = TARGET_HEIGHT / PREVIEW_SCALE;
+            const ctx = canvas.getContext('2d');
+            ctx.imageSmoothingQuality = 'high';
+            ctx.drawImage(cropCanvas, 0, 0, canvas.width, canvas.height);
+            return ctx.getImageData(0, 0, canvas.width, canvas.height);
+        }
+        
+        // Full resolution is computed once per algorithm, on hover, selection or confirmation
+        function getFullResolution(algo) {
+            if (!algorithmResults[algo.name]) {
+                const result = runDitherJob(algo, getPalette(paletteId), croppedImageData.data, TARGET_WIDTH, TARGET_HEIGHT);
+                algorithmResults[algo.name] = result;
+                // Hover starts it without waiting; a cancelled run is computed again next time
+                result.catch((err) => {
+                    if (algorithmResults[algo.name] === result) delete algorithmResults[algo.name];
+                    ignoreCancelled(err);
+                });
+            }
+            return algorithmResults[algo.name];
+        }
+        
+        function ignoreCancelled(err) {
+            if (err.name !== 'DitherCancelled') console.error(err);
+        }
+        
+        function createAlgorithmOption(algo, width, height) {
+            const option = document.createElement('div');
+            option.className = 'algorithm-option pending';
+            
+            const canvas = document.createElement('canvas');
+            canvas.width = width;
+            canvas.height = height;
+            
+            const name = document.createElement('div');
+            name.className = 'algorithm-name';
+            name.textContent = algo.name;
+            
+            const desc = document.createElement('div');
+            desc.className = 'algorithm-desc';
+            desc.textContent = '⏳ Processing...';
+            desc.dataset.text = algo.desc;
+            
+            option.appendChild(canvas);
+            option.appendChild(name);
+            option.appendChild(desc);
+            return option;
+        }
+        
+        function showAlgorithmResult(option, algo, quantizedPixels, width, height) {
+            const ctx = option.querySelector('canvas').getContext('2d');
+            const imageData = ctx.createImageData(width, height);
+            
+            for (let i = 0; i < quantizedPixels.length; i++) {
+                const [r, g, b] = PALETTES[paletteId].colors[quantizedPixels[i]];
+                const idx = i * 4;
+                imageData.data[idx] = r;
+                imageData.data[idx + 1] = g;
+                imageData.data[idx + 2] = b;
+                imageData.data[idx + 3] = 255;
+            }
+            ctx.putImageData(imageData, 0, 0);
+            
+            const desc = option.querySelector('.algorithm-desc');
+            desc.textContent = desc.dataset.text;
+            option.classList.remove('pending');
+            option.onmouseenter = () => getFullResolution(algo);
+            option.onclick = () => {
+                getFullResolution(algo);
+                selectAlgorithm(algo.name);
+            };
+        }
+        
+        /* ========================================
+           DITHERING WORKERS
+           ======================================== */
+        const DITHER_FUNCTIONS = [
+            findClosestColorExact, buildNearestLut, findClosestColor, matchColor, diffusionBuffer, diffuseErrorDithering,
+            floydSteinbergDithering, atkinsonDithering, orderedDithering, noDithering, blackAndWhiteDithering,
+            jarvisDithering, stuckiDithering, sierraDithering, serpentineDithering, blueNoiseDithering
+        ];
+        
+        // Resolves with the palette indices; runs in a worker when available.
+        // Rejects with a DitherCancelled error when cancelDitherJobs() drops it
+        function runDitherJob(algo, palette, pixels, width, height) {
+            return new Promise((resolve, reject) => {
+                ditherQueue.push({ algo, palette, pixels, width, height, resolve, reject });
+                pumpDitherQueue();
             });
         }
         
+        function ditherCancelled() {
+            const err = new Error('Dithering cancelled');
+            err.name = 'DitherCancelled';
+            return err;
+        }
+        
+        function runDitherJobHere(job) {
+            const pixels = new Uint8ClampedArray(job.pixels);
+            job.resolve(job.algo.func(pixels, job.width, job.height, job.palette));
+        }
+        
+        function pumpDitherQueue() {
+            const workers = getDitherWorkers();
+            if (workers.length === 0) {
+                // No workers: one job per task, so the page repaints in between
+                if (ditherMainThreadBusy || ditherQueue.length === 0) return;
+                ditherMainThreadBusy = true;
+                setTimeout(() => {
+                    ditherMainThreadBusy = false;
+                    const job = ditherQueue.shift();
+                    if (job) runDitherJobHere(job);
+                    pumpDitherQueue();
+                }, 0);
+                return;
+            }
+            
+            workers.forEach((worker) => {
+                if (worker.busy || ditherQueue.length === 0) return;
+                const job = ditherQueue.shift();
+                // Every job gets its own copy, handed over without cloning
+                const buffer = job.pixels.slice().buffer;
+                worker.busy = true;
+                worker.job = job;
+                worker.onmessage = (e) => {
+                    worker.busy = false;
+                    worker.job = null;
+                    job.resolve(e.data.quantized);
+                    pumpDitherQueue();
+                };
+                worker.onerror = (e) => {
+                    e.preventDefault();
+                    worker.busy = false;
+                    worker.job = null;
+                    runDitherJobHere(job);
+                    pumpDitherQueue();
+                };
+                worker.postMessage({
+                    func: job.algo.func.name,
+                    palette: job.palette,
+                    buffer: buffer,
+                    width: job.width,
+                    height: job.height
+                }, [buffer]);
+            });
+        }
+        
+        // Drops the work queued for the previous image; every dropped or
+        // interrupted job rejects, so nothing keeps waiting for it
+        function cancelDitherJobs() {
+            const dropped = ditherQueue;
+            ditherQueue = [];
+            if (ditherWorkers && ditherWorkers.some((worker) => worker.busy)) {
+                ditherWorkers.forEach((worker) => {
+                    worker.terminate();
+                    if (worker.job) dropped.push(worker.job);
+                });
+                ditherWorkers = null;
+            }
+            dropped.forEach((job) => job.reject(ditherCancelled()));
+        }
+        
+        // One worker per core, built from the same function sources as this page
+        function getDitherWorkers() {
+            if (ditherWorkers) return ditherWorkers;
+            
+            ditherWorkers = [];
+            if (typeof Worker === 'undefined' || typeof Blob === 'undefined') return ditherWorkers;
+            try {
+                const source = 'const COLORS = ' + JSON.stringify(COLORS) + ';\n' +
+                    'const FLOYD_STEINBERG_TAPS = ' + JSON.stringify(FLOYD_STEINBERG_TAPS) + ';\n' +
+                    'const BLUE_NOISE_SIZE = ' + BLUE_NOISE_SIZE + ';\n' +
+                    'const BLUE_NOISE = Uint8Array.from(atob(' + JSON.stringify(BLUE_NOISE_MASK) + '), (c) => c.charCodeAt(0));\n' +
+                    DITHER_FUNCTIONS.map((f) => f.toString()).join('\n') + '\n' +
+                    'const NEAREST_LUT = buildNearestLut();\n' +
+                    'self.onmessage = (e) => {\n' +
+                    '    const d = e.data;\n' +
+                    '    const quantized = self[d.func](new Uint8ClampedArray(d.buffer), d.width, d.height, d.palette);\n' +
+                    '    self.postMessage({ quantized: quantized }, [quantized.buffer]);\n' +
+                    '};\n';
+                const url = URL.createObjectURL(new Blob([source], { type: 'text/javascript' }));
+                const count = Math.max(1, Math.min(navigator.hardwareConcurrency || 2, ALGORITHMS.length));
+                for (let i = 0; i < count; i++) {
+                    ditherWorkers.push(new Worker(url));
+                }
+            } catch (err) {
+                console.warn('Web Workers unavailable, dithering on the main thread', err);
+                ditherWorkers = [];
+            }
+            return ditherWorkers;
+        }
+        
         /* ========================================
            ALGORITHM SELECTION & CONFIRMATION
            ======================================== */
@@ -821,15 +1039,32 @@ const char HTML_PAGE[] PROGMEM = R"rawliteral(
             document.getElementById('confirmAlgorithmBtn').disabled = false;
         }
         
-        function confirmAlgorithm() {
+        async function confirmAlgorithm() {
             if (!selectedAlgorithm) {
                 alert('Please select an algorithm!');
                 return;
             }
             
-            document.getElementById('algorithmSelection').style.display = 'none';
+            const run = processingRun;
+            const button = document.getElementById('confirmAlgorithmBtn');
+            button.disabled = true;
+            button.textContent = '⏳ Processing full resolution...';
             
-            const quantizedPixels = algorithmResults[selectedAlgorithm];
+            const algo = ALGORITHMS.find((a) => a.name === selectedAlgorithm);
+            let quantizedPixels;
+            try {
+                quantizedPixels = await getFullResolution(algo);
+            } catch (err) {
+                // Cancelled by a new palette or image: back to the choice
+                ignoreCancelled(err);
+                button.textContent = '✓ Use Selected Algorithm';
+                button.disabled = !selectedAlgorithm;
+                return;
+            }
+            button.textContent = '✓ Use Selected Algorithm';
+            if (run !== processingRun) return;
+            
+            document.getElementById('algorithmSelection').style.display = 'none';
             processFinalImage(quantizedPixels);
         }
         
@@ -847,8 +1082,12 @@ const char HTML_PAGE[] PROGMEM = R"rawliteral(
             
             const info = document.getElementById('info');
             info.style.display = 'block';
+            const rawSize = TARGET_WIDTH * TARGET_HEIGHT / 2;
             info.innerHTML = `✅ Ready to upload<br>
-                🎨 Algorithm: <strong>${selectedAlgorithm}</strong>`;
+                🎨 Algorithm: <strong>${selectedAlgorithm}</strong><br>
+                🖌️ Colors: <strong>${PALETTES[paletteId].name}</strong><br>
+                📦 Size: ${(convertedBinary.length / 1024).toFixed(1)} KB
+                (${Math.round(convertedBinary.length * 100 / rawSize)}% of raw)`;
         }
         
         /* ========================================
@@ -868,6 +1107,8 @@ const char HTML_PAGE[] PROGMEM = R"rawliteral(
             originalImage = null;
             selectedAlgorithm = null;
             algorithmResults = {};
+            processingRun++;
+            cancelDitherJobs();
             backgroundColor = 'white';
             cropRotation = 0;
             
@@ -875,12 +1116,13 @@ const char HTML_PAGE[] PROGMEM = R"rawliteral(
             document.getElementById('bgBlack').classList.remove('selected');
         }
         
-        function findClosestColor(r, g, b) {
+        function findClosestColorExact(r, g, b) {
             let minDist = Infinity;
             let closestIndex = 0;
             for (let i = 0; i < COLORS.length; i++) {
                 const [cr, cg, cb] = COLORS[i];
-                const dist = Math.sqrt(Math.pow(r-cr,2) + Math.pow(g-cg,2) + Math.pow(b-cb,2));
+                const dr = r - cr, dg = g - cg, db = b - cb;
+                const dist = dr * dr + dg * dg + db * db;
                 if (dist < minDist) {
                     minDist = dist;
                     closestIndex = i;
@@ -889,95 +1131,211 @@ const char HTML_PAGE[] PROGMEM = R"rawliteral(
             return closestIndex;
         }
         
-        function floydSteinbergDithering(pixels, width, height) {
-            const quantized = new Uint8Array(width * height);
-            const rgbData = new Uint8ClampedArray(pixels.length);
-            
-            for (let i = 0; i < pixels.length; i++) {
-                rgbData[i] = pixels[i];
+        // 32x32x32 cube: a cell whose 8 corners have the same nearest color
+        // maps entirely to it (255 = cell on a boundary, full search needed)
+        function buildNearestLut() {
+            const lut = new Uint8Array(32 * 32 * 32);
+            const corners = new Uint8Array(33 * 33 * 33);
+            for (let r = 0; r <= 32; r++) {
+                for (let g = 0; g <= 32; g++) {
+                    for (let b = 0; b <= 32; b++) {
+                        corners[(r * 33 + g) * 33 + b] = findClosestColorExact(
+                            Math.min(r * 8, 255), Math.min(g * 8, 255), Math.min(b * 8, 255));
+                    }
+                }
             }
-            
-            for (let y = 0; y < height; y++) {
-                for (let x = 0; x < width; x++) {
-                    const idx = (y * width + x) * 4;
-                    const r = rgbData[idx];
-                    const g = rgbData[idx + 1];
-                    const b = rgbData[idx + 2];
-                    
-                    const colorIndex = findClosestColor(r, g, b);
-                    quantized[y * width + x] = colorIndex;
-                    
-                    const [newR, newG, newB] = COLORS[colorIndex];
-                    const errR = r - newR;
-                    const errG = g - newG;
-                    const errB = b - newB;
-                    
-                    const distributeError = (dx, dy, factor) => {
-                        const nx = x + dx;
-                        const ny = y + dy;
-                        if (nx >= 0 && nx < width && ny >= 0 && ny < height) {
-                            const nidx = (ny * width + nx) * 4;
-                            rgbData[nidx] += errR * factor;
-                            rgbData[nidx + 1] += errG * factor;
-                            rgbData[nidx + 2] += errB * factor;
+            for (let r = 0; r < 32; r++) {
+                for (let g = 0; g < 32; g++) {
+                    for (let b = 0; b < 32; b++) {
+                        const first = corners[(r * 33 + g) * 33 + b];
+                        let uniform = true;
+                        for (let c = 1; c < 8 && uniform; c++) {
+                            uniform = corners[((r + (c >> 2)) * 33 + g + ((c >> 1) & 1)) * 33 + b + (c & 1)] === first;
                         }
-                    };
-                    
-                    distributeError(1, 0, 7/16);
-                    distributeError(-1, 1, 3/16);
-                    distributeError(0, 1, 5/16);
-                    distributeError(1, 1, 1/16);
+                        lut[(r << 10) | (g << 5) | b] = uniform ? first : 255;
+                    }
                 }
             }
-            return quantized;
+            return lut;
         }
         
-        function atkinsonDithering(pixels, width, height) {
-            const quantized = new Uint8Array(width * height);
-            const rgbData = new Uint8ClampedArray(pixels.length);
-            
-            for (let i = 0; i < pixels.length; i++) {
-                rgbData[i] = pixels[i];
+        function findClosestColor(r, g, b) {
+            const cached = NEAREST_LUT[((r >> 3) << 10) | ((g >> 3) << 5) | (b >> 3)];
+            return cached !== 255 ? cached : findClosestColorExact(r, g, b);
+        }
+        
+        // x^(1/n) for x >= 0 with + - * / only (Newton from above, after scaling
+        // into [1, 2^n) by powers of two): every engine gets the same bits, and
+        // so does palette_lut.h. Math.pow and Math.cbrt are not exact
+        function paletteRoot(x, n) {
+            if (!(x > 0)) return 0;
+            const step = 2 ** n;
+            let scale = 1;
+            while (x < 1) {
+                x *= step;
+                scale /= 2;
+            }
+            while (x >= step) {
+                x /= step;
+                scale *= 2;
             }
+            let y = 2;
+            for (let i = 0; i < 8; i++) {
+                let power = y;
+                for (let k = 2; k < n; k++) power *= y;
+                y = ((n - 1) * y + x / power) / n;
+            }
+            return y * scale;
+        }
+        
+        function srgbToLinear(c) {
+            const x = c / 255;
+            if (x <= 0.04045) return x / 12.92;
+            const t = (x + 0.055) / 1.055;
+            return t * t * paletteRoot(t * t, 5);  // t^2.4
+        }
+        
+        // OKLab (Ottosson) of an sRGB color
+        function toOklab(r, g, b) {
+            const lr = srgbToLinear(r), lg = srgbToLinear(g), lb = srgbToLinear(b);
+            const l = paletteRoot(0.4122214708 * lr + 0.5363325363 * lg + 0.0514459929 * lb, 3);
+            const m = paletteRoot(0.2119034982 * lr + 0.6806995451 * lg + 0.1073969566 * lb, 3);
+            const s = paletteRoot(0.0883024619 * lr + 0.2817188376 * lg + 0.6299787005 * lb, 3);
+            return [
+                0.2104542553 * l + 0.7936177850 * m - 0.0040720468 * s,
+                1.9779984951 * l - 2.4285922050 * m + 0.4505937099 * s,
+                0.0259040371 * l + 0.7827717662 * m - 0.8086757660 * s
+            ];
+        }
+        
+        // 32x32x32 cube of the color nearest in OKLab to each cell center, the
+        // first minimum winning: one lookup per pixel, like the RGB path
+        function buildPaletteLut(colors) {
+            const palette = colors.map(([r, g, b]) => toOklab(r, g, b));
+            const lut = new Uint8Array(32 * 32 * 32);
+            for (let r = 0; r < 32; r++) {
+                for (let g = 0; g < 32; g++) {
+                    for (let b = 0; b < 32; b++) {
+                        const [L, A, B] = toOklab(r * 8 + 4, g * 8 + 4, b * 8 + 4);
+                        let minDist = Infinity;
+                        for (let i = 0; i < palette.length; i++) {
+                            const dl = L - palette[i][0], da = A - palette[i][1], db = B - palette[i][2];
+                            const dist = dl * dl + da * da + db * db;
+                            if (dist < minDist) {
+                                minDist = dist;
+                                lut[(r << 10) | (g << 5) | b] = i;
+                            }
+                        }
+                    }
+                }
+            }
+            return lut;
+        }
+        
+        // { colors, lut } as the dithering functions take it; no LUT: RGB search
+        function createPalette(id) {
+            const profile = PALETTES[id];
+            return { colors: profile.colors, lut: profile.perceptual ? buildPaletteLut(profile.colors) : null };
+        }
+        
+        function matchColor(palette, r, g, b) {
+            return palette.lut ? palette.lut[((r >> 3) << 10) | ((g >> 3) << 5) | (b >> 3)] : findClosestColor(r, g, b);
+        }
+        
+        // RGB in sixteenths of a level, not clamped: the shares keep their
+        // fraction (truncated toward zero) and only the value a pixel is
+        // matched with is clamped to 0..255. dithering.h does the same
+        function diffusionBuffer(pixels, width, height) {
+            const data = new Int16Array(width * height * 3);
+            for (let i = 0, j = 0; j < data.length; i += 4, j += 3) {
+                data[j] = pixels[i] << 4;
+                data[j + 1] = pixels[i + 1] << 4;
+                data[j + 2] = pixels[i + 2] << 4;
+            }
+            return data;
+        }
+        
+        // taps: dx, dy, weight triples, weights over divisor; serpentine runs the
+        // odd rows right to left with the taps mirrored
+        function diffuseErrorDithering(pixels, width, height, palette, taps, divisor, serpentine) {
+            const quantized = new Uint8Array(width * height);
+            const data = diffusionBuffer(pixels, width, height);
             
             for (let y = 0; y < height; y++) {
-                for (let x = 0; x < width; x++) {
-                    const idx = (y * width + x) * 4;
-                    const r = rgbData[idx];
-                    const g = rgbData[idx + 1];
-                    const b = rgbData[idx + 2];
+                const reverse = serpentine && (y & 1) === 1;
+                const direction = reverse ? -1 : 1;
+                for (let i = 0; i < width; i++) {
+                    const x = reverse ? width - 1 - i : i;
+                    const idx = (y * width + x) * 3;
+                    const r = Math.min(Math.max(data[idx], 0), 4080);
+                    const g = Math.min(Math.max(data[idx + 1], 0), 4080);
+                    const b = Math.min(Math.max(data[idx + 2], 0), 4080);
                     
-                    const colorIndex = findClosestColor(r, g, b);
+                    const colorIndex = matchColor(palette, (r + 8) >> 4, (g + 8) >> 4, (b + 8) >> 4);
                     quantized[y * width + x] = colorIndex;
                     
-                    const [newR, newG, newB] = COLORS[colorIndex];
-                    const errR = r - newR;
-                    const errG = g - newG;
-                    const errB = b - newB;
+                    const color = palette.colors[colorIndex];
+                    const errR = r - (color[0] << 4);
+                    const errG = g - (color[1] << 4);
+                    const errB = b - (color[2] << 4);
                     
-                    const distributeError = (dx, dy, factor) => {
-                        const nx = x + dx;
-                        const ny = y + dy;
-                        if (nx >= 0 && nx < width && ny >= 0 && ny < height) {
-                            const nidx = (ny * width + nx) * 4;
-                            rgbData[nidx] += errR * factor;
-                            rgbData[nidx + 1] += errG * factor;
-                            rgbData[nidx + 2] += errB * factor;
+                    for (let t = 0; t < taps.length; t += 3) {
+                        const nx = x + taps[t] * direction;
+                        const ny = y + taps[t + 1];
+                        if (nx >= 0 && nx < width && ny < height) {
+                            const nidx = (ny * width + nx) * 3;
+                            const weight = taps[t + 2];
+                            data[nidx] += (errR * weight / divisor) | 0;
+                            data[nidx + 1] += (errG * weight / divisor) | 0;
+                            data[nidx + 2] += (errB * weight / divisor) | 0;
                         }
-                    };
-                    
-                    distributeError(1, 0, 1/8);
-                    distributeError(2, 0, 1/8);
-                    distributeError(-1, 1, 1/8);
-                    distributeError(0, 1, 1/8);
-                    distributeError(1, 1, 1/8);
-                    distributeError(0, 2, 1/8);
+                    }
                 }
             }
             return quantized;
         }
         
-        function orderedDithering(pixels, width, height) {
+        const FLOYD_STEINBERG_TAPS = [1, 0, 7,  -1, 1, 3,  0, 1, 5,  1, 1, 1];
+        
+        function floydSteinbergDithering(pixels, width, height, palette) {
+            return diffuseErrorDithering(pixels, width, height, palette, FLOYD_STEINBERG_TAPS, 16, false);
+        }
+        
+        function serpentineDithering(pixels, width, height, palette) {
+            return diffuseErrorDithering(pixels, width, height, palette, FLOYD_STEINBERG_TAPS, 16, true);
+        }
+        
+        function atkinsonDithering(pixels, width, height, palette) {
+            return diffuseErrorDithering(pixels, width, height, palette, [
+                1, 0, 1,  2, 0, 1,  -1, 1, 1,  0, 1, 1,  1, 1, 1,  0, 2, 1
+            ], 8, false);
+        }
+        
+        function jarvisDithering(pixels, width, height, palette) {
+            return diffuseErrorDithering(pixels, width, height, palette, [
+                1, 0, 7,  2, 0, 5,
+                -2, 1, 3,  -1, 1, 5,  0, 1, 7,  1, 1, 5,  2, 1, 3,
+                -2, 2, 1,  -1, 2, 3,  0, 2, 5,  1, 2, 3,  2, 2, 1
+            ], 48, false);
+        }
+        
+        function stuckiDithering(pixels, width, height, palette) {
+            return diffuseErrorDithering(pixels, width, height, palette, [
+                1, 0, 8,  2, 0, 4,
+                -2, 1, 2,  -1, 1, 4,  0, 1, 8,  1, 1, 4,  2, 1, 2,
+                -2, 2, 1,  -1, 2, 2,  0, 2, 4,  1, 2, 2,  2, 2, 1
+            ], 42, false);
+        }
+        
+        function sierraDithering(pixels, width, height, palette) {
+            return diffuseErrorDithering(pixels, width, height, palette, [
+                1, 0, 5,  2, 0, 3,
+                -2, 1, 2,  -1, 1, 4,  0, 1, 5,  1, 1, 4,  2, 1, 2,
+                -1, 2, 2,  0, 2, 3,  1, 2, 2
+            ], 32, false);
+        }
+        
+        function orderedDithering(pixels, width, height, palette) {
             const quantized = new Uint8Array(width * height);
             
             const bayerMatrix = [
@@ -999,14 +1357,39 @@ const char HTML_PAGE[] PROGMEM = R"rawliteral(
                     g = Math.max(0, Math.min(255, g + threshold));
                     b = Math.max(0, Math.min(255, b + threshold));
                     
-                    const colorIndex = findClosestColor(r, g, b);
+                    const colorIndex = matchColor(palette, r, g, b);
                     quantized[y * width + x] = colorIndex;
                 }
             }
             return quantized;
         }
         
-        function noDithering(pixels, width, height) {
+        // 64x64 void-and-cluster mask, one level (0-255) per pixel; generated by
+        // tools/blue_noise_mask.js together with blue_noise.h
+        const BLUE_NOISE_SIZE = 64;
+        const BLUE_NOISE_MASK = 'DHos2hHvghjhcwXqwKFF/I5L2ny43U2CNthWL2uZuIRL+h7EVxA0YALtMcH8NbbVUPllGoW/JOwz00rvXqMkVz7EYJ7BTqNbvi6qPIwRXa4kwO9YHI8KwRmt7YvNQV/mNKB2OofloLpEyqZhCYxtF4KtQ8mZ4Ud9uQiHHTy+cdiT8wWJO2/UDP6DUtBm3jLocQ+aLq/9atWZRXgD4R/EEGjRAe6qJdB1khZ7SeCqRPAwzwl3Ll6tGP9rqt+W6hSza0+s3xryLJNAsxbxI7d9zEGHZ9NGeiRZ8WYnsVKkdvOyj1a5RmcKU+gq9ZjOIny/XY7nuPcM1p1VOs4rZkyKMhzoKHpfsMR4Ycudb5BLAZ8e96gF6pW0Ow2904T3NpJOHzLhFoH1ltc9tVoTOWXmAqIjO2ZOinMm3I8PfsMA/Muevj/SmkoB6SHcCzqv+8Vg3k29OGEXyeSHnUARacEG2ofHbZvON70gaYnbdsKujVL+c9qlHLLHRGrvtkLlpVt5CVKID/swjak9VIDoXRUzdJMmfdCKpUttLftb3Jko7mOuR/8rXg12qPwDoUbrDy7HQrYPk+Y09QisHFeZciQ93WT0r2rFVtls9pS7IMqGpu4S2FQO8yvXAK14H7R/T6M3GIAHpuuNQsxVMsghXpp73xqGW8xJfl+chMkv9hXQspEb1TYgoXsTKcEGZKFE31K/PrGabbtdgetUzjnoFcdv0Oq9adNOteITmXLwh7j5PWOg8S5xAbon1Uvha76JSukvwJl+7UPitYZK0Tb6cyoJa4P4Lt5BHZu/GouiYkT6C49XI4k4GmcqgdhBrgxQJtMIv0fXp/uP6RJ2OwOpWwx/a0ECUcsMYjSc63erFI3Mm+kiXwSMqf83cEj1B8KHny61QNig+MeX9KxeHeRqxH+pbpEjgRY6aVCftP2WKu3Iofqx422nkL31FV0f203uXLhD1KzFTnnMCtmzLNt0IOFge+0BcFEQdz0Ewn0unj7eG/RR47NX078uzR9HfthwOR5YLIUU/ylMcspAuIKeADN7D5N2NeEUZJVRfJxbO7RPyxmVwjKr3LpV6qBH/s0AkF0yxgVw8JQMc4nmZL8RT7aL3JzGPV7WiAOi6GcpyG6y2PtXGvCZKb3oIfEOyv2RBaT4R2XlhB6SLG3ZEYhUcum7n3w9oipIrvZWBa0w9J/SCGgY7Kt3G7PgM5EO/ULiUSSlOc9ptFWBOq1pQ4Ibbuc1ciKxDUph+8YZj123Hq0qShD6zWLhgCDWO5zbhV4ic/dJgDNRzvFEYHzDU62KF5h/Yb2LAkP6ywePxeCnvSpbx4PbkfG/oj56sDfJ4Tz2hNlsjSCvDsRSkLpxFkLKlT6nv9yYBYotmxD3Itx4Nbz1COch2nijG2ziXC4XVj3al7MKVDptK9UG50/1CXeiYhXBOORaQZT/agkt8ljmtADoK1tw+bdmxHKrvUZpBdVNa55BrE/pNLqHRaT5cZ3xfhRI75vPGH6WXSWoZpsoStGUVaQDt9F1M6rdyIqkIXtjiNUOJkoV5yHcUzCGpfKRH80uw3IPlF/wJ9YTu4sAzCRt4DBlt/1R4r2L2xeD7LwG8SVw+IAj5RVLe18RSdMx/ky4ocyuhlpAkgbqyxRXt37oWof+KbLQCpdUezncSmKmw4yrH4MCpzcScjLKValrOXqwyjVOnGKz7504+a9smMEVOntkNNSg/cd9YJk82yhFCqcXzFWBPHCryO5oIrD/NlII81rERXXL60yz+z8Q4I7WRw+L1wnChicCvIAe4QlX5ZL0A+MfdA43tiX3dqpn+pbWbkC55Rv0SC4HlsWAD5bedzzSl+cmjmOgBJF5wy1aHZvkW6rrOVPUauhUyj+Lq3AjUJx+wEewbOFNGL4CjMNPLvKOAaBckNuCtFnhMnDKHrWJKQ9erxf2LM9fIO6euP5pvyx5HW/2kkKmK5pn9S/E2bM88liP7xWXg9dZ7jgafKteI9J1K7wOZ/k+GqXuSWX3UKnuftpPunxE5K5OcgE8ghLvQ5q1C8YWdNcFuhd/Rg5ozycK1S1cyTqkKpV10OYKv+pQrvtA0SSdzI5UuymeAthvQ8A1bhLYlwuHNNSVx1KxjsXgTH81rvtLhexV25n6iLueabN6qOsHarjfSaFkP5iBOhaJbqhRdgPnfA7Ugze6HZ0KkPKmOGbF+hVg5yH0MF4EKGTR51iLHaw7b6gsWxtI4DX8RSBRf/ocYAwosv0bbN/HWeYS87cwZEP8rG7sjV3+ySlYgOkkUrR2pUaMbaXZdv2kGJUnwmXgJr4Jyul1AX2TEL+M3LFCyI3yzodP0jCeBrMnmDqD3sKWLFkYSsYuek3asAXNcps82Ci8B98ZP7SEO75xRe4Qlc+BTo81pfVTzmDmbg2cMHWoUzdzBLmM9mY92nHPWR6kEs3kkrEH3aQTa5dDtxvvC4j2VoDEmFLKElvxANOeeD9c/yDdYsUsshqkKT3PXOwB2R7BmuJgH0rAhaZOCI/0bk6CYzH3aIU/u+Qh+lZ/qErGbBzmM2b2JZveibBVL7njBZpysBKKceJBgvi4kyG1SYVm7BNArOp4DO4d48ItsDzfvwyfR88l81d9N47UK+FiMa+bQ7YLftFtNEsdfvlhI6lIyDjtTA6X02kUUHrfbP+jKrNaftY0n81eNXmeYdEAjSbwuHkTqZABza4SarwDk9AQ8nTUlEmqBsCj5cYPkNd28RZfob79XDK8jO0KOJgYPdCN+CWSaBlIspH2EkZ1/6ZXbzneUMIz62VL9JxGd/5TgilZFfAv4F38dStlrDpRvTCT5HsniLAF5UKhyF7Wu1V3EEjICLr8f9okVbvmhhlCy5geifxfdqEhgsYw6BqxNtzApYdoxSCNPxSYSczrCYdm0AJB2BpNzGMlca8qhQbmqdpwm1fdPqUDbNM5qSjAae0I2LIrC9NE4rEJW4jKZ58HSes4sU+feNK28oEcdKH5HqpUumvzpHeX+hbbS/dqkCE2ufQqeR1g8LSADWKY3zKqekhjooO5GI42cdelKE3wkHUf0AP4E+RYNQKn3lQqxUd+8JotP9cQN7ZZgJwZykfwYwJCrIvMlyxDlPrHTROLUyPJ8jvcT/dgw+1EEOWBFNW3YZmDbb0mlHDOXzi5jGHfNhTTi7xb7IfPAO09tS+hfc2U5GcO7FDC3R90NexvzPu1kgVtIZh1A6Milbhqwz5YLvNF3jSjS/C7IYj8F9UIkbNuVwl/JW5Koi3EdFzqDFW0GFHXtzpyCKdTugSvnTwNXjGC6bHKL+VQe/tULaD4iqQKwh5cyYQIQN+fTXOiP/YmxeSm/MevG9pglRXahqwm/HYwfx2i/odo6I7WXSCA2KPhwlUXRYvRqzYMjd0CbyDQaH6r/xbXYrB5DsQv5GSrT3scRjUFk+k2fP5NwDpn00Cd6MaQXivRFD4leEXzwExyGT+qff9hEmy61mLAPOa0R+ooTo9rNpn0KVzqgRHNhgPtmmaL0k1ougmrKJoE748Ru1wEReO8TK32yJzgC44r+ZVk7A2hwSrwlEUhfJtahA2UvtsA7bYcSM2okUa9JFrUMLreWKkVhe9C03HlV3nJTXAn+Kp0DJV7WBhqL7JlqQPRL8l1O95ZhBbjpvMSyC36XjpzpUR93YptAzLycJ7/j0pzEfh34CueXIwTti+nGPSvz4U00iLuMcGoitJU7n1GtIQcUZAAtDfHVm80Tdt0nrYZyyVgyA5W+bHVUxe1OQ3FnSc4yUe9Gss0+WXVRoMtkw1kn1C3YtYAROQRPcYX41naova/ZZz4egbUuoitHUDehfOR4zSevD0jfZfJZH/dXey1ZgSUbfR8qU6SB+vEWuM72RrpiDuSc/xagaMllXI2CGo/J+MZS6+WJf4LZO9WC2tMB655HemRZeYRQNYoqkMahk7psTNTCN0hvHWcHmymT4CycQr0pRu1LcvxYr39rYzrsobQdS/rZj99oji9kc2nNsFb/URvBsZMr++IAPltltOnfBbShr5qPu9WNrj/AsbxJkPNVyrZZpkHd0AQUCnSHk4OWpLGE9e1UM4g5Xgq+IHbJI7LrNwpn3QyX5u8NOMOMf5EmuocoovODd6JRXgZjV/kq3nASYfhUajniMmgYH7Dn/w8p1aKGuJvjEkRtlEXoGkOUzWFXfsKw9xKG4JXwXNdtidiS/sueaxmI5zaOL6gETORBuwWOMEc0TFyDPUz2XAl5AZ5+DKaAfWtZNh06UK38pfiErtGjyOneM/uoiCTyQLid8MHtU8X88xYrWr4SHPI/WSdt3b6aJRZst1DkANIuWXCQqxpv1ktyTycB4kw0ngmqGvQfOZU9jkGY0Db9EyDqTSQ12fjoEB/CessGYXfUyI91lsmoUQB8iKaY77rqIQclNQh6j/do4Ed/VjCo18DTu0/HTOzFGuSsciGDWU32RP3Rx+CM8WQKLlMj9WoAbmOr38N5YS81nc6yhZ4K1reN/VSgQ+TdBPuaLsr3hT5lMqDuJPcXJ3UJ/FSLK7CIp9YbK+X8FkA/GPccsRBYzHoaRnxUsc3E1Wr44lP/50Qy3UJpGHPsilU0kGVf0twPrIxYwz+cQLASYIPb+iWedOK58ErzhO0d0erG5oN9nzOm0S+M4ylZfOVJmcGtdJBhrNN5bwk/UXGia4G5xmozojjH9RTqkOK8zLfo74+FvhQBUAYe19C4p7RMO1aOasiVgv6eNcE4iJ6w0j3nzFfHe9oLYk+mHoLZ+oxdrhf8i0QaZ955SzHHKd4YSKI214yp3S59aLXiSNoEI16vtmK6sCGKFCdbEa1O90Vgs1z6JXCAKXSE+xW2qYbm0zZO47EVfdBuxWZatlUC839Swi2zhvfjVIzB/LAOPfJTARoF0huo+G3FcX+hAqZWbM+D6wpSn37WHHDL4E9813EIKIAd6/RB45P9TqD6rk4lqxsgJNGYSTHbrZJfZtYsCam/pov1xI+Yo4lWqjRb/Ak4FKAz2PbF7hEnQSwz4wIfP9s50UfgzXpYsMEoCVJehTHJ/EBrv+cFu2WYBnYCXPnPH/OuV31esvuOdkaTjCmjWm3+QujNpEohtb4YSNJ360xVbuY2WumzCh7sVfQkPJh5D9Z5nE31Hs+3Syp7UaL0GEeUAuPrikNqm2XffbBAdQYM5RF7HbI8VscO3fGnWcUjc8RLFr7SBSY4B78agquIoigwS2JuwxSrQKFw24xuQ+WsPB0QeVWhEfgBrJBZYRR68ZvH7xUBa1upOKTDfQ5ue9DfuywC4q6aEw5hLdB3VPVEWvLHFzpks5j90wbpPlN4DKF1h/Flvm+IFzLJOOhO3qnWOCKL+dCGb9LJ7FR1HUipGPFPHTRMfWqzBHnJ5d5NbRIl/epQnMmtjmW0lyAI27IBGSmNwdnMaDzcJIPvP0SKtUKsGeY1Xz+jNhshRiZVuIEkSOj5lMBcZJZoW/DBPuD4g==';
+        const BLUE_NOISE = Uint8Array.from(atob(BLUE_NOISE_MASK), (c) => c.charCodeAt(0));
+        
+        // Per-pixel threshold over a whole palette step: no error to carry, no patterns
+        function blueNoiseDithering(pixels, width, height, palette) {
+            const quantized = new Uint8Array(width * height);
+            
+            for (let y = 0; y < height; y++) {
+                const maskRow = (y % BLUE_NOISE_SIZE) * BLUE_NOISE_SIZE;
+                for (let x = 0; x < width; x++) {
+                    const idx = (y * width + x) * 4;
+                    const threshold = BLUE_NOISE[maskRow + x % BLUE_NOISE_SIZE] - 128;
+                    const r = Math.max(0, Math.min(255, pixels[idx] + threshold));
+                    const g = Math.max(0, Math.min(255, pixels[idx + 1] + threshold));
+                    const b = Math.max(0, Math.min(255, pixels[idx + 2] + threshold));
+                    
+                    quantized[y * width + x] = matchColor(palette, r, g, b);
+                }
+            }
+            return quantized;
+        }
+        
+        function noDithering(pixels, width, height, palette) {
             const quantized = new Uint8Array(width * height);
             
             for (let y = 0; y < height; y++) {
@@ -1016,52 +1399,45 @@ const char HTML_PAGE[] PROGMEM = R"rawliteral(
                     const g = pixels[idx + 1];
                     const b = pixels[idx + 2];
                     
-                    const colorIndex = findClosestColor(r, g, b);
+                    const colorIndex = matchColor(palette, r, g, b);
                     quantized[y * width + x] = colorIndex;
                 }
             }
             return quantized;
         }
         
+        // Black and white only, the same with every palette
         function blackAndWhiteDithering(pixels, width, height) {
             const quantized = new Uint8Array(width * height);
-            const rgbData = new Uint8ClampedArray(pixels.length);
-            
-            for (let i = 0; i < pixels.length; i++) {
-                rgbData[i] = pixels[i];
-            }
+            const data = diffusionBuffer(pixels, width, height);
             
             for (let y = 0; y < height; y++) {
                 for (let x = 0; x < width; x++) {
-                    const idx = (y * width + x) * 4;
-                    const r = rgbData[idx];
-                    const g = rgbData[idx + 1];
-                    const b = rgbData[idx + 2];
+                    const idx = (y * width + x) * 3;
+                    const r = Math.min(Math.max(data[idx], 0), 4080);
+                    const g = Math.min(Math.max(data[idx + 1], 0), 4080);
+                    const b = Math.min(Math.max(data[idx + 2], 0), 4080);
                     
+                    // In sixteenths of a level, like the buffer
                     const gray = (r * 0.299 + g * 0.587 + b * 0.114);
                     
-                    const colorIndex = gray > 127 ? 1 : 0;
+                    const colorIndex = gray > 127 * 16 ? 1 : 0;
                     quantized[y * width + x] = colorIndex;
                     
-                    const targetGray = colorIndex === 0 ? 0 : 255;
+                    const targetGray = colorIndex === 0 ? 0 : 4080;
                     const error = gray - targetGray;
                     
-                    const distributeError = (dx, dy, factor) => {
-                        const nx = x + dx;
-                        const ny = y + dy;
-                        if (nx >= 0 && nx < width && ny >= 0 && ny < height) {
-                            const nidx = (ny * width + nx) * 4;
-                            const errorAmount = error * factor;
-                            rgbData[nidx] += errorAmount;
-                            rgbData[nidx + 1] += errorAmount;
-                            rgbData[nidx + 2] += errorAmount;
+                    for (let t = 0; t < FLOYD_STEINBERG_TAPS.length; t += 3) {
+                        const nx = x + FLOYD_STEINBERG_TAPS[t];
+                        const ny = y + FLOYD_STEINBERG_TAPS[t + 1];
+                        if (nx >= 0 && nx < width && ny < height) {
+                            const nidx = (ny * width + nx) * 3;
+                            const share = Math.trunc(error * FLOYD_STEINBERG_TAPS[t + 2] / 16);
+                            data[nidx] += share;
+                            data[nidx + 1] += share;
+                            data[nidx + 2] += share;
                         }
-                    };
-                    
-                    distributeError(1, 0, 7/16);
-                    distributeError(-1, 1, 3/16);
-                    distributeError(0, 1, 5/16);
-                    distributeError(1, 1, 1/16);
+                    }
                 }
             }
             return quantized;
@@ -1075,7 +1451,7 @@ const char HTML_PAGE[] PROGMEM = R"rawliteral(
             const imageData = ctx.createImageData(TARGET_WIDTH, TARGET_HEIGHT);
             
             for (let i = 0; i < quantizedPixels.length; i++) {
-                const [r, g, b] = COLORS[quantizedPixels[i]];
+                const [r, g, b] = PALETTES[paletteId].colors[quantizedPixels[i]];
                 const idx = i * 4;
                 imageData.data[idx] = r;
                 imageData.data[idx + 1] = g;
@@ -1085,7 +1461,7 @@ const char HTML_PAGE[] PROGMEM = R"rawliteral(
             ctx.putImageData(imageData, 0, 0);
         }
         
-        function generateBinary(quantizedPixels) {
+        function generateRawBinary(quantizedPixels) {
             const buffer = new Uint8Array(TARGET_WIDTH * TARGET_HEIGHT / 2);
             let bufferIndex = 0;
             for (let y = 0; y < TARGET_HEIGHT; y++) {
@@ -1098,6 +1474,198 @@ const char HTML_PAGE[] PROGMEM = R"rawliteral(
             return buffer;
         }
         
+        // Compressed (EPZ) unless the raw layout is smaller; the frame accepts both
+        function generateBinary(quantizedPixels) {
+            const raw = generateRawBinary(quantizedPixels);
+            const compressed = encodeCompressed(quantizedPixels);
+            return compressed.length < raw.length ? compressed : raw;
+        }
+        
+        // Same bytes as encodeCompressedImage() in image_codec.h: the image is
+        // scanned column by column from the bottom, then coded as 3-bit literals,
+        // runs and copies from a few fixed distances
+        function encodeCompressed(quantizedPixels) {
+            const count = TARGET_WIDTH * TARGET_HEIGHT;
+            const scan = new Uint8Array(count);
+            let i = 0;
+            for (let x = 0; x < TARGET_WIDTH; x++) {
+                for (let y = TARGET_HEIGHT - 1; y >= 0; y--) {
+                    scan[i++] = quantizedPixels[y * TARGET_WIDTH + x];
+                }
+            }
+            
+            const out = [0x45, 0x50, 0x5A, 0x31,
+                TARGET_WIDTH & 0xFF, TARGET_WIDTH >> 8, TARGET_HEIGHT & 0xFF, TARGET_HEIGHT >> 8];
+            
+            const putVarint = (value) => {
+                while (value >= 0x80) {
+                    out.push((value & 0x7F) | 0x80);
+                    value >>>= 7;
+                }
+                out.push(value);
+            };
+            
+            const flushLiteral = (start, end) => {
+                while (start < end) {
+                    const n = Math.min(end - start, EPZ_MAX_LITERAL);
+                    out.push(n - 1);
+                    let bitBuf = 0;
+                    let bitCount = 0;
+                    for (let k = 0; k < n; k++) {
+                        bitBuf |= (scan[start + k] & 0x07) << bitCount;
+                        bitCount += 3;
+                        while (bitCount >= 8) {
+                            out.push(bitBuf & 0xFF);
+                            bitBuf >>= 8;
+                            bitCount -= 8;
+                        }
+                    }
+                    if (bitCount > 0) out.push(bitBuf & 0xFF);
+                    start += n;
+                }
+            };
+            
+            let literalStart = 0;
+            let pos = 0;
+            while (pos < count) {
+                let runLen = 1;
+                while (pos + runLen < count && scan[pos + runLen] === scan[pos]) runLen++;
+                const inLiteral = pos > literalStart;
+                let bestLen = runLen >= (inLiteral ? EPZ_MIN_BREAK : 2) ? runLen : 0;
+                let bestDistance = -1;
+                
+                for (let d = 0; d < EPZ_DISTANCES.length; d++) {
+                    const distance = EPZ_DISTANCES[d];
+                    if (distance > pos) continue;
+                    let len = 0;
+                    while (pos + len < count && scan[pos + len] === scan[pos + len - distance]) len++;
+                    if (len >= (inLiteral ? EPZ_MIN_BREAK : 3) && len > bestLen) {
+                        bestLen = len;
+                        bestDistance = d;
+                    }
+                }
+                
+                if (bestLen === 0) {
+                    pos++;
+                    continue;
+                }
+                flushLiteral(literalStart, pos);
+                if (bestDistance < 0) {
+                    const token = 0x80 | ((scan[pos] & 0x07) << 3);
+                    if (bestLen <= 8) {
+                        out.push(token | (bestLen - 2));
+                    } else {
+                        out.push(token | 7);
+                        putVarint(bestLen - 9);
+                    }
+                } else {
+                    const token = 0xC0 | (bestDistance << 3);
+                    if (bestLen <= 9) {
+                        out.push(token | (bestLen - 3));
+                    } else {
+                        out.push(token | 7);
+                        putVarint(bestLen - 10);
+                    }
+                }
+                pos += bestLen;
+                literalStart = pos;
+            }
+            flushLiteral(literalStart, count);
+            return Uint8Array.from(out);
+        }
+        
+        // The frame refreshes in the background; follow it through /status
+        async function waitForDisplay(progressFill) {
+            const deadline = Date.now() + 120000;
+            while (Date.now() < deadline) {
+                await new Promise(resolve => setTimeout(resolve, 1000));
+                let status;
+                try {
+                    const response = await fetch('/status', { cache: 'no-store' });
+                    status = await response.json();
+                } catch (error) {
+                    continue;  // Busy or briefly unreachable, ask again
+                }
+                
+                if (status.state === 'idle' || status.state === 'busy') return true;
+                const label = status.state === 'queued' ? '⏳ Waiting for display'
+                            : status.step === 'refreshing' ? '🖼️ Refreshing display'
+                            : '📥 Loading display';
+                progressFill.style.width = status.progress + '%';
+                progressFill.textContent = label + ' ' + status.progress + '%';
+            }
+            return false;
+        }
+        
+        // SHA-256 (FIPS 180-4). crypto.subtle only exists on HTTPS pages, and
+        // the frame serves plain HTTP
+        const SHA256_K = new Uint32Array([
+            0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+            0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+            0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+            0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+            0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+            0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+            0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+            0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+        ]);
+        
+        function sha256(bytes) {
+            const blocks = Math.ceil((bytes.length + 9) / 64);
+            const padded = new Uint8Array(blocks * 64);
+            padded.set(bytes);
+            padded[bytes.length] = 0x80;
+            const view = new DataView(padded.buffer);
+            view.setUint32(padded.length - 8, Math.floor(bytes.length / 0x20000000));
+            view.setUint32(padded.length - 4, (bytes.length * 8) >>> 0);
+            
+            const h = new Uint32Array([0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                                       0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19]);
+            const w = new Uint32Array(64);
+            const rotr = (x, n) => (x >>> n) | (x << (32 - n));
+            for (let block = 0; block < blocks; block++) {
+                for (let i = 0; i < 16; i++) w[i] = view.getUint32(block * 64 + i * 4);
+                for (let i = 16; i < 64; i++) {
+                    const s0 = rotr(w[i - 15], 7) ^ rotr(w[i - 15], 18) ^ (w[i - 15] >>> 3);
+                    const s1 = rotr(w[i - 2], 17) ^ rotr(w[i - 2], 19) ^ (w[i - 2] >>> 10);
+                    w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+                }
+                let [a, b, c, d, e, f, g, k] = h;
+                for (let i = 0; i < 64; i++) {
+                    const t1 = (k + (rotr(e, 6) ^ rotr(e, 11) ^ rotr(e, 25)) + ((e & f) ^ (~e & g)) +
+                                SHA256_K[i] + w[i]) | 0;
+                    const t2 = ((rotr(a, 2) ^ rotr(a, 13) ^ rotr(a, 22)) + ((a & b) ^ (a & c) ^ (b & c))) | 0;
+                    k = g; g = f; f = e; e = (d + t1) | 0;
+                    d = c; c = b; b = a; a = (t1 + t2) | 0;
+                }
+                h[0] += a; h[1] += b; h[2] += c; h[3] += d;
+                h[4] += e; h[5] += f; h[6] += g; h[7] += k;
+            }
+            const digest = new Uint8Array(32);
+            const out = new DataView(digest.buffer);
+            for (let i = 0; i < 8; i++) out.setUint32(i * 4, h[i]);
+            return digest;
+        }
+        
+        // The frame's name for a stored image: the SHA-256 of the file cut to
+        // IMAGE_DIGEST_SIZE (12) bytes, in hex, then '-' and the file size
+        function imageHash(bytes) {
+            const hex = Array.from(sha256(bytes).subarray(0, 12), (b) => b.toString(16).padStart(2, '0'));
+            return hex.join('') + '-' + bytes.length;
+        }
+        
+        // Shows an image the frame already stores, without sending it again
+        async function showKnownImage(hash) {
+            try {
+                const known = await fetch('/image/' + hash, { method: 'HEAD', cache: 'no-store' });
+                if (!known.ok) return false;
+                const shown = await fetch('/image/' + hash, { method: 'POST' });
+                return shown.ok;
+            } catch (error) {
+                return false;  // Upload as usual
+            }
+        }
+        
         async function uploadToDisplay() {
             if (!convertedBinary) {
                 alert('No image to upload!');
@@ -1111,11 +1679,26 @@ const char HTML_PAGE[] PROGMEM = R"rawliteral(
             progressBar.style.display = 'block';
             uploadBtn.disabled = true;
             
+            const finish = async (message) => {
+                progressFill.textContent = message;
+                const shown = await waitForDisplay(progressFill);
+                progressFill.textContent = shown ? '✓ Complete!' : '⏳ Still refreshing';
+                setTimeout(() => {
+                    progressBar.style.display = 'none';
+                    alert(shown ? '✅ Image uploaded successfully!'
+                                : '✅ Image uploaded, the display is still refreshing');
+                    uploadBtn.disabled = false;
+                }, 1500);
+            };
+            
+            // Shown before, or still in the library: no transfer needed
+            if (await showKnownImage(imageHash(convertedBinary))) {
+                progressFill.style.width = '100%';
+                await finish('✓ Already on the frame');
+                return;
+            }
+            
             try {
-                const formData = new FormData();
-                const blob = new Blob([convertedBinary], { type: 'application/octet-stream' });
-                formData.append('file', blob, 'image.bin');
-                
                 const xhr = new XMLHttpRequest();
                 
                 xhr.upload.addEventListener('progress', (e) => {
@@ -1126,14 +1709,9 @@ const char HTML_PAGE[] PROGMEM = R"rawliteral(
                     }
                 });
                 
-                xhr.addEventListener('load', () => {
+                xhr.addEventListener('load', async () => {
                     if (xhr.status === 200) {
-                        progressFill.textContent = '✓ Complete!';
-                        setTimeout(() => {
-                            progressBar.style.display = 'none';
-                            alert('✅ Image uploaded successfully!');
-                            uploadBtn.disabled = false;
-                        }, 1500);
+                        await finish('✓ Uploaded!');
                     } else {
                         throw new Error('Upload failed');
                     }
@@ -1143,8 +1721,10 @@ const char HTML_PAGE[] PROGMEM = R"rawliteral(
                     throw new Error('Network error');
                 });
                 
-                xhr.open('POST', '/upload');
-                xhr.send(formData);
+                // Raw body: the frame writes it to flash without multipart parsing
+                xhr.open('PUT', '/image');
+                xhr.setRequestHeader('Content-Type', 'application/octet-stream');
+                xhr.send(convertedBinary);
                 
             } catch (error) {
                 alert('❌ Error: ' + error.message);
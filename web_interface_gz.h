@@ -0,0 +1,1303 @@
+/*
+ * Web Interface for E-Paper Photo Frame, gzip-compressed
+ * Generated from web_interface.h by tools/gzip_web_interface.js - do not edit.
+ *
+ * Repository: https://github.com/9carlo6/E-Paper
+ * @author 9carlo6
+ * @date 2025
+ * @version 1.0
+ *
+ * @copyright
+ * Copyright (c) 2025 9carlo6
+ * All rights reserved.
+ */
+
+#ifndef WEB_INTERFACE_GZ_H
+#define WEB_INTERFACE_GZ_H
+
+#define HTML_PAGE_SIZE 79149  // Uncompressed
+#define HTML_PAGE_GZ_SIZE 20447
+#define HTML_PAGE_ETAG "\"a6316f1c5fc55030\""  // Strong ETag: hash of the compressed page
+
+const uint8_t HTML_PAGE_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0xbd, 0xd9, 0x92, 0xe3, 0x4a,
+  0xb2, 0x20, 0xf6, 0xde, 0x5f, 0x11, 0x5d, 0xf7, 0xf6, 0x49, 0xb2, 0xc8, 0x24, 0x01, 0x90, 0xe0,
+  0x92, 0x59, 0x59, 0xc7, 0xb8, 0x93, 0xc9, 0x35, 0xb9, 0x24, 0x97, 0x9a, 0xba, 0x67, 0xb0, 0x04,
+  0x08, 0x90, 0x20, 0x80, 0xc4, 0xc2, 0xed, 0x74, 0xc9, 0xc6, 0xc6, 0x34, 0x66, 0x32, 0xd9, 0xd8,
+  0x5c, 0x99, 0x5a, 0x73, 0x9f, 0xae, 0xac, 0xcd, 0x64, 0x92, 0x6c, 0xde, 0xf5, 0xa0, 0xfb, 0x30,
+  0x5f, 0xd3, 0x3f, 0x30, 0xfd, 0x09, 0xb2, 0x08, 0x80, 0x24, 0x08, 0x02, 0x5c, 0xaa, 0xea, 0x9c,
+  0xee, 0x1e, 0xdd, 0x3a, 0xdd, 0x55, 0x20, 0x10, 0xe1, 0x11, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xee,
+  0xe1, 0xfe, 0x9b, 0x0f, 0xbf, 0x2d, 0xb6, 0x0b, 0xfd, 0x71, 0xa7, 0x04, 0x44, 0x73, 0x21, 0x7f,
+  0xfc, 0xcd, 0x07, 0xf4, 0x0f, 0x90, 0x19, 0x65, 0xfa, 0xf4, 0x0e, 0x2a, 0xef, 0xd0, 0x0b, 0xc8,
+  0xf0, 0x1f, 0x7f, 0x03, 0x00, 0x00, 0x1f, 0x16, 0xd0, 0x64, 0x00, 0x27, 0x32, 0xba, 0x01, 0xcd,
+  0xa7, 0x77, 0x83, 0x7e, 0xf9, 0x3e, 0xf3, 0xce, 0xfd, 0x49, 0x61, 0x16, 0xf0, 0xe9, 0xdd, 0x52,
+  0x82, 0x2b, 0x4d, 0xd5, 0xcd, 0x77, 0x80, 0x53, 0x15, 0x13, 0x2a, 0xe6, 0xd3, 0xbb, 0x95, 0xc4,
+  0x9b, 0xe2, 0x13, 0x0f, 0x97, 0x12, 0x07, 0xef, 0xf1, 0x8f, 0x28, 0x90, 0x14, 0xc9, 0x94, 0x18,
+  0xf9, 0xde, 0xe0, 0x18, 0x19, 0x3e, 0x91, 0x31, 0x22, 0x0a, 0x16, 0xcc, 0x5a, 0x5a, 0x58, 0x0b,
+  0xf7, 0x2b, 0xcb, 0x80, 0x3a, 0xfe, 0xcd, 0xb0, 0x32, 0x7c, 0x52, 0xd4, 0x5d, 0x7b, 0xa6, 0x64,
+  0xca, 0xf0, 0xe3, 0x9f, 0xff, 0xf8, 0x4f, 0xff, 0xf5, 0xbf, 0xfd, 0xcb, 0x3f, 0x82, 0xd2, 0x7d,
+  0x87, 0xd1, 0xa0, 0x0e, 0x0a, 0xaa, 0x62, 0xea, 0xaa, 0x2c, 0x43, 0xfd, 0x43, 0xdc, 0x2e, 0x61,
+  0x97, 0x36, 0xcc, 0xcd, 0xee, 0x19, 0xfd, 0x79, 0x0f, 0x7e, 0x06, 0x0b, 0x46, 0x9f, 0x4a, 0xca,
+  0x03, 0x20, 0x1e, 0x81, 0xc6, 0xf0, 0xbc, 0xa4, 0x4c, 0xf1, 0x33, 0xab, 0xae, 0xef, 0x0d, 0x69,
+  0x8b, 0x7f, 0xb2, 0xaa, 0xce, 0x43, 0xfd, 0x9e, 0x55, 0xd7, 0x8f, 0xe0, 0xcb, 0xbe, 0x32, 0xab,
+  0xf2, 0x1b, 0xf0, 0xf3, 0xfe, 0x27, 0xfa, 0x23, 0xa8, 0x8a, 0x79, 0x2f, 0x30, 0x0b, 0x49, 0xde,
+  0x3c, 0x80, 0x7b, 0x46, 0xd3, 0x64, 0x78, 0x6f, 0x6c, 0x0c, 0x13, 0x2e, 0xa2, 0x20, 0x2f, 0x4b,
+  0xca, 0xbc, 0xc9, 0x70, 0x3d, 0xfc, 0xbb, 0xac, 0x2a, 0x66, 0x14, 0xdc, 0xf5, 0xe0, 0x54, 0x85,
+  0x60, 0x50, 0xbb, 0x8b, 0x82, 0xae, 0xca, 0xaa, 0xa6, 0x1a, 0x05, 0x06, 0xa3, 0x18, 0xf7, 0x06,
+  0xd4, 0x25, 0xe1, 0xf1, 0x08, 0x36, 0xcb, 0x70, 0xf3, 0xa9, 0xae, 0x5a, 0x0a, 0xff, 0x00, 0x64,
+  0x49, 0x81, 0x8c, 0x7e, 0x3f, 0xd5, 0x19, 0x5e, 0x82, 0x8a, 0x19, 0x22, 0x13, 0x34, 0x0f, 0xa7,
+  0x51, 0xf0, 0x77, 0xa9, 0x54, 0x1a, 0x42, 0x06, 0x10, 0xbf, 0x8b, 0x82, 0xbf, 0x4b, 0xa7, 0x92,
+  0x2c, 0x43, 0x01, 0x92, 0x20, 0x7e, 0x17, 0x3e, 0x06, 0xb5, 0x90, 0x94, 0x7b, 0x11, 0x4a, 0x53,
+  0xd1, 0x7c, 0x40, 0x9f, 0x97, 0xe2, 0xf1, 0x67, 0x5e, 0x32, 0x34, 0x99, 0xd9, 0x3c, 0x00, 0x41,
+  0x86, 0xeb, 0xe3, 0x4f, 0x8c, 0x2c, 0x4d, 0x95, 0x7b, 0xc9, 0x84, 0x0b, 0xe3, 0x01, 0x70, 0x50,
+  0x31, 0xa1, 0x7e, 0x5c, 0x60, 0x66, 0x19, 0xa6, 0x24, 0x6c, 0xee, 0x9d, 0x19, 0xf7, 0x2f, 0xb4,
+  0xc7, 0x33, 0x45, 0x68, 0xae, 0x06, 0x0e, 0xa8, 0x8d, 0xa1, 0xea, 0x8c, 0xa4, 0x40, 0xdd, 0x83,
+  0x60, 0x37, 0x12, 0x56, 0xa2, 0x64, 0x42, 0x0f, 0x8e, 0xec, 0x89, 0x42, 0x68, 0xb1, 0x0c, 0x2f,
+  0x78, 0xbb, 0xc0, 0xfa, 0xde, 0x10, 0x19, 0x5e, 0x5d, 0x3d, 0x00, 0x02, 0x7f, 0x07, 0x29, 0xf4,
+  0x97, 0x3e, 0x65, 0x99, 0x10, 0x11, 0xc5, 0xff, 0xc5, 0x12, 0xe1, 0x80, 0xee, 0x26, 0x4f, 0xe0,
+  0x2d, 0x98, 0xb5, 0x4d, 0xc6, 0x0f, 0x20, 0x45, 0x9c, 0x7c, 0x75, 0xbe, 0xa0, 0x19, 0xf0, 0x1b,
+  0xa5, 0x48, 0x82, 0x9f, 0x81, 0x09, 0xd7, 0xe6, 0x3d, 0x46, 0xeb, 0x1e, 0x57, 0x80, 0x53, 0x65,
+  0x55, 0x7f, 0x00, 0x7f, 0x97, 0x48, 0x24, 0x1e, 0x1d, 0xfa, 0xbc, 0x67, 0x55, 0xd3, 0x54, 0x17,
+  0x08, 0x98, 0xb6, 0x7e, 0xb4, 0x09, 0xcd, 0x90, 0xb6, 0xf0, 0x01, 0x50, 0x70, 0xe1, 0xa6, 0xca,
+  0x98, 0x61, 0xb1, 0x98, 0xe2, 0x2f, 0xc0, 0x4e, 0xa5, 0x52, 0x27, 0xb0, 0x13, 0x5e, 0xd8, 0x44,
+  0x2c, 0xeb, 0x81, 0x6e, 0x69, 0xb2, 0xca, 0xf0, 0xf7, 0x8c, 0x0e, 0x19, 0xef, 0xd4, 0x60, 0xdc,
+  0x3f, 0x80, 0x84, 0xb6, 0x06, 0x3c, 0x63, 0x88, 0x90, 0x07, 0x7f, 0xc7, 0x71, 0xdc, 0xd9, 0x09,
+  0x22, 0x4f, 0x50, 0x76, 0x06, 0xd7, 0x3e, 0xa3, 0x39, 0xfa, 0xce, 0x59, 0xba, 0x81, 0x86, 0xa6,
+  0xa9, 0xd2, 0xe9, 0x47, 0x53, 0x67, 0x14, 0x43, 0x32, 0x25, 0x55, 0x79, 0x00, 0x8c, 0x2c, 0x03,
+  0x22, 0x96, 0x30, 0xbc, 0x53, 0x69, 0xf3, 0x01, 0x4c, 0x14, 0x84, 0x2f, 0x55, 0xba, 0x06, 0xff,
+  0x20, 0xaa, 0x4b, 0x44, 0x9d, 0xbb, 0x11, 0x1d, 0xd0, 0x8a, 0x16, 0xe0, 0xe3, 0x11, 0xa1, 0xfe,
+  0x9d, 0x90, 0x11, 0xb2, 0x82, 0x10, 0x84, 0xc7, 0x18, 0xaf, 0x33, 0xd3, 0x1b, 0xa0, 0xc1, 0x0c,
+  0x64, 0x8f, 0xa1, 0x49, 0x8a, 0x66, 0x99, 0x9f, 0xcc, 0x8d, 0x06, 0x9f, 0xde, 0x09, 0x92, 0x0c,
+  0xdf, 0x7d, 0x06, 0x3f, 0x1f, 0x56, 0xb1, 0xa2, 0x2a, 0xf0, 0xa8, 0x6d, 0x4e, 0x57, 0xb5, 0x7b,
+  0xc8, 0x4b, 0xa6, 0xea, 0x5d, 0x5e, 0xc7, 0x75, 0xae, 0x42, 0xcf, 0x99, 0xf5, 0xec, 0x5d, 0xb0,
+  0x36, 0x1e, 0x98, 0x1b, 0x28, 0xc2, 0xdb, 0xe9, 0x20, 0xb6, 0xa0, 0xa9, 0xbb, 0xb9, 0xd5, 0xa1,
+  0xcc, 0x98, 0xd2, 0x12, 0x5e, 0xb1, 0x10, 0x3d, 0xeb, 0x37, 0x99, 0xcc, 0x78, 0x3b, 0xcf, 0x18,
+  0x1a, 0xe4, 0xcc, 0x7b, 0x9d, 0x31, 0x25, 0x15, 0x17, 0x88, 0xa7, 0x08, 0xe2, 0x0c, 0x5a, 0x18,
+  0xcb, 0x54, 0x1f, 0x7d, 0x17, 0x05, 0xa5, 0xad, 0x81, 0xa1, 0xca, 0x12, 0xbf, 0x9f, 0xd3, 0xdb,
+  0x96, 0x05, 0x22, 0x0f, 0x41, 0x46, 0x5c, 0x4b, 0x94, 0x78, 0x1e, 0x2a, 0x67, 0x90, 0x4c, 0x78,
+  0xbb, 0xb8, 0x5b, 0x17, 0x0b, 0xd5, 0x8b, 0x16, 0x53, 0xb5, 0x38, 0xf1, 0x9e, 0xe1, 0x6c, 0xd4,
+  0x1d, 0xcf, 0x79, 0x30, 0xea, 0x39, 0x46, 0x59, 0x32, 0x86, 0x67, 0x06, 0x02, 0x31, 0xec, 0xda,
+  0x67, 0x7e, 0x17, 0xb0, 0xcd, 0xb0, 0xb2, 0xca, 0xcd, 0x83, 0x5b, 0x16, 0x74, 0x66, 0x01, 0x03,
+  0x27, 0x9c, 0x61, 0x0d, 0x55, 0xb6, 0xcc, 0x93, 0x91, 0x69, 0x78, 0x17, 0x97, 0xa1, 0x60, 0xe2,
+  0x07, 0xdd, 0xee, 0x05, 0xde, 0xd8, 0x6d, 0x66, 0x47, 0x04, 0xcf, 0x94, 0xc3, 0xbe, 0xf0, 0xa6,
+  0x40, 0xd1, 0x74, 0x14, 0x1c, 0xfe, 0x22, 0x62, 0x19, 0xef, 0xee, 0x60, 0xb3, 0x9b, 0x7b, 0xb8,
+  0x84, 0x8a, 0x69, 0x9c, 0x41, 0xe3, 0x56, 0x55, 0x17, 0x18, 0x8d, 0xba, 0x2a, 0x1b, 0xf7, 0xba,
+  0xba, 0x0a, 0x5a, 0x7c, 0xbf, 0xd4, 0xb6, 0x3b, 0x65, 0x34, 0x3f, 0xda, 0x3a, 0xb7, 0xb2, 0x51,
+  0x57, 0xee, 0x57, 0x3a, 0xaa, 0x88, 0xfe, 0x0e, 0x1e, 0x17, 0x6b, 0x2a, 0xf7, 0x32, 0xa3, 0x4f,
+  0xa1, 0x3f, 0x5d, 0xd0, 0x08, 0xf6, 0x6f, 0xa5, 0x05, 0x12, 0x07, 0x19, 0xc5, 0xf4, 0x27, 0x11,
+  0x3a, 0x78, 0x37, 0x20, 0x02, 0x2b, 0xef, 0xc5, 0xb7, 0xc0, 0x12, 0xee, 0xbd, 0x32, 0xe9, 0x6d,
+  0x01, 0x49, 0x52, 0xf7, 0xc1, 0x1d, 0xb8, 0x96, 0x3b, 0x61, 0x1c, 0x18, 0xb2, 0xc4, 0x9f, 0xb0,
+  0x26, 0x84, 0xc1, 0x07, 0x40, 0x9e, 0x0a, 0x60, 0x0e, 0x66, 0x28, 0xe2, 0x9c, 0x50, 0x91, 0x24,
+  0xce, 0xf2, 0x43, 0x7b, 0xe9, 0xde, 0xb3, 0x96, 0x69, 0xaa, 0x8a, 0x71, 0x3d, 0x3d, 0x05, 0x50,
+  0xc2, 0x55, 0x54, 0xb4, 0x43, 0x38, 0x49, 0x7f, 0x1d, 0xb9, 0xf8, 0x75, 0xdc, 0xfe, 0xf7, 0x46,
+  0xcc, 0x91, 0x54, 0x90, 0xc0, 0x75, 0xca, 0x87, 0xf7, 0x84, 0x44, 0xa2, 0xf5, 0x4d, 0x05, 0xae,
+  0x01, 0x22, 0x48, 0x1a, 0x15, 0x24, 0x7d, 0xe1, 0x74, 0xf7, 0x1c, 0x9d, 0x9f, 0x72, 0xb9, 0xa3,
+  0xbd, 0xf1, 0x1a, 0x1a, 0x25, 0x33, 0x67, 0xca, 0x39, 0x02, 0x1b, 0x66, 0x6f, 0x81, 0x00, 0x5d,
+  0x3d, 0x3f, 0xec, 0x0c, 0x7b, 0xce, 0xf3, 0x97, 0xa7, 0x92, 0xb3, 0xdc, 0xcc, 0xdd, 0xf9, 0x29,
+  0x62, 0x2b, 0xfe, 0x88, 0xce, 0x9c, 0x74, 0x6b, 0xb7, 0x88, 0x93, 0x01, 0x8b, 0xd8, 0x96, 0x4c,
+  0x9d, 0x4d, 0x98, 0xe7, 0xf9, 0xef, 0x2a, 0x3c, 0xfe, 0xe2, 0xbc, 0x1b, 0x13, 0xc8, 0xca, 0x19,
+  0xe2, 0x89, 0x14, 0xe2, 0x61, 0x53, 0x74, 0x00, 0xcf, 0xb0, 0x11, 0x1a, 0x33, 0xa0, 0x0c, 0x39,
+  0x13, 0xf2, 0xbe, 0x02, 0xbc, 0x57, 0xf6, 0x3c, 0x73, 0x7c, 0x22, 0x30, 0x71, 0xd8, 0xdb, 0x24,
+  0x49, 0x50, 0x51, 0x40, 0x52, 0xa9, 0x28, 0xa0, 0x12, 0x49, 0xb4, 0x4d, 0xd2, 0xe1, 0x33, 0x5d,
+  0xb8, 0xc7, 0x67, 0xb7, 0xdb, 0xce, 0x76, 0x4e, 0xbf, 0x58, 0x99, 0x09, 0x10, 0x16, 0x1c, 0xd0,
+  0xb8, 0xc0, 0x19, 0xd0, 0x1e, 0x00, 0x2e, 0xd0, 0x9e, 0x46, 0x4f, 0x41, 0x6b, 0x8c, 0x0c, 0x4d,
+  0x33, 0x78, 0xe9, 0x9f, 0x13, 0x7e, 0x83, 0x47, 0x84, 0x8f, 0x79, 0x7e, 0xad, 0x32, 0xf2, 0x54,
+  0xd5, 0x25, 0x53, 0x5c, 0xdc, 0xdb, 0x33, 0x26, 0x9d, 0xb0, 0xc8, 0xbf, 0x62, 0x79, 0xfd, 0xd0,
+  0xf9, 0xa9, 0x2e, 0xf1, 0x41, 0xfd, 0x46, 0xdf, 0x3c, 0x4c, 0x47, 0x97, 0xf8, 0x7b, 0x13, 0x2e,
+  0x34, 0x99, 0x31, 0x21, 0x22, 0x46, 0x6b, 0xa1, 0x18, 0x48, 0xae, 0xd7, 0x20, 0x63, 0x86, 0x10,
+  0x67, 0xbf, 0x17, 0x24, 0x33, 0x8a, 0x36, 0x82, 0x05, 0xb3, 0x0e, 0x91, 0x88, 0x11, 0x44, 0x01,
+  0x29, 0xe8, 0xe1, 0xb0, 0x1f, 0xf7, 0xa2, 0xfd, 0x39, 0xfd, 0x81, 0x83, 0x5e, 0xe8, 0xbc, 0xaa,
+  0xf9, 0xa0, 0xfd, 0x2c, 0xb3, 0xb8, 0x86, 0xdb, 0x5c, 0x7f, 0x0c, 0x26, 0x6f, 0x25, 0xaa, 0xf3,
+  0xbc, 0xea, 0xcc, 0x18, 0x77, 0x27, 0xda, 0x5b, 0x79, 0x02, 0x6e, 0x50, 0x50, 0xf5, 0xc5, 0x83,
+  0xfd, 0x88, 0xe6, 0x6d, 0x1c, 0xba, 0xa7, 0xb5, 0x75, 0xf8, 0x1c, 0xf3, 0xc8, 0x38, 0xfb, 0x70,
+  0x00, 0xfb, 0x48, 0x84, 0xaf, 0xea, 0xf4, 0xb7, 0xf0, 0xb2, 0x23, 0x4a, 0x27, 0x84, 0x84, 0x20,
+  0x5c, 0x47, 0x0b, 0xb7, 0x9d, 0x7f, 0xce, 0xb1, 0x66, 0x7c, 0x76, 0x5f, 0x30, 0x53, 0x78, 0xaf,
+  0x43, 0x85, 0x87, 0x3a, 0x9e, 0x71, 0x4d, 0x5a, 0xa3, 0x33, 0x2c, 0xe4, 0xaf, 0x43, 0x80, 0x06,
+  0x15, 0x44, 0x29, 0x01, 0x14, 0xba, 0x62, 0x24, 0x8f, 0x04, 0xa1, 0x6a, 0x0c, 0x27, 0x99, 0x1b,
+  0xa4, 0xdb, 0xa1, 0xbf, 0xf2, 0x20, 0x13, 0xd8, 0x07, 0x5f, 0xcc, 0x1c, 0xeb, 0x2e, 0xe0, 0x25,
+  0x90, 0xca, 0xe9, 0x61, 0xef, 0xfc, 0xde, 0xe7, 0x5e, 0xd0, 0xa7, 0xab, 0xc5, 0x97, 0xc7, 0x5e,
+  0xd2, 0x26, 0xf9, 0x76, 0x8c, 0x87, 0x06, 0xe7, 0xd7, 0xb1, 0x9d, 0xa6, 0x2c, 0x43, 0xc3, 0x85,
+  0x7f, 0xdb, 0x48, 0xd5, 0x16, 0xd8, 0x65, 0xfa, 0x16, 0x35, 0x97, 0xab, 0x63, 0x9a, 0x0e, 0x91,
+  0x7e, 0xdd, 0xa5, 0xc0, 0x76, 0x38, 0xbd, 0xaf, 0xd6, 0xcf, 0xa7, 0xa2, 0xef, 0x64, 0xb9, 0x8e,
+  0x1e, 0x17, 0x49, 0x99, 0xbc, 0xa0, 0x5d, 0x4d, 0x6a, 0x6b, 0x5b, 0xdc, 0x3e, 0x52, 0xae, 0x92,
+  0xe1, 0x6f, 0xa1, 0x7f, 0xdf, 0x83, 0xc2, 0x65, 0xd9, 0xfb, 0x74, 0x1b, 0xf8, 0x8e, 0xda, 0x74,
+  0x7f, 0xe9, 0xc1, 0xbd, 0x15, 0x9c, 0xee, 0xce, 0x17, 0x51, 0xe9, 0x3e, 0x10, 0xa4, 0x7c, 0x3f,
+  0x06, 0x2e, 0x88, 0xab, 0x45, 0xd9, 0x3d, 0xe7, 0x06, 0x44, 0x8c, 0x32, 0xae, 0x5d, 0x55, 0xde,
+  0xc9, 0xb0, 0xf7, 0x8d, 0x07, 0x45, 0x35, 0x43, 0x0f, 0xbc, 0x64, 0x20, 0xf3, 0x0c, 0x1f, 0xf6,
+  0xcc, 0x50, 0xc0, 0x1e, 0x41, 0x5d, 0xd8, 0x23, 0x52, 0xe7, 0xf7, 0x88, 0x64, 0xf8, 0x4c, 0xaf,
+  0x76, 0x5d, 0x41, 0x4a, 0x55, 0x37, 0x07, 0x42, 0x2a, 0xe9, 0x3d, 0x8a, 0x14, 0x15, 0xad, 0x14,
+  0x59, 0x5d, 0x41, 0xfe, 0xf1, 0x04, 0x44, 0xcc, 0x80, 0x9c, 0xaa, 0xf0, 0x8c, 0xbe, 0xf1, 0xc2,
+  0x48, 0x71, 0x69, 0x3a, 0xed, 0x5b, 0xc3, 0xe2, 0x38, 0x68, 0x18, 0xde, 0xf2, 0x54, 0x86, 0x49,
+  0x27, 0x69, 0x9f, 0xf2, 0x3c, 0xa3, 0x4c, 0x6d, 0xbd, 0xaf, 0xbb, 0x38, 0xcf, 0x25, 0xe8, 0xe3,
+  0xe2, 0x31, 0x4d, 0x57, 0xa7, 0x3a, 0x34, 0x8c, 0x7b, 0x96, 0xd1, 0x6f, 0xd5, 0xbc, 0x25, 0xce,
+  0x0b, 0x79, 0x90, 0x40, 0xff, 0x9d, 0x27, 0x4f, 0xfa, 0x36, 0x7d, 0xe4, 0x39, 0xd9, 0x33, 0x40,
+  0x64, 0xf5, 0x1b, 0xab, 0x20, 0xc9, 0xb2, 0x67, 0xb0, 0xc1, 0xda, 0xc4, 0x73, 0x0b, 0x3a, 0x4b,
+  0xdc, 0xb2, 0x9e, 0xdd, 0x4b, 0x04, 0x23, 0xf7, 0x2f, 0x71, 0xde, 0x0b, 0x66, 0x2a, 0xc1, 0x8b,
+  0xdf, 0x85, 0x43, 0x49, 0x11, 0xd4, 0xb3, 0xfb, 0x70, 0x42, 0xa0, 0x04, 0xfe, 0x7a, 0x6e, 0x79,
+  0x4c, 0x0f, 0x99, 0x9b, 0x54, 0x88, 0x5e, 0x73, 0x92, 0xef, 0x1e, 0x49, 0x66, 0xd3, 0x29, 0x9e,
+  0xf2, 0x1f, 0x0b, 0x87, 0x38, 0xbe, 0x1b, 0x4e, 0x02, 0x19, 0xa5, 0x7c, 0xed, 0x62, 0x76, 0xb5,
+  0x0f, 0x71, 0xc7, 0xce, 0xfb, 0x21, 0x6e, 0x1b, 0xad, 0x3f, 0x20, 0x5b, 0xad, 0x63, 0x02, 0xe6,
+  0xa5, 0x25, 0xe0, 0x64, 0xc6, 0x30, 0x9e, 0xde, 0xed, 0x75, 0xda, 0xef, 0x0e, 0x26, 0xe1, 0x0f,
+  0x22, 0x79, 0xd6, 0x9a, 0x2c, 0x92, 0xae, 0xb2, 0xda, 0x0e, 0xd2, 0xce, 0xe8, 0xf6, 0xee, 0xe3,
+  0x00, 0x1b, 0x76, 0x00, 0xa3, 0xf0, 0x00, 0x69, 0xba, 0xec, 0xfd, 0xcd, 0x00, 0x82, 0xaa, 0x83,
+  0x8d, 0x6a, 0xe9, 0x3b, 0xca, 0xf9, 0x10, 0xd7, 0x0e, 0x70, 0x0e, 0x00, 0x5d, 0x9d, 0x73, 0x59,
+  0x88, 0xde, 0x01, 0x89, 0xdf, 0xbd, 0xc8, 0xe1, 0xdf, 0xaa, 0xc2, 0xc9, 0x12, 0x37, 0x7f, 0x7a,
+  0xc7, 0xab, 0x9c, 0xb5, 0x80, 0x8a, 0x19, 0x9b, 0x42, 0xb3, 0x24, 0x43, 0xf4, 0x98, 0xdf, 0xd4,
+  0xf8, 0xd0, 0x1d, 0xb2, 0x03, 0xd5, 0x90, 0x5d, 0xe8, 0x2e, 0x1c, 0xc3, 0x65, 0x43, 0x61, 0xd7,
+  0x28, 0xbd, 0x8d, 0x21, 0x1c, 0xbf, 0xfb, 0xf8, 0xe7, 0x3f, 0xfe, 0xe1, 0x5f, 0x3e, 0xc4, 0x79,
+  0x69, 0xe9, 0x29, 0xa8, 0x01, 0x8c, 0xcf, 0xa7, 0x77, 0x27, 0xb4, 0xe7, 0x9d, 0x05, 0x44, 0x39,
+  0xef, 0x3e, 0x16, 0x50, 0x7b, 0x40, 0xd5, 0x01, 0xb2, 0x6c, 0x01, 0x46, 0xb1, 0x91, 0x70, 0x34,
+  0xe4, 0x63, 0xb8, 0x47, 0x46, 0xc9, 0x13, 0x82, 0x79, 0xf7, 0xf1, 0xb9, 0x53, 0x89, 0x82, 0x4e,
+  0xab, 0x12, 0x05, 0xf9, 0x66, 0x07, 0x18, 0x96, 0x86, 0x74, 0x5e, 0x90, 0x3f, 0x85, 0x88, 0x2d,
+  0x61, 0xc0, 0x65, 0x09, 0xc3, 0x98, 0xdb, 0xe3, 0xe2, 0x1d, 0x60, 0x38, 0x0e, 0x6a, 0xe6, 0xd3,
+  0x3b, 0xdc, 0xa3, 0xf8, 0x7b, 0x8c, 0x49, 0x11, 0x71, 0xe1, 0xa7, 0x77, 0x22, 0xa3, 0xf0, 0x32,
+  0x2c, 0x4b, 0x32, 0x0c, 0x99, 0xa2, 0x64, 0xc4, 0x50, 0x2d, 0xe3, 0x13, 0xf1, 0xd9, 0x8d, 0x37,
+  0x0f, 0x76, 0x7c, 0x27, 0xce, 0x65, 0x5e, 0xb3, 0x9b, 0x47, 0x2f, 0x4a, 0xf6, 0x6f, 0x4f, 0x77,
+  0xc5, 0xc4, 0x0e, 0x03, 0x7e, 0x42, 0x9b, 0x97, 0xc2, 0x6d, 0xe4, 0xfe, 0xe9, 0x9f, 0xff, 0x3d,
+  0xa2, 0xcd, 0x02, 0x22, 0xae, 0x1f, 0x40, 0xc7, 0x31, 0x84, 0x80, 0x9a, 0x8d, 0x62, 0x31, 0x11,
+  0x84, 0xe3, 0x8b, 0xc6, 0xe0, 0x53, 0xbb, 0xaf, 0x7f, 0x07, 0x8e, 0xe0, 0xa3, 0x3f, 0x45, 0x34,
+  0xcb, 0xa6, 0x8a, 0x0d, 0x4c, 0xe0, 0x4f, 0xff, 0xee, 0xff, 0x00, 0x1d, 0x49, 0xe1, 0x44, 0x34,
+  0xff, 0x96, 0x01, 0xc1, 0x5e, 0xef, 0x68, 0xaa, 0x00, 0xa9, 0xc9, 0x8f, 0xbb, 0xe7, 0x9d, 0xc1,
+  0x40, 0x0a, 0xf5, 0xd1, 0x64, 0xfa, 0x74, 0xe5, 0x83, 0xa1, 0x31, 0xca, 0x45, 0x6a, 0xd5, 0x77,
+  0x9b, 0x08, 0x1e, 0x4f, 0xfe, 0xc0, 0x18, 0x3f, 0xc4, 0x51, 0x7d, 0x1f, 0xb0, 0xee, 0x8e, 0xd8,
+  0x5a, 0xc9, 0x23, 0x45, 0xd6, 0xee, 0x14, 0x6a, 0xcf, 0x37, 0x3b, 0x1d, 0xa2, 0xb7, 0xae, 0x55,
+  0x6a, 0x40, 0xf3, 0xd0, 0x4a, 0xe8, 0x0e, 0x57, 0xba, 0x0b, 0xbf, 0xfb, 0x88, 0xcb, 0xf9, 0xac,
+  0xb8, 0xf3, 0x6d, 0x62, 0x0d, 0xd6, 0xae, 0xa9, 0xbc, 0xfd, 0x23, 0xa8, 0x29, 0x5c, 0x16, 0x35,
+  0x85, 0xcb, 0xf9, 0x2d, 0xee, 0xd3, 0x57, 0x81, 0x73, 0x70, 0x6c, 0x08, 0x3c, 0x10, 0x77, 0xc1,
+  0x87, 0x8f, 0xee, 0xeb, 0x3b, 0xe7, 0x8c, 0x7d, 0x59, 0xfc, 0xf3, 0xdd, 0xc7, 0x0f, 0x71, 0xfb,
+  0xc3, 0xf9, 0x81, 0x1f, 0x0c, 0x80, 0xa8, 0xc6, 0x37, 0x75, 0xfe, 0xc4, 0xfc, 0xe6, 0xd7, 0x59,
+  0xe7, 0x7c, 0xb1, 0xc7, 0x26, 0xaa, 0xd4, 0xb6, 0xcc, 0x50, 0xf8, 0xdd, 0x11, 0x98, 0x83, 0xb5,
+  0x6b, 0x2f, 0x23, 0xbe, 0xfb, 0xf8, 0xa7, 0xff, 0xe9, 0x7f, 0xfd, 0x10, 0xb7, 0x01, 0x5c, 0x09,
+  0xb9, 0xa6, 0x5c, 0x05, 0x38, 0x72, 0x06, 0xac, 0x9b, 0xe1, 0xe9, 0x88, 0x8f, 0xd9, 0xb3, 0x82,
+  0x80, 0xf5, 0xb0, 0x39, 0xea, 0x18, 0xbe, 0xe1, 0xbc, 0x5b, 0x48, 0xca, 0xd3, 0x3b, 0x92, 0x78,
+  0x87, 0x0e, 0x7c, 0x4f, 0xef, 0x12, 0x04, 0xf1, 0x0e, 0x2c, 0x19, 0xd9, 0x82, 0xe8, 0x25, 0x11,
+  0xb8, 0xae, 0x76, 0x90, 0x5f, 0x51, 0xd1, 0x77, 0x67, 0x96, 0xd9, 0xc1, 0x48, 0x93, 0xb2, 0xd7,
+  0x18, 0x12, 0xb3, 0xfc, 0x16, 0xd7, 0xcd, 0xd4, 0x77, 0x6c, 0x38, 0xba, 0x66, 0x0a, 0x39, 0x46,
+  0xe1, 0xa0, 0x8c, 0xd8, 0xa5, 0x0b, 0xd9, 0xb6, 0xe0, 0x8d, 0x98, 0xe9, 0x7f, 0x06, 0x05, 0x5c,
+  0xe0, 0x86, 0xa9, 0xd3, 0xa1, 0x01, 0x4d, 0x0f, 0x40, 0xd7, 0x74, 0xfd, 0xf9, 0x8f, 0xff, 0xdb,
+  0xff, 0x08, 0xba, 0xa8, 0xcc, 0x2d, 0x30, 0x55, 0x93, 0x31, 0x21, 0x66, 0xe2, 0xe7, 0xa0, 0xe2,
+  0x52, 0xfe, 0x60, 0x7f, 0x0d, 0x54, 0xe2, 0x6d, 0xe3, 0x4c, 0x27, 0xff, 0xf4, 0x3f, 0xff, 0x67,
+  0x50, 0xc0, 0x85, 0x6e, 0x18, 0xba, 0x20, 0x99, 0x27, 0x20, 0xed, 0x73, 0x14, 0x96, 0x48, 0xfe,
+  0x17, 0x50, 0x96, 0xcc, 0xaf, 0x1c, 0xf2, 0xc9, 0x00, 0x6c, 0x43, 0x9e, 0x67, 0xee, 0xfc, 0xcc,
+  0x7b, 0x88, 0x34, 0xfe, 0x80, 0x04, 0x3f, 0xf4, 0x05, 0x6f, 0xb6, 0xa7, 0x5d, 0xb8, 0x46, 0x18,
+  0xf0, 0xd1, 0xe1, 0xdb, 0x2b, 0x74, 0xff, 0xa1, 0xb7, 0x7f, 0xff, 0x4d, 0xc2, 0x81, 0xbd, 0xce,
+  0xfe, 0xfc, 0xc7, 0xff, 0xf4, 0x5f, 0x40, 0x41, 0x54, 0x55, 0x03, 0xa2, 0xce, 0x2f, 0xa1, 0x6e,
+  0x20, 0xe1, 0x20, 0xb7, 0x6b, 0xec, 0x2f, 0x23, 0x20, 0x38, 0xf2, 0xa0, 0x62, 0x4b, 0xc0, 0x9a,
+  0x0e, 0x05, 0xa8, 0xeb, 0x90, 0x07, 0x4e, 0xf7, 0xfe, 0xea, 0x24, 0x82, 0x0e, 0xa3, 0x40, 0xd9,
+  0x1e, 0xbb, 0xf1, 0x15, 0x32, 0xc1, 0xce, 0x4c, 0x74, 0x2c, 0x15, 0x38, 0x6f, 0x6b, 0x3c, 0x64,
+  0xe4, 0xe3, 0xfd, 0xba, 0x63, 0x7f, 0x09, 0xdd, 0x49, 0xe8, 0xdb, 0x5d, 0xf8, 0x1d, 0xc0, 0x67,
+  0x89, 0xa7, 0x77, 0x1d, 0x4b, 0x87, 0x4e, 0x37, 0xa2, 0x00, 0x1d, 0x69, 0xa1, 0x61, 0x02, 0x49,
+  0x01, 0xdd, 0x4a, 0xfe, 0xdd, 0x47, 0x0c, 0xe8, 0x66, 0xd9, 0xc1, 0xe9, 0xc5, 0x51, 0x97, 0x72,
+  0x1c, 0xd4, 0x02, 0x7a, 0xc4, 0x70, 0x50, 0x73, 0x75, 0xa8, 0x09, 0x19, 0xc3, 0x42, 0x33, 0x97,
+  0x2b, 0xc0, 0x0e, 0x90, 0x94, 0xf9, 0x71, 0xbf, 0xda, 0xf5, 0x06, 0xc3, 0xbe, 0xfb, 0xb8, 0x2b,
+  0xf5, 0x8d, 0x1b, 0xf6, 0xb1, 0x05, 0xc9, 0xb3, 0x6a, 0x2a, 0xe8, 0xd5, 0xc7, 0xaf, 0x65, 0x00,
+  0xfb, 0xf5, 0x80, 0xb8, 0x00, 0x96, 0x4c, 0x3c, 0xef, 0xf3, 0xa6, 0xf2, 0x0e, 0xec, 0x55, 0x48,
+  0x67, 0xf9, 0xc4, 0x09, 0xf2, 0x11, 0xe3, 0x18, 0x18, 0x10, 0xf4, 0x76, 0xa6, 0x89, 0x3d, 0x54,
+  0x0f, 0x2a, 0xfc, 0x58, 0xda, 0xf9, 0xee, 0xa3, 0x03, 0x60, 0x0b, 0xae, 0x82, 0x39, 0xf0, 0x8e,
+  0xd0, 0x4f, 0xd4, 0x77, 0x3e, 0xfd, 0xfc, 0xf3, 0x1f, 0xff, 0xf0, 0xff, 0x82, 0x06, 0x3a, 0xac,
+  0xb6, 0xe0, 0xca, 0x3e, 0x3f, 0x5c, 0xe8, 0xe0, 0x35, 0x0c, 0xcf, 0x51, 0x2f, 0x3b, 0x04, 0xb6,
+  0xfb, 0xe1, 0x74, 0xeb, 0x58, 0xf9, 0x13, 0xcc, 0xf0, 0xfc, 0xf9, 0x4a, 0x59, 0x52, 0x18, 0x19,
+  0x74, 0x6c, 0x98, 0x3e, 0x9c, 0xcc, 0x25, 0x69, 0x3a, 0x0d, 0x07, 0x0b, 0x9b, 0xd7, 0x0c, 0x05,
+  0x29, 0x51, 0xec, 0x71, 0xd8, 0x4f, 0x01, 0x83, 0xb8, 0x0e, 0x2b, 0x07, 0xfd, 0xdd, 0x0e, 0x35,
+  0xf6, 0x9b, 0x3c, 0xa3, 0x9f, 0x39, 0x97, 0x1f, 0xe9, 0xc2, 0x8e, 0x2b, 0x96, 0xd1, 0x9b, 0x8f,
+  0x48, 0xac, 0x3a, 0x6a, 0x3e, 0xb0, 0x37, 0x0e, 0x2d, 0x1d, 0x34, 0x09, 0x98, 0xc6, 0xf7, 0xa4,
+  0x65, 0xbf, 0xeb, 0xab, 0x45, 0x7b, 0x74, 0x88, 0xba, 0x02, 0xc6, 0xfb, 0xe7, 0x3f, 0xfe, 0xe1,
+  0xff, 0x04, 0x8e, 0x9a, 0xc3, 0x54, 0x41, 0x71, 0xa7, 0xd0, 0x38, 0xa1, 0x16, 0x57, 0x8b, 0x8a,
+  0x43, 0xb4, 0xc7, 0x6d, 0x7a, 0xc9, 0xd9, 0xb7, 0x41, 0x7f, 0xd5, 0xab, 0x0f, 0x81, 0xfb, 0xd0,
+  0xf3, 0x71, 0xa7, 0x1c, 0xd4, 0x38, 0x37, 0x01, 0x38, 0x5d, 0xd2, 0xcc, 0x43, 0x6f, 0xe3, 0xef,
+  0xc1, 0xd3, 0x95, 0x7f, 0xdc, 0xb3, 0x55, 0x68, 0xb7, 0x7a, 0xfd, 0x5c, 0xab, 0xdf, 0x03, 0x3f,
+  0xa0, 0xe7, 0x72, 0xad, 0x32, 0xe8, 0xe6, 0xfa, 0xb5, 0x76, 0xcb, 0x5d, 0xe8, 0x5a, 0xc0, 0xe0,
+  0x7d, 0xfc, 0x37, 0x07, 0xc5, 0x98, 0x62, 0x98, 0xa0, 0x9f, 0xeb, 0x56, 0x4a, 0xfd, 0x9f, 0x86,
+  0xb5, 0x62, 0xbf, 0x0a, 0x9e, 0x90, 0x0b, 0xea, 0xa3, 0x7f, 0x89, 0x6a, 0xa9, 0x56, 0xa9, 0xf6,
+  0xc1, 0xd3, 0xb1, 0x46, 0xd0, 0x2e, 0xd2, 0xe9, 0x96, 0x5e, 0x6b, 0xa5, 0xe1, 0x4f, 0xbd, 0x42,
+  0xae, 0x51, 0x42, 0x50, 0x1e, 0x01, 0x88, 0xc7, 0x41, 0x5f, 0xb4, 0x16, 0xac, 0xc2, 0x48, 0xb2,
+  0x01, 0x18, 0x1d, 0x02, 0x5e, 0x32, 0x45, 0x88, 0x78, 0x3b, 0x63, 0x02, 0x32, 0x9e, 0x04, 0xaa,
+  0x00, 0x4c, 0x11, 0x3a, 0x1a, 0x50, 0xa4, 0xce, 0xb2, 0x75, 0xaf, 0x1e, 0xd8, 0xa5, 0xce, 0xe4,
+  0xa7, 0x62, 0x0d, 0xa1, 0xa0, 0x50, 0xea, 0x81, 0x27, 0xf0, 0x89, 0x8a, 0x82, 0x64, 0x14, 0x64,
+  0xa2, 0x80, 0xce, 0x66, 0xa3, 0xa8, 0x37, 0xe8, 0x2f, 0x12, 0x29, 0xee, 0xd1, 0x23, 0x95, 0x24,
+  0x88, 0xcf, 0x8f, 0x3e, 0x30, 0x9a, 0xb9, 0xd1, 0x4f, 0x8d, 0x5a, 0xbf, 0xd4, 0xcd, 0x35, 0xc0,
+  0x13, 0x20, 0xa9, 0x8c, 0x6f, 0xa1, 0x5a, 0xeb, 0xa7, 0x7c, 0xb7, 0x94, 0xab, 0xa3, 0x71, 0x7a,
+  0x0b, 0x14, 0xda, 0x8d, 0x76, 0x17, 0x77, 0xe1, 0x68, 0x35, 0x7d, 0x22, 0xa2, 0x00, 0xfd, 0xef,
+  0x73, 0x14, 0x7c, 0x3a, 0xf2, 0xe5, 0x44, 0x2f, 0x88, 0x9d, 0x57, 0xa7, 0xf3, 0x83, 0x70, 0xbe,
+  0x1c, 0x43, 0xb0, 0x8b, 0x9c, 0xc0, 0x38, 0xfc, 0x24, 0x93, 0xf8, 0xeb, 0xbe, 0xd6, 0xc9, 0x08,
+  0x5b, 0xa5, 0x5c, 0xb7, 0xd4, 0xeb, 0xff, 0xd4, 0x18, 0xa0, 0x29, 0x62, 0x2d, 0x49, 0xe6, 0x5b,
+  0xf6, 0xb6, 0xd9, 0x40, 0x87, 0xcb, 0xc7, 0xd3, 0xe5, 0x1a, 0x8f, 0x03, 0x5b, 0x0a, 0xd1, 0x74,
+  0x15, 0x2b, 0xa2, 0x90, 0x2e, 0x98, 0x31, 0x01, 0x64, 0x38, 0xd1, 0x16, 0x09, 0xd0, 0x04, 0x39,
+  0x63, 0x96, 0x55, 0x75, 0x6e, 0x00, 0x59, 0x9a, 0x43, 0x24, 0x64, 0xa1, 0x59, 0xd3, 0x50, 0xdd,
+  0x18, 0x70, 0x24, 0x0a, 0x37, 0xd4, 0x05, 0x63, 0x72, 0x22, 0x34, 0x1c, 0x31, 0x02, 0x30, 0x53,
+  0x46, 0x72, 0x61, 0x2f, 0x84, 0x2a, 0xf3, 0x50, 0x60, 0x2c, 0xd9, 0x0c, 0x3f, 0x82, 0xc5, 0x6e,
+  0xbf, 0xdf, 0xf5, 0x02, 0xf0, 0x92, 0x20, 0x58, 0x06, 0x74, 0x43, 0x44, 0x55, 0xa0, 0xae, 0xab,
+  0xfa, 0x1e, 0x18, 0x7a, 0xb3, 0xaf, 0x8a, 0xa4, 0x04, 0x4c, 0x3f, 0xb8, 0xe5, 0xbd, 0x98, 0x00,
+  0x4c, 0x51, 0x57, 0xad, 0xa9, 0xe8, 0x86, 0x84, 0x11, 0xe3, 0xc8, 0x1e, 0x18, 0x31, 0x31, 0x2f,
+  0x25, 0xe7, 0x1a, 0xa5, 0x7e, 0x1f, 0x13, 0xda, 0xb1, 0x72, 0x1b, 0x8f, 0xf3, 0x01, 0xfc, 0x8c,
+  0x6f, 0x1e, 0x3d, 0x80, 0x3b, 0x2c, 0x1c, 0xdd, 0x45, 0x77, 0x32, 0x9c, 0x33, 0xbc, 0x28, 0xd0,
+  0xa0, 0x8e, 0xf4, 0x7f, 0x16, 0x2a, 0x2c, 0x30, 0xb2, 0x01, 0xc1, 0x97, 0xe3, 0xc9, 0x46, 0x02,
+  0x8f, 0x0b, 0xce, 0x91, 0xc0, 0xe3, 0x82, 0xf7, 0xe9, 0x64, 0x37, 0xfd, 0x44, 0xa7, 0xa3, 0x20,
+  0x89, 0xe8, 0x3e, 0xed, 0x4b, 0x6a, 0x74, 0x26, 0x0a, 0xb2, 0x64, 0x14, 0xa4, 0x31, 0xd9, 0xa4,
+  0x48, 0xb4, 0x40, 0xa2, 0x20, 0x9b, 0xf4, 0x10, 0x1b, 0x06, 0x45, 0xd2, 0xa9, 0x28, 0x48, 0x53,
+  0x51, 0x90, 0xc6, 0x55, 0x29, 0x22, 0x13, 0x05, 0x64, 0x96, 0x88, 0x82, 0x34, 0x89, 0x7e, 0x93,
+  0xe9, 0x74, 0x14, 0x90, 0x04, 0x2a, 0x93, 0xf8, 0x7c, 0x54, 0xfb, 0xf3, 0xf1, 0x08, 0x4d, 0xdd,
+  0x82, 0x2e, 0x4d, 0xfa, 0x17, 0x7f, 0x3a, 0xe3, 0x54, 0xc3, 0x3c, 0x38, 0xce, 0x03, 0xdd, 0x52,
+  0x80, 0x29, 0x2d, 0x60, 0x14, 0x4f, 0x23, 0x27, 0x42, 0x46, 0x43, 0xe2, 0x9d, 0xb3, 0xa3, 0xee,
+  0x78, 0x85, 0xa1, 0x61, 0x3a, 0xe2, 0x81, 0x20, 0xe9, 0x86, 0x97, 0x29, 0xe4, 0x1a, 0x95, 0x76,
+  0xb7, 0xd6, 0xaf, 0x36, 0x4f, 0x97, 0xe3, 0x1e, 0xb3, 0x65, 0x59, 0xdd, 0xf0, 0xf7, 0x3d, 0x13,
+  0x4a, 0x0a, 0x0b, 0xf5, 0xe9, 0x5d, 0x14, 0x20, 0x03, 0xfb, 0x03, 0xb8, 0xcb, 0x33, 0x32, 0x3a,
+  0x90, 0xf3, 0x51, 0xa0, 0x30, 0xa6, 0xa5, 0x33, 0x32, 0x26, 0xef, 0xbb, 0x28, 0x10, 0x2c, 0x85,
+  0x43, 0x06, 0x17, 0x75, 0xc3, 0xef, 0xab, 0x15, 0x31, 0xd3, 0x92, 0x94, 0x69, 0xd4, 0x19, 0x06,
+  0xe5, 0x9d, 0xd0, 0x7d, 0x83, 0x39, 0x73, 0x2e, 0x29, 0x86, 0xaa, 0x1c, 0x5a, 0xea, 0xa9, 0x82,
+  0x09, 0xf5, 0x28, 0x90, 0x91, 0xc9, 0x4e, 0x51, 0x25, 0x03, 0xee, 0x5b, 0x61, 0x9c, 0xc2, 0x37,
+  0xc0, 0x6f, 0x23, 0x13, 0x09, 0xe4, 0x41, 0x28, 0xcf, 0x6c, 0xa0, 0x1e, 0x3e, 0x34, 0xd3, 0x85,
+  0xa6, 0xae, 0x46, 0x81, 0xc6, 0x98, 0x26, 0xd4, 0x15, 0xc8, 0xef, 0x1b, 0x51, 0xed, 0x1a, 0x27,
+  0x6d, 0x90, 0x81, 0x6d, 0xb4, 0xd0, 0x76, 0xeb, 0x94, 0x3e, 0x34, 0x70, 0x74, 0x4c, 0xe0, 0x18,
+  0xdd, 0x54, 0x55, 0xe7, 0xc4, 0xb3, 0x6f, 0x4a, 0x51, 0x6f, 0x68, 0x05, 0xab, 0x0a, 0xc1, 0x0f,
+  0x00, 0x6b, 0x27, 0x0f, 0xcd, 0x14, 0x90, 0x48, 0x22, 0x71, 0x20, 0xff, 0xc3, 0x30, 0x0a, 0x28,
+  0xa7, 0xc1, 0x7d, 0x0b, 0x58, 0xd1, 0x98, 0x53, 0x78, 0x5c, 0xe9, 0x06, 0xb4, 0x3d, 0x33, 0xfa,
+  0x52, 0x32, 0xee, 0x9f, 0x2d, 0x1e, 0x5d, 0x09, 0x6c, 0x49, 0xca, 0xdc, 0xd5, 0x64, 0x6f, 0xa1,
+  0xaa, 0xa6, 0x08, 0x76, 0x86, 0x3c, 0x23, 0x8a, 0xb6, 0x23, 0x08, 0x0c, 0x4d, 0x87, 0xcc, 0x01,
+  0x8f, 0x33, 0x0c, 0xe2, 0xa4, 0xcd, 0x44, 0x60, 0x9b, 0x3d, 0xd3, 0xe2, 0xe6, 0xd2, 0xa1, 0x99,
+  0x06, 0xe2, 0x9c, 0x76, 0x47, 0xa2, 0x80, 0x01, 0xac, 0x64, 0x02, 0x43, 0x64, 0x74, 0x0d, 0xea,
+  0xfb, 0x36, 0x0c, 0x5c, 0xe5, 0x96, 0x36, 0x24, 0xa8, 0xeb, 0x8c, 0x8b, 0xac, 0xa1, 0xb9, 0x82,
+  0x50, 0x01, 0x1e, 0xba, 0xc7, 0x9c, 0xd1, 0x6e, 0xfa, 0xd0, 0x16, 0xae, 0x7a, 0x4b, 0x5b, 0x50,
+  0xd7, 0xa0, 0x62, 0x4a, 0x0a, 0x04, 0xe5, 0xfb, 0xde, 0xa1, 0x4d, 0x6f, 0x5b, 0x2b, 0xc9, 0x14,
+  0x55, 0xcb, 0x04, 0x86, 0xa9, 0x43, 0x66, 0xee, 0x6a, 0x70, 0x5f, 0xff, 0x86, 0x89, 0xcb, 0xcb,
+  0x16, 0x04, 0x2d, 0x67, 0xd5, 0xec, 0x1a, 0x44, 0x5d, 0x98, 0xea, 0x8c, 0xa4, 0x44, 0x81, 0xa2,
+  0xee, 0x48, 0xde, 0x4d, 0x24, 0x16, 0xc4, 0x55, 0xfc, 0xa8, 0xd1, 0x6f, 0xfb, 0xfc, 0x56, 0xf1,
+  0xac, 0xd7, 0xcf, 0xf5, 0x4b, 0xe0, 0x35, 0xd7, 0xad, 0xe5, 0xf2, 0x8d, 0x52, 0xef, 0x5b, 0x85,
+  0x32, 0x19, 0x9a, 0x88, 0xc5, 0x2d, 0x21, 0xb2, 0x3e, 0xe5, 0x25, 0x05, 0xf9, 0x06, 0x3c, 0x01,
+  0xc5, 0x92, 0xe5, 0xc7, 0xa3, 0x32, 0xaa, 0x2e, 0x4d, 0xd1, 0x61, 0x05, 0x0b, 0xa1, 0xbe, 0x25,
+  0x0e, 0xaa, 0xf0, 0xa8, 0xfd, 0x6c, 0xae, 0x4f, 0x0b, 0xf4, 0xd0, 0xf5, 0x57, 0x24, 0x0e, 0xc5,
+  0x88, 0xd3, 0x8f, 0x6d, 0x41, 0x30, 0xa0, 0x39, 0x02, 0x4f, 0x20, 0xf0, 0xe3, 0xd8, 0xff, 0x23,
+  0xd6, 0x22, 0x22, 0xb5, 0xd0, 0xc9, 0x57, 0xc9, 0x40, 0xb6, 0x9c, 0x29, 0xf2, 0xe5, 0x7a, 0xb2,
+  0xf7, 0xc7, 0xe3, 0xef, 0x32, 0x63, 0x98, 0x4d, 0xd5, 0x32, 0xa0, 0x4f, 0xb3, 0xfb, 0x6f, 0x3e,
+  0xad, 0x1e, 0x44, 0xf8, 0x02, 0x16, 0x5d, 0x9e, 0x80, 0x63, 0x03, 0x39, 0x2e, 0xb6, 0x57, 0x91,
+  0xa0, 0x02, 0xb6, 0xe8, 0xe2, 0x5b, 0xa0, 0xc0, 0x70, 0x22, 0xc2, 0xcb, 0xcf, 0x7e, 0x3b, 0x9a,
+  0x3d, 0x0e, 0x6c, 0x82, 0x0a, 0x1c, 0x87, 0x73, 0xe5, 0x18, 0x17, 0x2a, 0x4a, 0x86, 0x89, 0x36,
+  0x1c, 0x1f, 0x6c, 0xb8, 0x4a, 0xf9, 0x4e, 0xc5, 0x09, 0x66, 0x35, 0xc8, 0xe3, 0x29, 0x2f, 0x32,
+  0x26, 0xe3, 0x3b, 0xed, 0x7b, 0xfd, 0x45, 0x17, 0x1a, 0x96, 0x6c, 0x1a, 0x9e, 0x41, 0xa0, 0x22,
+  0x3b, 0xad, 0xd1, 0x5e, 0x6b, 0x70, 0x02, 0xe8, 0xa8, 0xb8, 0x2d, 0xb6, 0x0f, 0x55, 0x7d, 0x0e,
+  0x75, 0xc3, 0xb7, 0x4d, 0xbb, 0xc4, 0x8b, 0x05, 0x2d, 0x34, 0x80, 0x4f, 0x9f, 0xfd, 0xbe, 0x36,
+  0x19, 0x49, 0xe9, 0x8b, 0x88, 0xab, 0xe6, 0x2d, 0x63, 0xe3, 0x8f, 0x34, 0x4d, 0x57, 0x91, 0x52,
+  0x56, 0x52, 0xa6, 0x5d, 0xcb, 0x43, 0x3b, 0xdf, 0xba, 0x4c, 0xf3, 0xb9, 0x42, 0xbd, 0xd2, 0x6d,
+  0x0f, 0x5a, 0x45, 0x5b, 0x52, 0x03, 0xbd, 0x52, 0xa3, 0x54, 0xf8, 0x1e, 0xc7, 0x28, 0xc4, 0x77,
+  0x30, 0xad, 0x1f, 0xdb, 0xc5, 0xf0, 0xe6, 0x15, 0x0e, 0xf4, 0x90, 0xd8, 0x51, 0x29, 0x2e, 0xf6,
+  0x18, 0xac, 0xa0, 0x09, 0xb4, 0xbe, 0x3b, 0x26, 0x40, 0x6c, 0x7b, 0x67, 0x0c, 0xa3, 0x21, 0x19,
+  0x66, 0x4c, 0x87, 0xc8, 0x40, 0x1a, 0xba, 0xdb, 0x4d, 0xf0, 0x9d, 0xc7, 0xef, 0xe4, 0x0c, 0xb0,
+  0xbc, 0x6d, 0xc5, 0xbb, 0x01, 0xd8, 0xb1, 0x74, 0x2c, 0x00, 0x7b, 0xc4, 0x08, 0x85, 0xbb, 0xa5,
+  0xe7, 0x1d, 0xfd, 0xcd, 0xe3, 0x61, 0x78, 0x3e, 0xb8, 0xfd, 0x2f, 0x00, 0x22, 0xe9, 0xfa, 0xa6,
+  0x26, 0x4e, 0x47, 0x79, 0xbe, 0x89, 0x33, 0xf3, 0xa2, 0x33, 0x2b, 0xa4, 0xb3, 0x77, 0x74, 0x45,
+  0x21, 0x5f, 0x47, 0xb1, 0x6f, 0x25, 0xda, 0x4e, 0xae, 0x55, 0x6a, 0xec, 0x8e, 0x24, 0xbf, 0x0c,
+  0xc5, 0xee, 0xf4, 0xb0, 0xd2, 0x89, 0x47, 0x1d, 0x9a, 0x52, 0x89, 0xc7, 0xf3, 0xb9, 0xe7, 0x9a,
+  0x61, 0xa0, 0x43, 0xd3, 0xd2, 0x15, 0xaf, 0x5b, 0xcf, 0x81, 0xa9, 0x7a, 0x9d, 0xed, 0xaf, 0xa3,
+  0x3f, 0xb7, 0xe6, 0xfa, 0x68, 0x7a, 0x4c, 0x75, 0x3a, 0x95, 0xdd, 0x44, 0x18, 0x05, 0x4e, 0x9f,
+  0x76, 0xaa, 0xec, 0xc7, 0x9b, 0x5a, 0xc8, 0x61, 0x6d, 0xf3, 0x75, 0x0d, 0xd8, 0x9a, 0xe9, 0x33,
+  0xc3, 0x89, 0xc7, 0x41, 0x69, 0x09, 0xf5, 0xcd, 0xee, 0xe4, 0x82, 0x25, 0x2d, 0xc1, 0x92, 0x65,
+  0xa0, 0x43, 0x7c, 0x65, 0x14, 0xfb, 0x72, 0x63, 0xdf, 0x0f, 0x03, 0x4b, 0x46, 0xce, 0xc1, 0x19,
+  0xf7, 0xe4, 0x08, 0xd2, 0x65, 0x8e, 0x7c, 0x76, 0x70, 0x3e, 0xba, 0xe5, 0xbb, 0x70, 0x6c, 0xaf,
+  0x5c, 0x7e, 0xc2, 0xc7, 0xb4, 0xc7, 0xd3, 0x05, 0xeb, 0xd9, 0x4f, 0xc2, 0x3b, 0x06, 0x3c, 0x94,
+  0x4c, 0x31, 0x27, 0xcb, 0x7b, 0x78, 0xc6, 0x25, 0xf2, 0x46, 0xaa, 0x1e, 0x08, 0x90, 0xee, 0x41,
+  0x15, 0x00, 0x73, 0x72, 0xa8, 0x07, 0x92, 0x81, 0x4f, 0xde, 0x26, 0x52, 0x1e, 0xe0, 0xe3, 0x1c,
+  0xf2, 0xdb, 0xc0, 0xc7, 0x3f, 0x05, 0xcc, 0xa1, 0x66, 0x9e, 0x92, 0xe6, 0xf4, 0x12, 0x69, 0xfe,
+  0xd6, 0xbd, 0x53, 0x7f, 0x92, 0xf8, 0xcf, 0x61, 0xe0, 0x7d, 0x83, 0xd8, 0xab, 0x0e, 0x19, 0x13,
+  0xba, 0x20, 0x1d, 0x63, 0xc1, 0xa6, 0xe6, 0x93, 0x8a, 0xbf, 0xc4, 0x5a, 0x2e, 0x76, 0x73, 0x15,
+  0xf0, 0x03, 0x28, 0x76, 0xdb, 0x1d, 0x50, 0xae, 0x35, 0x4a, 0xa0, 0x9a, 0x6b, 0x15, 0x1b, 0xb5,
+  0x56, 0xe5, 0xfb, 0xa8, 0xf1, 0x0e, 0xae, 0x5b, 0xe0, 0x29, 0x98, 0x50, 0x0e, 0xa5, 0xdc, 0x84,
+  0x7d, 0x78, 0x8b, 0xd8, 0x61, 0x09, 0x39, 0xe7, 0xa3, 0xb5, 0x01, 0x15, 0xa8, 0x87, 0xee, 0x76,
+  0xa1, 0x03, 0xee, 0xa2, 0x20, 0x04, 0xc3, 0xe0, 0xe9, 0xa3, 0x67, 0x2e, 0x20, 0x76, 0xf7, 0x86,
+  0x8a, 0x59, 0xb4, 0x75, 0x3a, 0x21, 0x0f, 0x8a, 0x5d, 0xc0, 0x3d, 0x5c, 0x77, 0x0f, 0xd9, 0x4d,
+  0x5c, 0xb7, 0x74, 0x4b, 0x86, 0xcc, 0x12, 0x1d, 0x0d, 0x42, 0x3e, 0xdd, 0xf2, 0x6d, 0x76, 0xb7,
+  0xa5, 0x7d, 0x63, 0xcb, 0xaa, 0xf6, 0x5d, 0x91, 0x71, 0xae, 0x57, 0x3b, 0x6a, 0x87, 0x31, 0x9e,
+  0x31, 0x99, 0x3e, 0x76, 0x72, 0x86, 0xba, 0xed, 0x38, 0x16, 0x93, 0xa1, 0x32, 0x35, 0x45, 0xf0,
+  0x11, 0x10, 0x7e, 0x3b, 0xad, 0xcb, 0xd9, 0xcc, 0xaf, 0x36, 0x72, 0x3b, 0x0b, 0xda, 0xed, 0xbe,
+  0x84, 0xbf, 0x9f, 0xe0, 0x85, 0x69, 0x7d, 0xd0, 0x69, 0xb4, 0x73, 0x45, 0xf0, 0x03, 0xa8, 0x35,
+  0x73, 0x95, 0x12, 0x40, 0x3f, 0xbe, 0x03, 0xe5, 0xef, 0x99, 0x85, 0x6b, 0xa8, 0x68, 0x6c, 0xbe,
+  0xec, 0x02, 0xf3, 0xa1, 0xdf, 0xff, 0x1e, 0xe0, 0x87, 0x18, 0x72, 0x67, 0x89, 0x19, 0x26, 0xa3,
+  0x9b, 0x98, 0xd9, 0x85, 0xee, 0x6c, 0x6f, 0xbd, 0xbb, 0xb0, 0x1f, 0x26, 0x19, 0x19, 0xea, 0x66,
+  0xe8, 0xae, 0x23, 0x43, 0xc6, 0xd8, 0xd9, 0x5c, 0x01, 0x83, 0xdc, 0x59, 0x24, 0xde, 0x76, 0x3c,
+  0xfc, 0xad, 0x77, 0xce, 0x0e, 0xcc, 0xe5, 0x6a, 0x89, 0xc2, 0x5e, 0xc7, 0x48, 0x40, 0x86, 0x48,
+  0x30, 0x54, 0xe0, 0x0a, 0xa0, 0x11, 0x75, 0xf1, 0x8b, 0xd0, 0x09, 0xe3, 0x42, 0x6f, 0x63, 0xaa,
+  0x82, 0x6d, 0x24, 0x4f, 0xfe, 0xd4, 0x88, 0xdd, 0xa8, 0xbd, 0xe7, 0xc4, 0x9d, 0xe1, 0x22, 0xe4,
+  0xd3, 0xe3, 0xa3, 0xc2, 0x2e, 0xe0, 0x01, 0xb0, 0xcf, 0xee, 0x49, 0x6e, 0x56, 0x13, 0xc3, 0xaa,
+  0xa2, 0x98, 0x63, 0x75, 0x41, 0x47, 0x2f, 0x64, 0x77, 0xb9, 0x7b, 0xbc, 0x0d, 0xe2, 0xc1, 0xc9,
+  0xd1, 0x0f, 0x22, 0x0e, 0xf1, 0x70, 0x2b, 0x48, 0x67, 0xe3, 0xfe, 0x5e, 0x3d, 0x44, 0x46, 0xbc,
+  0xef, 0x05, 0x6b, 0x6f, 0x41, 0xfb, 0x5e, 0x00, 0x5d, 0x06, 0xb2, 0x1b, 0x41, 0xa2, 0x53, 0x6a,
+  0x61, 0x8f, 0x7c, 0x3f, 0xc2, 0xf9, 0x72, 0x89, 0x96, 0x0c, 0x9d, 0x03, 0x4f, 0x00, 0xc6, 0x4c,
+  0x64, 0xd1, 0x46, 0x2c, 0x0f, 0x9d, 0x4d, 0x3d, 0x4b, 0xc3, 0x97, 0xc2, 0xd1, 0x3f, 0x39, 0x03,
+  0x49, 0x27, 0x83, 0x6e, 0xc3, 0x5e, 0xdd, 0xbf, 0xc4, 0xee, 0x5c, 0x40, 0xdb, 0x72, 0xa9, 0x58,
+  0xeb, 0xb7, 0xbb, 0xa0, 0xd6, 0xaa, 0xf5, 0x6b, 0xb9, 0x46, 0x6d, 0x92, 0xfb, 0xae, 0xc2, 0xb6,
+  0x17, 0x8b, 0xde, 0xfb, 0x74, 0x7b, 0x75, 0xcd, 0xb9, 0x0d, 0xfc, 0x50, 0xca, 0xcb, 0x71, 0x1c,
+  0x15, 0x0f, 0x96, 0x79, 0x76, 0x65, 0x50, 0x75, 0xe4, 0x39, 0x09, 0xd7, 0x66, 0xe8, 0x8e, 0x3a,
+  0x7f, 0x82, 0x73, 0xd5, 0xb2, 0x0d, 0x72, 0x4f, 0x47, 0xa6, 0xc1, 0xc7, 0xa0, 0xc2, 0xb6, 0xcd,
+  0xee, 0x50, 0xda, 0x36, 0x13, 0x5e, 0x68, 0xc8, 0x57, 0xd7, 0xb1, 0xfb, 0xe8, 0xab, 0x76, 0x3a,
+  0xfe, 0x38, 0xf6, 0xff, 0xe8, 0xaf, 0x76, 0x3a, 0xe9, 0xc1, 0xc1, 0x1d, 0xec, 0xf1, 0x12, 0x3b,
+  0x3e, 0x78, 0x39, 0x9e, 0x9b, 0x95, 0x43, 0x29, 0x2f, 0x8a, 0x0f, 0x5f, 0x62, 0xd8, 0xfb, 0x11,
+  0x3c, 0x81, 0x26, 0x63, 0x8a, 0x31, 0x47, 0x47, 0xb0, 0x47, 0xc5, 0x7b, 0x74, 0x4d, 0x24, 0xb8,
+  0xee, 0xa9, 0x14, 0x82, 0xbd, 0x32, 0x83, 0xc4, 0x90, 0x43, 0xff, 0x55, 0x99, 0xdf, 0xe1, 0x7a,
+  0xdf, 0xd8, 0xe9, 0x5a, 0x75, 0x4f, 0xc9, 0x7e, 0x8d, 0xda, 0xfd, 0x8d, 0xa3, 0x8e, 0x3d, 0x5e,
+  0x7f, 0xc6, 0xde, 0x3b, 0x6f, 0xde, 0x85, 0x63, 0x88, 0xee, 0x0a, 0xf6, 0x15, 0x94, 0x53, 0xc0,
+  0x11, 0x70, 0xf7, 0x3b, 0x1f, 0x7e, 0x13, 0x30, 0x0e, 0xdb, 0x5b, 0x6c, 0xe4, 0x21, 0x4a, 0x10,
+  0x07, 0xd4, 0xe3, 0xd9, 0x1a, 0x63, 0x2f, 0x61, 0xfa, 0x57, 0xf1, 0xc5, 0xc8, 0x81, 0x0e, 0x77,
+  0xad, 0xdf, 0x83, 0xd0, 0xe1, 0xd1, 0x55, 0x24, 0x0c, 0xde, 0x03, 0xd7, 0x64, 0xc6, 0xf7, 0x68,
+  0x0f, 0x3f, 0x9e, 0x81, 0x3c, 0xde, 0x43, 0x1e, 0x1f, 0x20, 0x8f, 0x8f, 0x20, 0x8f, 0x6f, 0x81,
+  0x7c, 0x3a, 0x49, 0xc1, 0x3a, 0x0a, 0xaf, 0x94, 0x77, 0x52, 0xdf, 0x80, 0xa6, 0xa5, 0xa1, 0xca,
+  0x48, 0x5d, 0xeb, 0xad, 0xf9, 0xab, 0x28, 0x3f, 0x9a, 0xed, 0x41, 0xaf, 0x04, 0x7e, 0x00, 0xfd,
+  0xf6, 0xa0, 0x50, 0x05, 0x95, 0x52, 0xaf, 0x3f, 0xe8, 0x7e, 0xbf, 0x53, 0x93, 0x5b, 0x07, 0xe2,
+  0x1e, 0xa8, 0x97, 0x2b, 0xdb, 0xb4, 0xb4, 0x8f, 0x4c, 0x75, 0x89, 0x35, 0xef, 0x0a, 0xde, 0x5d,
+  0x60, 0x2d, 0x76, 0x29, 0x9f, 0x75, 0xbd, 0x40, 0xfa, 0x6d, 0x5e, 0x5d, 0x29, 0xe7, 0xd6, 0xf6,
+  0x91, 0x12, 0xfd, 0xf4, 0x6c, 0x8f, 0xd5, 0xa9, 0x6e, 0x3d, 0x3a, 0x44, 0xf7, 0x73, 0xa0, 0x62,
+  0x8e, 0xce, 0x94, 0x1b, 0xbb, 0xca, 0x8d, 0x4f, 0xcb, 0x5d, 0x3a, 0xd9, 0x7c, 0xf9, 0xa6, 0x01,
+  0xa3, 0x03, 0xd0, 0xd9, 0x01, 0x23, 0x09, 0xfe, 0x30, 0x6a, 0x7f, 0x35, 0xd4, 0x19, 0xf6, 0xc1,
+  0xaf, 0xdd, 0x58, 0x00, 0xf7, 0x2e, 0xf4, 0x04, 0xf1, 0x0f, 0x7e, 0xe3, 0x46, 0x88, 0xbb, 0xca,
+  0xf8, 0x46, 0xfe, 0x11, 0x79, 0x02, 0xfc, 0xfa, 0x3c, 0x23, 0x40, 0x45, 0x36, 0x57, 0x80, 0xfd,
+  0xde, 0xb3, 0x7a, 0x2b, 0xcb, 0xf8, 0xe5, 0x29, 0xc1, 0xd2, 0x02, 0x0e, 0xf4, 0x27, 0x74, 0xef,
+  0xb1, 0x1f, 0x7c, 0x7b, 0xd3, 0xe7, 0xd4, 0x09, 0xbf, 0x68, 0xeb, 0x38, 0x48, 0x1e, 0x3e, 0x8c,
+  0x5e, 0x5a, 0x03, 0x30, 0x86, 0xcb, 0x1e, 0xce, 0xfe, 0x88, 0xab, 0x91, 0xe1, 0x80, 0xb3, 0x99,
+  0x4d, 0xc8, 0xb8, 0x86, 0xbd, 0xff, 0xda, 0x75, 0x3f, 0xb9, 0xfd, 0xa3, 0x6e, 0x64, 0x2b, 0x76,
+  0xb1, 0x60, 0xd3, 0x57, 0x20, 0xb1, 0xe2, 0xb6, 0x83, 0x09, 0xf6, 0x84, 0x68, 0xdd, 0xe5, 0x7d,
+  0x08, 0xd7, 0x51, 0xfe, 0x07, 0xe2, 0x84, 0x0a, 0xc2, 0xc9, 0xa5, 0x49, 0xf4, 0x1d, 0x64, 0x30,
+  0x2e, 0x2e, 0xe1, 0x9d, 0xbc, 0x0a, 0xf1, 0xae, 0x0a, 0xd4, 0x51, 0x05, 0xf2, 0xf3, 0x0d, 0xcd,
+  0x06, 0x98, 0x1c, 0xb1, 0xbc, 0x29, 0x6e, 0x34, 0xd5, 0x0c, 0xf9, 0x56, 0x03, 0xbb, 0x30, 0x8d,
+  0x94, 0x8b, 0x3f, 0xda, 0x9d, 0xdf, 0xbd, 0x88, 0x5e, 0x57, 0x71, 0xec, 0xad, 0x38, 0xf6, 0xad,
+  0x17, 0x7e, 0xbc, 0xd8, 0xfd, 0x2b, 0x64, 0xd6, 0x2f, 0xbf, 0x1e, 0x63, 0xc2, 0x63, 0xba, 0x66,
+  0x8b, 0xf2, 0x5f, 0x9e, 0xe0, 0x87, 0x1f, 0x80, 0x7b, 0xef, 0xfa, 0x3e, 0x8b, 0xd5, 0xb5, 0xb1,
+  0x1d, 0xad, 0xad, 0x0b, 0x9b, 0x9b, 0x67, 0x83, 0x3b, 0x5a, 0x66, 0x17, 0x36, 0xb9, 0x60, 0x7a,
+  0xbf, 0xbc, 0xd9, 0x5d, 0xb9, 0xe1, 0x05, 0x36, 0xf1, 0x4b, 0xf2, 0x92, 0xc0, 0x46, 0xaf, 0xd8,
+  0x0c, 0x2f, 0xf2, 0x21, 0x7b, 0xf2, 0x77, 0xbc, 0xe4, 0x8a, 0xc9, 0xff, 0x35, 0x39, 0x86, 0x23,
+  0xdd, 0x5a, 0xba, 0x8e, 0x56, 0xcd, 0xdf, 0x1e, 0xcb, 0x38, 0x33, 0x28, 0x1c, 0xd7, 0xbd, 0x80,
+  0x6d, 0x6f, 0x88, 0x8f, 0x78, 0x86, 0x18, 0xf7, 0x65, 0x96, 0xe7, 0x50, 0x7d, 0xdd, 0x41, 0x7a,
+  0xe7, 0xc8, 0xa0, 0xc0, 0xd5, 0xae, 0xf4, 0x29, 0x5b, 0x7b, 0xef, 0xee, 0xdc, 0x0d, 0x03, 0x73,
+  0x01, 0xc5, 0x13, 0x84, 0x82, 0x93, 0x11, 0x31, 0x32, 0xea, 0xfc, 0x92, 0x94, 0x50, 0x02, 0x85,
+  0xb1, 0xdf, 0x15, 0x0b, 0x87, 0x6f, 0x5c, 0xc2, 0x3b, 0xe0, 0x3b, 0x00, 0xb7, 0x13, 0xd2, 0x0d,
+  0x87, 0xf4, 0xaf, 0x3c, 0xa8, 0xff, 0xb2, 0x67, 0xf3, 0x5f, 0xf6, 0x7c, 0x7e, 0x01, 0x7b, 0x48,
+  0x73, 0xd2, 0x41, 0xae, 0xb5, 0x58, 0x5b, 0xe2, 0xd2, 0x12, 0xed, 0xe7, 0xdd, 0x4f, 0x49, 0x74,
+  0x95, 0x42, 0x66, 0xa7, 0x9b, 0xda, 0xeb, 0xa0, 0x5c, 0x6d, 0x7d, 0x05, 0x38, 0x7f, 0xfd, 0x8e,
+  0xbb, 0xff, 0x01, 0xca, 0x9d, 0x6f, 0xe2, 0xb4, 0xbf, 0xf2, 0x7e, 0x0f, 0x15, 0xfe, 0xe6, 0xed,
+  0xfe, 0xc3, 0x39, 0xb9, 0xf3, 0xb2, 0xd0, 0xfc, 0xe5, 0x7a, 0xa1, 0x82, 0xf8, 0x16, 0xf9, 0xf6,
+  0xdb, 0x50, 0xf9, 0x1d, 0x95, 0xee, 0xb9, 0xd6, 0x6b, 0xae, 0x87, 0x2c, 0xe3, 0xc3, 0x5a, 0xab,
+  0x02, 0x86, 0xb5, 0x7e, 0x15, 0x74, 0xdb, 0xfd, 0xef, 0xab, 0x76, 0x3f, 0x21, 0x2d, 0x3f, 0xbd,
+  0xbb, 0xb9, 0x46, 0x46, 0x51, 0xb9, 0x87, 0x8c, 0x22, 0xe8, 0xfa, 0xc4, 0xb1, 0x9b, 0xd6, 0x63,
+  0x60, 0x85, 0x2e, 0xe4, 0xcc, 0x90, 0x7d, 0xab, 0xc3, 0xcd, 0xf2, 0xa2, 0xc7, 0xac, 0xec, 0xa2,
+  0xda, 0xdd, 0x5c, 0xc7, 0x0c, 0x66, 0x79, 0x41, 0x1f, 0xed, 0x14, 0xdc, 0x47, 0xb7, 0x0a, 0x79,
+  0x99, 0x6c, 0xf4, 0x94, 0x81, 0xfa, 0xdb, 0x08, 0x62, 0xf6, 0x55, 0xf0, 0xd0, 0x91, 0xca, 0xfc,
+  0xbd, 0xcd, 0x72, 0x3a, 0x35, 0xa4, 0xf2, 0xcd, 0x10, 0x01, 0x35, 0x0f, 0xad, 0xdf, 0x9f, 0x36,
+  0x7f, 0x7f, 0xa9, 0xfd, 0xdf, 0x04, 0xec, 0xd3, 0xfc, 0xd0, 0xb1, 0x38, 0x1c, 0x1b, 0x8d, 0x6c,
+  0x3b, 0xc4, 0xfb, 0xa0, 0x0d, 0xd7, 0x0d, 0xa0, 0xba, 0xb3, 0x42, 0x1c, 0x43, 0x70, 0x8c, 0x13,
+  0x81, 0x20, 0x7c, 0xc7, 0x88, 0x28, 0xc6, 0xb6, 0x0f, 0x9c, 0x37, 0x6a, 0x45, 0xcf, 0x69, 0x7d,
+  0xce, 0x7d, 0x1c, 0x9f, 0x7e, 0x74, 0xa1, 0x21, 0xe8, 0x63, 0xf5, 0xf8, 0x72, 0x94, 0x8f, 0x58,
+  0xe4, 0x3f, 0xd7, 0xd0, 0x30, 0x55, 0x1d, 0xfe, 0x32, 0x3a, 0x5a, 0xdb, 0x9c, 0xdf, 0xef, 0xe6,
+  0x5a, 0xbd, 0x72, 0xbb, 0xdb, 0xc4, 0x2b, 0x17, 0x94, 0x07, 0x2d, 0xec, 0xa6, 0xd6, 0xfb, 0x6e,
+  0x6b, 0xf8, 0x28, 0x74, 0x81, 0xcf, 0xfa, 0x75, 0xd9, 0x7d, 0x8e, 0x89, 0x3a, 0x02, 0xb2, 0x44,
+  0x18, 0xfc, 0x0e, 0x24, 0x52, 0xc4, 0xb7, 0x68, 0xb0, 0xf7, 0x1d, 0x39, 0x58, 0x8e, 0x7c, 0xf5,
+  0xc4, 0xd2, 0x62, 0xba, 0xa3, 0xe4, 0xe3, 0x7e, 0xfc, 0x0e, 0x2d, 0xa9, 0x1d, 0xe3, 0xfe, 0xd1,
+  0x97, 0xcc, 0x1f, 0x7c, 0x49, 0xf7, 0xd1, 0xbf, 0x95, 0x3d, 0xb9, 0xdf, 0xd0, 0x8c, 0xb3, 0x16,
+  0x1e, 0xfc, 0x5a, 0xbf, 0x6e, 0x99, 0xfa, 0x48, 0x76, 0xbb, 0x11, 0x07, 0xae, 0x4c, 0x3f, 0xb9,
+  0x6e, 0x3f, 0x80, 0xc7, 0x40, 0xc3, 0xe0, 0x5e, 0xc0, 0xb5, 0x1b, 0x8e, 0x3a, 0xc0, 0xfe, 0xda,
+  0xf9, 0xc9, 0xb1, 0x68, 0x7a, 0xcc, 0xa1, 0xef, 0xdd, 0x7d, 0x0b, 0x9f, 0x8a, 0xb7, 0xc7, 0x82,
+  0x67, 0xe8, 0x18, 0x69, 0xf7, 0x47, 0xfd, 0xf2, 0xa9, 0xfd, 0x9b, 0xaf, 0x17, 0x06, 0xaf, 0x36,
+  0x48, 0x7e, 0x85, 0x50, 0x78, 0x06, 0xb6, 0x9f, 0x90, 0xf8, 0x3d, 0xd6, 0xa8, 0x2b, 0x76, 0x8a,
+  0x0f, 0xab, 0xf8, 0xd5, 0x2d, 0xcf, 0xb7, 0xcd, 0xc5, 0x89, 0xb1, 0xf5, 0x2b, 0x70, 0x7e, 0x87,
+  0x42, 0xe1, 0xdc, 0x7d, 0x17, 0x7e, 0x77, 0x14, 0x8e, 0xc5, 0x97, 0xe5, 0xfd, 0xff, 0x75, 0xbd,
+  0x7d, 0x25, 0x42, 0x77, 0x31, 0x99, 0xfc, 0x71, 0xf9, 0x0d, 0x8e, 0x06, 0xd7, 0x6a, 0x29, 0xf0,
+  0x3d, 0x12, 0x5b, 0x1b, 0xf2, 0xea, 0xd0, 0x9c, 0x86, 0x92, 0xec, 0xd5, 0x14, 0x33, 0x64, 0xb8,
+  0x1c, 0x15, 0xc2, 0x27, 0x11, 0x5f, 0xdd, 0x55, 0x0e, 0x1a, 0x07, 0x74, 0xe5, 0xfa, 0xe8, 0x63,
+  0x04, 0x90, 0x5e, 0xbe, 0x61, 0x1c, 0x3b, 0x40, 0xb8, 0x8b, 0x07, 0xef, 0x00, 0x47, 0x40, 0xe3,
+  0xdf, 0x65, 0x61, 0x78, 0xfa, 0x79, 0x9e, 0xfb, 0xdc, 0xa6, 0xd2, 0xb8, 0x51, 0x95, 0xf1, 0xcb,
+  0xa8, 0x30, 0x7e, 0x19, 0xd5, 0xc5, 0xf7, 0x22, 0x7b, 0x1c, 0xe4, 0xec, 0xbf, 0x0b, 0xba, 0x47,
+  0x49, 0x01, 0xbc, 0x64, 0x7f, 0xff, 0xaf, 0x64, 0xff, 0xaf, 0x64, 0x7f, 0xb2, 0x7d, 0xba, 0x02,
+  0xc3, 0x79, 0xf3, 0x53, 0x7c, 0x9d, 0x97, 0xab, 0x8f, 0x97, 0xe6, 0x57, 0x7a, 0xe0, 0xfa, 0xf9,
+  0xcb, 0x5e, 0x15, 0xea, 0x75, 0x47, 0xcf, 0x77, 0x9e, 0xca, 0xe7, 0x6f, 0xa4, 0x7e, 0x67, 0x57,
+  0x4d, 0x1c, 0x08, 0x65, 0x77, 0xe0, 0xfc, 0xe1, 0x10, 0x0e, 0xe0, 0x17, 0xb8, 0x24, 0x75, 0x14,
+  0xd1, 0xcd, 0x47, 0xa2, 0xf4, 0xdc, 0xc8, 0xdc, 0x9d, 0xbb, 0xa7, 0xd0, 0xdc, 0xbf, 0xbe, 0x59,
+  0x45, 0xf4, 0xfd, 0xa8, 0xc3, 0x10, 0xd5, 0x55, 0xee, 0x24, 0x10, 0xdc, 0xb5, 0x04, 0x1c, 0x54,
+  0xdb, 0x97, 0x8d, 0xbb, 0xe2, 0xcd, 0x71, 0x8e, 0x2c, 0x1c, 0x38, 0x8e, 0xd3, 0xd8, 0x74, 0x5e,
+  0xc6, 0xee, 0x85, 0x76, 0x1d, 0x05, 0x1f, 0xdf, 0x4b, 0xfb, 0xca, 0xdb, 0x4c, 0x5f, 0x47, 0x97,
+  0x07, 0x1a, 0xec, 0x74, 0xdb, 0x85, 0x52, 0xaf, 0x87, 0x74, 0x9a, 0x28, 0x64, 0x4f, 0xb3, 0x93,
+  0xeb, 0xd6, 0x7a, 0xdf, 0x91, 0x22, 0x83, 0xc7, 0xe5, 0x3b, 0x2f, 0x3a, 0xbe, 0x4b, 0x1b, 0x89,
+  0x1c, 0xdd, 0xae, 0x0d, 0x40, 0xb6, 0xff, 0xa5, 0x61, 0x0c, 0x0b, 0xf3, 0x32, 0xfb, 0x56, 0xfd,
+  0xb3, 0xca, 0x1a, 0x57, 0x38, 0xcf, 0xe2, 0xb4, 0x3c, 0xd7, 0x10, 0x01, 0x0a, 0xb5, 0xe6, 0x9d,
+  0x7f, 0x54, 0x39, 0x26, 0x29, 0x0a, 0xd4, 0xab, 0xfd, 0x66, 0xc3, 0x87, 0xdf, 0xf8, 0x34, 0xb8,
+  0xbb, 0x87, 0xb7, 0xbf, 0xf7, 0x65, 0xff, 0xee, 0xa0, 0x7c, 0x0f, 0x27, 0x1d, 0x76, 0xaa, 0x38,
+  0x91, 0xf4, 0x9e, 0xdc, 0x37, 0xce, 0x0e, 0xf7, 0x1d, 0xfd, 0xaa, 0xcc, 0x54, 0x16, 0x21, 0xe8,
+  0x10, 0x82, 0x24, 0x66, 0xc8, 0x12, 0x07, 0x43, 0xe1, 0x98, 0xa1, 0xea, 0x66, 0x28, 0xc4, 0x44,
+  0x01, 0x8b, 0xad, 0x06, 0x4c, 0x0c, 0x45, 0x1e, 0x00, 0xf7, 0x80, 0xc5, 0x0f, 0xfe, 0x92, 0x0b,
+  0xce, 0x6f, 0xe2, 0x87, 0x70, 0x17, 0x7c, 0x41, 0xd5, 0x4b, 0x0c, 0x27, 0x86, 0x42, 0x08, 0x63,
+  0x41, 0x17, 0x3d, 0x6c, 0x40, 0x9f, 0x50, 0x91, 0x18, 0x0a, 0xa0, 0x70, 0xb8, 0xfe, 0xb6, 0xa7,
+  0x90, 0x36, 0x2e, 0x83, 0xa1, 0x44, 0x77, 0xc8, 0x8a, 0x39, 0x39, 0xb2, 0x77, 0x3f, 0xed, 0x23,
+  0x97, 0x8f, 0x01, 0x06, 0x4f, 0x08, 0xa3, 0xa1, 0x4c, 0x2c, 0x05, 0x51, 0x92, 0xf9, 0xd0, 0x69,
+  0x8b, 0xb7, 0x18, 0x60, 0x10, 0x16, 0xaf, 0x1a, 0x98, 0x6e, 0x29, 0x7b, 0xaa, 0xdb, 0x75, 0xdd,
+  0x9e, 0x9f, 0x43, 0xa7, 0xd1, 0xf5, 0xa6, 0x4b, 0x23, 0x8a, 0xa1, 0xdb, 0x86, 0xa1, 0xd0, 0x9b,
+  0xc5, 0x28, 0xa6, 0xb4, 0x85, 0xbc, 0x4d, 0x15, 0x67, 0xae, 0xb6, 0x20, 0xe3, 0x0b, 0x5a, 0x3b,
+  0xbf, 0x45, 0x37, 0x60, 0xdd, 0x6b, 0x27, 0xd8, 0xfd, 0xf0, 0x84, 0xe3, 0xda, 0xeb, 0xc9, 0x07,
+  0x55, 0x51, 0x60, 0x0f, 0xc5, 0xd3, 0x9d, 0xdb, 0xa7, 0xe5, 0x4b, 0x14, 0x48, 0x53, 0x45, 0xd5,
+  0xa1, 0x1d, 0x64, 0x16, 0xa5, 0xc6, 0xb8, 0xcd, 0x76, 0x13, 0x07, 0x45, 0x75, 0xa5, 0xd8, 0xc7,
+  0x5d, 0xc0, 0xa9, 0xda, 0x66, 0x17, 0x97, 0x0b, 0xed, 0x35, 0x38, 0x2b, 0x3a, 0x8f, 0x63, 0xcb,
+  0xa3, 0x57, 0xe6, 0x21, 0xa0, 0x97, 0xaa, 0xc8, 0x1b, 0x9f, 0xcd, 0xd2, 0x6f, 0xdd, 0xf9, 0xfb,
+  0xd4, 0x9e, 0xdc, 0x75, 0xb0, 0xeb, 0x3a, 0x1c, 0x22, 0x74, 0xc7, 0xf9, 0x5f, 0x73, 0x08, 0xbe,
+  0xa2, 0x00, 0xe2, 0xc7, 0x71, 0xc8, 0x7c, 0x2b, 0xfa, 0x5f, 0x57, 0xb8, 0x50, 0xd5, 0xee, 0xb0,
+  0x7d, 0xb9, 0xe2, 0x9a, 0x8b, 0x15, 0x9c, 0xb9, 0x8e, 0xe1, 0x7b, 0x61, 0x76, 0x74, 0x19, 0x49,
+  0x99, 0xbe, 0x58, 0x8c, 0x2c, 0x99, 0x78, 0xdb, 0x12, 0xa5, 0xa9, 0x78, 0x77, 0x5a, 0xfe, 0x60,
+  0x75, 0x70, 0x07, 0xee, 0xb0, 0x05, 0x07, 0xf7, 0xa0, 0xa3, 0xc7, 0x23, 0xf1, 0xbf, 0xd0, 0xca,
+  0xf9, 0x0b, 0x20, 0xd7, 0xc1, 0xf1, 0x27, 0x92, 0xb2, 0xe7, 0x5e, 0xb3, 0x64, 0x00, 0x4e, 0x5d,
+  0x68, 0x16, 0x0a, 0x3f, 0xa9, 0x22, 0x9f, 0x0a, 0x94, 0xc6, 0x60, 0xcf, 0xd1, 0xa3, 0xe8, 0xa6,
+  0x2f, 0x4e, 0xdb, 0x12, 0x05, 0x87, 0xd4, 0x72, 0xaa, 0xbe, 0x93, 0xa6, 0xb0, 0xb2, 0xcc, 0xf7,
+  0xd6, 0x2f, 0x6a, 0xa7, 0xbb, 0x6f, 0xc6, 0x61, 0x0c, 0x3e, 0xf7, 0xf9, 0xbc, 0x5b, 0x96, 0x9b,
+  0x0d, 0x05, 0x5e, 0x87, 0xb0, 0xef, 0x1d, 0x81, 0x27, 0x3f, 0xa6, 0xe2, 0xcb, 0xff, 0xa3, 0x27,
+  0x22, 0x9e, 0xc3, 0x6b, 0xae, 0x97, 0xe5, 0xfc, 0xf6, 0xd7, 0x63, 0x2e, 0xed, 0x77, 0x1b, 0xca,
+  0xc1, 0x7a, 0x15, 0x67, 0x4c, 0xb3, 0x2f, 0x2a, 0x02, 0xc9, 0xdc, 0xc7, 0xd7, 0x41, 0x59, 0xb7,
+  0x24, 0x65, 0xfa, 0x08, 0x18, 0x67, 0x63, 0x46, 0x8b, 0x17, 0x31, 0x2b, 0xf7, 0xb4, 0xe0, 0x60,
+  0x69, 0x40, 0x81, 0x6b, 0x13, 0x87, 0xdb, 0xf2, 0xb9, 0xa0, 0x88, 0xda, 0x8d, 0x71, 0x28, 0xce,
+  0x56, 0x28, 0x04, 0x75, 0xfd, 0x02, 0x33, 0x3c, 0x3b, 0x8a, 0xa7, 0xdd, 0x38, 0xc2, 0x80, 0x87,
+  0x32, 0x34, 0xe1, 0xb9, 0x41, 0x07, 0x78, 0x00, 0x1e, 0xf3, 0x31, 0xdc, 0x23, 0x1f, 0x86, 0x77,
+  0x36, 0x48, 0x83, 0xb3, 0x00, 0xae, 0x6a, 0xfb, 0x9c, 0xe4, 0xeb, 0xd7, 0x17, 0x1f, 0x32, 0x84,
+  0xba, 0x8e, 0xa1, 0xe2, 0x4d, 0xe2, 0xce, 0x26, 0xa9, 0x7d, 0xa5, 0xbb, 0x30, 0x26, 0x3b, 0x55,
+  0x86, 0x31, 0x1c, 0xbd, 0xce, 0x33, 0xa0, 0xb3, 0x27, 0xc7, 0x33, 0x1b, 0xb7, 0xb3, 0x7c, 0x9d,
+  0x75, 0xeb, 0xcb, 0x5c, 0x9d, 0x3c, 0x72, 0xc1, 0xcc, 0x95, 0x97, 0x96, 0x5e, 0xa6, 0xe5, 0x64,
+  0x5a, 0xc3, 0xf7, 0x92, 0x5b, 0x68, 0x48, 0x28, 0x04, 0x82, 0x37, 0x33, 0x9d, 0x93, 0x87, 0xed,
+  0x0a, 0x0d, 0xc2, 0x77, 0x61, 0xef, 0x3e, 0xc6, 0x29, 0x2f, 0x1f, 0xf7, 0xb3, 0x93, 0xf9, 0xf4,
+  0x47, 0xb1, 0x47, 0x74, 0x03, 0x3e, 0x50, 0x8d, 0x20, 0x6c, 0xa0, 0x6f, 0x77, 0x3e, 0xc5, 0x8f,
+  0x15, 0x2f, 0x7b, 0x9a, 0xbb, 0xd8, 0x3b, 0x9c, 0xf9, 0xed, 0xa6, 0xde, 0xa1, 0x1a, 0x41, 0xbd,
+  0x43, 0xdf, 0xee, 0x7c, 0x8a, 0x7b, 0xcc, 0x04, 0x7f, 0xfa, 0xc7, 0xff, 0x07, 0x74, 0xf6, 0x72,
+  0x4d, 0x2c, 0x16, 0xf3, 0xab, 0x83, 0xb8, 0x9d, 0x01, 0x4d, 0x5c, 0x77, 0x37, 0x24, 0xf4, 0xe1,
+  0xcc, 0x90, 0x1c, 0x42, 0x72, 0x8b, 0x8a, 0xf6, 0xa4, 0xf9, 0x13, 0x9c, 0xbb, 0x1c, 0x42, 0xd6,
+  0xe5, 0x52, 0xa8, 0x7d, 0xff, 0x7d, 0xcf, 0x2e, 0xfc, 0x15, 0x67, 0xdb, 0x23, 0x39, 0x2d, 0x50,
+  0x36, 0xbb, 0x62, 0xe5, 0xd9, 0x52, 0x82, 0xd3, 0xe9, 0x37, 0x0b, 0xea, 0x1b, 0xfb, 0x84, 0xab,
+  0xea, 0x07, 0x92, 0xbf, 0x24, 0x3d, 0x38, 0x56, 0x5e, 0x97, 0x4e, 0xc1, 0x5c, 0x3b, 0x24, 0x71,
+  0xd8, 0xd1, 0x8f, 0xfb, 0x72, 0xee, 0xb6, 0xa3, 0xaa, 0x83, 0x10, 0x0e, 0x36, 0x85, 0x8d, 0x53,
+  0x40, 0x02, 0x1f, 0xbc, 0x23, 0x73, 0x3c, 0x8b, 0x1e, 0x81, 0x14, 0x89, 0x04, 0x6f, 0x9e, 0x9f,
+  0xf4, 0x28, 0x98, 0x46, 0x01, 0x8b, 0xb6, 0xac, 0x5d, 0x98, 0xcc, 0x4f, 0xfb, 0xad, 0xf2, 0x73,
+  0xcc, 0x0e, 0xd7, 0xf7, 0xc9, 0x03, 0xfb, 0x93, 0xf4, 0xf9, 0x73, 0xd0, 0x1d, 0x1b, 0x09, 0xbb,
+  0x2f, 0x4b, 0xe0, 0x3d, 0x48, 0x9e, 0x16, 0x91, 0x8e, 0x76, 0xdc, 0x4f, 0x12, 0xbf, 0xc6, 0x7b,
+  0xe5, 0x35, 0x05, 0x91, 0x11, 0x02, 0x15, 0x9e, 0x5e, 0x59, 0x98, 0x42, 0x85, 0xd9, 0x2b, 0x0b,
+  0x27, 0x50, 0x61, 0x8a, 0xa6, 0xcf, 0xed, 0x42, 0x68, 0xc2, 0x34, 0xcb, 0x25, 0x7f, 0xed, 0x21,
+  0xd9, 0x22, 0x5d, 0xf8, 0x5a, 0x8e, 0xe0, 0x4f, 0x48, 0x9e, 0x9c, 0x91, 0xbe, 0xbc, 0xe1, 0x78,
+  0xb1, 0x9f, 0xac, 0xe5, 0x60, 0xde, 0x7f, 0x14, 0x93, 0x62, 0xc7, 0xef, 0xfd, 0x17, 0xa5, 0xaa,
+  0xe0, 0x8b, 0x33, 0x58, 0xcd, 0xba, 0x8f, 0x13, 0x10, 0x20, 0xc3, 0x05, 0x00, 0xc0, 0x71, 0x9a,
+  0xcf, 0xc4, 0x18, 0xb8, 0x0a, 0x1a, 0xd8, 0x87, 0xd0, 0x39, 0x84, 0x5d, 0xdf, 0x33, 0xdf, 0x70,
+  0xe0, 0x35, 0xf3, 0xef, 0x18, 0xdc, 0xa5, 0xd6, 0xaf, 0x96, 0xba, 0xd8, 0x89, 0xad, 0xdd, 0xad,
+  0x97, 0xba, 0xbd, 0xef, 0x13, 0xd4, 0xc5, 0x06, 0xfb, 0xd3, 0xde, 0xa1, 0xe6, 0x24, 0xd6, 0xa9,
+  0x20, 0x29, 0x7c, 0x41, 0x56, 0x0d, 0x68, 0x98, 0xd8, 0x53, 0xad, 0xb4, 0x66, 0x38, 0x33, 0xea,
+  0x0d, 0xff, 0x1b, 0x3d, 0x29, 0x17, 0xb5, 0x43, 0xe5, 0x3a, 0xcf, 0x76, 0xc4, 0x5d, 0x49, 0x55,
+  0xf2, 0x96, 0x20, 0xc0, 0xfd, 0x0b, 0x58, 0x42, 0x42, 0xcb, 0x21, 0x8e, 0xe2, 0x71, 0xcb, 0x41,
+  0x41, 0x52, 0x7d, 0xe2, 0x9a, 0x9e, 0x46, 0x21, 0x3d, 0x0a, 0x16, 0x1a, 0x10, 0xd7, 0xf3, 0x58,
+  0x5b, 0xe0, 0x0d, 0xc0, 0x79, 0x12, 0x2d, 0xf3, 0x24, 0xa4, 0xa5, 0x6f, 0xc8, 0xc9, 0xd3, 0xf0,
+  0x90, 0xe7, 0x63, 0x42, 0xc6, 0x01, 0xa6, 0xbc, 0xa5, 0x4f, 0x00, 0x27, 0x20, 0x29, 0x28, 0xa0,
+  0xa8, 0xf1, 0x88, 0xe4, 0x6e, 0x1c, 0xed, 0x98, 0x01, 0x2b, 0x1c, 0x24, 0x0f, 0xac, 0x50, 0x5c,
+  0x23, 0x66, 0xc9, 0x48, 0x32, 0x0a, 0xc0, 0x14, 0x3b, 0x06, 0x37, 0x83, 0x9c, 0xe9, 0x40, 0x63,
+  0x80, 0x47, 0x62, 0x74, 0xa2, 0x1c, 0xe3, 0xfa, 0xa7, 0x0a, 0x37, 0x80, 0x42, 0xcf, 0xa0, 0x63,
+  0x80, 0x8f, 0xd3, 0xc3, 0x39, 0x25, 0xc9, 0x35, 0xbb, 0x97, 0xb3, 0x81, 0xa2, 0xf0, 0x20, 0x1d,
+  0x5d, 0x5d, 0x48, 0x06, 0x0c, 0x85, 0x74, 0x7b, 0xe8, 0x51, 0xa0, 0xe3, 0x4e, 0x07, 0xac, 0x50,
+  0x57, 0xf0, 0xbf, 0x98, 0x66, 0x19, 0x62, 0xe8, 0x67, 0x70, 0x4d, 0x07, 0xa2, 0xc0, 0x03, 0xfe,
+  0x44, 0xb0, 0xc7, 0x2a, 0x5c, 0x6b, 0xa1, 0x15, 0x0f, 0x0d, 0xdc, 0xe8, 0x97, 0x7a, 0x70, 0x02,
+  0x3d, 0x46, 0x73, 0x80, 0x4a, 0x02, 0xea, 0xbb, 0xc0, 0x2b, 0x98, 0xf2, 0x43, 0x77, 0x7b, 0x22,
+  0x39, 0x1c, 0xb2, 0xbc, 0x9c, 0x70, 0x7f, 0x00, 0xf0, 0x11, 0xff, 0x7d, 0x45, 0x14, 0xa8, 0xeb,
+  0x57, 0xfa, 0xb1, 0xb8, 0xa6, 0xb4, 0x0a, 0x75, 0x18, 0x9a, 0xa9, 0xac, 0x7f, 0xbf, 0x6d, 0xfc,
+  0x3a, 0x5d, 0x1f, 0x48, 0x8a, 0x99, 0x29, 0xc8, 0xcc, 0x42, 0x83, 0x7c, 0x4e, 0xd7, 0x99, 0x0d,
+  0xaa, 0x17, 0xb3, 0x8b, 0x78, 0xfa, 0x8e, 0x3e, 0x38, 0x93, 0x80, 0x0b, 0x61, 0x96, 0x89, 0xda,
+  0x0f, 0xed, 0x66, 0x0c, 0xbd, 0x75, 0x66, 0x0d, 0x3d, 0xee, 0x66, 0x0e, 0x43, 0xb4, 0x67, 0x37,
+  0x7c, 0xe5, 0x0c, 0x9c, 0x4c, 0xa4, 0xef, 0x48, 0x56, 0xfb, 0x20, 0x93, 0x53, 0x68, 0x16, 0xdd,
+  0x71, 0x27, 0x43, 0x3e, 0x41, 0x91, 0x9c, 0xd2, 0x17, 0xfd, 0xa2, 0xe3, 0x71, 0xd0, 0x52, 0x77,
+  0xb0, 0x1f, 0x80, 0xaa, 0x40, 0x34, 0x02, 0xac, 0xb0, 0x30, 0x19, 0x63, 0x1e, 0x05, 0x86, 0xea,
+  0x2c, 0xec, 0x29, 0x44, 0x69, 0xe0, 0x19, 0x49, 0x31, 0xf1, 0x82, 0x66, 0xed, 0x88, 0xba, 0xbe,
+  0x6e, 0xd9, 0xbe, 0x51, 0x2d, 0x7f, 0xff, 0xfb, 0xa3, 0xe5, 0x70, 0xdc, 0xb1, 0x20, 0xa5, 0x61,
+  0x40, 0x7c, 0x4c, 0xff, 0x4b, 0x87, 0x06, 0x34, 0xfb, 0xd2, 0x02, 0xaa, 0x96, 0x19, 0x3a, 0x1b,
+  0x96, 0xe7, 0xaa, 0x98, 0x9b, 0xbe, 0xba, 0x6d, 0x24, 0x2d, 0xb8, 0xc6, 0x60, 0x88, 0x92, 0x60,
+  0x86, 0x82, 0xee, 0xec, 0x09, 0xc0, 0x26, 0x4b, 0x5f, 0x62, 0xf5, 0xaf, 0x73, 0x61, 0x49, 0x3b,
+  0x3a, 0x4d, 0xe2, 0xdb, 0x03, 0x2a, 0xed, 0xc8, 0x63, 0xaf, 0x64, 0xb6, 0x5f, 0x9c, 0x71, 0xe8,
+  0xb7, 0x0b, 0xc4, 0xd8, 0xaf, 0x9e, 0xca, 0x9b, 0x91, 0xb8, 0x0f, 0x21, 0x88, 0xea, 0x4c, 0x21,
+  0x56, 0xf2, 0x18, 0x40, 0x5d, 0x29, 0x58, 0x13, 0x1b, 0xc5, 0x91, 0xad, 0x90, 0x82, 0x0d, 0x69,
+  0x81, 0x76, 0xba, 0x1f, 0x4e, 0x56, 0x15, 0xf7, 0xc6, 0x75, 0xdc, 0x38, 0x8b, 0xf7, 0x70, 0xf0,
+  0x04, 0x0e, 0xcb, 0x7e, 0x6f, 0x9f, 0xb0, 0xbf, 0x9d, 0xf6, 0xc2, 0x3d, 0xee, 0x20, 0xc2, 0x73,
+  0xca, 0xd8, 0x63, 0x9b, 0xa9, 0x6c, 0x60, 0x09, 0x55, 0x59, 0x40, 0xc3, 0xb0, 0x6d, 0xc0, 0x81,
+  0xd7, 0x27, 0x4e, 0x5b, 0x3d, 0x43, 0x9a, 0x47, 0x4d, 0x9f, 0x86, 0x45, 0xf4, 0x63, 0x67, 0x76,
+  0xc4, 0xb3, 0xd8, 0xfe, 0x2c, 0xf2, 0x0d, 0xb4, 0x78, 0x66, 0xa0, 0xf6, 0x6e, 0x7d, 0x61, 0x98,
+  0x97, 0xee, 0x56, 0xfc, 0x52, 0xe8, 0xf8, 0xce, 0x4b, 0x32, 0x10, 0x0d, 0x9a, 0x6a, 0x98, 0x4d,
+  0x7b, 0xc6, 0x43, 0xfe, 0x18, 0x70, 0x62, 0xa8, 0xbb, 0x77, 0x18, 0xbc, 0x67, 0xfa, 0xdf, 0x11,
+  0x74, 0x36, 0x96, 0x07, 0xf7, 0x2e, 0xe3, 0x5f, 0xd2, 0x26, 0xe7, 0x07, 0xe7, 0x5f, 0xff, 0x32,
+  0x4e, 0x92, 0xc0, 0xc3, 0x46, 0xe6, 0x5b, 0x6a, 0x97, 0xf4, 0xf9, 0xb0, 0xc9, 0xf9, 0xf1, 0xa4,
+  0x4f, 0x76, 0x43, 0x9f, 0x6f, 0x37, 0xb0, 0x60, 0xb9, 0x0d, 0xe7, 0x3a, 0x51, 0xf5, 0x39, 0x78,
+  0x43, 0x48, 0x3e, 0x18, 0x55, 0xb0, 0x89, 0x47, 0xb5, 0x0c, 0xfb, 0xb8, 0xf9, 0x08, 0x20, 0x66,
+  0x08, 0xbc, 0xad, 0x77, 0x06, 0xaa, 0xee, 0x86, 0x84, 0xf3, 0xad, 0xeb, 0x96, 0x86, 0xd4, 0xbb,
+  0x88, 0x00, 0x6c, 0xd1, 0xc9, 0xc0, 0x5b, 0x98, 0x62, 0x9b, 0x1a, 0xc0, 0x1c, 0x42, 0xcd, 0xd8,
+  0x69, 0x88, 0x71, 0x2b, 0x7e, 0x12, 0xa3, 0x8f, 0x78, 0xe9, 0xb7, 0x23, 0xef, 0xba, 0x71, 0xc4,
+  0xcf, 0xbc, 0x99, 0xaa, 0x83, 0xa2, 0x3f, 0x1f, 0xef, 0x95, 0xbb, 0x08, 0xd2, 0x3f, 0xfc, 0x70,
+  0x1c, 0x52, 0x3a, 0x66, 0xa8, 0x0b, 0x78, 0xc4, 0x9d, 0x5d, 0x4b, 0xc1, 0x37, 0x20, 0xdf, 0x71,
+  0xf5, 0xeb, 0xf8, 0xbb, 0x8b, 0x62, 0x4d, 0xa8, 0x2f, 0x24, 0x05, 0x5d, 0x62, 0x39, 0xb3, 0xad,
+  0x1d, 0x56, 0x59, 0x78, 0x87, 0x04, 0x5b, 0xbc, 0x75, 0x7d, 0xb8, 0xac, 0x9c, 0x3e, 0xe9, 0xad,
+  0xef, 0x92, 0xfd, 0xe2, 0x71, 0x36, 0xb2, 0x5b, 0xdb, 0x8f, 0x0b, 0xf7, 0xe1, 0xe9, 0xa3, 0xc3,
+  0xe0, 0xd0, 0x84, 0x87, 0x4e, 0x04, 0xda, 0xf0, 0x45, 0x22, 0x6c, 0x2b, 0x70, 0x77, 0x3e, 0x41,
+  0x92, 0x0f, 0xa7, 0xea, 0x30, 0xea, 0x44, 0x65, 0x15, 0x74, 0x75, 0x81, 0x49, 0xd1, 0x40, 0x92,
+  0xec, 0x41, 0x43, 0xa6, 0x5a, 0x3a, 0x07, 0x0d, 0xc0, 0x20, 0xda, 0x95, 0x0c, 0x2c, 0x1f, 0xf9,
+  0xda, 0x6c, 0x3c, 0x92, 0x9a, 0x8f, 0x9e, 0xfc, 0x08, 0x07, 0xbb, 0xfd, 0xf3, 0x18, 0x33, 0xe7,
+  0xdc, 0xaf, 0x3c, 0x18, 0xf4, 0xa3, 0x31, 0x14, 0xd1, 0x51, 0x15, 0x80, 0x5d, 0xc8, 0x0e, 0xe0,
+  0x6b, 0x29, 0x3c, 0x14, 0x24, 0x94, 0x0f, 0x03, 0xed, 0xe6, 0x4e, 0x81, 0xbc, 0x8c, 0xf8, 0xe6,
+  0xf1, 0xe7, 0x6b, 0x3a, 0x64, 0xea, 0x9b, 0x40, 0xcd, 0x98, 0x8d, 0x28, 0x74, 0x04, 0xf0, 0x24,
+  0x0a, 0xba, 0x03, 0x11, 0xf0, 0xdc, 0x6b, 0xb7, 0x62, 0x86, 0x89, 0x8e, 0x11, 0x92, 0xb0, 0x09,
+  0xd9, 0xdf, 0xb0, 0xf7, 0xfb, 0xe3, 0xbf, 0x51, 0xee, 0x40, 0xc4, 0x97, 0x02, 0x1d, 0x40, 0xe5,
+  0x46, 0x7b, 0x5c, 0xfc, 0xa9, 0xd7, 0x2f, 0xd5, 0x5a, 0xf9, 0x52, 0xb7, 0xf2, 0x53, 0x3f, 0xd7,
+  0x09, 0x00, 0xeb, 0x57, 0xf2, 0xca, 0x46, 0xf2, 0x8d, 0x41, 0xe9, 0xa7, 0x56, 0xbb, 0xd6, 0x2b,
+  0xfd, 0xd4, 0xab, 0x4d, 0x4a, 0x0e, 0x7c, 0xef, 0xdb, 0x1b, 0x41, 0x81, 0x27, 0xfb, 0x24, 0x82,
+  0x8f, 0x20, 0x31, 0x44, 0x60, 0x21, 0xc6, 0x54, 0xd9, 0x90, 0x4f, 0xd7, 0x5d, 0x2d, 0x35, 0x73,
+  0xbd, 0x3a, 0xee, 0x75, 0x38, 0x0a, 0x42, 0x1c, 0x26, 0x7a, 0x2e, 0xc6, 0x89, 0x8c, 0x5e, 0x50,
+  0x79, 0x98, 0x33, 0x43, 0x44, 0x38, 0x7c, 0xa6, 0x13, 0x5e, 0x75, 0x49, 0x6c, 0xc1, 0x68, 0xa1,
+  0x90, 0x80, 0xc1, 0x08, 0x31, 0x53, 0xed, 0xe1, 0x26, 0x43, 0xe1, 0x70, 0x6c, 0xa6, 0x4a, 0x4a,
+  0xe8, 0xee, 0xdf, 0x28, 0x77, 0xb8, 0xb1, 0x8b, 0xc3, 0xba, 0x94, 0x5c, 0xe9, 0x0c, 0x00, 0x03,
+  0xca, 0x82, 0xaf, 0x48, 0x74, 0xa6, 0x8e, 0x8b, 0xfb, 0xe2, 0xbb, 0xfd, 0x48, 0x94, 0x79, 0xbc,
+  0xaa, 0xfc, 0x5e, 0xde, 0x01, 0x4f, 0x48, 0x21, 0x26, 0x7c, 0xe2, 0xf1, 0x6e, 0xfb, 0x39, 0xe4,
+  0x7f, 0x32, 0xe4, 0x1d, 0x89, 0x30, 0x1c, 0x05, 0xfc, 0xee, 0x9c, 0xc7, 0xef, 0x4f, 0x79, 0xfc,
+  0xfe, 0x8c, 0x77, 0xa9, 0x71, 0x3c, 0xc8, 0x23, 0x39, 0xe0, 0xd0, 0x93, 0x07, 0x57, 0xa7, 0xd0,
+  0x1e, 0xba, 0xff, 0x15, 0xdb, 0xef, 0xa6, 0x67, 0xa0, 0x7f, 0x41, 0x1f, 0x83, 0xe4, 0x6c, 0x4b,
+  0x97, 0x11, 0x99, 0x75, 0x1b, 0x8e, 0x72, 0xbc, 0xcd, 0x22, 0xde, 0x88, 0xe2, 0x44, 0xa2, 0xe1,
+  0xa2, 0x85, 0x1e, 0xfa, 0x64, 0x2f, 0xcd, 0xcf, 0x51, 0xf0, 0x33, 0x66, 0x00, 0x0f, 0xe0, 0x0e,
+  0x69, 0x3f, 0xe3, 0x33, 0x66, 0xc9, 0xd8, 0xf9, 0xd9, 0xee, 0xc0, 0x17, 0xbf, 0x9b, 0xf2, 0xbb,
+  0xc0, 0x5f, 0xd6, 0xe1, 0x1a, 0x0b, 0xf6, 0xfb, 0x75, 0xdd, 0xb6, 0x57, 0x98, 0xa5, 0x34, 0x65,
+  0x4c, 0x55, 0x8f, 0x89, 0x8c, 0xce, 0xaf, 0x18, 0x1d, 0x16, 0x54, 0xc5, 0x76, 0xb6, 0xe5, 0xf0,
+  0xf9, 0x81, 0x8a, 0xba, 0x9d, 0x78, 0xec, 0x13, 0x84, 0x5f, 0x5b, 0x7e, 0x1a, 0x7a, 0xdc, 0x72,
+  0xa0, 0x42, 0xfe, 0x74, 0x13, 0xc4, 0x5b, 0x13, 0x1a, 0xb6, 0xfd, 0x22, 0x64, 0xe9, 0x72, 0xf8,
+  0xe2, 0x2d, 0xea, 0x2f, 0x00, 0xdb, 0x7e, 0x81, 0x9f, 0x75, 0x73, 0x87, 0x04, 0x64, 0xbd, 0x5c,
+  0x31, 0xba, 0x12, 0xba, 0x1b, 0x42, 0x16, 0xec, 0x78, 0xb0, 0xa5, 0xec, 0xd5, 0x5b, 0x51, 0xa7,
+  0x27, 0x48, 0xd8, 0x70, 0x72, 0x83, 0x2d, 0x90, 0xdd, 0xd9, 0x14, 0x9d, 0x14, 0x3a, 0xfe, 0x66,
+  0xdc, 0x4b, 0x3c, 0xdd, 0xd7, 0xac, 0x1b, 0xc0, 0x9f, 0x7f, 0x09, 0x27, 0xbe, 0xbd, 0x23, 0xe9,
+  0x2e, 0xed, 0x9e, 0xe3, 0x6d, 0xfa, 0x1d, 0x03, 0xcf, 0x9d, 0x2a, 0xac, 0x91, 0x2d, 0xcf, 0x3b,
+  0x11, 0x7e, 0xb1, 0xe1, 0x77, 0x65, 0x2f, 0x9a, 0x11, 0x0e, 0xee, 0x65, 0x7b, 0xdb, 0xe2, 0x91,
+  0x2d, 0x21, 0x27, 0xcb, 0x47, 0xe6, 0x04, 0xbb, 0xbc, 0xbf, 0xba, 0xff, 0x20, 0x69, 0xa9, 0x9a,
+  0x89, 0x78, 0x98, 0xaa, 0x99, 0x67, 0xf3, 0x45, 0x78, 0x55, 0x65, 0x4b, 0x6c, 0xda, 0xb4, 0xbd,
+  0xd1, 0xfb, 0x76, 0x2c, 0xc8, 0x2b, 0x13, 0x31, 0x7c, 0xa7, 0x30, 0xf8, 0x9e, 0x43, 0x95, 0x0f,
+  0xd9, 0x30, 0xc6, 0x46, 0xe1, 0x4e, 0x7c, 0x7f, 0x5d, 0xc9, 0x5c, 0xfd, 0x5c, 0x51, 0x4e, 0x66,
+  0xe8, 0xfa, 0x20, 0xd2, 0x2e, 0x4f, 0x85, 0xef, 0x18, 0x43, 0x1a, 0x3b, 0x7c, 0x9e, 0x71, 0xf7,
+  0xdc, 0x69, 0x0a, 0x70, 0xf2, 0xcc, 0xa7, 0x1b, 0x11, 0x7a, 0x0c, 0xca, 0x06, 0x72, 0x3e, 0xd7,
+  0x80, 0x53, 0xe6, 0xac, 0xf9, 0xd9, 0x9b, 0x37, 0xe1, 0xd4, 0x1c, 0x1d, 0xe0, 0x71, 0x7c, 0xec,
+  0x89, 0x89, 0x0c, 0x1d, 0xa1, 0x10, 0xe3, 0xb8, 0x5f, 0xda, 0x8a, 0xd9, 0xa7, 0xa7, 0xd3, 0x35,
+  0x14, 0x3e, 0xbd, 0x1d, 0xe2, 0xb1, 0x5b, 0x5e, 0x23, 0xfd, 0x79, 0xaa, 0xa0, 0x85, 0x89, 0x8e,
+  0x5d, 0xd7, 0x19, 0xad, 0x2e, 0x31, 0xdf, 0x78, 0x1c, 0x1c, 0xec, 0x02, 0xec, 0x06, 0x30, 0x58,
+  0xbd, 0xbb, 0x33, 0x3e, 0xa0, 0x53, 0x1d, 0x3a, 0x2e, 0x3e, 0xe0, 0x60, 0x05, 0x28, 0x4b, 0xaa,
+  0x9d, 0x4b, 0x4f, 0x95, 0xb8, 0x53, 0x47, 0x9f, 0xeb, 0x1c, 0x6b, 0x02, 0xa6, 0x29, 0x30, 0xd7,
+  0xf0, 0x5d, 0x20, 0x08, 0x17, 0x35, 0x9c, 0x2e, 0x8e, 0xaf, 0x21, 0xf2, 0x6f, 0xec, 0xda, 0x8d,
+  0x9e, 0x9c, 0xd7, 0x71, 0x1b, 0x3f, 0x17, 0xf6, 0xab, 0x5c, 0xf2, 0x9d, 0x1e, 0x94, 0xf7, 0x97,
+  0x25, 0x4e, 0x7c, 0x52, 0x7f, 0x89, 0x9d, 0xad, 0x5c, 0x6b, 0xe5, 0x1a, 0xce, 0x85, 0xfd, 0x23,
+  0x07, 0xf5, 0x41, 0x0d, 0x0c, 0x3a, 0xc5, 0x5c, 0xbf, 0xf4, 0xbd, 0xfd, 0xd3, 0xcf, 0x0c, 0xd0,
+  0xbb, 0xc5, 0x89, 0xea, 0x6a, 0x77, 0xb5, 0x26, 0x18, 0x17, 0xce, 0xba, 0xf7, 0xa4, 0x46, 0x9b,
+  0xa2, 0x98, 0x2d, 0x8c, 0x09, 0xed, 0x17, 0x17, 0xaa, 0xdf, 0x72, 0x71, 0x26, 0x20, 0x4e, 0xfa,
+  0x4d, 0xf7, 0x66, 0xdc, 0x90, 0x82, 0xf7, 0x21, 0xf0, 0x0d, 0x61, 0xdb, 0x6f, 0xea, 0xce, 0x99,
+  0x70, 0xf7, 0x17, 0x2f, 0x53, 0x38, 0x1e, 0x1b, 0x8a, 0xa0, 0x9e, 0xdb, 0x31, 0xec, 0x08, 0xf8,
+  0x9e, 0xd5, 0xa7, 0x08, 0xea, 0x75, 0x0d, 0x3a, 0xdb, 0x17, 0xb3, 0xea, 0x49, 0x5b, 0xe8, 0xf5,
+  0xee, 0x7d, 0x7f, 0xe9, 0x76, 0x19, 0x6e, 0xc7, 0x7d, 0x63, 0xe0, 0xdf, 0xfe, 0xe9, 0x9f, 0xff,
+  0x03, 0x40, 0xf9, 0x13, 0x36, 0x88, 0x3f, 0xda, 0x73, 0xf1, 0x81, 0xd5, 0xfd, 0xf2, 0x94, 0xff,
+  0xa7, 0xff, 0x72, 0x60, 0x1e, 0x0f, 0xe0, 0x83, 0x61, 0xea, 0xaa, 0x32, 0xfd, 0xf8, 0xf7, 0x3f,
+  0x9f, 0x70, 0xaf, 0x2f, 0x1f, 0xe2, 0xce, 0xc7, 0x00, 0x48, 0xff, 0xf4, 0x1f, 0xff, 0xdb, 0xbf,
+  0xfc, 0x23, 0x28, 0x38, 0x59, 0x5c, 0x0f, 0x90, 0xfc, 0x3c, 0x66, 0xd0, 0xfe, 0x74, 0x11, 0xe0,
+  0x1f, 0xfe, 0x6f, 0x80, 0xd0, 0xf1, 0x00, 0xfe, 0xfe, 0xe7, 0x90, 0x87, 0xfc, 0x77, 0x56, 0x09,
+  0x74, 0x4f, 0x90, 0x4a, 0x86, 0x63, 0xa6, 0x5a, 0x96, 0xd6, 0x90, 0x0f, 0x91, 0xe1, 0x2f, 0xa0,
+  0x9e, 0x3f, 0x81, 0x15, 0xfa, 0xfb, 0x9f, 0xdd, 0xf7, 0xf1, 0xfd, 0x61, 0xe1, 0xcb, 0xf9, 0x20,
+  0xbe, 0x9b, 0x85, 0xf0, 0x97, 0xdf, 0x21, 0x7f, 0x70, 0x9d, 0x59, 0x85, 0xff, 0xed, 0x2f, 0xc1,
+  0x96, 0xba, 0xa5, 0x5e, 0xa9, 0x0f, 0x7e, 0x00, 0xad, 0xd2, 0xf0, 0x17, 0x4a, 0x0e, 0x72, 0x9c,
+  0x02, 0xfc, 0xda, 0x6b, 0x78, 0xdf, 0xf1, 0xf2, 0xdc, 0x6d, 0x49, 0x26, 0xbe, 0x47, 0x72, 0x89,
+  0x5f, 0xe1, 0x72, 0xe1, 0x57, 0xef, 0x7e, 0xdf, 0x2d, 0xe1, 0xc5, 0xad, 0x4c, 0xf7, 0x54, 0x2e,
+  0xfd, 0x8e, 0xa9, 0x32, 0xbe, 0xe9, 0xe6, 0xe4, 0xa5, 0x7c, 0x9f, 0x97, 0x6f, 0x57, 0x82, 0xab,
+  0x73, 0x88, 0x5d, 0x71, 0xd3, 0xeb, 0x48, 0x42, 0x8a, 0x44, 0x6e, 0xbb, 0x06, 0x76, 0x45, 0x1e,
+  0x4e, 0x70, 0x5b, 0xb6, 0x86, 0xef, 0x97, 0x31, 0xf0, 0xbb, 0xa5, 0x3f, 0x3c, 0x1f, 0x22, 0xc8,
+  0xc7, 0x25, 0x2b, 0xe4, 0xb8, 0x4e, 0x7a, 0xd9, 0x0f, 0x3a, 0x77, 0x2c, 0x24, 0x05, 0x05, 0xa0,
+  0x04, 0x4f, 0xa0, 0xa6, 0x08, 0x28, 0x5a, 0xe4, 0xc6, 0xe7, 0xe6, 0xba, 0x0d, 0xb0, 0xa6, 0xf0,
+  0x70, 0x7d, 0x8a, 0x2e, 0x3f, 0xfd, 0x91, 0xad, 0x66, 0xbe, 0xd2, 0xb1, 0x93, 0xd3, 0xa3, 0x80,
+  0x43, 0x89, 0x72, 0xb1, 0x6f, 0xa7, 0x5d, 0xf5, 0x93, 0x14, 0xe8, 0xb6, 0xc9, 0xa3, 0x69, 0xd5,
+  0xf1, 0xb5, 0xea, 0x28, 0xe0, 0x51, 0xa0, 0xb9, 0x29, 0xfa, 0x31, 0x8d, 0x02, 0x1e, 0x99, 0x24,
+  0x59, 0xf4, 0x83, 0x0d, 0xac, 0x6c, 0x8f, 0x95, 0xd7, 0xc1, 0x7b, 0xf4, 0x57, 0x04, 0x01, 0x78,
+  0x8f, 0xfe, 0x8a, 0xa0, 0xda, 0xef, 0x01, 0xef, 0xe7, 0x87, 0x89, 0x2d, 0x08, 0x86, 0x09, 0x3e,
+  0xec, 0xb0, 0x15, 0xa4, 0x14, 0x3b, 0x20, 0x13, 0x95, 0x0f, 0xf0, 0x74, 0x38, 0x46, 0xa6, 0x74,
+  0x51, 0x4b, 0xe6, 0x7b, 0xc3, 0xc6, 0x05, 0xe4, 0x92, 0xe5, 0x25, 0x41, 0xad, 0xf1, 0xff, 0x00,
+  0x67, 0xb1, 0xf0, 0x01, 0x5d, 0xd9, 0x80, 0xb2, 0x0c, 0x56, 0xa2, 0x6a, 0x40, 0x90, 0x41, 0x86,
+  0x18, 0x05, 0xa9, 0xc0, 0x44, 0x66, 0x09, 0x0f, 0x46, 0x18, 0xc5, 0xd6, 0x2f, 0xdb, 0xf9, 0x41,
+  0xdd, 0xc0, 0x16, 0x8c, 0x66, 0x00, 0xe4, 0xd7, 0xa6, 0x43, 0x19, 0xcb, 0x35, 0x92, 0x09, 0x42,
+  0x14, 0x4d, 0xe3, 0xab, 0xef, 0xb2, 0x8c, 0x54, 0x70, 0x0c, 0x60, 0xd1, 0x02, 0x64, 0xf4, 0x4d,
+  0xd4, 0x3e, 0x56, 0x1b, 0x90, 0xd1, 0x39, 0x11, 0x28, 0x10, 0xf2, 0x90, 0x0f, 0x9f, 0xd2, 0xec,
+  0x89, 0x46, 0xdb, 0xd7, 0x14, 0x28, 0x5b, 0xa6, 0xdb, 0xc7, 0xc8, 0x56, 0x21, 0x27, 0x28, 0xf0,
+  0x1e, 0x38, 0x7f, 0xf9, 0xfa, 0x31, 0xef, 0x86, 0x77, 0x5a, 0x33, 0x81, 0x2a, 0xd9, 0x7f, 0x85,
+  0x03, 0x08, 0x5a, 0xb7, 0x09, 0x5a, 0x07, 0x1f, 0x9e, 0x40, 0x82, 0x7a, 0x04, 0xba, 0x3f, 0x19,
+  0xef, 0xcb, 0x4f, 0xed, 0xf2, 0xd3, 0x5d, 0xf9, 0x69, 0xb0, 0xfa, 0x74, 0x5f, 0x87, 0xb5, 0xeb,
+  0xb0, 0xbb, 0x3a, 0x6c, 0x70, 0x1d, 0x7b, 0x54, 0x78, 0x3c, 0x9f, 0x42, 0xba, 0xdd, 0xfd, 0x08,
+  0x98, 0x86, 0x77, 0x4f, 0x78, 0xf9, 0xf8, 0x33, 0x80, 0x40, 0x78, 0xe8, 0xcf, 0x5e, 0xa5, 0x8c,
+  0x60, 0x66, 0xa2, 0xc8, 0xbb, 0x38, 0xec, 0x52, 0x34, 0x4f, 0x7d, 0xdf, 0xb2, 0x87, 0xb7, 0x01,
+  0x66, 0xcc, 0x2f, 0x37, 0x11, 0xb6, 0x0f, 0xd2, 0x6f, 0xc4, 0xf9, 0x57, 0xa0, 0xfc, 0x3a, 0x8c,
+  0x23, 0x3a, 0xb2, 0xd3, 0x46, 0x3e, 0x5d, 0xc0, 0xff, 0x63, 0x20, 0x14, 0xd4, 0xae, 0xa5, 0x48,
+  0x82, 0xaa, 0x2f, 0xce, 0x46, 0x74, 0x3f, 0xea, 0x28, 0x72, 0xc1, 0x26, 0x1f, 0x01, 0x07, 0x3e,
+  0x80, 0x0c, 0xb2, 0x5b, 0x3b, 0x00, 0x1e, 0x01, 0x77, 0xbe, 0xcb, 0xe8, 0xcf, 0xa1, 0xb1, 0x7d,
+  0x97, 0x43, 0x88, 0xdf, 0x85, 0x38, 0xf0, 0xf1, 0x23, 0xa0, 0xc2, 0xfb, 0x5e, 0x23, 0xd6, 0x17,
+  0xb2, 0xdf, 0x92, 0x61, 0xf0, 0x03, 0x20, 0x0f, 0x9f, 0x58, 0xbb, 0x3c, 0x7a, 0x67, 0x5f, 0xb1,
+  0xc2, 0x58, 0x08, 0xee, 0xf8, 0x97, 0xe0, 0xe1, 0x5b, 0x26, 0x42, 0xd9, 0x87, 0x0f, 0x28, 0x4e,
+  0x09, 0xf8, 0x3d, 0x08, 0x4d, 0xd1, 0x33, 0x8d, 0x1e, 0x31, 0xd5, 0xee, 0x7a, 0xfb, 0xa3, 0x83,
+  0xe8, 0x87, 0x53, 0x17, 0xf7, 0xaf, 0x23, 0x2b, 0x87, 0x5f, 0xca, 0x96, 0xf9, 0x75, 0xfb, 0x67,
+  0xd0, 0xd6, 0xb9, 0xbb, 0x66, 0xc4, 0x89, 0x58, 0xba, 0x73, 0x99, 0xe8, 0x30, 0x9e, 0x3f, 0x7e,
+  0x04, 0x89, 0xb0, 0x6b, 0xb8, 0xa1, 0xe9, 0xe1, 0x15, 0x1e, 0x75, 0x88, 0xb5, 0x5f, 0x7c, 0xf6,
+  0xbf, 0x40, 0x69, 0xc3, 0x45, 0x0a, 0x23, 0xc4, 0x5b, 0x7f, 0xdc, 0xbd, 0x78, 0xb8, 0xb0, 0xbf,
+  0x5f, 0xda, 0x0a, 0xd6, 0xff, 0x10, 0x22, 0xe3, 0x4a, 0x18, 0x53, 0xd8, 0x1a, 0x7c, 0x7c, 0x02,
+  0x84, 0xed, 0x09, 0x1c, 0x01, 0xf7, 0xe0, 0x3d, 0x0a, 0x46, 0xa2, 0xc8, 0x1b, 0x10, 0x6a, 0xc1,
+  0x15, 0xd2, 0xcc, 0x62, 0xb3, 0x3c, 0xc3, 0xaa, 0xc8, 0x47, 0x96, 0x11, 0x90, 0x8f, 0x3d, 0xba,
+  0xa5, 0xeb, 0x76, 0xfd, 0xb2, 0x3d, 0x42, 0x54, 0xf0, 0x89, 0x8c, 0x02, 0xea, 0x1f, 0x94, 0x30,
+  0xd2, 0x13, 0x6a, 0xea, 0x0a, 0xf1, 0x5b, 0x74, 0x89, 0x77, 0xa5, 0x86, 0x1f, 0x1c, 0x77, 0x12,
+  0xa8, 0x4c, 0x25, 0x05, 0xda, 0x2e, 0x66, 0xfb, 0x4d, 0x86, 0x95, 0x90, 0xeb, 0x08, 0xa3, 0xf0,
+  0x6e, 0x80, 0x86, 0x0a, 0x78, 0x15, 0x1a, 0x3b, 0x4d, 0xe3, 0x4f, 0xb2, 0x65, 0xc6, 0xc4, 0x98,
+  0xcd, 0x77, 0x34, 0xd5, 0x4e, 0x72, 0x8b, 0x7f, 0x70, 0xac, 0x6e, 0x02, 0x46, 0x87, 0xc8, 0xf1,
+  0x04, 0x40, 0x84, 0x06, 0x1f, 0x55, 0x90, 0x0d, 0xa4, 0xab, 0xaa, 0x66, 0x68, 0x1d, 0x05, 0x8a,
+  0xaf, 0xfe, 0x3c, 0xb4, 0xc6, 0x39, 0x2c, 0xf7, 0x56, 0x78, 0xc2, 0x37, 0x4e, 0x98, 0x09, 0x35,
+  0x74, 0xf1, 0x02, 0xbc, 0x7f, 0x0f, 0x94, 0x53, 0x09, 0xc9, 0xd8, 0xc5, 0x75, 0x3b, 0xfe, 0xb4,
+  0x12, 0x51, 0xda, 0xc7, 0xd0, 0x1a, 0x7c, 0xf0, 0x4f, 0x93, 0xb1, 0x06, 0xef, 0x9f, 0x30, 0xe8,
+  0x47, 0xff, 0xa8, 0x9b, 0x20, 0xfe, 0xe4, 0x55, 0x33, 0x7c, 0xf1, 0x6f, 0xe0, 0xa3, 0x0d, 0xc7,
+  0xbf, 0x91, 0xf8, 0xf9, 0x46, 0xde, 0x5f, 0x68, 0x04, 0x0d, 0x10, 0x1d, 0x0b, 0xa8, 0xcb, 0x72,
+  0x5f, 0x26, 0x50, 0xd6, 0xc3, 0x09, 0xd6, 0x11, 0x6d, 0x80, 0x27, 0xb0, 0x39, 0x63, 0x84, 0x9c,
+  0xe3, 0x86, 0xc0, 0x1c, 0x7c, 0x00, 0xca, 0x23, 0x98, 0x23, 0x60, 0x76, 0xb5, 0xf7, 0xbe, 0xf5,
+  0x50, 0xbf, 0x42, 0x21, 0x05, 0x05, 0x40, 0x42, 0x6c, 0x6b, 0x03, 0x22, 0x68, 0xbc, 0x76, 0x15,
+  0x14, 0x37, 0x4d, 0xb9, 0xc2, 0xac, 0xb7, 0xd9, 0xc5, 0x44, 0xbf, 0xf2, 0xe6, 0x96, 0x3e, 0x65,
+  0xfb, 0x6a, 0x43, 0x42, 0x32, 0x12, 0xf2, 0x12, 0xf0, 0x63, 0x0c, 0xf8, 0xae, 0x36, 0xd2, 0x11,
+  0x79, 0xb9, 0x18, 0xa2, 0xb8, 0x35, 0xda, 0xeb, 0x89, 0x18, 0x91, 0x24, 0x92, 0xf4, 0x9e, 0xea,
+  0x50, 0xaf, 0x49, 0x2a, 0x96, 0xf5, 0x0d, 0x71, 0x84, 0x63, 0x6d, 0xa2, 0xdb, 0x3f, 0x44, 0x8c,
+  0xa0, 0x69, 0x34, 0x2e, 0x12, 0x3d, 0xf8, 0xf2, 0x0e, 0x14, 0xaf, 0x0e, 0xfd, 0xdf, 0x4d, 0xfb,
+  0xf8, 0x5d, 0x14, 0xd0, 0xe1, 0x47, 0xbc, 0xc6, 0xcc, 0x7f, 0xa0, 0x62, 0xc9, 0x4b, 0xfe, 0x3a,
+  0xf5, 0x06, 0xc3, 0x82, 0x50, 0xdb, 0x34, 0x55, 0xc3, 0x50, 0x95, 0x30, 0x4e, 0xad, 0xac, 0x00,
+  0xa3, 0x5b, 0xc9, 0x7b, 0xa4, 0xc2, 0x3d, 0x62, 0x4c, 0xb5, 0x3d, 0x97, 0x19, 0xf6, 0x3c, 0xcb,
+  0x94, 0x11, 0x01, 0x1c, 0xa1, 0x10, 0xd9, 0xff, 0xe5, 0xa9, 0xf7, 0xed, 0x14, 0xbd, 0x65, 0xbd,
+  0x6f, 0x59, 0x5f, 0x21, 0x4f, 0x06, 0x4f, 0x47, 0xc3, 0x25, 0x62, 0x49, 0x92, 0xa2, 0x28, 0x32,
+  0x99, 0x26, 0x32, 0xe0, 0x3d, 0x6a, 0x12, 0x61, 0x8e, 0x4e, 0xa4, 0x12, 0x09, 0x0a, 0xfd, 0x8d,
+  0xde, 0x4d, 0x1d, 0x6c, 0x92, 0xc9, 0x24, 0x9d, 0xcd, 0x52, 0x59, 0xf4, 0x8e, 0x8d, 0x82, 0x84,
+  0x6f, 0x03, 0x8b, 0x93, 0x06, 0x28, 0x92, 0xcc, 0x12, 0x89, 0x64, 0x36, 0x43, 0x1d, 0x1a, 0x48,
+  0x65, 0x88, 0x54, 0x36, 0x4b, 0x27, 0x69, 0xf2, 0xd0, 0x00, 0x49, 0xa4, 0x13, 0xd9, 0x54, 0x96,
+  0x4e, 0xa5, 0xce, 0x36, 0x60, 0x9c, 0x34, 0x40, 0x64, 0x32, 0x09, 0x82, 0x4a, 0xa6, 0xc8, 0xec,
+  0xa1, 0x01, 0x2a, 0x43, 0xa6, 0xc9, 0x4c, 0x26, 0x91, 0x4e, 0x1d, 0x1a, 0x48, 0x51, 0xd9, 0x6c,
+  0x3a, 0x93, 0x26, 0x08, 0x3a, 0xa0, 0x01, 0x87, 0x2c, 0x3e, 0x9d, 0x2c, 0x1d, 0x34, 0x08, 0x22,
+  0x49, 0x27, 0x29, 0x9a, 0xc6, 0x18, 0xc1, 0xe0, 0xd2, 0xd9, 0x44, 0x8a, 0x4c, 0xa7, 0x33, 0x34,
+  0x01, 0xde, 0x83, 0x05, 0xb8, 0x47, 0x38, 0x22, 0x92, 0x44, 0x9a, 0x22, 0x92, 0x29, 0x84, 0x4b,
+  0xe3, 0xd4, 0x83, 0x91, 0x8c, 0x65, 0xd3, 0xe9, 0x6c, 0x36, 0x93, 0xcc, 0xda, 0x03, 0x07, 0xf7,
+  0x80, 0x8a, 0x25, 0xa9, 0x0c, 0x9d, 0xa5, 0x28, 0xc2, 0x81, 0x83, 0x40, 0x27, 0x69, 0x82, 0xce,
+  0x26, 0xd2, 0x44, 0x36, 0xeb, 0x0f, 0x87, 0x88, 0x11, 0x14, 0x9d, 0x25, 0x92, 0x44, 0x22, 0x4d,
+  0x1e, 0xfa, 0x93, 0xa1, 0xd2, 0x69, 0x32, 0x9d, 0x4a, 0x51, 0xfb, 0xfe, 0x64, 0x88, 0x4c, 0x2a,
+  0x4d, 0xa7, 0x53, 0x29, 0x04, 0xda, 0x38, 0x02, 0xf3, 0xf9, 0xa6, 0xb3, 0xd0, 0x3e, 0xd2, 0x04,
+  0x56, 0x15, 0xec, 0x8e, 0x3c, 0x92, 0xe2, 0xd0, 0xbe, 0xa9, 0x02, 0xc8, 0x70, 0xa2, 0x7d, 0xae,
+  0xb1, 0x83, 0x79, 0xe1, 0x9c, 0xe1, 0x6e, 0x78, 0xb6, 0xb4, 0xb2, 0x90, 0x14, 0x69, 0x61, 0x2d,
+  0xc0, 0x4a, 0x52, 0x90, 0x6b, 0xb4, 0xed, 0xe3, 0x2f, 0xab, 0xea, 0xdc, 0xd2, 0xb0, 0xb3, 0x1b,
+  0xf6, 0x83, 0x8e, 0x02, 0x59, 0x9a, 0xdb, 0x47, 0x2c, 0xb4, 0x86, 0x34, 0xc6, 0x14, 0x03, 0x8e,
+  0x42, 0x4e, 0x1c, 0x00, 0x74, 0x14, 0xb2, 0x2f, 0x35, 0x06, 0xdc, 0xbb, 0xd8, 0xc7, 0x8e, 0xb1,
+  0x4b, 0xd9, 0xfe, 0x46, 0xfb, 0x6b, 0x92, 0xd8, 0x08, 0xe9, 0x5d, 0x92, 0xfe, 0xcb, 0xe7, 0xc6,
+  0x93, 0xd5, 0x5f, 0xb9, 0xa8, 0xfe, 0xa9, 0x11, 0x05, 0xb9, 0x28, 0xc8, 0x7f, 0xc6, 0xb9, 0x57,
+  0x9c, 0xf1, 0xa3, 0xd3, 0x0a, 0x88, 0x80, 0x64, 0x14, 0x4c, 0x0f, 0x8f, 0xec, 0xee, 0x31, 0x7c,
+  0x5e, 0x70, 0xbf, 0xa4, 0x23, 0xb9, 0xb4, 0x2b, 0x3a, 0x33, 0x75, 0x49, 0x1d, 0xe2, 0xa3, 0xad,
+  0x40, 0x9c, 0xad, 0x01, 0xee, 0x77, 0x10, 0x3e, 0x49, 0x9f, 0x3f, 0x11, 0x9f, 0xa3, 0x80, 0x47,
+  0xd7, 0x72, 0x73, 0xc7, 0xef, 0xc9, 0xcf, 0x8e, 0x02, 0x24, 0x7f, 0xfc, 0x9e, 0x3a, 0x73, 0x2a,
+  0x39, 0xd5, 0x8b, 0xc8, 0x48, 0x07, 0x82, 0x96, 0x1e, 0xcf, 0xa0, 0x27, 0xe6, 0x9c, 0x5e, 0xe4,
+  0xeb, 0x74, 0x24, 0xb7, 0xea, 0x4b, 0x6e, 0x39, 0x46, 0x48, 0xe7, 0x41, 0x7c, 0xb9, 0xf1, 0xe4,
+  0xf2, 0x8b, 0x1c, 0x35, 0xe2, 0x71, 0xf0, 0xb3, 0xb3, 0x62, 0xa3, 0x78, 0xe9, 0x7d, 0xb1, 0x3d,
+  0x5c, 0xa1, 0xcb, 0x91, 0x69, 0xc7, 0x0f, 0x0c, 0x60, 0x32, 0x73, 0x08, 0x24, 0xf3, 0x11, 0x28,
+  0x2a, 0x68, 0x0c, 0xfa, 0x0f, 0x98, 0x77, 0xd8, 0x0a, 0x95, 0xc0, 0xf0, 0x37, 0x4e, 0x18, 0x11,
+  0x89, 0x0f, 0xe0, 0x1b, 0xba, 0x8a, 0xb3, 0x91, 0xbb, 0xae, 0x51, 0x4b, 0xbc, 0xff, 0x39, 0x64,
+  0xd7, 0xd1, 0x87, 0x5d, 0xa5, 0x98, 0xab, 0xe3, 0x87, 0x97, 0x1a, 0xca, 0xbb, 0xa1, 0x99, 0x16,
+  0x23, 0x83, 0x1f, 0x4f, 0x58, 0xd8, 0x71, 0xcd, 0x30, 0x78, 0xc0, 0x6a, 0xe1, 0x0b, 0x17, 0x61,
+  0xf7, 0x43, 0x3a, 0x5c, 0x14, 0x0d, 0xed, 0x2f, 0xf4, 0x05, 0xc8, 0x17, 0x4e, 0x9f, 0xf7, 0x8b,
+  0xcd, 0x32, 0xc1, 0x8f, 0xee, 0x5f, 0x37, 0x1e, 0xcc, 0x7c, 0x0e, 0x5b, 0x57, 0x9f, 0xb3, 0xd0,
+  0x24, 0x49, 0x0a, 0x30, 0xa4, 0xb5, 0x89, 0xae, 0x27, 0x8b, 0xf8, 0x3c, 0xc4, 0x00, 0x19, 0x2e,
+  0xd1, 0x3e, 0x80, 0x0e, 0x2c, 0x9c, 0xed, 0x08, 0xf9, 0x60, 0x9f, 0x86, 0x44, 0xb4, 0xf5, 0x60,
+  0xcf, 0x79, 0xf4, 0x5b, 0x3a, 0xd2, 0xb8, 0x09, 0x3a, 0x63, 0xa3, 0x22, 0x64, 0xea, 0x96, 0xc2,
+  0x31, 0xc8, 0xd3, 0xc0, 0x54, 0x57, 0x8c, 0xce, 0x83, 0x2d, 0xd4, 0xd5, 0x30, 0x3e, 0x11, 0xe1,
+  0x83, 0x1b, 0x02, 0x65, 0x2b, 0xf9, 0x19, 0x7b, 0xcb, 0x01, 0x92, 0x71, 0xac, 0xbb, 0x33, 0xf1,
+  0x29, 0x12, 0x1f, 0xf9, 0x50, 0xa4, 0x16, 0xbb, 0x0f, 0x68, 0xa3, 0x23, 0x62, 0x31, 0x8a, 0xa6,
+  0x63, 0x07, 0x12, 0x8c, 0x89, 0xf6, 0x31, 0x6c, 0x77, 0x58, 0xf3, 0xbb, 0xd4, 0x78, 0x74, 0x6d,
+  0x37, 0xa4, 0x5d, 0x1f, 0xa5, 0x80, 0xb7, 0xe3, 0x0a, 0xe0, 0x64, 0xf0, 0x8a, 0x49, 0xa6, 0xec,
+  0x1d, 0x67, 0x17, 0xaf, 0x79, 0x1f, 0x75, 0x39, 0x50, 0x2f, 0x87, 0x59, 0x6b, 0x14, 0xcc, 0x6c,
+  0x0e, 0x3b, 0x03, 0x1f, 0x30, 0xc4, 0x03, 0x7b, 0x45, 0xf9, 0xbd, 0x92, 0xe8, 0x7b, 0xe4, 0x09,
+  0x4d, 0xad, 0x8f, 0x07, 0x3f, 0xba, 0x4f, 0x3f, 0x43, 0x1c, 0x43, 0xdb, 0x45, 0x09, 0x40, 0x04,
+  0xe0, 0x13, 0x06, 0xc0, 0x2e, 0xb9, 0xbb, 0xd1, 0xbf, 0x2b, 0x6d, 0xff, 0xbe, 0x50, 0x83, 0xf2,
+  0xd4, 0xa0, 0xfc, 0x6a, 0xf8, 0xfb, 0x19, 0x22, 0x8f, 0xdb, 0x0b, 0x24, 0x66, 0x32, 0x9a, 0xf1,
+  0x00, 0xf8, 0x75, 0x14, 0xf0, 0x9b, 0x28, 0x58, 0xd9, 0x38, 0x33, 0x75, 0x49, 0x93, 0xa1, 0xb1,
+  0xfb, 0x6d, 0xd8, 0x37, 0xb7, 0x78, 0x69, 0x29, 0x19, 0xaa, 0xfe, 0xe8, 0xba, 0x93, 0x6c, 0x5f,
+  0x1a, 0xf6, 0x08, 0x33, 0x2a, 0xcf, 0x03, 0x5d, 0x5d, 0x19, 0x40, 0xb7, 0x81, 0xa9, 0x40, 0x86,
+  0x82, 0x79, 0xb8, 0x79, 0x8c, 0x9a, 0x04, 0x0b, 0x09, 0xdd, 0x3a, 0x82, 0x7c, 0x10, 0x41, 0x78,
+  0xae, 0x6d, 0x87, 0x02, 0x6e, 0xdf, 0xee, 0x17, 0x33, 0x02, 0x1a, 0xdd, 0x75, 0xd1, 0x7d, 0x6d,
+  0xda, 0x9f, 0x74, 0xdc, 0x2e, 0xc6, 0x1e, 0x89, 0xe5, 0x98, 0x7e, 0x7c, 0x25, 0x1d, 0x87, 0xf0,
+  0xae, 0x23, 0xdd, 0x6b, 0x82, 0x5a, 0x6c, 0x6c, 0x12, 0xdc, 0x80, 0x0f, 0xbb, 0x48, 0x30, 0x60,
+  0x73, 0xce, 0xd6, 0x81, 0xae, 0x62, 0xe9, 0x06, 0xc4, 0xfe, 0xd1, 0xfb, 0xb9, 0xf8, 0xe1, 0x07,
+  0x10, 0xda, 0x60, 0x2d, 0x9b, 0x9d, 0xb1, 0x2f, 0xd8, 0x76, 0xa1, 0xef, 0x43, 0x5b, 0xee, 0x00,
+  0xfd, 0x08, 0xee, 0x49, 0xf0, 0xe0, 0x57, 0xc7, 0x4f, 0x10, 0xb1, 0x03, 0xda, 0x9c, 0x93, 0x3f,
+  0x0e, 0xc7, 0xd7, 0x43, 0x0b, 0x36, 0x62, 0xef, 0x01, 0x09, 0xee, 0x81, 0x04, 0x1e, 0x82, 0x76,
+  0x59, 0x77, 0x50, 0x8d, 0x10, 0x3a, 0x53, 0xdb, 0xf5, 0x22, 0x60, 0x8d, 0x15, 0x8a, 0xe7, 0x2a,
+  0xe9, 0xee, 0xa0, 0xde, 0x7b, 0x6f, 0xe7, 0x7d, 0xe0, 0x0d, 0x74, 0x1f, 0x33, 0x0a, 0x92, 0x44,
+  0x26, 0x28, 0xfd, 0x94, 0x13, 0xf0, 0xf1, 0x2c, 0x14, 0xbc, 0x66, 0xaf, 0x84, 0xc4, 0x5e, 0x82,
+  0x44, 0x5d, 0x86, 0x74, 0x2e, 0xe7, 0x18, 0xda, 0x4c, 0x76, 0x06, 0x20, 0xbf, 0x1d, 0x0e, 0x6b,
+  0x6a, 0x33, 0x61, 0xb4, 0x13, 0x25, 0xa3, 0x48, 0xca, 0x71, 0xff, 0x62, 0x0f, 0xbf, 0x02, 0x9a,
+  0xde, 0x2f, 0x92, 0x4f, 0x47, 0xd3, 0xf0, 0x79, 0x77, 0x54, 0xf0, 0x98, 0x8d, 0x6e, 0xe9, 0xf5,
+  0xe1, 0x9c, 0xba, 0x0b, 0xb8, 0x72, 0x80, 0x78, 0x36, 0x59, 0x20, 0xd4, 0xf5, 0xae, 0x63, 0xb7,
+  0xb3, 0x4f, 0x35, 0x9f, 0x08, 0x9b, 0x1f, 0x86, 0x2f, 0xd4, 0xaa, 0x38, 0x06, 0x3e, 0xa7, 0x16,
+  0x79, 0x5d, 0xad, 0xbc, 0x63, 0x09, 0x74, 0x6a, 0x51, 0x67, 0x6b, 0x9d, 0x3f, 0x83, 0x98, 0xf6,
+  0xfa, 0x41, 0xa2, 0x2d, 0x62, 0x56, 0xfb, 0x6d, 0xc6, 0x0c, 0xdc, 0x5e, 0x8e, 0x7b, 0xa3, 0xa0,
+  0x59, 0x46, 0x44, 0x83, 0x6a, 0x7f, 0x32, 0x3f, 0x23, 0x69, 0x7a, 0xb7, 0x92, 0x1f, 0x2f, 0xd5,
+  0x45, 0x0c, 0x66, 0xb3, 0xaf, 0x8b, 0x69, 0x38, 0xb8, 0x0e, 0x12, 0xc2, 0x15, 0x47, 0xaf, 0xfb,
+  0xc3, 0x0f, 0xa8, 0x61, 0x67, 0xc9, 0xe3, 0x5f, 0x07, 0x26, 0x75, 0xdd, 0xe1, 0x43, 0x71, 0x96,
+  0xb2, 0xe2, 0x26, 0x22, 0xe5, 0xdc, 0x62, 0xf6, 0xdc, 0xa6, 0xdf, 0xc5, 0xc8, 0xda, 0xf7, 0xfd,
+  0xd2, 0x51, 0x04, 0x2f, 0x30, 0x05, 0x87, 0xda, 0x89, 0x3c, 0x61, 0xcf, 0xd4, 0x2e, 0x6a, 0xda,
+  0x86, 0x13, 0xdf, 0x6d, 0x12, 0x48, 0x4a, 0x23, 0xae, 0x04, 0x64, 0x6f, 0xd4, 0x0e, 0xb0, 0xca,
+  0xb7, 0x03, 0xa3, 0xf6, 0xc0, 0xf2, 0xb7, 0x03, 0xfb, 0x8e, 0x87, 0x8c, 0xfd, 0x0a, 0x3f, 0x2b,
+  0x26, 0x9c, 0xbd, 0xc5, 0x85, 0x94, 0xf6, 0x44, 0x14, 0xa4, 0xa3, 0x00, 0xdc, 0x93, 0x51, 0x40,
+  0x46, 0x41, 0x22, 0x0a, 0xd0, 0x1b, 0x32, 0x0a, 0xe8, 0x28, 0x00, 0xf6, 0x3b, 0xd2, 0x2f, 0x2e,
+  0xc9, 0xc1, 0x5a, 0xe2, 0x1f, 0x86, 0xe5, 0xc2, 0xa6, 0x1f, 0x20, 0xb8, 0x7f, 0x9d, 0xfc, 0xe0,
+  0x37, 0xba, 0x28, 0x20, 0x53, 0x51, 0xdb, 0xcd, 0xf1, 0xda, 0x48, 0xd3, 0xa7, 0xd1, 0x5a, 0xfe,
+  0x3a, 0x06, 0x81, 0x2c, 0x85, 0x57, 0x8e, 0xe1, 0x24, 0xf4, 0xcd, 0xaf, 0x39, 0x82, 0x53, 0xf5,
+  0xa2, 0x4d, 0x5e, 0x64, 0x14, 0xa0, 0x8b, 0x48, 0xce, 0x93, 0x43, 0x68, 0xe4, 0x9e, 0xd0, 0xc8,
+  0x03, 0xa1, 0xd9, 0xef, 0xa8, 0x28, 0x20, 0x8f, 0x55, 0x7a, 0x51, 0x64, 0x66, 0xbe, 0x65, 0x2e,
+  0x3d, 0xc1, 0x7a, 0xfe, 0x1a, 0xb0, 0x90, 0xde, 0x63, 0x81, 0x3e, 0xd5, 0x7b, 0xde, 0x53, 0xfb,
+  0xd5, 0xe7, 0xe0, 0x87, 0xde, 0xe3, 0x27, 0xbd, 0xc7, 0x0f, 0x6d, 0x83, 0xc0, 0x05, 0x7d, 0x41,
+  0x50, 0x07, 0x14, 0x53, 0xfb, 0xb5, 0x4c, 0xed, 0xd7, 0xb2, 0xf3, 0x8e, 0xf2, 0x47, 0x71, 0xf2,
+  0x46, 0x1c, 0x7b, 0xe2, 0x1f, 0xfd, 0x35, 0xe0, 0x38, 0xb3, 0xc7, 0x71, 0x32, 0x10, 0xc7, 0xd4,
+  0x01, 0xc7, 0xc9, 0x3d, 0x8e, 0x33, 0x7b, 0x1c, 0x27, 0xf7, 0x38, 0xa6, 0xae, 0xc1, 0x31, 0xb5,
+  0xc7, 0x71, 0x72, 0x8f, 0x63, 0xea, 0x0c, 0x8e, 0xa9, 0x1b, 0x71, 0x7c, 0x1c, 0x52, 0xea, 0xaf,
+  0x01, 0xc7, 0xf4, 0x1e, 0xc7, 0x89, 0xdb, 0x70, 0x4c, 0x5f, 0x89, 0x63, 0x2f, 0x62, 0x13, 0x07,
+  0xc4, 0x7a, 0xd1, 0x99, 0xb8, 0x11, 0x9d, 0xde, 0x30, 0x60, 0x37, 0xe2, 0xf3, 0xdb, 0x8e, 0x9f,
+  0x7e, 0xf7, 0x9f, 0x98, 0x0d, 0x0a, 0x91, 0x63, 0xea, 0xd2, 0xfa, 0x24, 0xb0, 0x1a, 0xfa, 0xf3,
+  0xc9, 0xa6, 0x69, 0x84, 0x2b, 0xe2, 0xf3, 0x29, 0xaa, 0x3e, 0x91, 0x36, 0xdd, 0x91, 0xc9, 0x28,
+  0x48, 0xf9, 0x7d, 0x4f, 0x44, 0x01, 0x69, 0xa3, 0x3c, 0xeb, 0x5b, 0x9d, 0xc6, 0xdc, 0x85, 0x4c,
+  0x44, 0x01, 0xfd, 0x39, 0xc8, 0x88, 0xf2, 0x3d, 0x0e, 0xbe, 0xfb, 0x2a, 0xb6, 0xeb, 0x20, 0x58,
+  0x1f, 0xce, 0xa1, 0xeb, 0x4b, 0xe7, 0xd0, 0xa0, 0xc3, 0x64, 0x32, 0x38, 0xf7, 0xb5, 0xee, 0x52,
+  0xba, 0xf0, 0x41, 0x47, 0x92, 0x9d, 0x35, 0xe2, 0x50, 0xf0, 0x8c, 0x64, 0xbd, 0xb3, 0x43, 0x1c,
+  0x15, 0xa6, 0x6e, 0x4f, 0x74, 0x8e, 0x6e, 0xa4, 0x1a, 0xa2, 0x2a, 0x23, 0xda, 0x09, 0xb9, 0x66,
+  0xff, 0xd3, 0x06, 0xfc, 0x0e, 0x24, 0x3f, 0x7f, 0x5a, 0xe3, 0x7f, 0x90, 0x6d, 0x37, 0x85, 0xed,
+  0x5c, 0x34, 0x1a, 0x29, 0x1d, 0x20, 0x4f, 0xea, 0x47, 0x69, 0xb8, 0x5d, 0x7e, 0x59, 0x14, 0x4d,
+  0x47, 0x01, 0x3a, 0x3e, 0xee, 0x9b, 0x0b, 0xf2, 0xcf, 0x9a, 0x9e, 0x05, 0x31, 0xbd, 0x06, 0x04,
+  0x7b, 0x16, 0x04, 0x7b, 0x0d, 0x88, 0x6f, 0x39, 0x26, 0x9f, 0xaa, 0x63, 0xbf, 0xc3, 0x29, 0xf8,
+  0xbb, 0x49, 0xdf, 0xf1, 0x38, 0x48, 0x25, 0xd7, 0xa9, 0x24, 0x58, 0xaa, 0x12, 0x7f, 0xcf, 0x28,
+  0xfc, 0x3d, 0x27, 0x5b, 0x06, 0xf2, 0xa3, 0x59, 0xe0, 0xb0, 0x5f, 0xd8, 0x48, 0x88, 0x34, 0xc2,
+  0x20, 0x44, 0xdc, 0x23, 0x3f, 0xba, 0x83, 0xad, 0xf0, 0x71, 0x7f, 0xaf, 0x08, 0xdd, 0xbd, 0x3b,
+  0x52, 0xfb, 0xa9, 0xaa, 0x6c, 0xc4, 0x51, 0x1c, 0xc1, 0x9f, 0x14, 0x14, 0x48, 0xf0, 0x27, 0x04,
+  0x2b, 0x36, 0x33, 0x80, 0xa9, 0x4e, 0x21, 0xe2, 0x6c, 0xb6, 0xba, 0xee, 0x50, 0x20, 0x26, 0x7a,
+  0x8e, 0x03, 0xa7, 0xf1, 0x16, 0x52, 0xae, 0xe5, 0x74, 0x52, 0x06, 0xc5, 0x44, 0xc0, 0xd1, 0xe5,
+  0xaa, 0xaa, 0x41, 0x89, 0xd5, 0xe5, 0x54, 0x9c, 0x89, 0xdc, 0x6a, 0xf4, 0xb6, 0xaa, 0x97, 0xcb,
+  0xf1, 0x1a, 0xdd, 0xa0, 0x94, 0x4d, 0x32, 0x31, 0xa0, 0x0a, 0x2d, 0x53, 0x1c, 0x36, 0x28, 0x6b,
+  0x62, 0xd5, 0xba, 0x8d, 0x88, 0x98, 0x2e, 0xbd, 0xae, 0x73, 0xc4, 0x38, 0xd7, 0x30, 0x9b, 0x5c,
+  0x35, 0xd3, 0x62, 0xd9, 0xd7, 0x41, 0x47, 0x96, 0x2b, 0xea, 0x30, 0xfe, 0xdc, 0x5e, 0x6d, 0x09,
+  0x42, 0x5f, 0x8e, 0xde, 0x9a, 0xf3, 0xd7, 0x6d, 0xba, 0x34, 0x7e, 0x4e, 0xe7, 0xfb, 0x6f, 0x2d,
+  0x76, 0x29, 0xa5, 0xde, 0x3a, 0xb5, 0x55, 0x77, 0xc4, 0x24, 0xe7, 0xab, 0x76, 0x76, 0x5c, 0xad,
+  0x65, 0xea, 0xab, 0xee, 0xc2, 0x4c, 0x8f, 0x97, 0xad, 0x97, 0xd7, 0xf8, 0xa2, 0x55, 0xcf, 0x53,
+  0x6d, 0x55, 0x90, 0xd5, 0x86, 0x56, 0xda, 0xbc, 0x4d, 0xc4, 0xc2, 0x78, 0x6d, 0x96, 0x93, 0x75,
+  0xf3, 0x25, 0xb3, 0x98, 0x24, 0x07, 0x7c, 0xd6, 0x7a, 0x91, 0xaa, 0xd5, 0xfe, 0x26, 0xc2, 0xf1,
+  0x52, 0x3f, 0xb3, 0x1a, 0x3e, 0xb7, 0xa9, 0xf8, 0xa0, 0xd8, 0x49, 0x15, 0x07, 0x66, 0x7e, 0x91,
+  0x98, 0x35, 0x54, 0xee, 0x25, 0xc2, 0x34, 0xde, 0xe2, 0x59, 0xc6, 0x1c, 0x4e, 0xba, 0xa3, 0x69,
+  0x31, 0xd9, 0x8d, 0x97, 0x4a, 0x95, 0x59, 0x37, 0x07, 0x53, 0x6f, 0xcf, 0x7c, 0x9e, 0x9c, 0x8b,
+  0x93, 0x74, 0x0f, 0x16, 0xde, 0xba, 0x9d, 0xdc, 0x6a, 0xbb, 0x92, 0x13, 0x0d, 0x39, 0x65, 0x56,
+  0x3a, 0x59, 0xfd, 0xcd, 0x8c, 0x0c, 0x53, 0x62, 0x6f, 0xcb, 0x10, 0x11, 0x23, 0xb1, 0xd6, 0x37,
+  0x8d, 0xe7, 0x56, 0xce, 0x58, 0xb3, 0xeb, 0x5a, 0x9a, 0xcf, 0x6e, 0x4b, 0x95, 0xea, 0x24, 0xdb,
+  0xaa, 0x40, 0xa9, 0x3b, 0xc9, 0x0c, 0xc7, 0x8a, 0xf1, 0x5a, 0x9f, 0xf3, 0xcb, 0xf6, 0x66, 0x46,
+  0x32, 0x74, 0x77, 0xc1, 0xd5, 0x07, 0x91, 0xe9, 0x5b, 0x76, 0x32, 0x6b, 0xd7, 0x94, 0x4d, 0x7c,
+  0x34, 0x4e, 0x2b, 0x56, 0x87, 0x6b, 0x92, 0x1a, 0xf9, 0xda, 0x36, 0x92, 0xfa, 0x64, 0xbe, 0xa9,
+  0x37, 0xc5, 0xad, 0x5a, 0xaf, 0x6a, 0x82, 0xd1, 0xec, 0x26, 0xc7, 0x9c, 0xc5, 0xb3, 0x74, 0xbe,
+  0x91, 0x9b, 0x64, 0x60, 0x36, 0x35, 0x2d, 0xa7, 0xb4, 0x21, 0xd1, 0x5e, 0x51, 0x59, 0x22, 0xd9,
+  0x4f, 0xb4, 0xb4, 0xe7, 0x76, 0x75, 0xdb, 0x10, 0xcb, 0x6a, 0x95, 0x94, 0x4d, 0x2e, 0x6b, 0xbe,
+  0xaa, 0xfd, 0xf6, 0x70, 0xb4, 0xc8, 0xbd, 0xd5, 0x66, 0x6d, 0x6a, 0xd2, 0x96, 0x94, 0xe6, 0x22,
+  0x51, 0xcb, 0x74, 0x04, 0xa3, 0x99, 0x8b, 0x37, 0x2d, 0xb8, 0x9c, 0xc5, 0x7b, 0x8b, 0xb9, 0x9a,
+  0x4f, 0xf5, 0xaa, 0x5c, 0x61, 0xfb, 0xb6, 0x8c, 0x64, 0x5e, 0xa7, 0x89, 0x39, 0x95, 0x6d, 0x57,
+  0x4a, 0xa3, 0x0d, 0xec, 0x55, 0x95, 0x41, 0xae, 0xcb, 0x70, 0xa5, 0x0a, 0xa5, 0x0a, 0x55, 0x76,
+  0xb2, 0x6c, 0xb7, 0xd2, 0xc4, 0x94, 0x19, 0x2b, 0x2c, 0x6f, 0xd4, 0xad, 0xd9, 0x6b, 0x23, 0xc2,
+  0x65, 0xdf, 0xe4, 0x6a, 0xa3, 0x51, 0xed, 0x56, 0xf4, 0xa5, 0x39, 0x6f, 0xc8, 0xda, 0xab, 0x49,
+  0x17, 0x5e, 0xeb, 0xb5, 0x62, 0xdc, 0x58, 0xcd, 0x98, 0x79, 0xf6, 0xb5, 0x56, 0x54, 0x47, 0xdd,
+  0xc1, 0x96, 0x7f, 0x6e, 0x2e, 0x04, 0xbe, 0x50, 0xd7, 0x06, 0xa6, 0xd9, 0x10, 0x4c, 0x36, 0xf1,
+  0x3c, 0x57, 0xd3, 0x8b, 0xb6, 0xd5, 0x8d, 0x67, 0xf4, 0xd1, 0x94, 0xa4, 0xde, 0x3a, 0xab, 0xa2,
+  0x3a, 0x60, 0xf5, 0xe2, 0x26, 0x5d, 0x7d, 0xd1, 0xc7, 0x9d, 0x79, 0x64, 0x4c, 0x64, 0x5f, 0x24,
+  0xa3, 0x5a, 0x86, 0x13, 0x4e, 0x7a, 0xc9, 0x26, 0x86, 0x7d, 0x42, 0xa7, 0xf4, 0xf2, 0xab, 0x29,
+  0x1b, 0x59, 0xad, 0x97, 0xae, 0x35, 0xdf, 0x2a, 0x9a, 0x95, 0xec, 0x51, 0xe5, 0x97, 0x76, 0x66,
+  0xb3, 0x1c, 0xe5, 0xea, 0x64, 0xb2, 0x9a, 0xee, 0xc6, 0xfb, 0xa9, 0x66, 0xa2, 0x52, 0xcb, 0x55,
+  0x35, 0xcb, 0x6a, 0xbd, 0x18, 0xeb, 0xd7, 0xa6, 0x31, 0x15, 0x47, 0x9a, 0x96, 0x4e, 0xac, 0xdf,
+  0x2a, 0xc3, 0xcc, 0xfa, 0x59, 0x90, 0x23, 0x9c, 0xd8, 0x9c, 0x2f, 0xb3, 0xe2, 0xe8, 0xc5, 0xd0,
+  0x4a, 0x2c, 0xd9, 0x1f, 0x4f, 0xd5, 0x91, 0xd1, 0xaf, 0x73, 0xa5, 0xca, 0xa4, 0x5e, 0x2e, 0x25,
+  0xc8, 0x7a, 0xbc, 0xa3, 0x57, 0x18, 0x96, 0x35, 0xf9, 0x29, 0x34, 0x07, 0xdb, 0x99, 0xa2, 0x96,
+  0x39, 0x7e, 0x49, 0xb4, 0xdf, 0xb2, 0x0c, 0xdf, 0x6a, 0x9b, 0xb0, 0xd6, 0x5f, 0x8c, 0x1a, 0x2b,
+  0x31, 0x3d, 0xa3, 0x3b, 0xc3, 0xf6, 0x34, 0xd3, 0xa3, 0xd7, 0x39, 0x56, 0x55, 0xc8, 0xc1, 0x52,
+  0x64, 0xd2, 0xa9, 0xe7, 0x9e, 0x35, 0x5f, 0xae, 0x9e, 0xe5, 0x48, 0x7a, 0xd0, 0x91, 0xcc, 0xf1,
+  0xa4, 0x4e, 0xf4, 0xd9, 0x14, 0xb7, 0x51, 0x9f, 0x99, 0x64, 0x27, 0xd9, 0x30, 0xe9, 0x7c, 0x75,
+  0x62, 0xc5, 0x2b, 0xaa, 0x25, 0x8d, 0xe7, 0xfd, 0x54, 0x21, 0x99, 0x1d, 0xd5, 0x92, 0xf3, 0x64,
+  0x65, 0xc1, 0xbd, 0x4d, 0x79, 0x31, 0xaf, 0x4f, 0xd7, 0x2f, 0xcf, 0x66, 0xb3, 0xb6, 0x24, 0x84,
+  0x91, 0x16, 0xb7, 0x3a, 0xa9, 0xee, 0x33, 0xd5, 0x5e, 0xb5, 0xb5, 0xe1, 0x6a, 0x1d, 0x67, 0x88,
+  0x52, 0x61, 0xc0, 0x19, 0xcd, 0xf1, 0xac, 0xc7, 0xa5, 0x12, 0x50, 0x2f, 0xd7, 0x12, 0xcd, 0x45,
+  0x64, 0x2e, 0x8d, 0x56, 0xbd, 0xe6, 0x9b, 0x90, 0x49, 0x70, 0xa5, 0x19, 0x99, 0xcf, 0xd4, 0xab,
+  0xca, 0x26, 0x45, 0xbe, 0xb4, 0xa4, 0x69, 0xa4, 0x09, 0x47, 0xd9, 0xfa, 0x1a, 0x56, 0x61, 0xf7,
+  0x6d, 0x5d, 0x8d, 0x68, 0xac, 0x56, 0x9a, 0x4d, 0xbb, 0xe3, 0x14, 0xf3, 0x5a, 0x10, 0xcc, 0x0e,
+  0x35, 0xac, 0x5b, 0x89, 0x9a, 0x2a, 0xbc, 0xad, 0x93, 0x14, 0xa5, 0xcc, 0x1b, 0x09, 0xb2, 0xfc,
+  0x4a, 0x08, 0x14, 0x91, 0xb0, 0x46, 0x0d, 0xb1, 0x48, 0xd6, 0xb7, 0xe5, 0xbe, 0xa2, 0x34, 0x0b,
+  0xe6, 0x62, 0xdb, 0x68, 0x99, 0x44, 0xad, 0x5d, 0x9e, 0xc2, 0x08, 0x91, 0xe7, 0xca, 0xa5, 0x17,
+  0x7e, 0x4b, 0x94, 0x56, 0x0a, 0x61, 0x29, 0xb3, 0x34, 0xac, 0xc4, 0xbb, 0xdd, 0x64, 0xba, 0x35,
+  0x22, 0xd2, 0x19, 0x6b, 0xdb, 0xcd, 0x56, 0x05, 0x53, 0x5c, 0xb5, 0xbb, 0xf4, 0xb8, 0x51, 0x1b,
+  0x0c, 0xe2, 0x1b, 0xb9, 0xc9, 0x19, 0x5a, 0xce, 0xaa, 0xd5, 0x61, 0xae, 0xd8, 0x4a, 0x17, 0xe9,
+  0x16, 0xd5, 0x82, 0xa5, 0xc1, 0xe4, 0xf9, 0xb5, 0x2b, 0x3c, 0xaf, 0xd9, 0x76, 0xba, 0xdb, 0xd9,
+  0xac, 0x17, 0xaf, 0xab, 0x59, 0x5d, 0x4f, 0x34, 0xb4, 0xd7, 0xd4, 0x5b, 0xbe, 0x1a, 0x37, 0x88,
+  0xdc, 0xbc, 0x4c, 0x6c, 0xd6, 0xd3, 0xd7, 0x55, 0xe6, 0xf9, 0xa5, 0xc9, 0x25, 0x95, 0xc5, 0xa4,
+  0x91, 0xe9, 0xf6, 0xd3, 0x4c, 0x23, 0xf1, 0xbc, 0xad, 0x74, 0x5e, 0xd3, 0x43, 0x29, 0xd7, 0x96,
+  0x52, 0x15, 0x4e, 0xdb, 0x54, 0x52, 0x1b, 0xaa, 0x63, 0x8e, 0x2a, 0xcb, 0xc2, 0xa4, 0xce, 0x26,
+  0xd4, 0x9a, 0x50, 0x6a, 0x6f, 0x96, 0x54, 0x37, 0xcf, 0xf4, 0x93, 0x5d, 0x6a, 0x24, 0x8b, 0xf9,
+  0x54, 0xaf, 0x51, 0x49, 0x4c, 0x4a, 0x63, 0x71, 0xc0, 0x59, 0x8b, 0xb4, 0x92, 0x58, 0x65, 0x55,
+  0x49, 0xab, 0xe9, 0xcb, 0xc9, 0x30, 0xcf, 0x10, 0xab, 0xec, 0x73, 0xbc, 0x57, 0xa8, 0x4c, 0xc7,
+  0xe9, 0xba, 0x99, 0xa8, 0xa4, 0x3b, 0xd3, 0x26, 0x5d, 0x6a, 0xc7, 0x07, 0x0d, 0x69, 0xd0, 0xeb,
+  0xc9, 0x6d, 0x2e, 0xab, 0x99, 0xe5, 0x61, 0xbe, 0xfd, 0x46, 0x6a, 0x2f, 0xc9, 0x1a, 0xcb, 0x5a,
+  0x1c, 0xc9, 0x49, 0xf5, 0x75, 0x71, 0xa0, 0x89, 0x91, 0xcc, 0x78, 0x32, 0x23, 0xa9, 0x44, 0xf5,
+  0x8d, 0x78, 0xeb, 0x89, 0xc5, 0xd4, 0x76, 0xd8, 0x10, 0xa7, 0x85, 0xe2, 0xb0, 0x4d, 0x6f, 0x59,
+  0xf1, 0x35, 0x29, 0x71, 0x71, 0xfe, 0x79, 0x5a, 0x6c, 0x75, 0xb7, 0xcb, 0x72, 0x69, 0x5c, 0xdd,
+  0x16, 0x07, 0x29, 0xaa, 0x5e, 0xa6, 0xc5, 0xf8, 0x98, 0xa5, 0x1a, 0xb9, 0x79, 0x27, 0xb5, 0x59,
+  0xc1, 0xce, 0x1a, 0x16, 0x94, 0x65, 0x4f, 0x63, 0xd7, 0xc9, 0x0e, 0x3b, 0x17, 0x2a, 0x71, 0x75,
+  0x46, 0xa7, 0x8c, 0xa2, 0xf0, 0x9c, 0xec, 0x6f, 0x29, 0xb1, 0x25, 0x1b, 0xb3, 0x5e, 0x61, 0x59,
+  0x34, 0xba, 0xbd, 0x79, 0x43, 0x5b, 0x97, 0xe7, 0x8d, 0xba, 0xdc, 0x4f, 0x29, 0xcb, 0xec, 0x66,
+  0x9c, 0x1f, 0xab, 0xe6, 0x62, 0x5d, 0x4c, 0xd4, 0xcc, 0x75, 0xb2, 0xc5, 0x6e, 0xc9, 0x42, 0x9b,
+  0x13, 0x29, 0x45, 0x9a, 0x55, 0xa8, 0xad, 0x34, 0x2a, 0x24, 0x47, 0xaf, 0xb3, 0x04, 0x23, 0xa7,
+  0x9b, 0xf5, 0xd7, 0xa2, 0x66, 0xd6, 0xb3, 0x83, 0x0a, 0x4d, 0xc4, 0xc9, 0xc2, 0x08, 0x4a, 0x63,
+  0x71, 0x94, 0x6f, 0xb7, 0xbb, 0xcc, 0xcb, 0xa4, 0x1f, 0x67, 0xa6, 0x73, 0x33, 0x23, 0xcf, 0x16,
+  0x66, 0xae, 0xa8, 0xd6, 0x49, 0x73, 0x15, 0x61, 0xf9, 0xc5, 0xba, 0x5a, 0xd7, 0x97, 0x83, 0x89,
+  0x96, 0xe7, 0x5f, 0x5b, 0x0c, 0x4d, 0xe7, 0xf5, 0x52, 0x5c, 0x6b, 0x35, 0xde, 0xaa, 0x5d, 0xa6,
+  0x4f, 0x73, 0x93, 0xc4, 0x5a, 0x10, 0xbb, 0xb5, 0x34, 0xbd, 0xec, 0x54, 0xaa, 0xa9, 0xe1, 0xa8,
+  0x37, 0x54, 0x27, 0x9a, 0xa1, 0xf6, 0xcc, 0xca, 0xe0, 0x95, 0x79, 0x29, 0x9a, 0xd9, 0x32, 0xd9,
+  0x4c, 0xe9, 0xfc, 0xa6, 0xf6, 0x36, 0xaf, 0x8d, 0xcc, 0x99, 0xd4, 0x1a, 0xb4, 0x9f, 0xe7, 0xea,
+  0x2b, 0xbd, 0xa9, 0x72, 0x83, 0x6d, 0xa1, 0xa2, 0x09, 0xf5, 0x6e, 0x35, 0x43, 0x58, 0xab, 0x44,
+  0xad, 0x23, 0x97, 0xe3, 0xab, 0xe7, 0xec, 0xb8, 0x6f, 0x25, 0x8d, 0xdc, 0xb6, 0xd0, 0x35, 0x93,
+  0xc5, 0xbc, 0x6c, 0xc6, 0xc9, 0x6e, 0x52, 0xa7, 0x1a, 0xd4, 0x1a, 0x16, 0xd3, 0x8d, 0x55, 0x25,
+  0xd3, 0x7b, 0x5d, 0x45, 0x6a, 0xb9, 0x19, 0xdd, 0x7d, 0x6d, 0x40, 0x32, 0xd3, 0xed, 0xf1, 0xcd,
+  0x75, 0x7c, 0xbe, 0x49, 0xaa, 0xdc, 0xc6, 0x12, 0x65, 0x2d, 0x37, 0x9f, 0xb2, 0x6f, 0x9b, 0x75,
+  0x77, 0x64, 0x26, 0xd2, 0xea, 0x50, 0x15, 0x22, 0x75, 0xb6, 0xf1, 0x52, 0xd0, 0xf8, 0x01, 0xdc,
+  0x2a, 0x5c, 0x6f, 0x51, 0x5f, 0xac, 0x92, 0x1b, 0xbd, 0x9a, 0x6c, 0x16, 0xb4, 0x2d, 0xd7, 0xe3,
+  0x66, 0x8d, 0xfa, 0x2b, 0x23, 0xeb, 0xed, 0xd1, 0xdb, 0x6a, 0x33, 0x7b, 0x6d, 0x2b, 0x95, 0xfa,
+  0x36, 0x4d, 0x13, 0xc9, 0x08, 0x93, 0x35, 0x16, 0xcd, 0xd2, 0x6b, 0x5b, 0x31, 0xe7, 0xad, 0x56,
+  0x6f, 0x1a, 0xe7, 0xf8, 0xec, 0xf8, 0x79, 0x9e, 0xa1, 0x36, 0x62, 0xb9, 0xf0, 0xc6, 0x8d, 0xb6,
+  0xe5, 0x61, 0xbe, 0x53, 0x2d, 0xe8, 0x9b, 0x36, 0xad, 0xd6, 0xf4, 0x62, 0xbc, 0x25, 0xd7, 0x6a,
+  0x19, 0x52, 0x2f, 0x75, 0x47, 0xa3, 0x46, 0x8a, 0xd8, 0x6c, 0x23, 0xdb, 0xcc, 0x4b, 0xb2, 0x96,
+  0x1e, 0x76, 0x57, 0x91, 0x06, 0xb9, 0x52, 0x0a, 0xa2, 0xc4, 0x15, 0x96, 0xb5, 0x1c, 0x4c, 0xbe,
+  0xc8, 0x23, 0x7a, 0xd2, 0x20, 0x72, 0x91, 0xa6, 0xc0, 0xe7, 0x92, 0x09, 0x53, 0x1a, 0x25, 0xf8,
+  0x37, 0x4d, 0x89, 0x68, 0xec, 0x90, 0x9d, 0x17, 0x68, 0xba, 0xbb, 0x24, 0x7a, 0x85, 0x64, 0x55,
+  0x36, 0x86, 0xb9, 0x22, 0xcd, 0x42, 0x7e, 0xbb, 0xed, 0xc9, 0x11, 0x6e, 0x31, 0x5b, 0xb4, 0xa7,
+  0xf9, 0xe7, 0x32, 0xbd, 0xda, 0x90, 0x4c, 0x75, 0xb2, 0x9c, 0x0f, 0x53, 0xba, 0xde, 0x7e, 0xed,
+  0x0c, 0x18, 0x4b, 0x1c, 0x6c, 0x66, 0x91, 0xc6, 0x5b, 0x22, 0x37, 0x1b, 0x3c, 0xaf, 0x23, 0xab,
+  0x12, 0x5c, 0xb1, 0xed, 0x72, 0xab, 0xd2, 0x48, 0x16, 0x66, 0xcd, 0x56, 0xa7, 0xb1, 0xac, 0xb7,
+  0x73, 0x4c, 0x9e, 0x9b, 0xb7, 0xac, 0x82, 0x59, 0x56, 0xc4, 0xa6, 0x52, 0xac, 0x57, 0xf5, 0xe1,
+  0x73, 0xfd, 0x25, 0x0b, 0xf5, 0xb5, 0x40, 0x35, 0x9a, 0x59, 0xa1, 0xd6, 0x4e, 0x41, 0xab, 0x43,
+  0x6b, 0xcb, 0xcd, 0x9a, 0xae, 0x0e, 0xe3, 0xd4, 0x7c, 0x5e, 0x5f, 0xd4, 0x69, 0x4d, 0xc9, 0xf6,
+  0xe2, 0x25, 0x8a, 0x6d, 0x66, 0x32, 0xb2, 0xd4, 0x49, 0xaf, 0x87, 0xa3, 0x69, 0x96, 0x9f, 0xa4,
+  0x67, 0x53, 0x46, 0xa8, 0x9b, 0xb0, 0x96, 0x7d, 0x26, 0xeb, 0xe9, 0x55, 0x7b, 0x12, 0x9f, 0x47,
+  0x2a, 0x6f, 0x23, 0xab, 0x37, 0x1c, 0x25, 0x06, 0x75, 0xc5, 0x12, 0x4c, 0xad, 0x63, 0x29, 0xeb,
+  0x12, 0x5d, 0xa7, 0xdb, 0xdc, 0xb4, 0x94, 0x99, 0x8a, 0x8d, 0xe5, 0x0b, 0xfd, 0x46, 0x16, 0x32,
+  0xe3, 0x21, 0xdf, 0xe2, 0xca, 0x96, 0xc8, 0xc7, 0xbb, 0x53, 0x5a, 0xdd, 0x6e, 0xb8, 0x3a, 0xd9,
+  0x23, 0xb9, 0x4d, 0xff, 0x6d, 0x5e, 0xd7, 0x5e, 0x49, 0xa2, 0x3d, 0xae, 0x2f, 0x23, 0xda, 0x8b,
+  0xbe, 0x34, 0x73, 0x44, 0xaf, 0xc7, 0x6f, 0x6b, 0xf4, 0xc0, 0xda, 0x2c, 0x60, 0xce, 0x14, 0x97,
+  0x2f, 0x99, 0x1c, 0xc9, 0x8a, 0x8d, 0xb1, 0xbc, 0xb2, 0xaa, 0xad, 0x56, 0xef, 0x75, 0x4d, 0xd6,
+  0xd7, 0x33, 0x63, 0x34, 0xed, 0x57, 0x33, 0xa4, 0xbe, 0x34, 0x1b, 0x22, 0x5c, 0xbf, 0x52, 0xb4,
+  0x92, 0x92, 0x1a, 0x16, 0x64, 0xd8, 0x56, 0xea, 0xad, 0x6d, 0x54, 0x19, 0x7d, 0x26, 0xf4, 0x98,
+  0xf2, 0xbc, 0x43, 0x4b, 0xf9, 0xb6, 0xc8, 0x3c, 0xb3, 0x6f, 0x62, 0x97, 0x9f, 0x76, 0x14, 0x21,
+  0x97, 0x1e, 0x4c, 0xb7, 0x30, 0x55, 0x9d, 0x10, 0xf5, 0x79, 0xa7, 0xbe, 0x68, 0x57, 0xd8, 0x72,
+  0x44, 0x7c, 0x9d, 0xd2, 0x9b, 0x2a, 0xd1, 0x2c, 0x27, 0x4b, 0xf5, 0x4a, 0xbf, 0x4b, 0x93, 0x52,
+  0xa3, 0xca, 0xac, 0xd2, 0x6c, 0x6a, 0x6a, 0x0c, 0xd7, 0x66, 0x2d, 0x59, 0x1c, 0x65, 0xba, 0xbd,
+  0x7c, 0x57, 0x88, 0xab, 0xdc, 0x38, 0xb7, 0x52, 0x8d, 0x25, 0xc1, 0xb2, 0xad, 0x78, 0x75, 0x08,
+  0xc7, 0xbd, 0x4c, 0x9a, 0x5b, 0x4d, 0x4a, 0x9d, 0x8c, 0x5e, 0x49, 0x1b, 0xb3, 0xd7, 0x44, 0x64,
+  0xd3, 0x93, 0xc7, 0xd3, 0xf6, 0x7c, 0x3e, 0xd0, 0xbb, 0x94, 0x36, 0x60, 0x9a, 0x2c, 0x33, 0x9a,
+  0xf0, 0x4b, 0x6a, 0x5e, 0x79, 0x1e, 0x28, 0xab, 0xc5, 0x68, 0xfa, 0xac, 0x27, 0x9f, 0x37, 0x96,
+  0x4c, 0xe6, 0x46, 0x54, 0xbf, 0xd4, 0x88, 0x34, 0x13, 0x8d, 0x72, 0x61, 0x53, 0x4b, 0x6c, 0xb6,
+  0x2a, 0xdf, 0x21, 0x66, 0x05, 0x98, 0xd7, 0x9b, 0xca, 0xa2, 0xf8, 0x56, 0x4c, 0x18, 0xf5, 0x61,
+  0xa3, 0x3c, 0x1f, 0xf7, 0x8c, 0xb1, 0x05, 0xe7, 0x09, 0xc6, 0xc8, 0x8d, 0x5a, 0x9c, 0x66, 0x64,
+  0xa8, 0x82, 0x94, 0xc9, 0x67, 0x33, 0x93, 0x4e, 0xba, 0x57, 0x6a, 0xa7, 0xe9, 0x75, 0x17, 0x51,
+  0x14, 0x17, 0xc9, 0xf7, 0xd5, 0x0c, 0xa9, 0x09, 0xaf, 0xfd, 0xed, 0xa2, 0xb8, 0x60, 0xa7, 0x14,
+  0xd7, 0xac, 0x0e, 0xd5, 0xc1, 0x96, 0xdf, 0xe6, 0x1b, 0x8b, 0x66, 0x76, 0x31, 0xce, 0x52, 0x4a,
+  0xb5, 0x33, 0xec, 0xa6, 0xe6, 0x25, 0x23, 0x31, 0x9f, 0xeb, 0xa5, 0x6a, 0x82, 0x79, 0xe9, 0x33,
+  0x34, 0x5f, 0x34, 0xd7, 0xcb, 0x65, 0x21, 0x39, 0xa3, 0x5e, 0xd5, 0x62, 0x69, 0x51, 0x6e, 0xd4,
+  0x4b, 0xf2, 0x72, 0x9d, 0x6b, 0xb5, 0x21, 0x2c, 0x66, 0xb9, 0xf8, 0xa6, 0xc8, 0x8f, 0x8d, 0x81,
+  0x61, 0x88, 0x6f, 0xf3, 0x7a, 0x3f, 0xd1, 0x19, 0xb5, 0x57, 0x79, 0xaa, 0x9b, 0xce, 0x2f, 0xac,
+  0xe7, 0x69, 0x95, 0xd0, 0x73, 0x22, 0x33, 0x69, 0x17, 0x6a, 0x71, 0x82, 0x9d, 0xa7, 0x0a, 0xe3,
+  0x6d, 0x35, 0xc1, 0xd4, 0x06, 0x71, 0x2b, 0xf2, 0x22, 0x46, 0xe4, 0x49, 0xfc, 0xad, 0xa4, 0x57,
+  0xd8, 0xfc, 0x76, 0xd1, 0xa4, 0x58, 0xea, 0x79, 0xb2, 0x84, 0x12, 0x9b, 0x7f, 0x6d, 0xa4, 0x95,
+  0x59, 0x7e, 0xa2, 0x6d, 0x8c, 0x7c, 0xbd, 0xce, 0xc1, 0xe7, 0xfc, 0x74, 0x29, 0x25, 0xe7, 0x9b,
+  0x0a, 0xd9, 0x1b, 0xbf, 0x2e, 0xd2, 0xf9, 0x56, 0x4e, 0x6f, 0x6b, 0xc9, 0x62, 0x3b, 0xc9, 0x27,
+  0x33, 0x35, 0xd3, 0x28, 0x6e, 0x85, 0xe5, 0x6a, 0x23, 0x74, 0x33, 0x19, 0x39, 0x43, 0xf2, 0xd9,
+  0x56, 0x32, 0x3d, 0xa8, 0x47, 0xca, 0x52, 0x93, 0x89, 0xb0, 0x2f, 0xe9, 0x71, 0x43, 0x30, 0xcb,
+  0x66, 0xab, 0x64, 0xf0, 0xc2, 0x52, 0x16, 0x6b, 0x29, 0xb9, 0xb6, 0x29, 0xce, 0xcc, 0x7e, 0x2e,
+  0x35, 0x22, 0xa8, 0xf9, 0x60, 0x50, 0xd5, 0x05, 0xb6, 0x13, 0x99, 0xd5, 0xf5, 0x16, 0x23, 0x98,
+  0x63, 0x42, 0xc9, 0x90, 0xb0, 0x35, 0x5a, 0xc0, 0x31, 0x5f, 0xca, 0xcd, 0x7a, 0xec, 0xca, 0xaa,
+  0xce, 0xfb, 0x6f, 0x93, 0x5c, 0x7e, 0xcb, 0x24, 0x7b, 0x8c, 0xbe, 0x2a, 0xce, 0xb3, 0xb9, 0x97,
+  0x8c, 0xd2, 0x1f, 0xc8, 0xa5, 0xc5, 0x5b, 0xde, 0x28, 0xcc, 0x68, 0x6e, 0xdc, 0x99, 0xb7, 0x78,
+  0x2a, 0xd3, 0x9d, 0x08, 0x2a, 0x9b, 0xce, 0x8e, 0x8a, 0xf5, 0xcc, 0xac, 0x4d, 0xd4, 0xdb, 0xcf,
+  0xd3, 0x71, 0x87, 0x2f, 0xb4, 0x22, 0x85, 0x61, 0x8f, 0xc9, 0xcb, 0x35, 0x43, 0xab, 0x52, 0xa5,
+  0xf9, 0x84, 0x8c, 0xa7, 0x26, 0x23, 0x76, 0xab, 0xc0, 0x41, 0xb3, 0xb6, 0x4d, 0x51, 0xaf, 0x8d,
+  0xec, 0xf3, 0xba, 0xc2, 0xc7, 0xe9, 0xfe, 0x54, 0x92, 0x27, 0x65, 0x21, 0xb7, 0x4c, 0x96, 0x13,
+  0x19, 0xbe, 0x67, 0xca, 0x7a, 0x51, 0xeb, 0x2e, 0xfb, 0x85, 0x3e, 0x5d, 0x35, 0x14, 0xa9, 0x91,
+  0x2b, 0xd3, 0x83, 0xba, 0xb8, 0x29, 0xa7, 0x87, 0x16, 0xf9, 0x9a, 0x28, 0x95, 0x66, 0xb5, 0x42,
+  0x43, 0xcf, 0x08, 0x59, 0x75, 0xfe, 0xca, 0x2e, 0x17, 0xa2, 0x28, 0x17, 0x36, 0xf4, 0x14, 0x4a,
+  0xc2, 0x5a, 0xe0, 0xdf, 0x4a, 0xe2, 0xd4, 0x18, 0xaf, 0x52, 0xf9, 0xb7, 0x75, 0xcb, 0xdc, 0xe6,
+  0xb4, 0x31, 0xaf, 0xae, 0x7b, 0x85, 0x56, 0x67, 0xdd, 0x1b, 0xf7, 0xb8, 0xad, 0x5e, 0x18, 0xf3,
+  0x0b, 0x22, 0xf7, 0x9c, 0xa7, 0xf2, 0x5a, 0x6b, 0x5b, 0x69, 0xca, 0x1c, 0x93, 0x79, 0x13, 0x5f,
+  0xd8, 0xc5, 0x1b, 0xaf, 0xad, 0x16, 0xa4, 0xc0, 0x77, 0xde, 0x06, 0x45, 0xb6, 0xd5, 0xa4, 0xdf,
+  0x7a, 0xb3, 0x1c, 0x03, 0x89, 0x1a, 0xd5, 0xa8, 0xe9, 0x85, 0x6c, 0xab, 0x94, 0xd4, 0x4b, 0xcf,
+  0xc3, 0xe4, 0xac, 0x3e, 0xa1, 0x33, 0xd5, 0x1e, 0x34, 0x92, 0xc6, 0x20, 0x22, 0xc0, 0x56, 0x9d,
+  0xca, 0xa8, 0x25, 0x8e, 0xaf, 0x57, 0xe9, 0xea, 0x9b, 0x36, 0xb0, 0x16, 0xcb, 0xad, 0x56, 0x85,
+  0xa3, 0x88, 0xc8, 0xb2, 0xbd, 0x38, 0xff, 0x36, 0x2f, 0x94, 0x28, 0x4b, 0x78, 0x79, 0x83, 0x5d,
+  0x72, 0x9a, 0x69, 0xf4, 0x72, 0xc5, 0x61, 0x7d, 0x9c, 0xd8, 0xd6, 0xdf, 0xe0, 0x5c, 0x9c, 0xa9,
+  0x6a, 0x9b, 0xae, 0xd4, 0x92, 0x14, 0xc7, 0x43, 0xb9, 0x5e, 0x4a, 0xac, 0xe6, 0xd5, 0x81, 0x40,
+  0xe4, 0x3a, 0xc9, 0x52, 0xa4, 0x3b, 0x6e, 0xbd, 0xd4, 0x95, 0x84, 0xfc, 0xf2, 0xb6, 0x1e, 0xf0,
+  0x91, 0xcc, 0xb3, 0x6a, 0x76, 0xb2, 0xdc, 0x4b, 0x2b, 0x3d, 0x99, 0x4c, 0x9f, 0x57, 0x93, 0xcd,
+  0x5c, 0x58, 0x8d, 0x57, 0xcf, 0x05, 0xbd, 0xb6, 0x6c, 0xca, 0x9b, 0x75, 0x51, 0xee, 0xe8, 0xd5,
+  0x7e, 0xb7, 0xdd, 0x18, 0x6c, 0x3a, 0xcf, 0x99, 0xd9, 0x92, 0xeb, 0xc7, 0xf9, 0xe9, 0x2a, 0x42,
+  0x96, 0x4a, 0xed, 0x61, 0xbe, 0xdc, 0x1a, 0x26, 0xc6, 0x93, 0x45, 0x91, 0x65, 0x89, 0x85, 0x5c,
+  0x2d, 0xb6, 0x47, 0x5b, 0x89, 0x9e, 0x55, 0xaa, 0x42, 0x4b, 0xec, 0xf7, 0xa5, 0xf4, 0x9a, 0x4d,
+  0xd7, 0x84, 0x4e, 0xae, 0x4d, 0x64, 0xcd, 0x5e, 0x44, 0x14, 0x38, 0x6a, 0x40, 0x57, 0xb8, 0x76,
+  0xba, 0x5c, 0x2c, 0x24, 0xba, 0x59, 0xa2, 0x05, 0xd7, 0xcb, 0x6d, 0xc7, 0x22, 0xe7, 0xd3, 0x57,
+  0xb3, 0x36, 0x11, 0xc9, 0x5c, 0xaa, 0x29, 0xc9, 0xac, 0xf8, 0xb6, 0xda, 0xd2, 0xe3, 0xc6, 0xb2,
+  0x55, 0x4e, 0xcc, 0x7a, 0xb3, 0x5e, 0xbc, 0x90, 0xae, 0x8d, 0x67, 0x99, 0x72, 0x76, 0x50, 0x9b,
+  0xb3, 0x2d, 0xeb, 0x75, 0x25, 0xc7, 0x9f, 0x87, 0x74, 0x5d, 0x95, 0x12, 0x25, 0xbe, 0xbc, 0x7d,
+  0x2b, 0x96, 0x87, 0x44, 0xa5, 0x5c, 0x1d, 0x99, 0x5b, 0x6d, 0x53, 0xa8, 0xf3, 0x7d, 0x6b, 0xda,
+  0x5b, 0x2a, 0xfd, 0x55, 0x6b, 0x34, 0xab, 0x14, 0x52, 0x6c, 0xb5, 0xde, 0x88, 0xbc, 0xbe, 0xc0,
+  0xb8, 0x39, 0x68, 0x30, 0xc5, 0xa4, 0xf4, 0xf6, 0x52, 0x5f, 0x89, 0x34, 0xb7, 0x19, 0xbf, 0xd4,
+  0x5e, 0x5a, 0x11, 0xa1, 0x3f, 0x6a, 0x4b, 0x9d, 0xf8, 0x78, 0xb1, 0x86, 0xbd, 0x45, 0xbc, 0x09,
+  0x97, 0x95, 0xac, 0x36, 0x95, 0xbb, 0x23, 0x46, 0x7c, 0x5b, 0x2d, 0xe2, 0xd5, 0xf1, 0x4a, 0x58,
+  0x53, 0x52, 0x5c, 0xe5, 0xd5, 0x54, 0x2d, 0x3d, 0x1c, 0xf5, 0x0a, 0x39, 0xaa, 0xde, 0x11, 0x57,
+  0xf2, 0x60, 0xd4, 0x1d, 0x2f, 0xbb, 0x6f, 0xdb, 0x71, 0x73, 0xc6, 0x13, 0x05, 0x76, 0x53, 0x7c,
+  0x61, 0xaa, 0x29, 0x3d, 0xbe, 0x66, 0x47, 0x63, 0x3d, 0x4f, 0x17, 0x8d, 0x97, 0x25, 0x5d, 0xe9,
+  0xe9, 0xfd, 0x84, 0xc1, 0x75, 0x67, 0x83, 0xf2, 0x3c, 0x32, 0xa7, 0x84, 0x0e, 0xdd, 0x5a, 0x15,
+  0x35, 0x85, 0x20, 0x0a, 0x7c, 0xaa, 0xc9, 0xbc, 0x8c, 0xa4, 0x65, 0xb7, 0x5c, 0x4c, 0xca, 0xb0,
+  0x34, 0xda, 0xae, 0x4a, 0xeb, 0x4d, 0xa5, 0x1f, 0x79, 0x13, 0x84, 0xac, 0x58, 0x5a, 0x6c, 0x52,
+  0xe4, 0xa2, 0x91, 0xeb, 0xb4, 0x19, 0xa2, 0x1b, 0x51, 0xd5, 0xbe, 0x9a, 0xd5, 0x5b, 0x9a, 0x42,
+  0xd4, 0x5f, 0xb7, 0x6f, 0xd3, 0x6e, 0xb5, 0x25, 0x4e, 0x3b, 0xe6, 0x62, 0xc1, 0x34, 0x88, 0x39,
+  0xa9, 0x5a, 0xd3, 0x85, 0x5e, 0x7f, 0x56, 0x4b, 0xe9, 0x64, 0xa6, 0x6b, 0x91, 0xab, 0x52, 0x17,
+  0xb6, 0x33, 0xfd, 0x7a, 0x82, 0xda, 0x3c, 0x6f, 0xa7, 0x85, 0x64, 0x52, 0x8f, 0x4c, 0x5e, 0xe7,
+  0xe9, 0x1c, 0x25, 0xae, 0x7a, 0xfa, 0x4a, 0x2e, 0x0d, 0x44, 0xe1, 0xd9, 0x64, 0xc4, 0x1c, 0x35,
+  0x58, 0x9a, 0x46, 0x2e, 0xcd, 0x8e, 0xb9, 0x5e, 0x93, 0x52, 0xe7, 0x03, 0x26, 0xfb, 0x5c, 0xd6,
+  0x07, 0xcd, 0x86, 0x0e, 0x87, 0xf5, 0xf9, 0xab, 0x08, 0xb3, 0x05, 0x22, 0x51, 0x95, 0x5f, 0x13,
+  0xca, 0x73, 0x7f, 0x94, 0x53, 0x22, 0x75, 0x8d, 0x28, 0x3e, 0xbf, 0xa6, 0x87, 0x79, 0xf1, 0xad,
+  0x91, 0x7e, 0x96, 0xdf, 0x5e, 0x3a, 0xdd, 0x46, 0x46, 0x26, 0xdb, 0x59, 0x7a, 0x22, 0xe6, 0xd9,
+  0x99, 0xb6, 0x6c, 0xf6, 0x36, 0x85, 0x44, 0x6a, 0x34, 0xd3, 0xb6, 0xda, 0xa0, 0x9b, 0x4d, 0x8c,
+  0x35, 0x33, 0xb7, 0x6d, 0x6c, 0xb8, 0xe7, 0x74, 0x7c, 0x46, 0x68, 0xdb, 0x92, 0x20, 0x26, 0x92,
+  0x05, 0x0b, 0x8e, 0x6a, 0xab, 0xbe, 0x29, 0x45, 0x94, 0x4a, 0xa7, 0xb7, 0xdc, 0x26, 0x07, 0x04,
+  0x21, 0x35, 0xac, 0x26, 0x57, 0x51, 0x25, 0xf3, 0x79, 0x90, 0x56, 0xc8, 0x8a, 0x59, 0x7b, 0xe1,
+  0x06, 0x93, 0x5c, 0xce, 0x2c, 0x0a, 0xd5, 0xd7, 0x45, 0x86, 0xe8, 0xf3, 0x26, 0xa1, 0xe8, 0xe3,
+  0xc9, 0x66, 0xf3, 0x3a, 0xdd, 0xe4, 0xe8, 0x61, 0x84, 0xad, 0xbe, 0x0e, 0xd6, 0x90, 0x6c, 0xbf,
+  0x24, 0xca, 0x4a, 0x8f, 0x4b, 0x6e, 0x06, 0x30, 0x5b, 0x31, 0x0c, 0x22, 0x32, 0x1c, 0xbd, 0x76,
+  0xd5, 0xa6, 0x39, 0x5f, 0x91, 0x73, 0x85, 0x2c, 0x24, 0xc6, 0xe6, 0x38, 0xd7, 0x6d, 0xbf, 0x74,
+  0x3b, 0xdc, 0x78, 0x94, 0x24, 0x15, 0x46, 0x5d, 0x32, 0xf1, 0xc9, 0x64, 0x9b, 0x84, 0x53, 0x76,
+  0x60, 0xa9, 0x92, 0x59, 0x1d, 0x14, 0xa1, 0x28, 0xb4, 0xbb, 0xc9, 0x6d, 0x0f, 0x2e, 0x8b, 0xc4,
+  0x4c, 0x98, 0x08, 0xcf, 0x93, 0x6a, 0x9c, 0x1f, 0xc1, 0x0d, 0x39, 0x99, 0xf6, 0x06, 0xac, 0xd0,
+  0xcd, 0xbc, 0x0d, 0x52, 0xbd, 0x7c, 0x64, 0x59, 0x1a, 0x5a, 0xcd, 0x34, 0xd5, 0xd5, 0x35, 0xa9,
+  0x68, 0xf5, 0xb8, 0xf8, 0x9a, 0x99, 0x32, 0x4d, 0x59, 0x1e, 0xd5, 0xa8, 0x42, 0x45, 0x8d, 0x3f,
+  0x47, 0x9a, 0x93, 0x5e, 0x2a, 0x32, 0x7c, 0x16, 0x92, 0x8d, 0x49, 0x3b, 0x3b, 0x2c, 0x50, 0x66,
+  0x33, 0x9f, 0xa2, 0xe9, 0x2a, 0x5c, 0x74, 0x27, 0x70, 0xdc, 0x7d, 0x69, 0x8d, 0xd5, 0xb7, 0x79,
+  0x93, 0x11, 0xe7, 0x69, 0xcd, 0xe8, 0xb7, 0xfa, 0x85, 0x16, 0x21, 0x2e, 0xab, 0x43, 0xae, 0xba,
+  0xd8, 0x2c, 0xfa, 0xc9, 0xc2, 0x86, 0x7b, 0xd1, 0x09, 0xad, 0x6b, 0x91, 0x0d, 0x6e, 0xb9, 0x1e,
+  0xeb, 0x89, 0xac, 0x3e, 0xde, 0xea, 0x86, 0xca, 0xbe, 0xf0, 0xbd, 0xb8, 0x3e, 0x99, 0x65, 0xb3,
+  0xea, 0x4c, 0xca, 0xce, 0x39, 0x4a, 0x69, 0x19, 0x65, 0x36, 0x3e, 0xe8, 0x2e, 0xf3, 0xc6, 0xa4,
+  0xa9, 0x47, 0x22, 0xb5, 0x5c, 0x47, 0x36, 0x65, 0xb3, 0xad, 0x08, 0x79, 0xb6, 0x27, 0xea, 0xf4,
+  0x5b, 0xc7, 0xca, 0x0e, 0x5b, 0xfa, 0x2c, 0x9e, 0x33, 0xd8, 0xf5, 0xf3, 0xbc, 0xd3, 0x7a, 0xdd,
+  0xe8, 0x93, 0x89, 0x36, 0xaf, 0xf2, 0x44, 0xee, 0x65, 0x50, 0x50, 0x7a, 0xd5, 0x79, 0xb2, 0x3d,
+  0xd4, 0x1a, 0x95, 0x52, 0x16, 0x92, 0x83, 0x66, 0x72, 0x4a, 0x8f, 0xa6, 0x6f, 0x91, 0x5a, 0x95,
+  0x7d, 0xae, 0xa5, 0x1b, 0x7a, 0x6b, 0xa5, 0x29, 0x89, 0x97, 0xcd, 0x88, 0xb6, 0x32, 0xad, 0x76,
+  0xb3, 0xdd, 0x14, 0xe8, 0xd2, 0xc2, 0x52, 0x39, 0x55, 0x5d, 0xb6, 0x8b, 0x7c, 0xea, 0xb9, 0x3b,
+  0x9a, 0x4e, 0x66, 0xaf, 0xf1, 0xf9, 0x5b, 0x42, 0xc9, 0xf5, 0xc6, 0x82, 0x38, 0x60, 0x66, 0x8a,
+  0xd4, 0x5c, 0x4c, 0xc7, 0xd5, 0x74, 0x51, 0x89, 0xaf, 0x32, 0x1a, 0xc9, 0xd4, 0x2b, 0xd6, 0xf3,
+  0x72, 0x56, 0x9a, 0x77, 0x4d, 0xb9, 0x34, 0x52, 0x2b, 0xf3, 0xf6, 0x60, 0x3b, 0x2c, 0x8f, 0x04,
+  0xa3, 0xbe, 0xca, 0xae, 0xeb, 0x95, 0xe4, 0xf3, 0x68, 0x35, 0x6a, 0xf1, 0xa6, 0xc4, 0x4b, 0xbd,
+  0xb8, 0x61, 0x41, 0x66, 0xbd, 0xa8, 0xd1, 0x5b, 0xa6, 0xdd, 0x48, 0x4d, 0x4b, 0xfd, 0x76, 0x37,
+  0x6f, 0xad, 0x86, 0xed, 0x66, 0x89, 0x23, 0xfa, 0xe5, 0x4d, 0xb1, 0x33, 0xd8, 0x52, 0xa3, 0x9c,
+  0x4c, 0xe7, 0x26, 0x74, 0xa4, 0x58, 0x67, 0x72, 0xc2, 0xd0, 0x9c, 0xb4, 0x44, 0x22, 0x35, 0xa8,
+  0x27, 0x32, 0x9a, 0x20, 0x95, 0x74, 0xb3, 0x32, 0xdb, 0xb4, 0x15, 0xd8, 0x8c, 0x5b, 0xaa, 0x54,
+  0xe8, 0x6f, 0x5e, 0x1a, 0x12, 0x9f, 0x69, 0x56, 0xcd, 0x41, 0x66, 0x94, 0xc9, 0xac, 0xc7, 0xfa,
+  0x50, 0x4f, 0xf6, 0xaa, 0x9d, 0x5a, 0x7c, 0xd8, 0xe3, 0xcd, 0x04, 0x9b, 0x62, 0x9e, 0xbb, 0x13,
+  0xc3, 0x24, 0x8b, 0xf3, 0x5c, 0xab, 0x66, 0x0d, 0x47, 0x85, 0x97, 0xb7, 0xb5, 0xb6, 0x24, 0xe7,
+  0xe6, 0xa6, 0xbf, 0xe1, 0xf2, 0xc9, 0xf9, 0x8a, 0x50, 0xa6, 0x8b, 0xb7, 0xca, 0xf2, 0x45, 0x68,
+  0x4f, 0x06, 0xd9, 0xd9, 0xbc, 0x32, 0x26, 0x8a, 0x6c, 0xb6, 0xb4, 0x29, 0xbe, 0xf5, 0x7b, 0x2f,
+  0x24, 0x25, 0xcc, 0xd4, 0x52, 0x3e, 0x5e, 0x80, 0x86, 0x51, 0x19, 0x8f, 0x84, 0xc1, 0xa6, 0x96,
+  0x25, 0x65, 0x63, 0xa1, 0x0e, 0x5e, 0xf2, 0x19, 0xa9, 0xce, 0x8c, 0xd3, 0x69, 0xfd, 0xad, 0xf6,
+  0xc2, 0xc9, 0xad, 0x17, 0x31, 0x35, 0x8b, 0xf3, 0x6a, 0xb2, 0xc4, 0xc7, 0x5f, 0x67, 0x05, 0x95,
+  0xcc, 0x14, 0xfb, 0x16, 0x11, 0xaf, 0xf6, 0xdb, 0xdb, 0x72, 0xc5, 0xea, 0x19, 0x9c, 0x54, 0x29,
+  0x0e, 0x07, 0x09, 0xaa, 0xdb, 0x49, 0x74, 0xd7, 0x91, 0x42, 0x33, 0x33, 0x7c, 0xa9, 0x37, 0xe4,
+  0xe6, 0x2c, 0x3b, 0x54, 0x73, 0xec, 0xa2, 0xad, 0x27, 0x32, 0x2d, 0x7a, 0xdc, 0xcb, 0x90, 0x0a,
+  0x97, 0xda, 0x88, 0x93, 0x64, 0x9d, 0xd4, 0x61, 0x2b, 0xfe, 0xda, 0x9b, 0xbe, 0x44, 0xfa, 0x7c,
+  0xbe, 0x63, 0x31, 0x0d, 0x43, 0x4f, 0x88, 0x7d, 0x5a, 0x6e, 0xbe, 0x15, 0xad, 0xe7, 0x0e, 0x37,
+  0x7a, 0x4e, 0x0c, 0x9e, 0xe3, 0xe5, 0x5e, 0xa3, 0x9e, 0x2e, 0xd4, 0xb4, 0xec, 0x98, 0xad, 0x47,
+  0x46, 0x99, 0xf2, 0x3c, 0x17, 0xaf, 0x74, 0x38, 0xce, 0xe8, 0xe6, 0xc7, 0xdb, 0xaa, 0xca, 0x74,
+  0x95, 0xf5, 0xc0, 0xe0, 0x12, 0x25, 0x72, 0xa8, 0x27, 0x93, 0x72, 0x27, 0x4e, 0x13, 0x2f, 0x9b,
+  0xc4, 0xe0, 0x59, 0xab, 0x54, 0x3b, 0x86, 0x24, 0x0f, 0x88, 0x79, 0xe5, 0x55, 0x20, 0xcc, 0x55,
+  0x47, 0xaf, 0xad, 0xc7, 0xab, 0x6d, 0x84, 0x7b, 0x69, 0xe4, 0x7a, 0xe3, 0x5a, 0x87, 0x8d, 0x48,
+  0x43, 0xc8, 0xb7, 0xeb, 0x74, 0xa6, 0xa4, 0x6f, 0xc5, 0x36, 0xc1, 0x13, 0x50, 0xaf, 0xd0, 0x6a,
+  0x2b, 0xab, 0x6c, 0xdb, 0x0b, 0xa2, 0x17, 0x69, 0x26, 0x37, 0xf2, 0x44, 0x68, 0xbf, 0x3e, 0x2f,
+  0xb8, 0x8a, 0xc9, 0x3f, 0xe7, 0x45, 0xbd, 0xd5, 0xa2, 0xd9, 0xd5, 0x3c, 0x3e, 0x18, 0x55, 0x24,
+  0x26, 0x59, 0xa1, 0xd7, 0x0b, 0x75, 0xab, 0xce, 0x66, 0xd5, 0x6c, 0xb7, 0xff, 0x36, 0x6f, 0xd7,
+  0x33, 0xdb, 0x86, 0xa0, 0xa6, 0x93, 0x91, 0xf2, 0x52, 0x7c, 0xc9, 0x0f, 0x72, 0x63, 0x48, 0x66,
+  0x0b, 0x49, 0x2d, 0xdd, 0x6d, 0xb6, 0x49, 0xa6, 0xcd, 0x18, 0xd2, 0xeb, 0x74, 0x99, 0x82, 0x2d,
+  0xae, 0x94, 0x94, 0x9e, 0x53, 0x2b, 0x62, 0x96, 0x50, 0xb6, 0x65, 0xa1, 0x0a, 0xb3, 0x6a, 0x63,
+  0x3c, 0x8f, 0x2c, 0xaa, 0x6a, 0x63, 0x12, 0x51, 0xd7, 0xbc, 0x2e, 0x0a, 0x19, 0x89, 0x78, 0x61,
+  0x26, 0x59, 0x9a, 0xee, 0x6d, 0xab, 0xd5, 0x3a, 0x9f, 0x1c, 0xf7, 0xea, 0x35, 0x8a, 0x4c, 0x6e,
+  0xb4, 0x44, 0x8f, 0xce, 0x32, 0x8d, 0x91, 0xd4, 0x6b, 0xa9, 0xa5, 0x1a, 0x99, 0x5a, 0x9a, 0x8b,
+  0x7a, 0xca, 0x28, 0x54, 0xea, 0xe5, 0x02, 0xcf, 0x96, 0x18, 0xb2, 0x9d, 0x25, 0x5e, 0xa7, 0x06,
+  0xb9, 0x4d, 0x3d, 0x8f, 0x0a, 0xb9, 0xfa, 0xa8, 0x57, 0x8a, 0xac, 0x87, 0xd4, 0xdb, 0x98, 0x5d,
+  0x10, 0xdb, 0x49, 0x3b, 0x99, 0x2e, 0xbd, 0x0a, 0x7c, 0xde, 0x5a, 0x0f, 0x27, 0x8c, 0x29, 0x0f,
+  0x0a, 0x99, 0x44, 0xb6, 0xb7, 0x92, 0xa8, 0xad, 0xb8, 0x14, 0x66, 0xaf, 0xb5, 0x6d, 0x3e, 0xde,
+  0xc8, 0xb5, 0x3b, 0xc2, 0x73, 0x3f, 0xd7, 0x55, 0xcb, 0x84, 0x68, 0xa9, 0x91, 0x4a, 0xa2, 0xcc,
+  0x8d, 0x22, 0x62, 0xee, 0x6d, 0x32, 0x64, 0x9b, 0x91, 0x62, 0x6a, 0xa5, 0xf5, 0x94, 0x44, 0x7a,
+  0x58, 0xad, 0x16, 0x1b, 0xc9, 0x52, 0x36, 0x43, 0x26, 0x4a, 0xb5, 0x7a, 0x2d, 0xc7, 0xa7, 0xe2,
+  0xdd, 0x7c, 0x92, 0xee, 0x64, 0xfb, 0x6f, 0xc5, 0x94, 0x3e, 0x4f, 0xca, 0x6f, 0x6b, 0x63, 0xfa,
+  0xdc, 0xaa, 0x8c, 0x7b, 0xfd, 0x2a, 0xab, 0x4f, 0x9e, 0x85, 0x89, 0x39, 0x36, 0x0a, 0xcc, 0x22,
+  0xae, 0xa9, 0x4b, 0x72, 0x5d, 0x8b, 0x8c, 0xd5, 0xa4, 0x3c, 0x7c, 0x9b, 0x75, 0xd9, 0x78, 0x6e,
+  0x9e, 0x2c, 0xd7, 0x73, 0x5b, 0xaa, 0xc3, 0x96, 0xd3, 0x62, 0x49, 0x79, 0xe9, 0xad, 0xb6, 0xc9,
+  0x55, 0x4d, 0xe8, 0x64, 0x0d, 0x9a, 0x18, 0x08, 0xd3, 0xed, 0x48, 0x1b, 0x1b, 0xcd, 0x92, 0x5a,
+  0x78, 0x7d, 0x86, 0x62, 0xbf, 0xfa, 0x1c, 0x2f, 0xe5, 0xf5, 0x65, 0x84, 0x2b, 0x5b, 0xd4, 0x70,
+  0x9c, 0x57, 0xc6, 0x85, 0x51, 0x47, 0xe9, 0x54, 0xe3, 0x6d, 0xeb, 0x35, 0x41, 0x42, 0x63, 0x69,
+  0xb5, 0xf9, 0x39, 0xd3, 0x9f, 0x15, 0x16, 0xb3, 0xe1, 0x22, 0x11, 0x79, 0xb1, 0x66, 0x2d, 0xad,
+  0xa4, 0x8a, 0x26, 0x9b, 0x1c, 0xf7, 0x5a, 0xcf, 0x89, 0x14, 0xb1, 0x7e, 0x65, 0xad, 0x31, 0x35,
+  0xb4, 0x16, 0xdb, 0x82, 0x98, 0x36, 0x5e, 0x85, 0x97, 0x79, 0xe7, 0x59, 0xa4, 0x8b, 0xd9, 0x09,
+  0xad, 0x94, 0x12, 0x64, 0xd5, 0x88, 0x24, 0x7a, 0x1b, 0x2d, 0x3d, 0x60, 0x1a, 0x44, 0xa5, 0x04,
+  0x07, 0x39, 0xab, 0xa3, 0x4b, 0xf3, 0xd6, 0xdb, 0x82, 0x1a, 0x09, 0x02, 0x9b, 0xcf, 0xf1, 0x2f,
+  0xe3, 0x26, 0xdd, 0x2d, 0xa7, 0xab, 0x6c, 0x2d, 0xf3, 0x6a, 0x70, 0xed, 0x84, 0x50, 0x51, 0x86,
+  0xdc, 0x60, 0xc6, 0x65, 0xba, 0x8d, 0xb2, 0x9e, 0xee, 0xe5, 0x7b, 0xe3, 0x64, 0x3e, 0x9d, 0x61,
+  0xa6, 0x6f, 0x56, 0x4d, 0x95, 0xa6, 0xab, 0x1e, 0xf5, 0x6c, 0xad, 0xd6, 0x3d, 0xfd, 0xa5, 0x5e,
+  0x5e, 0x51, 0xc9, 0xb5, 0xf5, 0x12, 0x19, 0x1a, 0x9d, 0x3c, 0xf1, 0x02, 0x5f, 0x87, 0x62, 0x49,
+  0x98, 0xe6, 0xf5, 0xe7, 0xfc, 0x64, 0xdc, 0xed, 0xa6, 0x32, 0x93, 0x65, 0x35, 0xbd, 0x1e, 0xe4,
+  0x19, 0xd2, 0xd2, 0xda, 0xf5, 0x7e, 0x51, 0x78, 0xa1, 0x2d, 0x98, 0x2d, 0x0a, 0xd6, 0x66, 0x55,
+  0x48, 0xbe, 0xa5, 0x98, 0xd2, 0x8a, 0x16, 0x1b, 0x7c, 0x3e, 0xf1, 0xda, 0x79, 0x2d, 0x0d, 0x97,
+  0x8d, 0x6a, 0x79, 0xab, 0xcd, 0x0d, 0x7a, 0x96, 0x25, 0x56, 0xac, 0xd6, 0x91, 0x5b, 0xc9, 0x62,
+  0xbd, 0x4c, 0x8a, 0xf1, 0xb2, 0xbc, 0x5c, 0x44, 0x6a, 0xe5, 0x6d, 0xe3, 0xb9, 0xdd, 0x16, 0xdb,
+  0x89, 0x37, 0x65, 0xd8, 0x2e, 0xd4, 0x1b, 0x11, 0xbe, 0x50, 0x61, 0xb3, 0x8d, 0xe7, 0x74, 0xb9,
+  0x4b, 0x56, 0x07, 0x92, 0x56, 0xe9, 0x94, 0x3b, 0xd5, 0x7e, 0xb7, 0x29, 0x0c, 0xdf, 0xb6, 0xf9,
+  0xaa, 0xf2, 0x4c, 0xf3, 0x74, 0x8b, 0xed, 0xd6, 0xe4, 0x38, 0xd4, 0x5e, 0x94, 0xe6, 0xc2, 0x9c,
+  0x2d, 0x86, 0x84, 0xbc, 0xc9, 0xd5, 0xa8, 0x74, 0x2d, 0x5f, 0xe9, 0x2d, 0x5a, 0x2b, 0x5e, 0x69,
+  0x32, 0xc5, 0x2d, 0xf7, 0x5c, 0xeb, 0x2c, 0x3b, 0x44, 0xaf, 0x6e, 0x0e, 0xea, 0x46, 0x05, 0x8e,
+  0xc9, 0xd1, 0x36, 0x32, 0x6b, 0x89, 0x86, 0xd8, 0x95, 0x26, 0xaf, 0x56, 0xad, 0x34, 0xef, 0xb5,
+  0x67, 0xb4, 0xdc, 0xcc, 0x73, 0x93, 0xe7, 0x89, 0x3a, 0x8c, 0x17, 0xf3, 0x1d, 0xab, 0x98, 0x9c,
+  0x3e, 0x3d, 0xdd, 0x05, 0xeb, 0x5e, 0x83, 0x82, 0xd8, 0x7a, 0x23, 0xd6, 0x06, 0x07, 0xab, 0xf5,
+  0x55, 0x4a, 0x77, 0xa0, 0x7e, 0x6f, 0xbb, 0x07, 0x1f, 0x2c, 0x12, 0xd8, 0x4f, 0x94, 0x41, 0x41,
+  0x01, 0xe4, 0x43, 0x86, 0x19, 0x74, 0x67, 0xf0, 0x01, 0x39, 0x9e, 0xdb, 0x81, 0xe6, 0x4d, 0x15,
+  0x70, 0x8c, 0x8e, 0x6e, 0xf5, 0x2b, 0x2a, 0xba, 0xbe, 0x62, 0x42, 0x5d, 0x31, 0x7c, 0xae, 0xb0,
+  0x9c, 0xe4, 0xb8, 0xf9, 0xcb, 0x59, 0xda, 0xbe, 0xda, 0x4f, 0x13, 0x69, 0xd5, 0xbb, 0xea, 0xca,
+  0x36, 0x3e, 0xfd, 0xce, 0xab, 0x33, 0x47, 0x86, 0x19, 0xcf, 0xab, 0xc7, 0xbf, 0xa4, 0xdd, 0xeb,
+  0xd4, 0xbe, 0x74, 0xe8, 0xdd, 0xa7, 0xdd, 0x50, 0xd0, 0xc5, 0xc8, 0x93, 0x91, 0x7c, 0x46, 0x6e,
+  0x9d, 0x54, 0xe6, 0x3a, 0xdf, 0x4c, 0x3f, 0x1b, 0x8f, 0xcb, 0xd4, 0x76, 0x8d, 0xb5, 0xc7, 0xeb,
+  0xa8, 0x79, 0x1e, 0xa4, 0xe3, 0xbd, 0x75, 0x2d, 0x58, 0xf6, 0x7a, 0xb0, 0xd4, 0xe7, 0xaf, 0xb6,
+  0x4d, 0x9d, 0x31, 0x2b, 0xdd, 0x66, 0xa3, 0xfa, 0x6e, 0x86, 0xa6, 0xfd, 0xd2, 0x73, 0xe5, 0xb5,
+  0xfa, 0x9b, 0x5a, 0x73, 0xbf, 0xfa, 0x52, 0xb9, 0xca, 0x48, 0x7c, 0xa0, 0xd5, 0xab, 0xcc, 0xc4,
+  0x07, 0x1a, 0xfc, 0x56, 0x43, 0xf1, 0xdf, 0xbe, 0xdd, 0x13, 0xc7, 0x33, 0xc2, 0x17, 0x53, 0x70,
+  0xf4, 0x25, 0x7c, 0x3d, 0x25, 0x7a, 0xb8, 0xf8, 0x8f, 0x4d, 0x94, 0x76, 0x60, 0x00, 0x67, 0x4c,
+  0x7e, 0xdb, 0x88, 0x5f, 0x5a, 0xb6, 0x5b, 0x6e, 0x99, 0xfc, 0xcd, 0x5e, 0x15, 0xf8, 0x25, 0x96,
+  0xc3, 0xbf, 0xba, 0xdf, 0x3b, 0xa4, 0x59, 0x0b, 0xbc, 0x96, 0xb5, 0xbf, 0x9e, 0x6b, 0x47, 0x86,
+  0x3f, 0x37, 0x52, 0x1d, 0x47, 0x62, 0xc3, 0xb7, 0x4a, 0x89, 0x18, 0x95, 0xcd, 0xe2, 0x30, 0x2a,
+  0xe8, 0x99, 0xce, 0xa4, 0x71, 0xdc, 0x14, 0xf4, 0x4c, 0x92, 0xc9, 0x6f, 0xf4, 0x79, 0xc0, 0xed,
+  0x7c, 0x04, 0x24, 0x95, 0x46, 0x71, 0x11, 0x53, 0xe0, 0x47, 0x80, 0xee, 0x7a, 0x10, 0xbf, 0xa6,
+  0xd3, 0xbf, 0x89, 0x03, 0x65, 0x57, 0xec, 0x01, 0xbb, 0x3b, 0x87, 0x32, 0x51, 0x81, 0x1f, 0x01,
+  0x01, 0x1e, 0xf0, 0x2c, 0x5c, 0x70, 0xc7, 0xc7, 0x17, 0x07, 0xf0, 0x70, 0xee, 0x5d, 0x20, 0xbf,
+  0xd1, 0x1b, 0xdf, 0xcf, 0x6b, 0xf6, 0xeb, 0xbd, 0xf3, 0xfd, 0xa0, 0x7d, 0x32, 0x3f, 0x5f, 0xed,
+  0xa1, 0xef, 0x5f, 0xff, 0x6f, 0xca, 0x63, 0x1f, 0xdf, 0x43, 0xdc, 0xad, 0x3d, 0x7c, 0xdb, 0x30,
+  0x64, 0xcf, 0xdd, 0xfb, 0xe0, 0xd1, 0x51, 0xb6, 0xc7, 0x52, 0xf8, 0x16, 0xcf, 0x7e, 0xdc, 0xce,
+  0xad, 0x1e, 0xfc, 0x37, 0x56, 0xa2, 0xae, 0xa9, 0xf4, 0xab, 0x7b, 0xe4, 0x1f, 0xa5, 0x7f, 0x0e,
+  0x8a, 0x39, 0x1c, 0x10, 0x6a, 0xc8, 0x9b, 0xd1, 0x3c, 0x20, 0xd0, 0x67, 0xe1, 0x9a, 0xcc, 0xe6,
+  0xee, 0xd0, 0xb6, 0xe7, 0x13, 0x9c, 0x1f, 0x45, 0xbd, 0x7d, 0x0c, 0x4c, 0x39, 0xed, 0x54, 0xfb,
+  0x1e, 0xa9, 0xa5, 0xdd, 0x7d, 0x8b, 0x1e, 0xb7, 0xff, 0xaf, 0x89, 0xa6, 0xff, 0x66, 0x13, 0x4d,
+  0x9f, 0x5b, 0x0c, 0x3b, 0x67, 0xb7, 0x2e, 0xb3, 0x0a, 0x88, 0xa3, 0xed, 0xbb, 0x24, 0xf6, 0xb9,
+  0x06, 0x3d, 0xd2, 0xdd, 0xa5, 0xb8, 0xcd, 0x3e, 0xd1, 0xf7, 0x6d, 0x50, 0x97, 0x02, 0x5c, 0xba,
+  0x44, 0xb8, 0xe3, 0x65, 0x71, 0x8b, 0x24, 0x77, 0xb4, 0xf4, 0xd0, 0xce, 0xf3, 0x04, 0xa8, 0xf3,
+  0x32, 0x9d, 0x46, 0x82, 0x27, 0x2f, 0x29, 0xe3, 0x4d, 0xfe, 0x68, 0xa0, 0x78, 0xaf, 0xff, 0x01,
+  0x10, 0x6b, 0xa2, 0x7c, 0x6e, 0x33, 0xd6, 0xa8, 0x2b, 0x81, 0xd9, 0xc4, 0x75, 0x0e, 0xa0, 0x8d,
+  0xb4, 0x4f, 0x2e, 0xdc, 0x45, 0x22, 0x88, 0x68, 0x42, 0x1a, 0x69, 0xdf, 0xb6, 0x03, 0xbf, 0x07,
+  0x1a, 0xf5, 0x55, 0x27, 0x0d, 0x6f, 0xaa, 0x48, 0xff, 0x63, 0x46, 0x41, 0x5d, 0x68, 0x3a, 0x34,
+  0x0c, 0xc8, 0x83, 0x50, 0xa9, 0x33, 0x09, 0x03, 0x4b, 0x91, 0xa1, 0x61, 0x5f, 0x5a, 0xd7, 0x99,
+  0x15, 0x90, 0x99, 0x0d, 0xca, 0x58, 0x29, 0x19, 0xc0, 0x58, 0x30, 0xb2, 0x0c, 0xf5, 0x47, 0xfc,
+  0x49, 0xd0, 0xd1, 0x21, 0x84, 0xe1, 0x50, 0xcc, 0x02, 0x03, 0xb0, 0xaa, 0x5f, 0x20, 0x96, 0x0b,
+  0x71, 0xdd, 0x7d, 0xe9, 0x11, 0x35, 0xf9, 0x74, 0x05, 0x31, 0xfb, 0xc7, 0xa9, 0xdc, 0x0f, 0xe5,
+  0x09, 0x40, 0x85, 0x53, 0x79, 0x78, 0x18, 0xdd, 0x05, 0x08, 0xbb, 0xa0, 0x71, 0xfb, 0xf2, 0xbb,
+  0x60, 0xda, 0x1f, 0x50, 0x97, 0x76, 0x3f, 0x7e, 0x74, 0xb7, 0xf1, 0x80, 0xbe, 0x5c, 0x42, 0x6f,
+  0x0f, 0x07, 0x69, 0xdb, 0x98, 0x76, 0x0e, 0x36, 0x6f, 0xa7, 0x76, 0x11, 0xad, 0x25, 0xc5, 0xe6,
+  0x1f, 0x3f, 0xa1, 0xcf, 0x5c, 0x4c, 0xb4, 0x43, 0x1a, 0xe0, 0x57, 0x9e, 0xf8, 0x03, 0x06, 0xc7,
+  0x28, 0x0a, 0xe4, 0x91, 0x18, 0x69, 0x2d, 0x14, 0x14, 0x2c, 0xce, 0x79, 0xda, 0x27, 0x80, 0x63,
+  0x55, 0xd3, 0x54, 0x17, 0xf8, 0xa4, 0x88, 0xc6, 0x83, 0x72, 0x8f, 0x32, 0x06, 0x48, 0xdc, 0xb3,
+  0x92, 0x09, 0x64, 0xc9, 0x84, 0x3a, 0x23, 0xbb, 0x02, 0x07, 0xc5, 0xe3, 0xf6, 0x35, 0x76, 0x74,
+  0xce, 0xe4, 0x54, 0x4d, 0x82, 0x86, 0x13, 0xb3, 0x0e, 0x08, 0x70, 0x05, 0x04, 0x14, 0x8b, 0x1c,
+  0xc7, 0x15, 0x41, 0x31, 0x83, 0x7d, 0x14, 0x95, 0x17, 0xb1, 0xec, 0xbf, 0x0f, 0x3b, 0x39, 0x99,
+  0xce, 0x31, 0x19, 0xdf, 0x08, 0x4f, 0x1c, 0xa3, 0x9c, 0xb2, 0x2a, 0x0c, 0xcd, 0x87, 0x1f, 0x49,
+  0x67, 0xb8, 0x50, 0x30, 0x2f, 0xb9, 0xc0, 0x84, 0x36, 0xde, 0xed, 0x1c, 0x29, 0xff, 0x10, 0x3b,
+  0xfb, 0x68, 0xb3, 0xb5, 0xfb, 0xfb, 0x20, 0x3e, 0x84, 0x3a, 0xff, 0x49, 0xb2, 0x57, 0xf7, 0x55,
+  0x8c, 0xe8, 0xb6, 0x45, 0xef, 0x97, 0x39, 0x08, 0xc7, 0x24, 0xfa, 0x44, 0xac, 0x93, 0x74, 0x14,
+  0x10, 0x6b, 0x9a, 0xc0, 0x7f, 0xe7, 0xd0, 0xdf, 0x09, 0xf2, 0xf4, 0x3a, 0xc3, 0x51, 0x07, 0x10,
+  0xcf, 0x2a, 0x97, 0xa3, 0xc7, 0x2f, 0x3f, 0x7e, 0x44, 0xb7, 0x29, 0x8e, 0x87, 0xef, 0x29, 0xe8,
+  0xbc, 0x45, 0x25, 0x3f, 0x5f, 0xbc, 0xbe, 0xa1, 0x59, 0xe6, 0x2b, 0xa3, 0x4b, 0x98, 0x16, 0x42,
+  0x38, 0xea, 0x46, 0x40, 0xe6, 0x47, 0x27, 0x44, 0x9f, 0x1d, 0x98, 0x03, 0x61, 0x7a, 0x9d, 0x21,
+  0x82, 0xf0, 0xac, 0x5a, 0xa6, 0x9d, 0x4a, 0xcb, 0x29, 0x8e, 0x3a, 0x98, 0x2e, 0xe3, 0x6b, 0xa5,
+  0xeb, 0xc0, 0x93, 0xae, 0x03, 0xf9, 0xe3, 0xc7, 0x27, 0x90, 0xbe, 0x84, 0xf7, 0xa3, 0x46, 0xec,
+  0x5e, 0x7b, 0xf6, 0xf7, 0x8b, 0x03, 0x17, 0x64, 0xcb, 0x10, 0x1b, 0xf6, 0x62, 0x44, 0x63, 0x37,
+  0x4c, 0x46, 0x37, 0xa3, 0x00, 0x2a, 0xfc, 0x79, 0x04, 0xe0, 0x72, 0xe0, 0x83, 0x5d, 0xf0, 0xdc,
+  0x76, 0xa7, 0xb8, 0x4f, 0xff, 0x50, 0xe1, 0xc1, 0x3d, 0x70, 0xda, 0x28, 0x75, 0x26, 0x3f, 0x35,
+  0x73, 0xa3, 0x9f, 0x1a, 0xb5, 0x7e, 0xa9, 0x9b, 0x6b, 0x04, 0xe0, 0x63, 0x3f, 0x3e, 0x3b, 0x2a,
+  0xe0, 0x99, 0x4b, 0x1d, 0x92, 0x99, 0xb7, 0x84, 0xd3, 0x95, 0xe6, 0x29, 0x53, 0x70, 0x56, 0x7c,
+  0x40, 0xa9, 0xa3, 0xc8, 0x85, 0xc4, 0x71, 0xe4, 0xc2, 0xe0, 0x43, 0x9b, 0xd3, 0xf6, 0xef, 0x11,
+  0x02, 0xd1, 0xe2, 0xb2, 0xb1, 0x13, 0x01, 0x73, 0x67, 0xcb, 0x4d, 0xe3, 0x88, 0x34, 0xbb, 0xd6,
+  0x1f, 0xcf, 0xc1, 0xb1, 0xfb, 0x87, 0x4e, 0xbb, 0xc1, 0xc5, 0x9c, 0x39, 0xd8, 0x97, 0xfe, 0xf8,
+  0x84, 0x42, 0x08, 0x9c, 0x3f, 0x53, 0xee, 0xf1, 0xe8, 0xf4, 0xd5, 0x5e, 0x2d, 0x17, 0x0e, 0x7a,
+  0x4e, 0x59, 0x44, 0x8c, 0x99, 0x8b, 0x25, 0xed, 0xbe, 0xdc, 0x9f, 0x2d, 0x7a, 0xed, 0x11, 0x6d,
+  0x77, 0x9a, 0x3e, 0x0c, 0x11, 0x65, 0xca, 0xbe, 0x69, 0x0c, 0xce, 0x1c, 0x3c, 0x01, 0xe5, 0x22,
+  0xfb, 0x3a, 0xb3, 0x4a, 0x10, 0x29, 0x38, 0x7b, 0x55, 0x0f, 0x03, 0x3c, 0xa1, 0x1c, 0x3b, 0x14,
+  0xa6, 0x71, 0xfa, 0xc1, 0x99, 0x25, 0xf4, 0xcd, 0x49, 0xc1, 0x17, 0x14, 0x49, 0x53, 0xb7, 0x94,
+  0x06, 0x54, 0x80, 0x6f, 0xb0, 0x10, 0x17, 0x94, 0xc8, 0xae, 0xa0, 0x03, 0x0e, 0x69, 0x15, 0x30,
+  0xb9, 0xb9, 0x3f, 0xda, 0xa1, 0x7d, 0x77, 0xaf, 0x3f, 0x87, 0x9d, 0xd7, 0xde, 0xd0, 0xfb, 0xae,
+  0xe3, 0x8c, 0x72, 0x58, 0xfe, 0x08, 0xd0, 0xc7, 0xa3, 0xf1, 0x3e, 0xfa, 0x76, 0x98, 0x45, 0xb1,
+  0xbd, 0x71, 0x8f, 0x9d, 0x1e, 0x7d, 0x7c, 0x02, 0xa1, 0x03, 0xa0, 0x1f, 0xed, 0xb5, 0x5d, 0x6b,
+  0xfd, 0x94, 0xef, 0x96, 0x72, 0x75, 0x14, 0xff, 0x37, 0x0c, 0x7e, 0xdc, 0x95, 0xf5, 0xd5, 0x79,
+  0xed, 0xa0, 0x16, 0x9d, 0x1d, 0x1e, 0x3c, 0x81, 0x7b, 0x1f, 0x6c, 0x04, 0x6f, 0x87, 0xbc, 0xbd,
+  0x5e, 0x79, 0xf0, 0x01, 0x37, 0x5e, 0xac, 0xf5, 0xfa, 0xb9, 0x56, 0xa1, 0x74, 0x50, 0x21, 0xf1,
+  0x97, 0x94, 0xad, 0xfc, 0xa1, 0xe9, 0x23, 0x08, 0x9f, 0xf8, 0xcf, 0xc1, 0x99, 0x7d, 0xf7, 0x95,
+  0x3e, 0x22, 0xe4, 0x85, 0x11, 0x28, 0x53, 0x52, 0x82, 0xe2, 0x41, 0x63, 0x6a, 0x82, 0x4a, 0x30,
+  0xfb, 0x39, 0x9a, 0x6d, 0x39, 0x70, 0xaa, 0x65, 0xef, 0x3c, 0x3b, 0xa5, 0xef, 0xf7, 0x83, 0xf8,
+  0x1c, 0x46, 0x2f, 0xfc, 0x66, 0x7d, 0xd7, 0x73, 0xf9, 0x8a, 0x69, 0x4b, 0x84, 0x51, 0xc3, 0xb8,
+  0xe4, 0x6e, 0xce, 0xcf, 0xb2, 0xc1, 0x3d, 0x59, 0xc8, 0xf0, 0x4c, 0x30, 0x0c, 0xcf, 0x3c, 0xf3,
+  0x5f, 0x17, 0x19, 0xda, 0x97, 0x1c, 0x30, 0xcf, 0xd8, 0xf5, 0x02, 0x29, 0x35, 0x83, 0xba, 0xab,
+  0xa9, 0x46, 0x10, 0x72, 0x82, 0xa7, 0xf0, 0xb4, 0x03, 0xee, 0xed, 0x33, 0xe4, 0x5e, 0x37, 0x51,
+  0x4c, 0x0e, 0x8f, 0x81, 0x1d, 0xdc, 0x8f, 0xff, 0x43, 0x70, 0x1f, 0x1d, 0x9d, 0xad, 0x3a, 0xb7,
+  0x29, 0x66, 0x9d, 0x21, 0x70, 0x8c, 0xb3, 0xfd, 0xda, 0x76, 0xef, 0x2d, 0x89, 0x33, 0xd9, 0xa7,
+  0x77, 0x08, 0xf9, 0x70, 0x61, 0x9b, 0xd8, 0xb3, 0x57, 0xbb, 0xc9, 0xdf, 0x1f, 0x6a, 0xde, 0xa3,
+  0x10, 0xe3, 0x01, 0xd3, 0x04, 0xa0, 0x6c, 0xc0, 0x5b, 0xa0, 0xa6, 0xcf, 0x6c, 0x3a, 0x7b, 0x39,
+  0xcc, 0xd5, 0x74, 0xf6, 0xfa, 0x88, 0xf4, 0xe7, 0xfa, 0xe2, 0xc5, 0x66, 0x81, 0xd8, 0x8d, 0xf0,
+  0x30, 0x17, 0x57, 0xe3, 0x31, 0xfb, 0xb5, 0x78, 0x4c, 0xfc, 0xe5, 0xf0, 0x48, 0x12, 0xe1, 0xaf,
+  0x5f, 0x69, 0x98, 0xc7, 0x3c, 0xed, 0x56, 0xb8, 0x0f, 0xff, 0x3e, 0xde, 0x23, 0x35, 0xd5, 0x38,
+  0xa7, 0x69, 0x3a, 0xb3, 0x6c, 0xfc, 0xce, 0x50, 0xce, 0x91, 0xd8, 0xeb, 0x3e, 0xa3, 0x5a, 0xe6,
+  0xc5, 0xd8, 0x7d, 0xfd, 0xbd, 0x86, 0x40, 0x87, 0x02, 0x72, 0x10, 0x80, 0x06, 0x90, 0xec, 0xc4,
+  0xb2, 0x87, 0xec, 0x32, 0x8f, 0x40, 0x50, 0x65, 0x59, 0x5d, 0xa1, 0xf4, 0x17, 0xa6, 0xa8, 0xab,
+  0xd6, 0x54, 0x04, 0x71, 0xc3, 0x64, 0x4c, 0xcb, 0x08, 0x4a, 0xe6, 0x89, 0x52, 0x33, 0x96, 0xd1,
+  0x25, 0x7c, 0x9c, 0xc8, 0x07, 0x85, 0x45, 0x9c, 0xea, 0x38, 0x4d, 0x9d, 0x2c, 0x07, 0x44, 0xc9,
+  0x83, 0x0c, 0x2f, 0xa3, 0xf8, 0x60, 0x4f, 0xa0, 0xc8, 0x98, 0x30, 0xa6, 0xa8, 0xab, 0x10, 0x4a,
+  0x18, 0x4d, 0x52, 0x04, 0x41, 0xf8, 0x4b, 0x0e, 0xae, 0x72, 0x1f, 0xf6, 0xf5, 0x7d, 0xd3, 0x81,
+  0xe2, 0x44, 0x91, 0xe8, 0x30, 0xda, 0xd1, 0xd5, 0x85, 0x64, 0xc0, 0x10, 0xce, 0x7d, 0xb9, 0x84,
+  0x48, 0x84, 0x37, 0xa0, 0xd9, 0x97, 0x16, 0x50, 0xb5, 0xcc, 0xdd, 0x5b, 0x74, 0x07, 0x9d, 0x20,
+  0xfc, 0x08, 0x11, 0x07, 0x3f, 0xc7, 0xe3, 0x3e, 0xfd, 0xe6, 0x9f, 0xb5, 0xd2, 0x1d, 0x0c, 0xcd,
+  0xd0, 0x54, 0x05, 0x47, 0x43, 0xb3, 0xfb, 0x23, 0x40, 0x93, 0x13, 0x43, 0x77, 0x0e, 0x22, 0xef,
+  0x50, 0xd6, 0x64, 0x1c, 0xf8, 0xfe, 0x01, 0x25, 0x3d, 0xba, 0x37, 0x4c, 0x55, 0x87, 0x77, 0xbe,
+  0x39, 0xee, 0x1d, 0xe9, 0xcd, 0xb4, 0x0e, 0x49, 0x30, 0x77, 0xc0, 0x63, 0x33, 0x43, 0x55, 0x42,
+  0x7e, 0xee, 0x17, 0xae, 0x04, 0x98, 0xaa, 0x7e, 0x86, 0xa3, 0xda, 0xac, 0xdd, 0xb6, 0x6b, 0x5b,
+  0xc6, 0x06, 0xe5, 0xbe, 0x64, 0x75, 0x09, 0x0a, 0xf2, 0x06, 0x58, 0x8a, 0x8e, 0x42, 0x04, 0xdb,
+  0x79, 0x88, 0x19, 0x63, 0x0e, 0x98, 0x29, 0x23, 0x29, 0x5f, 0xbb, 0x0d, 0xd9, 0x23, 0x88, 0xa1,
+  0x7f, 0xec, 0xbc, 0xa1, 0x77, 0x12, 0x2f, 0x43, 0x9c, 0x3d, 0xfe, 0xf4, 0x13, 0x6b, 0x19, 0x9b,
+  0x43, 0xe6, 0x78, 0xff, 0x84, 0x12, 0x4e, 0x78, 0x5f, 0x86, 0x85, 0x48, 0x54, 0x3b, 0x85, 0xf1,
+  0x66, 0x41, 0x0b, 0xa5, 0xa7, 0xff, 0xd1, 0x4e, 0x87, 0x3a, 0x64, 0x24, 0x13, 0x47, 0x1f, 0x55,
+  0x51, 0xcc, 0x40, 0x4c, 0xa6, 0x77, 0x67, 0x45, 0xf8, 0x87, 0x03, 0x4c, 0x14, 0x1d, 0x1f, 0x81,
+  0x74, 0xd6, 0x8c, 0xa4, 0x4c, 0x31, 0xd8, 0x3f, 0xff, 0xf1, 0x9f, 0xfe, 0x2b, 0x4a, 0x48, 0xd7,
+  0xdd, 0xbf, 0xbe, 0x16, 0xf2, 0xdd, 0x9f, 0xff, 0xf8, 0x87, 0xff, 0x0b, 0x34, 0x54, 0x86, 0x77,
+  0x57, 0x3a, 0x1d, 0xa3, 0x7b, 0x1d, 0x39, 0xb9, 0xb2, 0x76, 0x46, 0x0e, 0xa7, 0x73, 0xbb, 0x12,
+  0x28, 0xd7, 0xfa, 0xef, 0x2e, 0x41, 0x38, 0xce, 0xf1, 0x69, 0xa3, 0x2e, 0x02, 0xee, 0x70, 0x4e,
+  0xfa, 0x2b, 0xe0, 0xf9, 0x2a, 0x33, 0x2f, 0xe7, 0xfd, 0x45, 0xca, 0xb6, 0x6a, 0xee, 0x9e, 0xa2,
+  0x53, 0x20, 0x54, 0xae, 0x75, 0x7a, 0x80, 0xcc, 0x10, 0xf7, 0xc9, 0x70, 0x0c, 0x70, 0xfa, 0x46,
+  0x33, 0xd5, 0x98, 0x61, 0xb1, 0xa6, 0x6c, 0xbb, 0x51, 0x00, 0xb8, 0x96, 0x0c, 0x14, 0xd9, 0x51,
+  0x01, 0xd5, 0x7e, 0xbf, 0xd3, 0x03, 0x1a, 0x33, 0x85, 0xa7, 0x69, 0x14, 0x0e, 0x7a, 0x4e, 0x03,
+  0xea, 0x4b, 0x94, 0x4f, 0x41, 0x46, 0x59, 0xb1, 0x51, 0x15, 0x8f, 0xbf, 0x61, 0xaf, 0x9a, 0xa3,
+  0xe8, 0xd4, 0x4f, 0x75, 0x97, 0x72, 0x2a, 0x41, 0xd9, 0xda, 0xa9, 0xe3, 0xa0, 0x14, 0xc4, 0x3a,
+  0x49, 0x65, 0x18, 0x4a, 0xc8, 0x66, 0x90, 0x16, 0x26, 0x4d, 0x26, 0xd2, 0xc9, 0x64, 0x16, 0xc5,
+  0x05, 0x59, 0xb3, 0x34, 0x47, 0x08, 0x2c, 0x27, 0xa0, 0x67, 0x98, 0x65, 0x69, 0x9e, 0x65, 0xb0,
+  0xd6, 0x26, 0x91, 0xa5, 0x53, 0x1c, 0x45, 0xb3, 0x58, 0x77, 0x93, 0x15, 0x48, 0x92, 0x14, 0x70,
+  0xf9, 0x2c, 0x95, 0x10, 0x32, 0x14, 0x93, 0x44, 0xcf, 0x0c, 0x4b, 0x72, 0x34, 0xe4, 0x3d, 0x71,
+  0x71, 0x88, 0x35, 0x9f, 0x21, 0xd2, 0x0c, 0x63, 0xb7, 0x45, 0x52, 0x99, 0x04, 0xcd, 0x12, 0xb8,
+  0x2e, 0x95, 0x4c, 0x90, 0x19, 0x9a, 0x85, 0x18, 0x26, 0x4d, 0x70, 0x69, 0x9e, 0x4b, 0xe0, 0xfe,
+  0x50, 0x2c, 0xa4, 0xf9, 0x34, 0x86, 0x99, 0x21, 0x78, 0xc8, 0x92, 0x02, 0x2e, 0x93, 0x65, 0x79,
+  0x8e, 0x48, 0x31, 0x69, 0xf4, 0xcc, 0x91, 0x59, 0x56, 0x20, 0xd3, 0x49, 0x6f, 0x5b, 0x30, 0x99,
+  0x65, 0x53, 0x59, 0x0e, 0xc3, 0x87, 0x02, 0x0b, 0x93, 0xe9, 0x4c, 0x0a, 0x3d, 0x13, 0x02, 0x47,
+  0x66, 0x79, 0x2e, 0x65, 0xb7, 0x4b, 0x70, 0x0c, 0xc9, 0x71, 0xf8, 0x99, 0x87, 0x59, 0x8a, 0x4b,
+  0xe1, 0xf1, 0x26, 0x99, 0x74, 0x32, 0x93, 0x64, 0x18, 0xdc, 0x1f, 0x8e, 0x25, 0x98, 0x2c, 0x8f,
+  0xcb, 0xa4, 0x53, 0x42, 0x36, 0x93, 0xe1, 0x19, 0x6f, 0x5b, 0xd9, 0x4c, 0x02, 0xd2, 0x24, 0x4d,
+  0xe1, 0xb1, 0x67, 0x12, 0x24, 0x97, 0x4a, 0xf1, 0x18, 0x87, 0x04, 0x91, 0xa0, 0xd2, 0x1c, 0x1e,
+  0x2f, 0x2b, 0xd0, 0xd9, 0xb4, 0xc0, 0xd9, 0x7d, 0x4e, 0x41, 0x82, 0x60, 0x05, 0x3c, 0x46, 0x9e,
+  0x66, 0xd2, 0x59, 0x32, 0x89, 0xdf, 0x13, 0x29, 0x8e, 0x49, 0x25, 0x68, 0xdc, 0x67, 0x32, 0x49,
+  0x65, 0xa9, 0x6c, 0x2a, 0xed, 0x6d, 0x8b, 0x4a, 0xb3, 0x69, 0x82, 0xc9, 0xe0, 0xb9, 0xa0, 0x20,
+  0xc9, 0x52, 0x64, 0x02, 0xc3, 0x4f, 0xf2, 0x14, 0x97, 0xe2, 0x05, 0xdc, 0x4f, 0x3a, 0x91, 0xc8,
+  0x10, 0x3c, 0x89, 0xe1, 0xa7, 0x68, 0x82, 0x49, 0x27, 0xe8, 0xa4, 0xdd, 0xff, 0x14, 0x43, 0x30,
+  0x2c, 0x9e, 0xbb, 0x0c, 0xc9, 0x51, 0x5c, 0x96, 0xb2, 0xf1, 0x49, 0xa5, 0x29, 0x8a, 0xcb, 0x9c,
+  0xcc, 0x17, 0x43, 0xb1, 0x02, 0xcc, 0x30, 0xa4, 0x3d, 0x2e, 0x92, 0x49, 0xa5, 0x92, 0xb8, 0x2e,
+  0x47, 0x25, 0xd9, 0x0c, 0x9b, 0xc6, 0xfa, 0x3b, 0x2e, 0x9d, 0xe2, 0x68, 0x92, 0xb1, 0xc7, 0x42,
+  0x66, 0x29, 0x98, 0x21, 0xb3, 0xf8, 0x39, 0x95, 0xcd, 0x12, 0x29, 0x0a, 0xb7, 0x2b, 0x24, 0x09,
+  0x98, 0xa0, 0xed, 0x3e, 0x93, 0x44, 0x8a, 0x61, 0x88, 0x34, 0xe1, 0x6d, 0x8b, 0xcc, 0x32, 0x49,
+  0x8e, 0x24, 0xf1, 0xbc, 0x90, 0x30, 0x91, 0x4e, 0x71, 0x04, 0x1e, 0x17, 0x95, 0x4e, 0x66, 0xd2,
+  0xe9, 0x24, 0x1e, 0x57, 0x22, 0xc9, 0x12, 0x2c, 0xc7, 0x3a, 0x74, 0x48, 0x72, 0x04, 0xc7, 0xe2,
+  0x76, 0x93, 0x90, 0xcf, 0x30, 0x4c, 0xd2, 0x9e, 0x2f, 0x36, 0xcb, 0x71, 0x4c, 0x12, 0xcf, 0x63,
+  0x2a, 0x43, 0xc1, 0x94, 0x20, 0x24, 0xbc, 0x6d, 0xa5, 0x93, 0x19, 0x21, 0x43, 0x41, 0x3c, 0xf6,
+  0x74, 0x86, 0xa1, 0x53, 0x09, 0x7b, 0xde, 0x33, 0x49, 0x2e, 0x93, 0xce, 0x90, 0x36, 0xbd, 0x71,
+  0x5c, 0x9a, 0xa0, 0xec, 0x3e, 0x64, 0x09, 0x16, 0x0a, 0x82, 0x80, 0xe1, 0x33, 0x49, 0x9a, 0x48,
+  0x71, 0x10, 0xe3, 0x81, 0x85, 0x42, 0x96, 0x49, 0x08, 0xce, 0x9c, 0xa6, 0xc9, 0x74, 0x46, 0x38,
+  0x84, 0xb4, 0xf9, 0x1c, 0x7e, 0x3c, 0x6b, 0x2b, 0x66, 0x28, 0x3a, 0x15, 0xc2, 0x9a, 0xf8, 0x00,
+  0x4b, 0x18, 0x4a, 0x08, 0x69, 0xec, 0xf4, 0x66, 0x1c, 0x94, 0xe4, 0x90, 0x5d, 0x7c, 0xa7, 0xfc,
+  0x8f, 0x20, 0xf9, 0x13, 0xc5, 0xa3, 0xf0, 0x35, 0x3e, 0x68, 0x0c, 0xcf, 0xfb, 0xb9, 0x49, 0x39,
+  0x60, 0xdf, 0x9f, 0xd6, 0xb3, 0x6b, 0xc4, 0x0c, 0x68, 0x3a, 0xdd, 0xf2, 0xfb, 0xfc, 0xc9, 0xdd,
+  0x85, 0xcf, 0xce, 0x81, 0xc4, 0xaf, 0x7d, 0x64, 0xb6, 0x76, 0x5a, 0x47, 0xb6, 0xc3, 0x57, 0x64,
+  0x14, 0x77, 0x5a, 0xb0, 0x0d, 0x41, 0x1e, 0xf0, 0xa8, 0x3c, 0x6a, 0xdb, 0xe6, 0x55, 0xbb, 0xa2,
+  0xce, 0x50, 0xef, 0x91, 0x9e, 0x17, 0xe3, 0x41, 0x90, 0x55, 0x55, 0x3f, 0xc6, 0x43, 0x1c, 0x51,
+  0x09, 0x61, 0xff, 0x09, 0xdf, 0x06, 0x15, 0x87, 0xde, 0x74, 0xc3, 0x7a, 0x6f, 0x47, 0xe1, 0xfc,
+  0x08, 0x88, 0xcb, 0xc1, 0x7e, 0x44, 0x3f, 0xee, 0x4a, 0xac, 0x53, 0x0c, 0x91, 0x85, 0xa9, 0x14,
+  0x26, 0x0a, 0x96, 0x4d, 0xa5, 0x19, 0x68, 0x13, 0x7e, 0x82, 0x4b, 0x41, 0x21, 0x91, 0xb6, 0x99,
+  0x04, 0x9d, 0x14, 0x04, 0x3a, 0xc1, 0x44, 0x2f, 0x46, 0x47, 0xdf, 0xd3, 0x2c, 0x4d, 0x12, 0x90,
+  0xa6, 0xd2, 0x82, 0xcd, 0xff, 0x08, 0x3a, 0x95, 0xc9, 0xe0, 0x35, 0x41, 0x0a, 0x99, 0x04, 0x9f,
+  0x65, 0x6c, 0x7e, 0xcc, 0x42, 0x82, 0xe3, 0xc9, 0xec, 0x67, 0x5f, 0x8a, 0x58, 0xf9, 0xf4, 0x37,
+  0x80, 0x78, 0x74, 0xd5, 0xd4, 0x71, 0x7a, 0x12, 0x9c, 0x5f, 0xe7, 0xe9, 0x23, 0xce, 0x46, 0xf3,
+  0xf1, 0x23, 0xfa, 0xf1, 0x7b, 0x9c, 0xeb, 0xe4, 0x03, 0x40, 0xc9, 0x04, 0xee, 0x81, 0x12, 0x0e,
+  0x8a, 0xe7, 0x8c, 0xe9, 0xcc, 0x89, 0xf4, 0x8f, 0x1f, 0x3f, 0x38, 0x14, 0xed, 0xfc, 0xbe, 0x60,
+  0xd7, 0x70, 0x19, 0xfc, 0xc9, 0x94, 0x63, 0xdc, 0x5f, 0xa1, 0x90, 0xce, 0x4f, 0xf6, 0x9c, 0x4e,
+  0xf7, 0x73, 0x6a, 0x43, 0x47, 0xf4, 0x0c, 0x22, 0xb6, 0x3d, 0x3e, 0x7c, 0x21, 0x70, 0x2e, 0x06,
+  0x08, 0x3e, 0xa0, 0x18, 0x29, 0x97, 0xc3, 0xe6, 0x1a, 0x04, 0xd2, 0x6f, 0xa9, 0xa6, 0x1e, 0x5a,
+  0x7d, 0x92, 0xd0, 0xf9, 0x89, 0xfe, 0x1c, 0x05, 0xe9, 0x30, 0xf8, 0x87, 0x93, 0x97, 0x64, 0x06,
+  0xbd, 0x3d, 0xbc, 0xc1, 0x18, 0x4b, 0x9c, 0x75, 0x8a, 0x33, 0xc8, 0x63, 0xe0, 0xc8, 0x07, 0x8e,
+  0xf4, 0x02, 0xc7, 0x2f, 0xb3, 0x2e, 0xd8, 0x94, 0x0d, 0x3a, 0xf0, 0x24, 0xe7, 0xe0, 0xc9, 0xe9,
+  0x48, 0x0a, 0xb9, 0x45, 0x1b, 0x04, 0x88, 0x38, 0x2f, 0xd2, 0xf8, 0x37, 0x79, 0x8d, 0x5e, 0x03,
+  0x21, 0xec, 0x13, 0x13, 0x05, 0x6c, 0x14, 0x70, 0x51, 0xc0, 0x47, 0x01, 0x8c, 0x02, 0x01, 0x3b,
+  0x52, 0xcc, 0x51, 0x03, 0xe2, 0x75, 0x01, 0x8a, 0xaf, 0x42, 0xb3, 0x89, 0x30, 0x11, 0x9a, 0xa3,
+  0xe4, 0x64, 0x78, 0xe8, 0x30, 0x0a, 0x52, 0x7b, 0x3c, 0xa0, 0xb3, 0x0a, 0xe9, 0xfe, 0x45, 0xd1,
+  0xe1, 0x30, 0x4e, 0x71, 0x86, 0xcc, 0x29, 0x02, 0x46, 0xcd, 0xff, 0x80, 0x1e, 0xa7, 0xe8, 0xf5,
+  0xc5, 0x35, 0xb5, 0x93, 0x8e, 0x10, 0x9a, 0x30, 0x56, 0x3e, 0x9f, 0x09, 0xf2, 0xe9, 0x74, 0x8f,
+  0xc2, 0x39, 0x89, 0x70, 0xfb, 0x4c, 0x14, 0x29, 0x32, 0x9d, 0xce, 0x30, 0x28, 0xdc, 0x96, 0xfb,
+  0x17, 0x45, 0x39, 0x5d, 0x63, 0xc0, 0x0f, 0x28, 0x9e, 0xfd, 0x3f, 0x00, 0xfc, 0xc4, 0xe1, 0x27,
+  0x16, 0x3f, 0x85, 0xcf, 0x34, 0x37, 0xc7, 0xae, 0x1f, 0xd8, 0xef, 0x52, 0x78, 0x04, 0xc8, 0x90,
+  0x01, 0x1f, 0x01, 0x3a, 0x4d, 0x85, 0x78, 0xe4, 0xdd, 0x4e, 0x9e, 0xa9, 0x8a, 0x98, 0x3d, 0xf7,
+  0x88, 0x13, 0xcc, 0xb1, 0x8f, 0xd8, 0xdf, 0x92, 0x79, 0x04, 0xc8, 0x21, 0x27, 0x64, 0x92, 0xa8,
+  0x2e, 0x15, 0x50, 0xf7, 0x74, 0xde, 0x45, 0x14, 0xc7, 0x37, 0x82, 0xeb, 0x8b, 0x9f, 0x6c, 0x4f,
+  0x2d, 0x16, 0x3d, 0xda, 0xfe, 0x57, 0x1c, 0x7a, 0x4c, 0xe0, 0x47, 0x1f, 0xa5, 0x9d, 0xf8, 0x29,
+  0x89, 0x3f, 0x41, 0x54, 0x8a, 0xc6, 0x8f, 0x02, 0x7a, 0x4c, 0xe1, 0xc7, 0x29, 0x7a, 0x4c, 0xe3,
+  0xc7, 0xf9, 0x59, 0x27, 0x14, 0x47, 0x17, 0x3b, 0x85, 0x86, 0x6f, 0x1e, 0x13, 0x5f, 0xae, 0xa5,
+  0xee, 0x73, 0x9e, 0xec, 0x77, 0x1c, 0x1b, 0x82, 0xff, 0x8e, 0x73, 0x2e, 0xd7, 0x15, 0x52, 0xb3,
+  0x1c, 0xb6, 0x0d, 0xcc, 0x55, 0xa2, 0x40, 0x44, 0x94, 0xf2, 0xe8, 0x1f, 0x91, 0x0f, 0x35, 0x73,
+  0xb5, 0x16, 0xe2, 0xce, 0x00, 0x28, 0x4f, 0x37, 0xee, 0x01, 0x03, 0xf0, 0x19, 0x98, 0xb7, 0xad,
+  0xeb, 0xb6, 0xa1, 0x7d, 0x77, 0x6e, 0x70, 0x72, 0xd9, 0xe0, 0xcc, 0x0e, 0x9c, 0x85, 0xd4, 0x56,
+  0x6e, 0x70, 0x38, 0xb7, 0xf5, 0x4f, 0xc5, 0x5a, 0x05, 0x25, 0xa9, 0xc3, 0x61, 0x9f, 0x42, 0x24,
+  0x15, 0xb6, 0x8d, 0xfb, 0x51, 0xa4, 0xde, 0x10, 0xe1, 0xda, 0x31, 0xbb, 0xdf, 0xdd, 0xdf, 0x61,
+  0x8b, 0xfa, 0x1e, 0x9a, 0x21, 0x6d, 0x7d, 0xfc, 0xb3, 0x71, 0x17, 0xaa, 0x0c, 0x32, 0xad, 0x04,
+  0xcb, 0x25, 0x22, 0x76, 0xa7, 0x71, 0x29, 0x60, 0x8e, 0x44, 0x19, 0x74, 0xac, 0x61, 0xf0, 0x24,
+  0xa1, 0x20, 0x81, 0x14, 0xba, 0xc7, 0xc4, 0xe2, 0x1d, 0x84, 0x8d, 0x99, 0x6a, 0xcf, 0xc4, 0xfe,
+  0xde, 0x64, 0x2a, 0x1c, 0xd3, 0x18, 0x1e, 0xab, 0x7a, 0x42, 0x54, 0x14, 0xdc, 0x11, 0x77, 0x61,
+  0x7f, 0xbc, 0x8a, 0x70, 0x1d, 0x9b, 0xa9, 0x92, 0x12, 0xba, 0xbb, 0x43, 0x8b, 0x0a, 0x0d, 0x23,
+  0x02, 0xdc, 0x1b, 0xf6, 0xc5, 0x13, 0x98, 0x88, 0x62, 0xdf, 0x33, 0xce, 0xd0, 0xdc, 0x9e, 0x22,
+  0xb2, 0x8e, 0xb3, 0xb8, 0x63, 0xe4, 0x63, 0xdf, 0x6f, 0x53, 0x44, 0xf4, 0x63, 0x40, 0x05, 0x1f,
+  0x4e, 0x25, 0xd3, 0x73, 0xee, 0xf7, 0x68, 0x7e, 0x90, 0xaf, 0x5f, 0x5d, 0x51, 0x57, 0x8a, 0xed,
+  0x32, 0x21, 0x32, 0x86, 0xe8, 0x45, 0x97, 0xbf, 0xaa, 0xc4, 0x46, 0xe2, 0x1c, 0x55, 0x3d, 0xd1,
+  0x91, 0xe0, 0x4e, 0xc6, 0xd1, 0x18, 0x11, 0x3c, 0xa4, 0x2a, 0x59, 0x40, 0x53, 0x54, 0xf9, 0x07,
+  0x70, 0x57, 0x2d, 0xe5, 0x8a, 0x77, 0xd1, 0x2b, 0x55, 0x27, 0x38, 0x05, 0x1e, 0x6e, 0x22, 0xa6,
+  0xce, 0xc3, 0x01, 0x47, 0x56, 0xaf, 0x9b, 0xe8, 0x8d, 0x1d, 0xea, 0xb4, 0x7b, 0x7d, 0xff, 0xd6,
+  0x9d, 0xe6, 0x30, 0xc4, 0x98, 0xea, 0x5d, 0xe6, 0x17, 0x35, 0x34, 0x47, 0xbd, 0xc5, 0x93, 0x38,
+  0xc0, 0xd9, 0xb7, 0x91, 0xd7, 0x88, 0x65, 0x58, 0x8c, 0x1c, 0xc0, 0x36, 0x7c, 0x08, 0xc0, 0x33,
+  0x67, 0x76, 0x16, 0xef, 0xbe, 0xba, 0x53, 0xd7, 0xf9, 0x66, 0x0e, 0xf4, 0x64, 0xce, 0xf6, 0x55,
+  0xb4, 0xc9, 0x50, 0x37, 0x43, 0x77, 0x2d, 0x75, 0x47, 0x55, 0xaa, 0x03, 0xfa, 0xb7, 0x77, 0x81,
+  0xe8, 0x78, 0xbc, 0xcd, 0x55, 0x62, 0xa7, 0x8f, 0xc8, 0x33, 0xfa, 0x79, 0xf7, 0xd0, 0x7d, 0x31,
+  0x7f, 0xbf, 0x4c, 0xb7, 0x1e, 0xe4, 0x1a, 0x40, 0xa8, 0x9c, 0x3f, 0xa4, 0x7d, 0x0a, 0xf4, 0x73,
+  0x60, 0x5c, 0x79, 0xd2, 0xcf, 0x88, 0xcf, 0xae, 0x5e, 0x9f, 0x66, 0x42, 0xc7, 0xe2, 0x9c, 0x47,
+  0x03, 0xb3, 0x07, 0x7b, 0x3e, 0xf9, 0xba, 0x9f, 0x63, 0x83, 0xa4, 0x48, 0x06, 0x12, 0xd4, 0x6d,
+  0x52, 0x08, 0x2d, 0xa0, 0x61, 0x30, 0xd3, 0x20, 0xb7, 0x8e, 0x33, 0x5a, 0x23, 0xa7, 0xe2, 0x75,
+  0xcb, 0xe7, 0x9c, 0x5a, 0xf8, 0x26, 0x5d, 0x95, 0x0d, 0x16, 0xa9, 0xf2, 0xfe, 0xf9, 0x0f, 0xd8,
+  0x33, 0x4e, 0x86, 0x26, 0xfc, 0xed, 0x1d, 0x52, 0xa5, 0x21, 0xe5, 0x5e, 0xcf, 0x44, 0xd3, 0xea,
+  0x52, 0xcf, 0xf9, 0x64, 0x83, 0x3c, 0xe8, 0x7d, 0x43, 0x01, 0xa3, 0xbe, 0x38, 0x25, 0x3e, 0xc9,
+  0xe9, 0x8f, 0x97, 0x82, 0xab, 0x9b, 0xff, 0x01, 0xd8, 0xe9, 0xe4, 0xed, 0x29, 0x83, 0x3c, 0x30,
+  0x2c, 0x0e, 0xa5, 0x7e, 0x47, 0x49, 0xa3, 0x37, 0xbf, 0xbd, 0xbb, 0x28, 0x9b, 0x3d, 0xf8, 0x01,
+  0x89, 0x3a, 0xa9, 0x94, 0xec, 0x1e, 0x21, 0xd7, 0x3f, 0xef, 0xc0, 0x03, 0x24, 0x61, 0x5f, 0xc2,
+  0x09, 0xe0, 0x83, 0x5f, 0xa2, 0x80, 0xa4, 0x09, 0xe2, 0x06, 0xdf, 0x19, 0x67, 0x7f, 0x51, 0x00,
+  0x0b, 0x05, 0x55, 0x87, 0x51, 0xa4, 0x45, 0xb6, 0x7b, 0xe6, 0xd8, 0x16, 0x64, 0x89, 0xd5, 0x19,
+  0x7d, 0x83, 0xef, 0xdb, 0x9a, 0x3a, 0xa3, 0x18, 0xc8, 0xb5, 0xd5, 0x4e, 0x99, 0x7d, 0xc2, 0x78,
+  0x6c, 0xca, 0xf1, 0x6c, 0x2b, 0x87, 0x0d, 0xd9, 0xcb, 0x96, 0xc2, 0xe1, 0x4b, 0xf4, 0x7b, 0xac,
+  0x37, 0xbd, 0x23, 0x09, 0xc2, 0x4f, 0x51, 0xea, 0xf0, 0x7b, 0xbc, 0x4c, 0x42, 0x98, 0xcc, 0x72,
+  0xce, 0xce, 0xa8, 0x2a, 0x87, 0xed, 0xf2, 0x3b, 0xf0, 0xb5, 0x73, 0xbb, 0xe1, 0x5a, 0xdc, 0x79,
+  0xfc, 0x8e, 0x9a, 0x8d, 0xaa, 0x69, 0x6a, 0x5d, 0xf8, 0x66, 0x41, 0xc3, 0xf4, 0x53, 0xf1, 0x9f,
+  0xa6, 0x42, 0x15, 0xf5, 0x98, 0x3d, 0xcf, 0x31, 0x86, 0xe7, 0x4b, 0x4b, 0xa8, 0x98, 0x0d, 0xc9,
+  0x30, 0x91, 0xc7, 0xe6, 0x81, 0xaf, 0xdd, 0x45, 0x41, 0x08, 0x9e, 0xa1, 0x7f, 0x34, 0x03, 0xbb,
+  0x5c, 0x6e, 0x68, 0x9d, 0x59, 0x26, 0xa2, 0x96, 0xcb, 0x37, 0x4d, 0x70, 0x96, 0x2c, 0xbc, 0x54,
+  0xb1, 0x76, 0x02, 0xdb, 0x91, 0x42, 0x08, 0x92, 0x4d, 0xfc, 0x71, 0x00, 0x63, 0xa6, 0x6a, 0x32,
+  0x32, 0xba, 0xae, 0x41, 0x12, 0xc4, 0x39, 0x5b, 0x5d, 0xf0, 0xdc, 0xed, 0x1a, 0x09, 0xd0, 0x75,
+  0x5f, 0xc1, 0x47, 0xae, 0x80, 0xe0, 0x63, 0xfe, 0xbb, 0x16, 0xfb, 0xa7, 0x68, 0x47, 0xc3, 0xbf,
+  0x8b, 0xee, 0x98, 0xee, 0x05, 0xbc, 0x23, 0x10, 0x3b, 0x43, 0x0f, 0x4a, 0x8e, 0x4c, 0x10, 0xe7,
+  0xf0, 0x7e, 0x4a, 0xb0, 0x03, 0x87, 0x4b, 0xfc, 0xf6, 0xee, 0x6b, 0x8d, 0xaa, 0xc8, 0xda, 0xb7,
+  0xc2, 0xf4, 0x87, 0x63, 0x6a, 0x87, 0xee, 0x1c, 0x89, 0x43, 0x60, 0x24, 0x19, 0xf2, 0x77, 0xe1,
+  0x5f, 0x01, 0x63, 0x58, 0x1c, 0x42, 0x54, 0x7a, 0x06, 0x59, 0x27, 0xdd, 0x6c, 0x41, 0x73, 0xa5,
+  0xea, 0x73, 0xfb, 0x32, 0x96, 0x5f, 0x37, 0xaf, 0xea, 0x10, 0xca, 0x6d, 0xc6, 0xac, 0x00, 0xab,
+  0xf2, 0x9b, 0x07, 0x97, 0x84, 0xbc, 0xd2, 0x25, 0xe4, 0x25, 0x2c, 0xe1, 0xa4, 0x51, 0x82, 0xcc,
+  0x18, 0xe2, 0x5e, 0x48, 0x5e, 0x58, 0xb2, 0x29, 0x69, 0xc8, 0xc6, 0xab, 0x31, 0xba, 0xe1, 0xce,
+  0x1e, 0xed, 0x1e, 0xa4, 0xaa, 0x41, 0x25, 0x74, 0xd7, 0x19, 0xf4, 0xef, 0xa2, 0xc0, 0x11, 0x25,
+  0xfd, 0xfa, 0x88, 0xa7, 0x1f, 0x9a, 0xce, 0x92, 0xaf, 0x42, 0x86, 0x47, 0xf8, 0x70, 0x68, 0xf7,
+  0xbe, 0xbf, 0xd1, 0x20, 0xaa, 0xcf, 0x68, 0x9a, 0x2c, 0x71, 0x0c, 0x92, 0xe3, 0xe2, 0x2a, 0x67,
+  0x42, 0xf3, 0xde, 0x30, 0x75, 0xc8, 0x2c, 0x82, 0x21, 0x2a, 0xfc, 0x09, 0xd3, 0xbc, 0x80, 0x8c,
+  0xcb, 0xb2, 0xa9, 0x23, 0xf9, 0xfd, 0xe9, 0x7f, 0xff, 0x8f, 0xf6, 0x14, 0x3c, 0x60, 0x1b, 0x12,
+  0x2e, 0x1e, 0xdb, 0x89, 0x16, 0xc1, 0x1b, 0xfc, 0x2d, 0x9b, 0xeb, 0xb5, 0x3b, 0x97, 0x57, 0xfe,
+  0xfd, 0x10, 0x37, 0x38, 0x5d, 0xd2, 0xcc, 0x8f, 0xbf, 0xf9, 0x10, 0x47, 0x33, 0x8a, 0xfe, 0x15,
+  0xcd, 0x85, 0xfc, 0xf1, 0x37, 0xff, 0x1f, 0x68, 0xa9, 0x27, 0x84, 0x2d, 0x35, 0x01, 0x00,
+};
+
+#endif